@@ -60,6 +60,60 @@ void printValueStatistics(FILE *file, const char *valueStatsName, const char *co
 			pStats->count);
 }
 
+void cleanupValueSamples(ValueSamples *pSamples)
+{
+	free(pSamples->samples);
+	initValueSamples(pSamples);
+}
+
+RsslRet addValueSample(ValueSamples *pSamples, double newValue)
+{
+	if (pSamples->count == pSamples->_capacity)
+	{
+		RsslUInt64 newCapacity = pSamples->_capacity ? pSamples->_capacity * 2 : 1024;
+		double *newSamples = (double*)realloc(pSamples->samples, (size_t)newCapacity * sizeof(double));
+
+		if (!newSamples)
+			return RSSL_RET_FAILURE;
+
+		pSamples->samples = newSamples;
+		pSamples->_capacity = newCapacity;
+	}
+
+	pSamples->samples[pSamples->count++] = newValue;
+	pSamples->_sorted = RSSL_FALSE;
+	return RSSL_RET_SUCCESS;
+}
+
+static int compareSamples(const void *pLeft, const void *pRight)
+{
+	double left = *(const double*)pLeft, right = *(const double*)pRight;
+	return (left > right) - (left < right);
+}
+
+double getValueSamplesPercentile(ValueSamples *pSamples, double percent)
+{
+	RsslUInt64 rank;
+
+	if (!pSamples->count)
+		return 0;
+
+	if (!pSamples->_sorted)
+	{
+		qsort(pSamples->samples, (size_t)pSamples->count, sizeof(double), compareSamples);
+		pSamples->_sorted = RSSL_TRUE;
+	}
+
+	/* Nearest-rank method. The small adjustment keeps rounding error in percent(e.g. 99.9) from moving up a rank. */
+	rank = (RsslUInt64)ceil(percent * (double)pSamples->count / 100.0 - 1e-9);
+	if (rank < 1)
+		rank = 1;
+	else if (rank > pSamples->count)
+		rank = pSamples->count;
+
+	return pSamples->samples[rank - 1];
+}
+
 void timeRecordQueueInit(TimeRecordQueue *pRecordQueue)
 {
 	int i;
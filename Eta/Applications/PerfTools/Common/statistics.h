@@ -54,6 +54,30 @@ void updateValueStatistics(ValueStatistics *pStats, double newValue);
 void printValueStatistics(FILE *file, const char *valueStatsName, const char *countUnitName, 
 		ValueStatistics *pStats, RsslBool displayThousandths);
 
+/* Stores every sample of a value(such as latency) so that percentiles can be calculated.
+ * ValueStatistics only keeps running totals, which cannot show the tail of the distribution. */
+typedef struct {
+	double			*samples;			/* Recorded samples. */
+	RsslUInt64		count;				/* Total number of samples. */
+	RsslUInt64		_capacity;			/* Number of samples that fit in the samples array. */
+	RsslBool		_sorted;			/* Whether the samples array is currently sorted. */
+} ValueSamples;
+
+/* Clears a ValueSamples structure. */
+RTR_C_INLINE void initValueSamples(ValueSamples *pSamples)
+{
+	memset(pSamples, 0, sizeof(ValueSamples));
+}
+
+/* Frees the memory used by a ValueSamples structure. */
+void cleanupValueSamples(ValueSamples *pSamples);
+
+/* Records a new sample. */
+RsslRet addValueSample(ValueSamples *pSamples, double newValue);
+
+/* Returns the smallest sample that at least the given percent(0-100) of samples are less than or equal to. */
+double getValueSamplesPercentile(ValueSamples *pSamples, double percent);
+
 /*** Time Statistics. ***/
 
 /* This functionality is used to collect individual time differences
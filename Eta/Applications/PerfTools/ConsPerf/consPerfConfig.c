@@ -39,6 +39,7 @@ static void clearConsPerfConfig()
 	consPerfConfig.recvBufSize = 0;
 	consPerfConfig.highWaterMark = 0;
 	consPerfConfig.tcpNoDelay = RSSL_TRUE;
+	consPerfConfig.busyPollIdleTimeout = 0;
 	consPerfConfig.connectionType = RSSL_CONN_TYPE_SOCKET;
 	consPerfConfig.guaranteedOutputBuffers = 5000;
 	consPerfConfig.numInputBuffers = 15;
@@ -138,6 +139,11 @@ void initConsPerfConfig(int argc, char **argv)
 			++iargs;
 			consPerfConfig.tcpNoDelay = RSSL_FALSE;
 		}
+		else if(strcmp("-busyPoll", argv[iargs]) == 0)
+		{
+			++iargs; if (iargs == argc) exitMissingArgument(argv, iargs - 1);
+			consPerfConfig.busyPollIdleTimeout = atoi(argv[iargs++]);
+		}
 		else if(strcmp("-serviceName", argv[iargs]) == 0)
 		{
 			++iargs; if (iargs == argc) exitMissingArgument(argv, iargs - 1);
@@ -417,6 +423,7 @@ void printConsPerfConfig(FILE *file)
 		"         High Water Mark: %u%s\n"
 		"          Interface Name: %s\n"
 		"             Tcp_NoDelay: %s\n"
+		"               Busy Poll: %u%s\n"
 		"                Username: %s\n"
 		"              Item Count: %d\n"
 		"       Common Item Count: %d\n"
@@ -443,6 +450,7 @@ void printConsPerfConfig(FILE *file)
 		consPerfConfig.highWaterMark, (consPerfConfig.highWaterMark > 0 ?  " bytes" : "(use default)"),
 		strlen(consPerfConfig.interfaceName) ? consPerfConfig.interfaceName : "(use default)",
 		(consPerfConfig.tcpNoDelay ? "Yes" : "No"),
+		consPerfConfig.busyPollIdleTimeout, (consPerfConfig.busyPollIdleTimeout ? " ms idle timeout" : "(off)"),
 		strlen(consPerfConfig.username) ? consPerfConfig.username : "(use system login name)",
 		consPerfConfig.itemRequestCount,
 		consPerfConfig.commonItemCount,
@@ -479,6 +487,8 @@ void exitWithUsage()
 			"  -tcpDelay                            Turns off tcp_nodelay in RsslConnectOptions, enabling Nagle's\n"
 			"  -sendBufSize <size>                  System Send Buffer Size(configures sysSendBufSize in RsslConnectOptions)\n"
 			"  -recvBufSize <size>                  System Receive Buffer Size(configures sysRecvBufSize in RsslConnectOptions)\n"
+			"  -busyPoll <idle ms>                  Read the channel without waiting in select() until no data has been read\n"
+			"                                         for the given time(for comparing latency with and without busy-polling)\n"
 			"\n"
 			"  -tickRate <ticks per second>         Ticks per second\n"
 			"  -itemCount <count>                   Number of items to request\n"
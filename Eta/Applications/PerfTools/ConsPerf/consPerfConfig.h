@@ -52,6 +52,8 @@ typedef struct
 	RsslUInt32			recvBufSize;				/* System Send Buffer Size(-recvBufSize) */
 	RsslUInt32			highWaterMark;				/* sets the point which will cause UPA to automatically flush */
 	RsslBool			tcpNoDelay;					/* Enable/Disable Nagle's algorithm. See -tcpDelay */
+	RsslUInt32			busyPollIdleTimeout;		/* If nonzero, time(in milliseconds) to keep reading the channel without waiting in select()
+													 * after data was last read. See -busyPoll */
 	RsslBool			requestSnapshots;			/* Whether to request all items as snapshots. See -snapshot */
 
 	char				username[128];				/* Username used when logging in. */
@@ -765,6 +765,8 @@ RSSL_THREAD_DECLARE(runConsumerConnection, threadStruct)
 
 	RsslInt64 nsecPerTick;
 	TimeValue currentTime, nextTickTime;
+	TimeValue lastDataReadTime = 0;		/* Time a message was last read, for -busyPoll. */
+	RsslInt64 nsecBusyPollIdle = (RsslInt64)consPerfConfig.busyPollIdleTimeout * 1000000;
 
 	RsslInt32 postsPerTick, postsPerTickRemainder;
 	RsslInt32 genMsgsPerTick, genMsgsPerTickRemainder;
@@ -1203,9 +1205,21 @@ RSSL_THREAD_DECLARE(runConsumerConnection, threadStruct)
 		useWrt = pConsumerThread->wrtfds;
 
 		currentTime = getTimeNano();
-		time_interval.tv_usec = (long)((currentTime > nextTickTime) ? 0 : ((nextTickTime - currentTime)/1000));
 
-		selRet = select(FD_SETSIZE,&useRead,&useWrt,&useExcept,&time_interval);
+		if (nsecBusyPollIdle && currentTime < nextTickTime && (RsslInt64)(currentTime - lastDataReadTime) < nsecBusyPollIdle)
+		{
+			/* Busy-polling: a message was read recently, so read the channel again without waiting in select().
+			 * Flushing and the tick work are left to select(), which is called once the next tick is due. */
+			FD_ZERO(&useWrt);
+			FD_ZERO(&useExcept);
+			selRet = 1;
+		}
+		else
+		{
+			time_interval.tv_usec = (long)((currentTime > nextTickTime) ? 0 : ((nextTickTime - currentTime)/1000));
+
+			selRet = select(FD_SETSIZE,&useRead,&useWrt,&useExcept,&time_interval);
+		}
 
 		if (selRet > 0)
 		{
@@ -1215,6 +1229,7 @@ RSSL_THREAD_DECLARE(runConsumerConnection, threadStruct)
 					if ((msgBuf = rsslRead(pConsumerThread->pChannel,&readret,&pConsumerThread->threadRsslError)) != 0)
 					{	
 						pConsumerThread->receivedPing = RSSL_TRUE;
+						lastDataReadTime = currentTime;
 
 						/* clear decode iterator */
 						rsslClearDecodeIterator(&dIter);
@@ -1920,6 +1935,7 @@ void consumerThreadCleanup(ConsumerThread *pConsumerThread)
 	timeRecordQueueCleanup(&pConsumerThread->latencyRecords);
 	timeRecordQueueCleanup(&pConsumerThread->postLatencyRecords);
 	timeRecordQueueCleanup(&pConsumerThread->genMsgLatencyRecords);
+	cleanupValueSamples(&pConsumerThread->stats.steadyStateLatencySamples);
 	if (pConsumerThread->statsFile)
 		fclose(pConsumerThread->statsFile);
 	if (pConsumerThread->latencyLogFile)
@@ -97,6 +97,7 @@ typedef struct {
 
 	ValueStatistics startupLatencyStats;		/* Statup latency statistics. */
 	ValueStatistics steadyStateLatencyStats;	/* Steady-state latency statistics. */
+	ValueSamples	steadyStateLatencySamples;	/* Steady-state latencies, for percentiles. */
 	ValueStatistics overallLatencyStats;		/* Overall latency statistics. */
 	ValueStatistics postLatencyStats;			/* Posting latency statistics. */
 	ValueStatistics genMsgLatencyStats;			/* Gen Msg latency statistics. */
@@ -126,6 +127,7 @@ RTR_C_INLINE void consumerStatsInit(ConsumerStats *stats)
 	clearValueStatistics(&stats->intervalGenMsgLatencyStats);
 	clearValueStatistics(&stats->startupLatencyStats);
 	clearValueStatistics(&stats->steadyStateLatencyStats);
+	initValueSamples(&stats->steadyStateLatencySamples);
 	clearValueStatistics(&stats->overallLatencyStats);
 	clearValueStatistics(&stats->postLatencyStats);
 	clearValueStatistics(&stats->genMsgLatencyStats);
@@ -308,6 +308,8 @@ void collectStats(RsslBool writeStats, RsslBool displayStats, RsslUInt32 current
 					&consumerThreads[i].stats.steadyStateLatencyStats
 					: &consumerThreads[i].stats.startupLatencyStats,
 					latency);
+			if (latencyIsSteadyStateForClient)
+				addValueSample(&consumerThreads[i].stats.steadyStateLatencySamples, latency);
 
 			if (consPerfConfig.threadCount > 1)
 			{
@@ -320,6 +322,8 @@ void collectStats(RsslBool writeStats, RsslBool displayStats, RsslUInt32 current
 						&totalStats.steadyStateLatencyStats
 						: &totalStats.startupLatencyStats,
 						latency);
+				if (latencyIsSteadyStateOverall)
+					addValueSample(&totalStats.steadyStateLatencySamples, latency);
 				updateValueStatistics(&totalStats.overallLatencyStats, latency);
 			}
 
@@ -601,6 +605,10 @@ void consumerCleanupThreads()
 		consumerThreadCleanup(&consumerThreads[i]);
 	}
 
+	/* With one consumer thread, totalStats is a copy of its statistics and the samples were freed with the thread. */
+	if (consPerfConfig.threadCount > 1)
+		cleanupValueSamples(&totalStats.steadyStateLatencySamples);
+
 }
 
 
@@ -683,6 +691,13 @@ void printSummaryStatistics(FILE *file)
 							sqrt(consumerThreads[i].stats.steadyStateLatencyStats.variance),
 							consumerThreads[i].stats.steadyStateLatencyStats.maxValue,
 							consumerThreads[i].stats.steadyStateLatencyStats.minValue);
+					fprintf( file,
+							"  Latency 50th percentile (usec): %.1f\n"
+							"  Latency 99th percentile (usec): %.1f\n"
+							"  Latency 99.9th percentile (usec): %.1f\n",
+							getValueSamplesPercentile(&consumerThreads[i].stats.steadyStateLatencySamples, 50.0),
+							getValueSamplesPercentile(&consumerThreads[i].stats.steadyStateLatencySamples, 99.0),
+							getValueSamplesPercentile(&consumerThreads[i].stats.steadyStateLatencySamples, 99.9));
 				}
 				else
 					fprintf( file, "  No latency information was received during steady-state time.\n");
@@ -876,6 +891,13 @@ void printSummaryStatistics(FILE *file)
 					sqrt(totalStats.steadyStateLatencyStats.variance),
 					totalStats.steadyStateLatencyStats.maxValue,
 					totalStats.steadyStateLatencyStats.minValue);
+			fprintf( file,
+					"  Latency 50th percentile (usec): %.1f\n"
+					"  Latency 99th percentile (usec): %.1f\n"
+					"  Latency 99.9th percentile (usec): %.1f\n",
+					getValueSamplesPercentile(&totalStats.steadyStateLatencySamples, 50.0),
+					getValueSamplesPercentile(&totalStats.steadyStateLatencySamples, 99.0),
+					getValueSamplesPercentile(&totalStats.steadyStateLatencySamples, 99.9));
 		}
 		else
 			fprintf( file, "  No latency information was received during steady-state time.\n");
@@ -0,0 +1,383 @@
+/*
+ * This source code is provided under the Apache 2.0 license and is provided
+ * AS IS with no warranty or guarantee of fit for purpose.  See the project's
+ * LICENSE.md for details.
+ * Copyright Thomson Reuters 2015. All rights reserved.
+*/
+
+/* hashPerf.c
+ * Measures how the RsslHashTable hash functions spread keys across buckets, and what it costs to find keys
+ * with them. Keys are generated RIC names and integer stream IDs. The hash functions that were used before
+ * rsslHashBytes() and rsslHashMixU32() are included so that the two can be compared. */
+
+#include "rtr/rsslHashTable.h"
+#include "getTime.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+typedef struct
+{
+	RsslUInt32	ricCount;		/* Number of RIC names (and integer keys) to generate. */
+	RsslUInt32	bucketCount;	/* Number of buckets in the chained tables. */
+	RsslUInt32	lookupPasses;	/* Number of times every key is looked up when measuring lookup cost. */
+	RsslUInt32	idStride;		/* Difference between consecutive integer keys. */
+} HashPerfConfig;
+
+static HashPerfConfig hashPerfConfig;
+
+typedef struct
+{
+	RsslHashLink	hashLink;
+	RsslBuffer		name;
+} RicEntry;
+
+typedef struct
+{
+	RsslHashLink	hashLink;
+	RsslUInt32		id;
+} IdEntry;
+
+/* Results for one set of keys and one hash function. */
+typedef struct
+{
+	RsslUInt32	emptyBuckets;
+	RsslUInt32	longestChain;
+	double		averageProbes;		/* Average number of keys compared to find a key in the chained table. */
+	double		hashNsPerKey;
+	double		chainedNsPerFind;
+	double		openAddressingNsPerFind;
+	RsslUInt32	maxProbeLength;		/* Longest probe in the open-addressing table. */
+} HashResults;
+
+/* Buffer hash used by rsslHashBufferSum() before rsslHashBytes(). */
+static RsslUInt32 previousHashBufferSum(void *pKey)
+{
+	RsslUInt32 i;
+	RsslUInt32 hashSum = 0;
+	RsslBuffer *pBuffer = (RsslBuffer*)pKey;
+
+	for(i = 0; i < pBuffer->length; ++i)
+	{
+		hashSum = (hashSum << 4) + (RsslUInt32)pBuffer->data[i];
+		hashSum ^= (hashSum >> 12);
+	}
+
+	return hashSum;
+}
+
+/* Integer hash used by rsslHashU32Sum() before rsslHashMixU32(). */
+static RsslUInt32 previousHashU32Sum(void *pKey)
+{ return *((RsslUInt32*)pKey); }
+
+static void exitWithUsage()
+{
+	printf(	"Options:\n"
+			"  -?                         Shows this usage\n"
+			"\n"
+			"  -ricCount <count>          Number of RIC names and integer keys to generate(default 500000).\n"
+			"  -buckets <count>           Number of buckets in the chained hash tables(default 100003).\n"
+			"  -lookupPasses <count>      Number of times each key is found when measuring lookup cost(default 5).\n"
+			"  -idStride <stride>         Difference between consecutive integer keys(default 1024).\n"
+			"\n");
+	exit(-1);
+}
+
+static void exitMissingArgument(char **argv, int arg)
+{
+	printf("Config error: %s missing argument.\n"
+			"Run '%s -?' to see usage.\n\n", argv[arg], argv[0]);
+	exit(-1);
+}
+
+static void initHashPerfConfig(int argc, char **argv)
+{
+	int iargs;
+
+	hashPerfConfig.ricCount = 500000;
+	hashPerfConfig.bucketCount = 100003;
+	hashPerfConfig.lookupPasses = 5;
+	hashPerfConfig.idStride = 1024;
+
+	for(iargs = 1; iargs < argc; ++iargs)
+	{
+		if (0 == strcmp("-?", argv[iargs]))
+		{
+			exitWithUsage();
+		}
+		else if (0 == strcmp("-ricCount", argv[iargs]))
+		{
+			++iargs; if (iargs == argc) exitMissingArgument(argv, iargs - 1);
+			sscanf(argv[iargs], "%u", &hashPerfConfig.ricCount);
+		}
+		else if (0 == strcmp("-buckets", argv[iargs]))
+		{
+			++iargs; if (iargs == argc) exitMissingArgument(argv, iargs - 1);
+			sscanf(argv[iargs], "%u", &hashPerfConfig.bucketCount);
+		}
+		else if (0 == strcmp("-lookupPasses", argv[iargs]))
+		{
+			++iargs; if (iargs == argc) exitMissingArgument(argv, iargs - 1);
+			sscanf(argv[iargs], "%u", &hashPerfConfig.lookupPasses);
+		}
+		else if (0 == strcmp("-idStride", argv[iargs]))
+		{
+			++iargs; if (iargs == argc) exitMissingArgument(argv, iargs - 1);
+			sscanf(argv[iargs], "%u", &hashPerfConfig.idStride);
+		}
+		else
+		{
+			printf("Config Error: Unrecognized option: %s\n", argv[iargs]);
+			exitWithUsage();
+		}
+	}
+
+	if (hashPerfConfig.ricCount == 0 || hashPerfConfig.bucketCount == 0 || hashPerfConfig.lookupPasses == 0
+			|| hashPerfConfig.idStride == 0)
+	{
+		printf("Config Error: counts must be greater than zero.\n");
+		exitWithUsage();
+	}
+}
+
+/* Writes a number as upper-case letters(A, B, ... Z, AA, AB, ...). */
+static int writeLetters(char *pOut, RsslUInt32 number)
+{
+	char letters[8];
+	int length = 0, i;
+
+	do
+	{
+		letters[length++] = (char)('A' + number % 26);
+		number /= 26;
+	} while (number-- > 0);
+
+	for (i = 0; i < length; ++i)
+		pOut[i] = letters[length - 1 - i];
+
+	return length;
+}
+
+/* Generates a RIC name. Names follow a few common forms, so that they share prefixes and suffixes the way
+ * real symbol lists do, and are unique by construction. */
+static int writeRicName(char *pOut, RsslUInt32 index)
+{
+	static const char *exchanges[] = { "O", "N", "L", "TO", "PA", "DE", "T", "HK", "AX" };
+	static const char monthCodes[] = "FGHJKMNQUVXZ";
+	RsslUInt32 number = index / 4;
+	int length;
+
+	switch (index % 4)
+	{
+		case 0: /* Equity, e.g. VOD.L */
+			length = writeLetters(pOut, number / 9);
+			length += sprintf(pOut + length, ".%s", exchanges[number % 9]);
+			return length;
+
+		case 1: /* Numeric code, e.g. 7203.T */
+			return sprintf(pOut, "%u.T", 1000 + number);
+
+		case 2: /* Future, e.g. ESZ6 */
+			length = writeLetters(pOut, number / 60);
+			length += sprintf(pOut + length, "%c%u", monthCodes[number % 12], (number % 60) / 12 + 5);
+			return length;
+
+		default: /* Option, e.g. IBM1200C.U */
+			length = writeLetters(pOut, number / 2000);
+			length += sprintf(pOut + length, "%u%c.U", 100 + (number % 1000) * 5, (number % 2000) < 1000 ? 'C' : 'P');
+			return length;
+	}
+}
+
+/* Counts how the keys are spread across bucketCount buckets. */
+static void measureDistribution(RsslHashSumFunction *hashFunction, void **keys, RsslUInt32 keyCount, HashResults *pResults)
+{
+	RsslUInt32 *chainLengths = (RsslUInt32*)calloc(hashPerfConfig.bucketCount, sizeof(RsslUInt32));
+	RsslUInt64 probes = 0;
+	RsslUInt32 i;
+
+	if (!chainLengths)
+	{
+		printf("Memory allocation failure.\n");
+		exit(-1);
+	}
+
+	for (i = 0; i < keyCount; ++i)
+		++chainLengths[hashFunction(keys[i]) % hashPerfConfig.bucketCount];
+
+	pResults->emptyBuckets = 0;
+	pResults->longestChain = 0;
+	for (i = 0; i < hashPerfConfig.bucketCount; ++i)
+	{
+		if (chainLengths[i] == 0)
+			++pResults->emptyBuckets;
+		if (chainLengths[i] > pResults->longestChain)
+			pResults->longestChain = chainLengths[i];
+
+		/* Finding each key in a chain compares it with the keys before it. */
+		probes += (RsslUInt64)chainLengths[i] * (chainLengths[i] + 1) / 2;
+	}
+
+	pResults->averageProbes = (double)probes / keyCount;
+	free(chainLengths);
+}
+
+static void measureHashCost(RsslHashSumFunction *hashFunction, void **keys, RsslUInt32 keyCount, HashResults *pResults)
+{
+	volatile RsslUInt32 sumTotal = 0;
+	TimeValue startTime;
+	RsslUInt32 i, pass;
+
+	startTime = getTimeNano();
+	for (pass = 0; pass < hashPerfConfig.lookupPasses; ++pass)
+		for (i = 0; i < keyCount; ++i)
+			sumTotal += hashFunction(keys[i]);
+
+	pResults->hashNsPerKey = (double)(getTimeNano() - startTime) / ((double)keyCount * hashPerfConfig.lookupPasses);
+}
+
+/* Adds every key to the table, then finds every key lookupPasses times. Returns nanoseconds per find. */
+static double measureFindCost(RsslHashTable *pTable, RsslHashLink **links, void **keys, RsslUInt32 keyCount)
+{
+	TimeValue startTime;
+	RsslUInt32 i, pass, found = 0;
+
+	for (i = 0; i < keyCount; ++i)
+		rsslHashTableInsertLink(pTable, links[i], keys[i], NULL);
+
+	startTime = getTimeNano();
+	for (pass = 0; pass < hashPerfConfig.lookupPasses; ++pass)
+		for (i = 0; i < keyCount; ++i)
+			if (rsslHashTableFind(pTable, keys[i], NULL) == links[i])
+				++found;
+
+	if (found != keyCount * hashPerfConfig.lookupPasses)
+	{
+		printf("Error: only %u of %u keys were found.\n", found, keyCount * hashPerfConfig.lookupPasses);
+		exit(-1);
+	}
+
+	return (double)(getTimeNano() - startTime) / ((double)keyCount * hashPerfConfig.lookupPasses);
+}
+
+static void measureHashFunction(RsslHashSumFunction *hashFunction, RsslHashCompareFunction *compareFunction,
+		RsslHashLink **links, void **keys, RsslUInt32 keyCount, HashResults *pResults)
+{
+	RsslHashTable table;
+	RsslErrorInfo errorInfo;
+
+	measureDistribution(hashFunction, keys, keyCount, pResults);
+	measureHashCost(hashFunction, keys, keyCount, pResults);
+
+	if (rsslHashTableInit(&table, hashPerfConfig.bucketCount, hashFunction, compareFunction, RSSL_FALSE, &errorInfo) != RSSL_RET_SUCCESS)
+	{
+		printf("rsslHashTableInit() failed: %s\n", errorInfo.rsslError.text);
+		exit(-1);
+	}
+	pResults->chainedNsPerFind = measureFindCost(&table, links, keys, keyCount);
+	rsslHashTableCleanup(&table);
+
+	if (rsslHashTableInitOpenAddressing(&table, keyCount, hashFunction, compareFunction, RSSL_FALSE, &errorInfo) != RSSL_RET_SUCCESS)
+	{
+		printf("rsslHashTableInitOpenAddressing() failed: %s\n", errorInfo.rsslError.text);
+		exit(-1);
+	}
+	pResults->openAddressingNsPerFind = measureFindCost(&table, links, keys, keyCount);
+	pResults->maxProbeLength = table.maxProbeLength;
+	rsslHashTableCleanup(&table);
+}
+
+static void printResults(const char *name, HashResults *pResults)
+{
+	printf("  %-26s %10u %8u %11.3f %12.1f %12.1f %12.1f %10u\n", name,
+			pResults->emptyBuckets, pResults->longestChain, pResults->averageProbes,
+			pResults->hashNsPerKey, pResults->chainedNsPerFind, pResults->openAddressingNsPerFind,
+			pResults->maxProbeLength);
+}
+
+static void printHeader(RsslUInt32 keyCount)
+{
+	double load = (double)keyCount / hashPerfConfig.bucketCount;
+
+	printf("  %-26s %10s %8s %11s %12s %12s %12s %10s\n", "Hash function", "Empty", "Longest", "Avg probes",
+			"Hash ns/key", "Chained ns", "OpenAddr ns", "Max probe");
+
+	/* What a uniformly random hash would give. */
+	printf("  %-26s %10.0f %8s %11.3f\n", "(uniform)", hashPerfConfig.bucketCount * exp(-load), "", 1.0 + load / 2.0);
+}
+
+int main(int argc, char **argv)
+{
+	RsslUInt32 keyCount, i;
+	RicEntry *ricEntries;
+	IdEntry *idEntries;
+	RsslHashLink **links;
+	void **keys;
+	char *names, *pName;
+	HashResults results;
+
+	initHashPerfConfig(argc, argv);
+	keyCount = hashPerfConfig.ricCount;
+
+	ricEntries = (RicEntry*)malloc(keyCount * sizeof(RicEntry));
+	idEntries = (IdEntry*)malloc(keyCount * sizeof(IdEntry));
+	links = (RsslHashLink**)malloc(keyCount * sizeof(RsslHashLink*));
+	keys = (void**)malloc(keyCount * sizeof(void*));
+	names = (char*)malloc((size_t)keyCount * 32);
+
+	if (!ricEntries || !idEntries || !links || !keys || !names)
+	{
+		printf("Memory allocation failure.\n");
+		exit(-1);
+	}
+
+	printf("HashPerf: %u keys, %u chained buckets, %u lookup passes.\n"
+			"Empty, Longest and Avg probes are for the chained table. Max probe is for the open-addressing table.\n\n",
+			keyCount, hashPerfConfig.bucketCount, hashPerfConfig.lookupPasses);
+
+	/* RIC names */
+	pName = names;
+	for (i = 0; i < keyCount; ++i)
+	{
+		rsslHashLinkInit(&ricEntries[i].hashLink);
+		ricEntries[i].name.data = pName;
+		ricEntries[i].name.length = (RsslUInt32)writeRicName(pName, i);
+		pName += ricEntries[i].name.length;
+		links[i] = &ricEntries[i].hashLink;
+		keys[i] = &ricEntries[i].name;
+	}
+
+	printf("RIC names (%.*s ... %.*s)\n", ricEntries[0].name.length, ricEntries[0].name.data,
+			ricEntries[keyCount - 1].name.length, ricEntries[keyCount - 1].name.data);
+	printHeader(keyCount);
+
+	measureHashFunction(previousHashBufferSum, rsslHashBufferCompare, links, keys, keyCount, &results);
+	printResults("previous rsslHashBufferSum", &results);
+	measureHashFunction(rsslHashBufferSum, rsslHashBufferCompare, links, keys, keyCount, &results);
+	printResults("rsslHashBufferSum", &results);
+
+	/* Integer keys */
+	for (i = 0; i < keyCount; ++i)
+	{
+		rsslHashLinkInit(&idEntries[i].hashLink);
+		idEntries[i].id = (i + 1) * hashPerfConfig.idStride;
+		links[i] = &idEntries[i].hashLink;
+		keys[i] = &idEntries[i].id;
+	}
+
+	printf("\nInteger keys (%u apart)\n", hashPerfConfig.idStride);
+	printHeader(keyCount);
+
+	measureHashFunction(previousHashU32Sum, rsslHashU32Compare, links, keys, keyCount, &results);
+	printResults("previous rsslHashU32Sum", &results);
+	measureHashFunction(rsslHashU32Sum, rsslHashU32Compare, links, keys, keyCount, &results);
+	printResults("rsslHashU32Sum", &results);
+
+	free(names);
+	free(keys);
+	free(links);
+	free(idEntries);
+	free(ricEntries);
+	return 0;
+}
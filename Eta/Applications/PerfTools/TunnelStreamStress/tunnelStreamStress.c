@@ -0,0 +1,1113 @@
+/*
+ * This source code is provided under the Apache 2.0 license and is provided
+ * AS IS with no warranty or guarantee of fit for purpose.  See the project's
+ * LICENSE.md for details.
+ * Copyright Thomson Reuters 2015. All rights reserved.
+*/
+
+/* tunnelStreamStress.c
+ * Runs a provider reactor and a consumer reactor in one process, connected through a proxy that drops tunnel
+ * stream data messages on their way to the provider. Every drop makes the provider NAK the gap and the consumer
+ * retransmit from its wait-ack ring. The application checks that the provider receives every message exactly
+ * once and in order, that retained receive buffers keep their content, and that every buffer the consumer used
+ * is released once its messages are acknowledged. */
+
+#include "rtr/rsslReactor.h"
+#include "getTime.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+
+/* Domain type used for the tunnel stream, as in the VA examples. */
+static const RsslUInt8 TUNNEL_DOMAIN_TYPE = 199;
+
+/* Stream ID used by the consumer to open the tunnel stream. */
+static const RsslInt32 TUNNEL_STREAM_ID = 1000;
+
+/* ID of the provider's service. */
+static const RsslUInt16 TUNNEL_SERVICE_ID = 1;
+
+/* First byte of the extended header of tunnel stream data messages, and of retransmissions of them. */
+static const char TUNNEL_OPCODE_DATA = 1;
+static const char TUNNEL_OPCODE_RETRANS = 3;
+
+/* Length of the message counter at the start of each message. */
+#define PAYLOAD_HEADER_LENGTH 4
+
+/* Number of received buffers the provider holds with rsslTunnelStreamRetainBuffer() at a time. */
+#define RETAINED_BUFFER_COUNT 64
+
+/* Maximum number of messages forwarded in one direction, or submitted by the consumer, per pass. */
+static const RsslUInt32 MAX_MSGS_PER_PASS = 100;
+
+/* Number of output buffers given to the proxy's channels, so that it rarely has to wait for one. */
+static const RsslUInt32 PROXY_OUTPUT_BUFFERS = 5000;
+
+typedef struct
+{
+	RsslUInt32	msgCount;				/* Number of messages the consumer sends. */
+	RsslUInt32	msgSize;				/* Size of each message. */
+	RsslUInt32	dropInterval;			/* The proxy drops every dropInterval'th data message. */
+	RsslUInt32	retainInterval;			/* The provider retains every retainInterval'th message. */
+	RsslUInt32	guaranteedOutputBuffers;	/* Buffers available to the consumer's tunnel stream. */
+	RsslUInt32	timeout;				/* Seconds without progress before the test fails. */
+	char		providerPort[32];
+	char		proxyPort[32];
+} TunnelStreamStressConfig;
+
+static TunnelStreamStressConfig tunnelStreamStressConfig;
+
+/* A received buffer held by the provider, and the counter of the message it holds. */
+typedef struct
+{
+	RsslBuffer	*pBuffer;
+	RsslUInt32	counter;
+} RetainedBuffer;
+
+/* One side of the proxy. */
+typedef struct
+{
+	RsslChannel	*pChannel;
+	RsslBool	needFlush;
+} ProxyChannel;
+
+typedef struct
+{
+	RsslServer		*pServer;
+	ProxyChannel	consumerSide;		/* Accepted from the consumer. */
+	ProxyChannel	providerSide;		/* Connected to the provider. */
+	RsslUInt32		dataMsgCount;		/* Data messages seen from the consumer, including dropped ones. */
+	RsslUInt32		droppedCount;
+	RsslUInt32		retransmitCount;	/* Retransmissions seen from the consumer. */
+	RsslUInt32		highestDataSeqNum;
+	TimeValue		nextPingTime;
+} Proxy;
+
+typedef struct
+{
+	RsslReactor			*pProviderReactor;
+	RsslReactor			*pConsumerReactor;
+	RsslServer			*pProviderServer;
+	RsslReactorChannel	*pProviderChannel;
+	RsslReactorChannel	*pConsumerChannel;
+	RsslTunnelStream	*pProviderTunnel;
+	RsslTunnelStream	*pConsumerTunnel;
+	RsslBool			tunnelStreamOpened;
+	RsslUInt32			submittedCount;
+	RsslUInt32			receivedCount;
+	RsslUInt32			retainedCount;		/* Total number of buffers retained so far. */
+	RetainedBuffer		retainedBuffers[RETAINED_BUFFER_COUNT];
+	RsslBool			failed;
+	TimeValue			lastProgressTime;
+	char				lastBufferError[256];	/* Why the consumer last failed to get a buffer. */
+} TunnelStreamStress;
+
+static TunnelStreamStress stress;
+static Proxy proxy;
+
+static void exitWithUsage()
+{
+	printf(	"Options:\n"
+			"  -?                                 Shows this usage\n"
+			"\n"
+			"  -msgCount <count>                  Number of messages the consumer sends(default 200000).\n"
+			"  -msgSize <bytes>                   Size of each message(default 200, minimum 4).\n"
+			"  -dropInterval <count>              Drop every Nth tunnel stream data message on its way to the provider(default 20, 0 disables).\n"
+			"  -retainInterval <count>            Provider retains every Nth received message(default 10, 0 disables).\n"
+			"  -guaranteedOutputBuffers <count>   Guaranteed output buffers of the consumer's tunnel stream(default 50).\n"
+			"  -timeout <seconds>                 Fail if no message is received for this long(default 30).\n"
+			"  -providerPort <port>               Port the provider listens on(default 14031).\n"
+			"  -proxyPort <port>                  Port the proxy listens on(default 14032).\n"
+			"\n");
+	exit(-1);
+}
+
+static void exitMissingArgument(char **argv, int arg)
+{
+	printf("Config error: %s missing argument.\n"
+			"Run '%s -?' to see usage.\n\n", argv[arg], argv[0]);
+	exit(-1);
+}
+
+static void initTunnelStreamStressConfig(int argc, char **argv)
+{
+	int iargs;
+
+	tunnelStreamStressConfig.msgCount = 200000;
+	tunnelStreamStressConfig.msgSize = 200;
+	tunnelStreamStressConfig.dropInterval = 20;
+	tunnelStreamStressConfig.retainInterval = 10;
+	tunnelStreamStressConfig.guaranteedOutputBuffers = 50;
+	tunnelStreamStressConfig.timeout = 30;
+	snprintf(tunnelStreamStressConfig.providerPort, sizeof(tunnelStreamStressConfig.providerPort), "14031");
+	snprintf(tunnelStreamStressConfig.proxyPort, sizeof(tunnelStreamStressConfig.proxyPort), "14032");
+
+	for(iargs = 1; iargs < argc; ++iargs)
+	{
+		if (0 == strcmp("-?", argv[iargs]))
+		{
+			exitWithUsage();
+		}
+		else if (0 == strcmp("-msgCount", argv[iargs]))
+		{
+			++iargs; if (iargs == argc) exitMissingArgument(argv, iargs - 1);
+			sscanf(argv[iargs], "%u", &tunnelStreamStressConfig.msgCount);
+		}
+		else if (0 == strcmp("-msgSize", argv[iargs]))
+		{
+			++iargs; if (iargs == argc) exitMissingArgument(argv, iargs - 1);
+			sscanf(argv[iargs], "%u", &tunnelStreamStressConfig.msgSize);
+		}
+		else if (0 == strcmp("-dropInterval", argv[iargs]))
+		{
+			++iargs; if (iargs == argc) exitMissingArgument(argv, iargs - 1);
+			sscanf(argv[iargs], "%u", &tunnelStreamStressConfig.dropInterval);
+		}
+		else if (0 == strcmp("-retainInterval", argv[iargs]))
+		{
+			++iargs; if (iargs == argc) exitMissingArgument(argv, iargs - 1);
+			sscanf(argv[iargs], "%u", &tunnelStreamStressConfig.retainInterval);
+		}
+		else if (0 == strcmp("-guaranteedOutputBuffers", argv[iargs]))
+		{
+			++iargs; if (iargs == argc) exitMissingArgument(argv, iargs - 1);
+			sscanf(argv[iargs], "%u", &tunnelStreamStressConfig.guaranteedOutputBuffers);
+		}
+		else if (0 == strcmp("-timeout", argv[iargs]))
+		{
+			++iargs; if (iargs == argc) exitMissingArgument(argv, iargs - 1);
+			sscanf(argv[iargs], "%u", &tunnelStreamStressConfig.timeout);
+		}
+		else if (0 == strcmp("-providerPort", argv[iargs]))
+		{
+			++iargs; if (iargs == argc) exitMissingArgument(argv, iargs - 1);
+			snprintf(tunnelStreamStressConfig.providerPort, sizeof(tunnelStreamStressConfig.providerPort), "%s", argv[iargs]);
+		}
+		else if (0 == strcmp("-proxyPort", argv[iargs]))
+		{
+			++iargs; if (iargs == argc) exitMissingArgument(argv, iargs - 1);
+			snprintf(tunnelStreamStressConfig.proxyPort, sizeof(tunnelStreamStressConfig.proxyPort), "%s", argv[iargs]);
+		}
+		else
+		{
+			printf("Config Error: Unrecognized option: %s\n", argv[iargs]);
+			exitWithUsage();
+		}
+	}
+
+	if (tunnelStreamStressConfig.msgCount == 0 || tunnelStreamStressConfig.guaranteedOutputBuffers == 0
+			|| tunnelStreamStressConfig.timeout == 0)
+	{
+		printf("Config Error: counts must be greater than zero.\n");
+		exitWithUsage();
+	}
+
+	if (tunnelStreamStressConfig.msgSize < PAYLOAD_HEADER_LENGTH)
+	{
+		printf("Config Error: -msgSize must be at least %d.\n", PAYLOAD_HEADER_LENGTH);
+		exitWithUsage();
+	}
+}
+
+/* Records a failure. Only the first one is printed, since later ones usually follow from it. */
+static void stressFail(const char *format, ...)
+{
+	va_list args;
+
+	if (stress.failed)
+		return;
+
+	stress.failed = RSSL_TRUE;
+	printf("FAILURE: ");
+	va_start(args, format);
+	vprintf(format, args);
+	va_end(args);
+	printf("\n");
+}
+
+/* Fills a message with its counter followed by bytes derived from it, so that the content can be checked later. */
+static void writePayload(RsslBuffer *pBuffer, RsslUInt32 counter)
+{
+	RsslUInt32 i;
+
+	pBuffer->data[0] = (char)(counter >> 24);
+	pBuffer->data[1] = (char)(counter >> 16);
+	pBuffer->data[2] = (char)(counter >> 8);
+	pBuffer->data[3] = (char)counter;
+
+	for (i = PAYLOAD_HEADER_LENGTH; i < tunnelStreamStressConfig.msgSize; ++i)
+		pBuffer->data[i] = (char)(counter + i);
+
+	pBuffer->length = tunnelStreamStressConfig.msgSize;
+}
+
+/* Reads the counter of a message and checks the rest of its content. */
+static RsslBool readPayload(RsslBuffer *pBuffer, RsslUInt32 *pCounter)
+{
+	RsslUInt32 i, counter;
+
+	if (pBuffer->length != tunnelStreamStressConfig.msgSize)
+		return RSSL_FALSE;
+
+	counter = ((RsslUInt32)(unsigned char)pBuffer->data[0] << 24) | ((RsslUInt32)(unsigned char)pBuffer->data[1] << 16)
+		| ((RsslUInt32)(unsigned char)pBuffer->data[2] << 8) | (RsslUInt32)(unsigned char)pBuffer->data[3];
+
+	for (i = PAYLOAD_HEADER_LENGTH; i < pBuffer->length; ++i)
+	{
+		if (pBuffer->data[i] != (char)(counter + i))
+			return RSSL_FALSE;
+	}
+
+	*pCounter = counter;
+	return RSSL_TRUE;
+}
+
+/* Checks that a retained buffer still holds the message it was retained with, and releases it. */
+static void releaseRetainedBuffer(RetainedBuffer *pRetained)
+{
+	RsslErrorInfo errorInfo;
+	RsslUInt32 counter;
+
+	if (pRetained->pBuffer == NULL)
+		return;
+
+	if (!readPayload(pRetained->pBuffer, &counter) || counter != pRetained->counter)
+		stressFail("Retained buffer for message %u no longer holds its content.", pRetained->counter);
+
+	if (rsslTunnelStreamReleaseBuffer(pRetained->pBuffer, &errorInfo) != RSSL_RET_SUCCESS)
+		stressFail("rsslTunnelStreamReleaseBuffer() failed for a retained buffer: %s", errorInfo.rsslError.text);
+
+	pRetained->pBuffer = NULL;
+}
+
+static void releaseAllRetainedBuffers()
+{
+	int i;
+
+	for (i = 0; i < RETAINED_BUFFER_COUNT; ++i)
+		releaseRetainedBuffer(&stress.retainedBuffers[i]);
+}
+
+static RsslReactorCallbackRet providerTunnelMsgCallback(RsslTunnelStream *pTunnelStream, RsslTunnelStreamMsgEvent *pEvent)
+{
+	RsslUInt32 counter;
+
+	if (pEvent->containerType != RSSL_DT_OPAQUE || pEvent->pRsslBuffer == NULL)
+	{
+		stressFail("Provider received unexpected content of container type %u.", pEvent->containerType);
+		return RSSL_RC_CRET_SUCCESS;
+	}
+
+	if (!readPayload(pEvent->pRsslBuffer, &counter))
+	{
+		stressFail("Provider received a corrupt message after message %u.", stress.receivedCount);
+		return RSSL_RC_CRET_SUCCESS;
+	}
+
+	/* Messages must arrive exactly once and in order, however many were dropped and retransmitted. */
+	if (counter != stress.receivedCount)
+	{
+		stressFail("Provider received message %u when expecting message %u.", counter, stress.receivedCount);
+		return RSSL_RC_CRET_SUCCESS;
+	}
+
+	++stress.receivedCount;
+	stress.lastProgressTime = getTimeMilli();
+
+	if (tunnelStreamStressConfig.retainInterval && counter % tunnelStreamStressConfig.retainInterval == 0)
+	{
+		RetainedBuffer *pRetained = &stress.retainedBuffers[stress.retainedCount % RETAINED_BUFFER_COUNT];
+		RsslErrorInfo errorInfo;
+
+		/* Release the oldest retained buffer to make room, after checking that later messages did not overwrite it. */
+		releaseRetainedBuffer(pRetained);
+
+		if ((pRetained->pBuffer = rsslTunnelStreamRetainBuffer(pTunnelStream, pEvent->pRsslBuffer, &errorInfo)) == NULL)
+		{
+			stressFail("rsslTunnelStreamRetainBuffer() failed: %s", errorInfo.rsslError.text);
+			return RSSL_RC_CRET_SUCCESS;
+		}
+
+		pRetained->counter = counter;
+		++stress.retainedCount;
+	}
+
+	return RSSL_RC_CRET_SUCCESS;
+}
+
+static RsslReactorCallbackRet providerTunnelStatusCallback(RsslTunnelStream *pTunnelStream, RsslTunnelStreamStatusEvent *pEvent)
+{
+	if (pEvent->pState && pEvent->pState->streamState != RSSL_STREAM_OPEN)
+	{
+		stressFail("Provider's tunnel stream closed.");
+		releaseAllRetainedBuffers();
+		stress.pProviderTunnel = NULL;
+	}
+
+	return RSSL_RC_CRET_SUCCESS;
+}
+
+static RsslReactorCallbackRet providerTunnelListenerCallback(RsslTunnelStreamRequestEvent *pEvent, RsslErrorInfo *pErrorInfo)
+{
+	RsslReactorAcceptTunnelStreamOptions acceptOpts;
+	RsslErrorInfo errorInfo;
+
+	rsslClearReactorAcceptTunnelStreamOptions(&acceptOpts);
+	acceptOpts.statusEventCallback = providerTunnelStatusCallback;
+	acceptOpts.defaultMsgCallback = providerTunnelMsgCallback;
+	acceptOpts.classOfService.flowControl.type = RDM_COS_FC_BIDIRECTIONAL;
+	acceptOpts.classOfService.dataIntegrity.type = RDM_COS_DI_RELIABLE;
+
+	if (rsslReactorAcceptTunnelStream(pEvent, &acceptOpts, &errorInfo) != RSSL_RET_SUCCESS)
+		stressFail("rsslReactorAcceptTunnelStream() failed: %s", errorInfo.rsslError.text);
+
+	return RSSL_RC_CRET_SUCCESS;
+}
+
+static RsslReactorCallbackRet providerLoginMsgCallback(RsslReactor *pReactor, RsslReactorChannel *pReactorChannel, RsslRDMLoginMsgEvent *pEvent)
+{
+	RsslRDMLoginMsg *pLoginMsg = pEvent->pRDMLoginMsg;
+	RsslRDMLoginRefresh loginRefresh;
+	RsslReactorSubmitMsgOptions submitOpts;
+	RsslErrorInfo errorInfo;
+
+	if (pLoginMsg == NULL || pLoginMsg->rdmMsgBase.rdmMsgType != RDM_LG_MT_REQUEST)
+		return RSSL_RC_CRET_SUCCESS;
+
+	rsslClearRDMLoginRefresh(&loginRefresh);
+	loginRefresh.rdmMsgBase.streamId = pLoginMsg->rdmMsgBase.streamId;
+	loginRefresh.flags = RDM_LG_RFF_SOLICITED | RDM_LG_RFF_HAS_USERNAME;
+	loginRefresh.userName = pLoginMsg->request.userName;
+
+	rsslClearReactorSubmitMsgOptions(&submitOpts);
+	submitOpts.pRDMMsg = (RsslRDMMsg*)&loginRefresh;
+
+	if (rsslReactorSubmitMsg(pReactor, pReactorChannel, &submitOpts, &errorInfo) < RSSL_RET_SUCCESS)
+		stressFail("Provider failed to send login refresh: %s", errorInfo.rsslError.text);
+
+	return RSSL_RC_CRET_SUCCESS;
+}
+
+static RsslReactorCallbackRet providerDirectoryMsgCallback(RsslReactor *pReactor, RsslReactorChannel *pReactorChannel, RsslRDMDirectoryMsgEvent *pEvent)
+{
+	RsslRDMDirectoryMsg *pDirectoryMsg = pEvent->pRDMDirectoryMsg;
+	RsslRDMDirectoryRefresh directoryRefresh;
+	RsslRDMService service;
+	RsslUInt capabilities[1];
+	RsslQos qos;
+	RsslReactorSubmitMsgOptions submitOpts;
+	RsslErrorInfo errorInfo;
+
+	if (pDirectoryMsg == NULL || pDirectoryMsg->rdmMsgBase.rdmMsgType != RDM_DR_MT_REQUEST)
+		return RSSL_RC_CRET_SUCCESS;
+
+	capabilities[0] = TUNNEL_DOMAIN_TYPE;
+
+	rsslClearQos(&qos);
+	qos.rate = RSSL_QOS_RATE_TICK_BY_TICK;
+	qos.timeliness = RSSL_QOS_TIME_REALTIME;
+
+	rsslClearRDMService(&service);
+	service.flags = RDM_SVCF_HAS_INFO | RDM_SVCF_HAS_STATE;
+	service.action = RSSL_MPEA_ADD_ENTRY;
+	service.serviceId = TUNNEL_SERVICE_ID;
+	service.info.serviceName.data = (char*)"TUNNEL_STRESS";
+	service.info.serviceName.length = (RsslUInt32)strlen(service.info.serviceName.data);
+	service.info.capabilitiesList = capabilities;
+	service.info.capabilitiesCount = 1;
+	service.info.flags |= RDM_SVC_IFF_HAS_QOS;
+	service.info.qosList = &qos;
+	service.info.qosCount = 1;
+	service.state.flags |= RDM_SVC_STF_HAS_ACCEPTING_REQS;
+	service.state.serviceState = 1;
+	service.state.acceptingRequests = 1;
+
+	rsslClearRDMDirectoryRefresh(&directoryRefresh);
+	directoryRefresh.rdmMsgBase.streamId = pDirectoryMsg->rdmMsgBase.streamId;
+	directoryRefresh.flags = RDM_DR_RFF_SOLICITED | RDM_DR_RFF_CLEAR_CACHE;
+	directoryRefresh.filter = pDirectoryMsg->request.filter;
+	directoryRefresh.serviceList = &service;
+	directoryRefresh.serviceCount = 1;
+
+	if (pDirectoryMsg->request.flags & RDM_DR_RQF_HAS_SERVICE_ID)
+	{
+		directoryRefresh.flags |= RDM_DR_RFF_HAS_SERVICE_ID;
+		directoryRefresh.serviceId = pDirectoryMsg->request.serviceId;
+	}
+
+	rsslClearReactorSubmitMsgOptions(&submitOpts);
+	submitOpts.pRDMMsg = (RsslRDMMsg*)&directoryRefresh;
+
+	if (rsslReactorSubmitMsg(pReactor, pReactorChannel, &submitOpts, &errorInfo) < RSSL_RET_SUCCESS)
+		stressFail("Provider failed to send directory refresh: %s", errorInfo.rsslError.text);
+
+	return RSSL_RC_CRET_SUCCESS;
+}
+
+static RsslReactorCallbackRet providerDefaultMsgCallback(RsslReactor *pReactor, RsslReactorChannel *pReactorChannel, RsslMsgEvent *pEvent)
+{
+	return RSSL_RC_CRET_SUCCESS;
+}
+
+static RsslReactorCallbackRet providerChannelEventCallback(RsslReactor *pReactor, RsslReactorChannel *pReactorChannel, RsslReactorChannelEvent *pEvent)
+{
+	RsslErrorInfo errorInfo;
+
+	switch(pEvent->channelEventType)
+	{
+		case RSSL_RC_CET_CHANNEL_UP:
+			stress.pProviderChannel = pReactorChannel;
+			break;
+
+		case RSSL_RC_CET_CHANNEL_DOWN:
+		case RSSL_RC_CET_CHANNEL_DOWN_RECONNECTING:
+			stressFail("Provider channel went down: %s", pEvent->pError ? pEvent->pError->rsslError.text : "");
+			stress.pProviderChannel = NULL;
+			stress.pProviderTunnel = NULL;
+			rsslReactorCloseChannel(pReactor, pReactorChannel, &errorInfo);
+			break;
+
+		default:
+			break;
+	}
+
+	return RSSL_RC_CRET_SUCCESS;
+}
+
+static RsslReactorCallbackRet consumerTunnelMsgCallback(RsslTunnelStream *pTunnelStream, RsslTunnelStreamMsgEvent *pEvent)
+{
+	return RSSL_RC_CRET_SUCCESS;
+}
+
+static RsslReactorCallbackRet consumerTunnelStatusCallback(RsslTunnelStream *pTunnelStream, RsslTunnelStreamStatusEvent *pEvent)
+{
+	if (pEvent->pState == NULL)
+		return RSSL_RC_CRET_SUCCESS;
+
+	if (pEvent->pState->streamState == RSSL_STREAM_OPEN)
+	{
+		if (pEvent->pState->dataState == RSSL_DATA_OK)
+		{
+			stress.pConsumerTunnel = pTunnelStream;
+			stress.lastProgressTime = getTimeMilli();
+		}
+	}
+	else
+	{
+		stressFail("Consumer's tunnel stream closed: %.*s", (int)pEvent->pState->text.length, pEvent->pState->text.data);
+		stress.pConsumerTunnel = NULL;
+	}
+
+	return RSSL_RC_CRET_SUCCESS;
+}
+
+static RsslReactorCallbackRet consumerChannelEventCallback(RsslReactor *pReactor, RsslReactorChannel *pReactorChannel, RsslReactorChannelEvent *pEvent)
+{
+	RsslErrorInfo errorInfo;
+
+	switch(pEvent->channelEventType)
+	{
+		case RSSL_RC_CET_CHANNEL_UP:
+			stress.pConsumerChannel = pReactorChannel;
+			break;
+
+		case RSSL_RC_CET_CHANNEL_READY:
+		{
+			RsslTunnelStreamOpenOptions openOpts;
+
+			if (stress.tunnelStreamOpened)
+				break;
+
+			rsslClearTunnelStreamOpenOptions(&openOpts);
+			openOpts.name = (char*)"TunnelStreamStress";
+			openOpts.streamId = TUNNEL_STREAM_ID;
+			openOpts.domainType = TUNNEL_DOMAIN_TYPE;
+			openOpts.serviceId = TUNNEL_SERVICE_ID;
+			openOpts.guaranteedOutputBuffers = tunnelStreamStressConfig.guaranteedOutputBuffers;
+			openOpts.statusEventCallback = consumerTunnelStatusCallback;
+			openOpts.defaultMsgCallback = consumerTunnelMsgCallback;
+			openOpts.classOfService.flowControl.type = RDM_COS_FC_BIDIRECTIONAL;
+			openOpts.classOfService.dataIntegrity.type = RDM_COS_DI_RELIABLE;
+
+			if (rsslReactorOpenTunnelStream(pReactorChannel, &openOpts, &errorInfo) != RSSL_RET_SUCCESS)
+				stressFail("rsslReactorOpenTunnelStream() failed: %s", errorInfo.rsslError.text);
+
+			stress.tunnelStreamOpened = RSSL_TRUE;
+			break;
+		}
+
+		case RSSL_RC_CET_CHANNEL_DOWN:
+		case RSSL_RC_CET_CHANNEL_DOWN_RECONNECTING:
+			stressFail("Consumer channel went down: %s", pEvent->pError ? pEvent->pError->rsslError.text : "");
+			stress.pConsumerChannel = NULL;
+			stress.pConsumerTunnel = NULL;
+			rsslReactorCloseChannel(pReactor, pReactorChannel, &errorInfo);
+			break;
+
+		default:
+			break;
+	}
+
+	return RSSL_RC_CRET_SUCCESS;
+}
+
+static RsslReactorCallbackRet consumerDefaultMsgCallback(RsslReactor *pReactor, RsslReactorChannel *pReactorChannel, RsslMsgEvent *pEvent)
+{
+	return RSSL_RC_CRET_SUCCESS;
+}
+
+static void dispatchReactor(RsslReactor *pReactor)
+{
+	RsslReactorDispatchOptions dispatchOpts;
+	RsslErrorInfo errorInfo;
+	RsslRet ret;
+
+	rsslClearReactorDispatchOptions(&dispatchOpts);
+
+	do
+	{
+		if ((ret = rsslReactorDispatch(pReactor, &dispatchOpts, &errorInfo)) < RSSL_RET_SUCCESS)
+			stressFail("rsslReactorDispatch() failed: %s", errorInfo.rsslError.text);
+	} while (ret > RSSL_RET_SUCCESS);
+}
+
+static void dispatchReactors()
+{
+	dispatchReactor(stress.pProviderReactor);
+	dispatchReactor(stress.pConsumerReactor);
+}
+
+static void proxyFlush(ProxyChannel *pProxyChannel)
+{
+	RsslError error;
+	RsslRet ret;
+
+	if ((ret = rsslFlush(pProxyChannel->pChannel, &error)) < RSSL_RET_SUCCESS)
+		stressFail("Proxy failed to flush: %s", error.text);
+
+	pProxyChannel->needFlush = (ret > RSSL_RET_SUCCESS);
+}
+
+/* Decides whether to drop a message sent by the consumer. Only tunnel stream data messages are dropped, never
+ * retransmissions, and only while the consumer has more messages to send; every gap is then followed by a later
+ * message, which makes the provider NAK it. */
+static RsslBool proxyShouldDrop(RsslBuffer *pMsgBuffer)
+{
+	RsslDecodeIterator dIter;
+	RsslMsg msg;
+
+	rsslClearDecodeIterator(&dIter);
+	rsslSetDecodeIteratorRWFVersion(&dIter, proxy.consumerSide.pChannel->majorVersion, proxy.consumerSide.pChannel->minorVersion);
+	rsslSetDecodeIteratorBuffer(&dIter, pMsgBuffer);
+
+	if (rsslDecodeMsg(&dIter, &msg) != RSSL_RET_SUCCESS
+			|| msg.msgBase.msgClass != RSSL_MC_GENERIC
+			|| msg.msgBase.domainType != TUNNEL_DOMAIN_TYPE
+			|| !(msg.genericMsg.flags & RSSL_GNMF_HAS_EXTENDED_HEADER)
+			|| !(msg.genericMsg.flags & RSSL_GNMF_HAS_SEQ_NUM)
+			|| msg.genericMsg.extendedHeader.length < 1)
+		return RSSL_FALSE;
+
+	if (msg.genericMsg.extendedHeader.data[0] == TUNNEL_OPCODE_DATA)
+	{
+		if (msg.genericMsg.seqNum > proxy.highestDataSeqNum)
+			proxy.highestDataSeqNum = msg.genericMsg.seqNum;
+
+		++proxy.dataMsgCount;
+
+		if (tunnelStreamStressConfig.dropInterval && proxy.dataMsgCount % tunnelStreamStressConfig.dropInterval == 0
+				&& stress.submittedCount < tunnelStreamStressConfig.msgCount)
+		{
+			++proxy.droppedCount;
+			return RSSL_TRUE;
+		}
+	}
+	else if (msg.genericMsg.extendedHeader.data[0] == TUNNEL_OPCODE_RETRANS)
+	{
+		/* A retransmission must resend a message that was already sent, in its original position. */
+		if (msg.genericMsg.seqNum > proxy.highestDataSeqNum)
+			stressFail("Consumer retransmitted sequence number %u, which it has not sent yet.", msg.genericMsg.seqNum);
+
+		++proxy.retransmitCount;
+	}
+
+	return RSSL_FALSE;
+}
+
+/* Copies a message read from one side of the proxy to the other. */
+static void proxyWrite(ProxyChannel *pProxyChannel, RsslBuffer *pMsgBuffer)
+{
+	RsslBuffer *pOutBuffer;
+	RsslUInt32 bytesWritten, uncompressedBytesWritten;
+	RsslError error;
+	RsslRet ret;
+
+	while ((pOutBuffer = rsslGetBuffer(pProxyChannel->pChannel, pMsgBuffer->length, RSSL_FALSE, &error)) == NULL)
+	{
+		if (error.rsslErrorId != RSSL_RET_BUFFER_NO_BUFFERS)
+		{
+			stressFail("Proxy failed to get a buffer: %s", error.text);
+			return;
+		}
+
+		/* Let the receiving reactor read, so that flushing can make room. */
+		proxyFlush(pProxyChannel);
+		dispatchReactors();
+
+		if (stress.failed)
+			return;
+	}
+
+	memcpy(pOutBuffer->data, pMsgBuffer->data, pMsgBuffer->length);
+	pOutBuffer->length = pMsgBuffer->length;
+
+	while ((ret = rsslWrite(pProxyChannel->pChannel, pOutBuffer, RSSL_HIGH_PRIORITY, 0, &bytesWritten, &uncompressedBytesWritten,
+					&error)) == RSSL_RET_WRITE_CALL_AGAIN)
+		proxyFlush(pProxyChannel);
+
+	if (ret > RSSL_RET_SUCCESS || ret == RSSL_RET_WRITE_FLUSH_FAILED)
+		pProxyChannel->needFlush = RSSL_TRUE;
+	else if (ret < RSSL_RET_SUCCESS)
+	{
+		rsslReleaseBuffer(pOutBuffer, &error);
+		stressFail("Proxy failed to write: %s", error.text);
+	}
+}
+
+static void proxyForward(ProxyChannel *pFrom, ProxyChannel *pTo, RsslBool fromConsumer)
+{
+	RsslBuffer *pMsgBuffer;
+	RsslError error;
+	RsslRet readRet;
+	RsslUInt32 msgCount = 0;
+
+	do
+	{
+		if ((pMsgBuffer = rsslRead(pFrom->pChannel, &readRet, &error)) != NULL)
+		{
+			if (!fromConsumer || !proxyShouldDrop(pMsgBuffer))
+				proxyWrite(pTo, pMsgBuffer);
+		}
+		else if (readRet < RSSL_RET_SUCCESS && readRet != RSSL_RET_READ_WOULD_BLOCK && readRet != RSSL_RET_READ_PING
+				&& readRet != RSSL_RET_READ_FD_CHANGE)
+		{
+			stressFail("Proxy failed to read: %s", error.text);
+			return;
+		}
+	} while (readRet > RSSL_RET_SUCCESS && ++msgCount < MAX_MSGS_PER_PASS && !stress.failed);
+}
+
+static void proxyInitChannel(ProxyChannel *pProxyChannel)
+{
+	RsslInProgInfo inProg;
+	RsslError error;
+
+	if (pProxyChannel->pChannel == NULL || pProxyChannel->pChannel->state != RSSL_CH_STATE_INITIALIZING)
+		return;
+
+	if (rsslInitChannel(pProxyChannel->pChannel, &inProg, &error) < RSSL_RET_SUCCESS)
+		stressFail("Proxy failed to initialize a channel: %s", error.text);
+}
+
+static void proxyAccept()
+{
+	RsslAcceptOptions acceptOpts = RSSL_INIT_ACCEPT_OPTS;
+	RsslConnectOptions connectOpts = RSSL_INIT_CONNECT_OPTS;
+	RsslError error;
+
+	if ((proxy.consumerSide.pChannel = rsslAccept(proxy.pServer, &acceptOpts, &error)) == NULL)
+	{
+		stressFail("Proxy failed to accept: %s", error.text);
+		return;
+	}
+
+	connectOpts.connectionInfo.unified.address = (char*)"localhost";
+	connectOpts.connectionInfo.unified.serviceName = tunnelStreamStressConfig.providerPort;
+	connectOpts.guaranteedOutputBuffers = PROXY_OUTPUT_BUFFERS;
+	connectOpts.majorVersion = RSSL_RWF_MAJOR_VERSION;
+	connectOpts.minorVersion = RSSL_RWF_MINOR_VERSION;
+	connectOpts.protocolType = RSSL_RWF_PROTOCOL_TYPE;
+
+	if ((proxy.providerSide.pChannel = rsslConnect(&connectOpts, &error)) == NULL)
+		stressFail("Proxy failed to connect to the provider: %s", error.text);
+}
+
+static void proxyDispatch()
+{
+	ProxyChannel *pConsumerSide = &proxy.consumerSide, *pProviderSide = &proxy.providerSide;
+	RsslError error;
+
+	if (pConsumerSide->pChannel == NULL || pProviderSide->pChannel == NULL)
+		return;
+
+	proxyInitChannel(pConsumerSide);
+	proxyInitChannel(pProviderSide);
+
+	if (pConsumerSide->pChannel->state != RSSL_CH_STATE_ACTIVE || pProviderSide->pChannel->state != RSSL_CH_STATE_ACTIVE)
+		return;
+
+	proxyForward(pConsumerSide, pProviderSide, RSSL_TRUE);
+	proxyForward(pProviderSide, pConsumerSide, RSSL_FALSE);
+
+	if (pConsumerSide->needFlush)
+		proxyFlush(pConsumerSide);
+	if (pProviderSide->needFlush)
+		proxyFlush(pProviderSide);
+
+	/* The reactors do not see each other's pings, so the proxy pings both of them. */
+	if (getTimeMilli() >= proxy.nextPingTime)
+	{
+		if (rsslPing(pConsumerSide->pChannel, &error) < RSSL_RET_SUCCESS || rsslPing(pProviderSide->pChannel, &error) < RSSL_RET_SUCCESS)
+			stressFail("Proxy failed to ping: %s", error.text);
+		proxy.nextPingTime = getTimeMilli() + 1000;
+	}
+}
+
+/* Submits as many messages as the consumer's tunnel stream has buffers for. */
+static void consumerSubmit()
+{
+	RsslTunnelStreamGetBufferOptions getBufferOpts;
+	RsslTunnelStreamSubmitOptions submitOpts;
+	RsslErrorInfo errorInfo;
+	RsslBuffer *pBuffer;
+	RsslUInt32 msgCount;
+	RsslRet ret;
+
+	rsslClearTunnelStreamGetBufferOptions(&getBufferOpts);
+	getBufferOpts.size = tunnelStreamStressConfig.msgSize;
+
+	rsslClearTunnelStreamSubmitOptions(&submitOpts);
+	submitOpts.containerType = RSSL_DT_OPAQUE;
+
+	for (msgCount = 0; msgCount < MAX_MSGS_PER_PASS && stress.submittedCount < tunnelStreamStressConfig.msgCount; ++msgCount)
+	{
+		/* Buffers run out while messages wait for acknowledgement; they are released as acknowledgements arrive. */
+		if ((pBuffer = rsslTunnelStreamGetBuffer(stress.pConsumerTunnel, &getBufferOpts, &errorInfo)) == NULL)
+		{
+			snprintf(stress.lastBufferError, sizeof(stress.lastBufferError), "%s", errorInfo.rsslError.text);
+			return;
+		}
+
+		writePayload(pBuffer, stress.submittedCount);
+
+		if ((ret = rsslTunnelStreamSubmit(stress.pConsumerTunnel, pBuffer, &submitOpts, &errorInfo)) < RSSL_RET_SUCCESS)
+		{
+			rsslTunnelStreamReleaseBuffer(pBuffer, &errorInfo);
+			stressFail("rsslTunnelStreamSubmit() failed: %s", errorInfo.rsslError.text);
+			return;
+		}
+
+		++stress.submittedCount;
+	}
+}
+
+/* Checks that every buffer the consumer used was released: with nothing waiting for acknowledgement, the tunnel
+ * stream must be able to provide all of its guaranteed output buffers at once. Each buffer is as large as the
+ * largest message, so none of them share memory. */
+static void checkConsumerBuffersReleased()
+{
+	RsslTunnelStreamGetBufferOptions getBufferOpts;
+	RsslErrorInfo errorInfo;
+	RsslBuffer **buffers;
+	RsslUInt32 i, bufferCount = 0;
+
+	if ((buffers = (RsslBuffer**)malloc(tunnelStreamStressConfig.guaranteedOutputBuffers * sizeof(RsslBuffer*))) == NULL)
+	{
+		stressFail("Failed to allocate buffer list.");
+		return;
+	}
+
+	rsslClearTunnelStreamGetBufferOptions(&getBufferOpts);
+	getBufferOpts.size = (RsslUInt32)stress.pConsumerTunnel->classOfService.common.maxMsgSize;
+
+	for (; bufferCount < tunnelStreamStressConfig.guaranteedOutputBuffers; ++bufferCount)
+	{
+		if ((buffers[bufferCount] = rsslTunnelStreamGetBuffer(stress.pConsumerTunnel, &getBufferOpts, &errorInfo)) == NULL)
+		{
+			stressFail("Only %u of %u guaranteed output buffers are available after all messages were acknowledged: %s",
+					bufferCount, tunnelStreamStressConfig.guaranteedOutputBuffers, errorInfo.rsslError.text);
+			break;
+		}
+	}
+
+	for (i = 0; i < bufferCount; ++i)
+		rsslTunnelStreamReleaseBuffer(buffers[i], &errorInfo);
+
+	free(buffers);
+}
+
+static void addSocket(RsslSocket socketId, fd_set *pFds)
+{
+	if (socketId != REACTOR_INVALID_SOCKET)
+		FD_SET(socketId, pFds);
+}
+
+static void waitForEvents()
+{
+	fd_set readFds, writeFds, exceptFds;
+	struct timeval selectTime;
+
+	FD_ZERO(&readFds);
+	FD_ZERO(&writeFds);
+	FD_ZERO(&exceptFds);
+
+	addSocket(stress.pProviderReactor->eventFd, &readFds);
+	addSocket(stress.pConsumerReactor->eventFd, &readFds);
+	addSocket(stress.pProviderServer->socketId, &readFds);
+	addSocket(proxy.pServer->socketId, &readFds);
+
+	if (stress.pProviderChannel)
+		addSocket(stress.pProviderChannel->socketId, &readFds);
+	if (stress.pConsumerChannel)
+		addSocket(stress.pConsumerChannel->socketId, &readFds);
+
+	if (proxy.consumerSide.pChannel)
+	{
+		addSocket(proxy.consumerSide.pChannel->socketId, &readFds);
+		addSocket(proxy.consumerSide.pChannel->socketId, &exceptFds);
+		if (proxy.consumerSide.needFlush)
+			addSocket(proxy.consumerSide.pChannel->socketId, &writeFds);
+	}
+
+	if (proxy.providerSide.pChannel)
+	{
+		addSocket(proxy.providerSide.pChannel->socketId, &readFds);
+		addSocket(proxy.providerSide.pChannel->socketId, &exceptFds);
+		if (proxy.providerSide.needFlush || proxy.providerSide.pChannel->state == RSSL_CH_STATE_INITIALIZING)
+			addSocket(proxy.providerSide.pChannel->socketId, &writeFds);
+	}
+
+	/* Wake up regularly, since the reactors' timers and the proxy's pings do not signal a descriptor. */
+	selectTime.tv_sec = 0;
+	selectTime.tv_usec = 1000;
+	select(FD_SETSIZE, &readFds, &writeFds, &exceptFds, &selectTime);
+
+	if (proxy.consumerSide.pChannel == NULL && FD_ISSET(proxy.pServer->socketId, &readFds))
+		proxyAccept();
+}
+
+static void startEndpoints()
+{
+	RsslCreateReactorOptions reactorOpts;
+	RsslBindOptions bindOpts = RSSL_INIT_BIND_OPTS;
+	RsslReactorAcceptOptions acceptOpts;
+	RsslReactorConnectOptions connectOpts;
+	RsslReactorOMMConsumerRole consumerRole;
+	RsslRDMLoginRequest loginRequest;
+	RsslRDMDirectoryRequest directoryRequest;
+	RsslReactorOMMProviderRole providerRole;
+	RsslErrorInfo errorInfo;
+	RsslError error;
+	TimeValue deadline;
+
+	rsslClearCreateReactorOptions(&reactorOpts);
+
+	if ((stress.pProviderReactor = rsslCreateReactor(&reactorOpts, &errorInfo)) == NULL
+			|| (stress.pConsumerReactor = rsslCreateReactor(&reactorOpts, &errorInfo)) == NULL)
+	{
+		printf("rsslCreateReactor() failed: %s\n", errorInfo.rsslError.text);
+		exit(-1);
+	}
+
+	bindOpts.serviceName = tunnelStreamStressConfig.providerPort;
+	bindOpts.majorVersion = RSSL_RWF_MAJOR_VERSION;
+	bindOpts.minorVersion = RSSL_RWF_MINOR_VERSION;
+	bindOpts.protocolType = RSSL_RWF_PROTOCOL_TYPE;
+
+	if ((stress.pProviderServer = rsslBind(&bindOpts, &error)) == NULL)
+	{
+		printf("rsslBind() failed for the provider: %s\n", error.text);
+		exit(-1);
+	}
+
+	bindOpts.serviceName = tunnelStreamStressConfig.proxyPort;
+	bindOpts.guaranteedOutputBuffers = PROXY_OUTPUT_BUFFERS;
+	bindOpts.maxOutputBuffers = PROXY_OUTPUT_BUFFERS;
+
+	if ((proxy.pServer = rsslBind(&bindOpts, &error)) == NULL)
+	{
+		printf("rsslBind() failed for the proxy: %s\n", error.text);
+		exit(-1);
+	}
+
+	/* The consumer connects to the proxy, which connects to the provider when it accepts the consumer. */
+	rsslInitDefaultRDMLoginRequest(&loginRequest, 1);
+	rsslInitDefaultRDMDirectoryRequest(&directoryRequest, 2);
+
+	rsslClearOMMConsumerRole(&consumerRole);
+	consumerRole.base.channelEventCallback = consumerChannelEventCallback;
+	consumerRole.base.defaultMsgCallback = consumerDefaultMsgCallback;
+	consumerRole.pLoginRequest = &loginRequest;
+	consumerRole.pDirectoryRequest = &directoryRequest;
+	consumerRole.watchlistOptions.enableWatchlist = RSSL_TRUE;
+
+	rsslClearReactorConnectOptions(&connectOpts);
+	connectOpts.rsslConnectOptions.connectionInfo.unified.address = (char*)"localhost";
+	connectOpts.rsslConnectOptions.connectionInfo.unified.serviceName = tunnelStreamStressConfig.proxyPort;
+	connectOpts.rsslConnectOptions.majorVersion = RSSL_RWF_MAJOR_VERSION;
+	connectOpts.rsslConnectOptions.minorVersion = RSSL_RWF_MINOR_VERSION;
+	connectOpts.rsslConnectOptions.protocolType = RSSL_RWF_PROTOCOL_TYPE;
+
+	if (rsslReactorConnect(stress.pConsumerReactor, &connectOpts, (RsslReactorChannelRole*)&consumerRole, &errorInfo) != RSSL_RET_SUCCESS)
+	{
+		printf("rsslReactorConnect() failed: %s\n", errorInfo.rsslError.text);
+		exit(-1);
+	}
+
+	/* Wait for the proxy to connect to the provider, and accept that connection. */
+	deadline = getTimeMilli() + tunnelStreamStressConfig.timeout * 1000;
+	while (proxy.providerSide.pChannel == NULL && !stress.failed)
+	{
+		if (getTimeMilli() > deadline)
+		{
+			stressFail("The consumer did not connect to the proxy.");
+			return;
+		}
+
+		waitForEvents();
+		dispatchReactor(stress.pConsumerReactor);
+	}
+
+	while (!stress.failed)
+	{
+		fd_set readFds;
+		struct timeval selectTime;
+
+		if (getTimeMilli() > deadline)
+		{
+			stressFail("The proxy did not connect to the provider.");
+			return;
+		}
+
+		FD_ZERO(&readFds);
+		FD_SET(stress.pProviderServer->socketId, &readFds);
+		selectTime.tv_sec = 0;
+		selectTime.tv_usec = 1000;
+
+		if (select(FD_SETSIZE, &readFds, NULL, NULL, &selectTime) > 0)
+			break;
+
+		dispatchReactor(stress.pConsumerReactor);
+	}
+
+	rsslClearOMMProviderRole(&providerRole);
+	providerRole.base.channelEventCallback = providerChannelEventCallback;
+	providerRole.base.defaultMsgCallback = providerDefaultMsgCallback;
+	providerRole.loginMsgCallback = providerLoginMsgCallback;
+	providerRole.directoryMsgCallback = providerDirectoryMsgCallback;
+	providerRole.tunnelStreamListenerCallback = providerTunnelListenerCallback;
+
+	rsslClearReactorAcceptOptions(&acceptOpts);
+
+	if (!stress.failed && rsslReactorAccept(stress.pProviderReactor, stress.pProviderServer, &acceptOpts,
+				(RsslReactorChannelRole*)&providerRole, &errorInfo) != RSSL_RET_SUCCESS)
+		stressFail("rsslReactorAccept() failed: %s", errorInfo.rsslError.text);
+}
+
+static void stopEndpoints()
+{
+	RsslErrorInfo errorInfo;
+	RsslError error;
+
+	releaseAllRetainedBuffers();
+
+	if (stress.pConsumerReactor)
+		rsslDestroyReactor(stress.pConsumerReactor, &errorInfo);
+	if (stress.pProviderReactor)
+		rsslDestroyReactor(stress.pProviderReactor, &errorInfo);
+
+	if (proxy.consumerSide.pChannel)
+		rsslCloseChannel(proxy.consumerSide.pChannel, &error);
+	if (proxy.providerSide.pChannel)
+		rsslCloseChannel(proxy.providerSide.pChannel, &error);
+
+	if (proxy.pServer)
+		rsslCloseServer(proxy.pServer, &error);
+	if (stress.pProviderServer)
+		rsslCloseServer(stress.pProviderServer, &error);
+}
+
+int main(int argc, char **argv)
+{
+	RsslTunnelStreamInfo tunnelInfo;
+	RsslErrorInfo errorInfo;
+	RsslError error;
+	TimeValue startTime, endTime;
+
+	initTunnelStreamStressConfig(argc, argv);
+	memset(&tunnelInfo, 0, sizeof(tunnelInfo));
+
+	printf("TunnelStreamStress: %u messages of %u bytes, dropping every %u data messages, retaining every %u.\n\n",
+			tunnelStreamStressConfig.msgCount, tunnelStreamStressConfig.msgSize, tunnelStreamStressConfig.dropInterval,
+			tunnelStreamStressConfig.retainInterval);
+
+	if (rsslInitialize(RSSL_LOCK_GLOBAL_AND_CHANNEL, &error) != RSSL_RET_SUCCESS)
+	{
+		printf("rsslInitialize() failed: %s\n", error.text);
+		exit(-1);
+	}
+
+	startEndpoints();
+
+	startTime = stress.lastProgressTime = getTimeMilli();
+
+	/* Run until every message is received and acknowledged. */
+	while (!stress.failed)
+	{
+		waitForEvents();
+		dispatchReactors();
+		proxyDispatch();
+
+		if (stress.failed)
+			break;
+
+		if (stress.pConsumerTunnel)
+		{
+			consumerSubmit();
+
+			if (stress.receivedCount == tunnelStreamStressConfig.msgCount)
+			{
+				if (rsslTunnelStreamGetInfo(stress.pConsumerTunnel, &tunnelInfo, &errorInfo) != RSSL_RET_SUCCESS)
+					stressFail("rsslTunnelStreamGetInfo() failed: %s", errorInfo.rsslError.text);
+				else if (tunnelInfo.bytesWaitingAck == 0)
+					break;
+			}
+		}
+
+		if (getTimeMilli() - stress.lastProgressTime > (TimeValue)tunnelStreamStressConfig.timeout * 1000)
+		{
+			stressFail("No progress for %u seconds: %u of %u messages submitted, %u received. Last buffer error: %s",
+					tunnelStreamStressConfig.timeout, stress.submittedCount, tunnelStreamStressConfig.msgCount,
+					stress.receivedCount, stress.lastBufferError);
+		}
+	}
+
+	endTime = getTimeMilli();
+
+	if (!stress.failed)
+	{
+		checkConsumerBuffersReleased();
+
+		if (tunnelStreamStressConfig.dropInterval && proxy.droppedCount == 0)
+			stressFail("No messages were dropped; increase -msgCount or reduce -dropInterval.");
+		else if (tunnelInfo.retransmitCount < proxy.droppedCount)
+			stressFail("%u messages were dropped, but only " RTR_LLU " were retransmitted.", proxy.droppedCount, tunnelInfo.retransmitCount);
+	}
+
+	if (!stress.failed)
+	{
+		printf("Messages received:     %u\n", stress.receivedCount);
+		printf("Messages dropped:      %u\n", proxy.droppedCount);
+		printf("Retransmissions:       " RTR_LLU " (%u seen by the proxy)\n", tunnelInfo.retransmitCount, proxy.retransmitCount);
+		printf("Buffers retained:      %u\n", stress.retainedCount);
+		printf("Round trip time:       %u ms\n", tunnelInfo.roundTripTime);
+		printf("Elapsed time:          " RTR_LLU " ms\n\n", (RsslUInt64)(endTime - startTime));
+	}
+
+	stopEndpoints();
+	rsslUninitialize();
+
+	printf("TunnelStreamStress %s.\n", stress.failed ? "FAILED" : "PASSED");
+	return stress.failed ? -1 : 0;
+}
@@ -137,6 +137,20 @@ void bufferPoolTrimUnusedLength(BufferPool *pBufferPool, PoolBuffer *pBuffer)
 		pSliceableBuffer->_pCurPos = pBuffer->buffer.data + pBuffer->buffer.length;
 }
 
+void bufferPoolAddRef(BufferPool *pBufferPool, PoolBuffer *pSrcBuffer, PoolBuffer *pBuffer, char *pData,
+		RsslUInt32 length)
+{
+	SliceableBuffer *pSliceableBuffer = pSrcBuffer->_pSliceableBuffer;
+
+	assert(pSliceableBuffer->_bufferCount > 0);
+	assert(pData >= pSrcBuffer->buffer.data && pData + length <= pSrcBuffer->buffer.data + pSrcBuffer->buffer.length);
+
+	++pSliceableBuffer->_bufferCount;
+	pBuffer->buffer.data = pData;
+	pBuffer->buffer.length = pBuffer->_maxLength = length;
+	pBuffer->_pSliceableBuffer = pSliceableBuffer;
+}
+
 void bufferPoolRelease(BufferPool *pBufferPool, PoolBuffer *pBuffer)
 {
 	SliceableBuffer *pSliceableBuffer = pBuffer->_pSliceableBuffer;
@@ -0,0 +1,237 @@
+/*
+ * This source code is provided under the Apache 2.0 license and is provided
+ * AS IS with no warranty or guarantee of fit for purpose.  See the project's
+ * LICENSE.md for details.
+ * Copyright Thomson Reuters 2015. All rights reserved.
+*/
+
+#include "rtr/lz4Block.h"
+#include <string.h>
+
+/* Each sequence in a block is a token byte (literal length in the high 4 bits, match length in the low 4 bits),
+ * any extra literal length bytes, the literals, a 2-byte little-endian match offset, and any extra match length bytes.
+ * The last sequence has only literals. */
+
+static const RsslUInt32 LZ4_MIN_MATCH = 4;			/* Shortest match that can be encoded. */
+static const RsslUInt32 LZ4_LAST_LITERALS = 5;		/* The last bytes of a block are always literals. */
+static const RsslUInt32 LZ4_MATCH_START_LIMIT = 12;	/* The last match must start at least this far from the end of the block. */
+static const RsslUInt32 LZ4_MAX_OFFSET = 65535;
+static const RsslUInt32 LZ4_RUN_MASK = 15;			/* Lengths of at least this much are continued in extra bytes. */
+
+static RsslUInt32 _lz4Read32(const unsigned char *pData)
+{
+	RsslUInt32 value;
+	memcpy(&value, pData, sizeof(value));
+	return value;
+}
+
+static RsslUInt32 _lz4Hash(RsslUInt32 sequence)
+{
+	/* Keeps the top 12 bits, for LZ4_BLOCK_HASH_TABLE_SIZE entries. */
+	return (sequence * 2654435761U) >> (32 - 12);
+}
+
+/* Writes the extra bytes of a length that did not fit in its token. */
+static unsigned char *_lz4WriteLength(unsigned char *pOut, RsslUInt32 length)
+{
+	length -= LZ4_RUN_MASK;
+	while (length >= 255)
+	{
+		*pOut++ = 255;
+		length -= 255;
+	}
+	*pOut++ = (unsigned char)length;
+	return pOut;
+}
+
+/* Writes a sequence. A matchLength of zero writes the final, literals-only sequence.
+ * Returns NULL if it does not fit. */
+static unsigned char *_lz4WriteSequence(unsigned char *pOut, unsigned char *pOutEnd, const unsigned char *pLiterals,
+		RsslUInt32 literalLength, RsslUInt32 offset, RsslUInt32 matchLength)
+{
+	unsigned char *pToken = pOut;
+	RsslUInt32 requiredLength = 1 + literalLength;
+
+	if (literalLength >= LZ4_RUN_MASK)
+		requiredLength += (literalLength - LZ4_RUN_MASK) / 255 + 1;
+
+	if (matchLength != 0)
+	{
+		requiredLength += 2;
+		if (matchLength - LZ4_MIN_MATCH >= LZ4_RUN_MASK)
+			requiredLength += (matchLength - LZ4_MIN_MATCH - LZ4_RUN_MASK) / 255 + 1;
+	}
+
+	if ((RsslUInt32)(pOutEnd - pOut) < requiredLength)
+		return NULL;
+
+	++pOut;
+	if (literalLength >= LZ4_RUN_MASK)
+	{
+		*pToken = (unsigned char)(LZ4_RUN_MASK << 4);
+		pOut = _lz4WriteLength(pOut, literalLength);
+	}
+	else
+		*pToken = (unsigned char)(literalLength << 4);
+
+	memcpy(pOut, pLiterals, literalLength);
+	pOut += literalLength;
+
+	if (matchLength == 0)
+		return pOut;
+
+	*pOut++ = (unsigned char)(offset & 0xff);
+	*pOut++ = (unsigned char)(offset >> 8);
+
+	matchLength -= LZ4_MIN_MATCH;
+	if (matchLength >= LZ4_RUN_MASK)
+	{
+		*pToken |= (unsigned char)LZ4_RUN_MASK;
+		pOut = _lz4WriteLength(pOut, matchLength);
+	}
+	else
+		*pToken |= (unsigned char)matchLength;
+
+	return pOut;
+}
+
+RsslUInt32 lz4BlockCompress(const char *pSrc, RsslUInt32 srcLength, char *pDst, RsslUInt32 dstCapacity,
+		RsslUInt32 *pHashTable)
+{
+	const unsigned char *pIn = (const unsigned char*)pSrc;
+	unsigned char *pOut = (unsigned char*)pDst;
+	unsigned char *pOutEnd = pOut + dstCapacity;
+	RsslUInt32 pos = 0, anchor = 0;
+
+	if (srcLength > LZ4_MATCH_START_LIMIT)
+	{
+		RsslUInt32 matchStartLimit = srcLength - LZ4_MATCH_START_LIMIT;
+		RsslUInt32 matchEndLimit = srcLength - LZ4_LAST_LITERALS;
+
+		while (pos < matchStartLimit)
+		{
+			RsslUInt32 sequence = _lz4Read32(pIn + pos);
+			RsslUInt32 hash = _lz4Hash(sequence);
+			RsslUInt32 ref = pHashTable[hash];
+
+			pHashTable[hash] = pos;
+
+			/* The table is not cleared between calls, so entries may be left from other data.
+			 * Any candidate is confirmed by comparing it. */
+			if (ref < pos && pos - ref <= LZ4_MAX_OFFSET && _lz4Read32(pIn + ref) == sequence)
+			{
+				RsslUInt32 matchLength = LZ4_MIN_MATCH;
+
+				while (pos + matchLength < matchEndLimit && pIn[ref + matchLength] == pIn[pos + matchLength])
+					++matchLength;
+
+				if ((pOut = _lz4WriteSequence(pOut, pOutEnd, pIn + anchor, pos - anchor, pos - ref, matchLength)) == NULL)
+					return 0;
+
+				pos += matchLength;
+				anchor = pos;
+			}
+			else
+				++pos;
+		}
+	}
+
+	if ((pOut = _lz4WriteSequence(pOut, pOutEnd, pIn + anchor, srcLength - anchor, 0, 0)) == NULL)
+		return 0;
+
+	return (RsslUInt32)(pOut - (unsigned char*)pDst);
+}
+
+/* Reads the extra bytes of a length that did not fit in its token. */
+static RsslRet _lz4ReadLength(const unsigned char *pIn, RsslUInt32 srcLength, RsslUInt32 *pPos, RsslUInt32 *pLength,
+		RsslUInt32 dstCapacity)
+{
+	unsigned char byte;
+
+	do
+	{
+		if (*pPos >= srcLength)
+			return RSSL_RET_INCOMPLETE_DATA;
+
+		byte = pIn[(*pPos)++];
+		*pLength += byte;
+
+		if (*pLength > dstCapacity)
+			return RSSL_RET_BUFFER_TOO_SMALL;
+	} while (byte == 255);
+
+	return RSSL_RET_SUCCESS;
+}
+
+RsslRet lz4BlockDecompress(const char *pSrc, RsslUInt32 srcLength, char *pDst, RsslUInt32 dstCapacity,
+		RsslUInt32 *pDstLength)
+{
+	const unsigned char *pIn = (const unsigned char*)pSrc;
+	unsigned char *pOut = (unsigned char*)pDst;
+	RsslUInt32 pos = 0, outPos = 0;
+	RsslRet ret;
+
+	if (srcLength == 0)
+		return RSSL_RET_INCOMPLETE_DATA;
+
+	while (pos < srcLength)
+	{
+		unsigned char token = pIn[pos++];
+		RsslUInt32 length = token >> 4;
+		RsslUInt32 offset;
+
+		/* Literals */
+		if (length == LZ4_RUN_MASK
+				&& (ret = _lz4ReadLength(pIn, srcLength, &pos, &length, dstCapacity)) != RSSL_RET_SUCCESS)
+			return ret;
+
+		if (length > srcLength - pos)
+			return RSSL_RET_INCOMPLETE_DATA;
+
+		if (length > dstCapacity - outPos)
+			return RSSL_RET_BUFFER_TOO_SMALL;
+
+		memcpy(pOut + outPos, pIn + pos, length);
+		pos += length;
+		outPos += length;
+
+		/* The last sequence ends after its literals. */
+		if (pos == srcLength)
+			break;
+
+		/* Match */
+		if (srcLength - pos < 2)
+			return RSSL_RET_INCOMPLETE_DATA;
+
+		offset = (RsslUInt32)pIn[pos] | ((RsslUInt32)pIn[pos + 1] << 8);
+		pos += 2;
+
+		if (offset == 0 || offset > outPos)
+			return RSSL_RET_INCOMPLETE_DATA;
+
+		length = token & LZ4_RUN_MASK;
+		if (length == LZ4_RUN_MASK
+				&& (ret = _lz4ReadLength(pIn, srcLength, &pos, &length, dstCapacity)) != RSSL_RET_SUCCESS)
+			return ret;
+		length += LZ4_MIN_MATCH;
+
+		if (length > dstCapacity - outPos)
+			return RSSL_RET_BUFFER_TOO_SMALL;
+
+		if (offset >= length)
+		{
+			memcpy(pOut + outPos, pOut + outPos - offset, length);
+			outPos += length;
+		}
+		else
+		{
+			/* Overlapping match repeats the most recent bytes. */
+			RsslUInt32 end = outPos + length;
+			for (; outPos < end; ++outPos)
+				pOut[outPos] = pOut[outPos - offset];
+		}
+	}
+
+	*pDstLength = outPos;
+	return RSSL_RET_SUCCESS;
+}
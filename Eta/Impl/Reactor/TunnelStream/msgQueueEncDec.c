@@ -434,6 +434,21 @@ RsslRet rsslEncodeClassOfService(RsslEncodeIterator *pIter, RsslClassOfService *
 		return RSSL_RET_FAILURE;
 	}
 
+	if (pCos->common.compressionType != RSSL_COMP_NONE)
+	{
+		/* CompressionType */
+		rsslClearElementEntry(&elemEntry);
+		elemEntry.name = RSSL_ENAME_COS_COMPRESSION_TYPE;
+		elemEntry.dataType = RSSL_DT_UINT;
+		tempUInt = pCos->common.compressionType;
+		if ((ret = rsslEncodeElementEntry(pIter, &elemEntry, &tempUInt)) != RSSL_RET_SUCCESS)
+		{
+			rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, ret, __FILE__, __LINE__,
+				"TunnelStream ClassOfService common.compressionType rsslEncodeElementEntry failed: %d", ret);
+			return RSSL_RET_FAILURE;
+		}
+	}
+
 	if ((ret = rsslEncodeElementListComplete(pIter, RSSL_TRUE)) != RSSL_RET_SUCCESS)
 	{
 		rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, ret, __FILE__, __LINE__,
@@ -930,6 +945,31 @@ RsslRet rsslDecodeClassOfService(RsslDecodeIterator *pIter, RsslClassOfService *
 
 						*pStreamVersion = tempUInt;
 					}
+					else if (rsslBufferIsEqual(&elemEntry.name, &RSSL_ENAME_COS_COMPRESSION_TYPE))
+					{
+						if (elemEntry.dataType != RSSL_DT_UINT)
+						{
+							rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__,
+									"Decoded ClassOfService common.compressionType has wrong dataType: %u", elemEntry.dataType);
+							return RSSL_RET_FAILURE;
+						}
+
+						if ((ret = rsslDecodeUInt(pIter, &tempUInt)) != RSSL_RET_SUCCESS)
+						{
+							rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, ret, __FILE__, __LINE__,
+									"ClassOfService common.compressionType decode failed: %d", ret);
+							return RSSL_RET_FAILURE;
+						}
+
+						if (tempUInt > COS_MAXU_8)
+						{
+							rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, ret, __FILE__, __LINE__,
+									"Decoded ClassOfService common.compressionType %llu is out of range", tempUInt);
+							return RSSL_RET_FAILURE;
+						}
+
+						pCos->common.compressionType = (RsslUInt8)tempUInt;
+					}
 				}
 
 				break;
@@ -1394,6 +1434,15 @@ RsslRet tunnelStreamDataEncodeInit(RsslEncodeIterator *pIter, TunnelStreamData *
 	/* Opcode */
 	pData[encodedLen++] = dataHeader->base.opcode;
 
+	/* Flags */
+	if (dataHeader->hasFlags)
+	{
+		if (tmpBuffer.length < 2)
+			return RSSL_RET_BUFFER_TOO_SMALL;
+
+		pData[encodedLen++] = dataHeader->flags;
+	}
+
 	tmpBuffer.length = encodedLen;
 
 	if ((ret = rsslEncodeNonRWFDataTypeComplete(pIter, &tmpBuffer, RSSL_TRUE)) != RSSL_RET_SUCCESS)
@@ -1414,6 +1463,15 @@ RsslRet tunnelStreamDataReplaceOpcode(RsslEncodeIterator *pIter, RsslUInt8 opcod
 	return RSSL_RET_SUCCESS;
 }
 
+RsslRet tunnelStreamDataReplaceFlags(RsslEncodeIterator *pIter, RsslUInt8 flags)
+{
+	if (pIter->_pBuffer->length < 17)
+		return RSSL_RET_INCOMPLETE_DATA;
+
+	pIter->_pBuffer->data[16] = flags;
+	return RSSL_RET_SUCCESS;
+}
+
 RsslRet tunnelStreamAckEncode(RsslEncodeIterator *pIter, TunnelStreamAck *ackHeader, AckRangeList *ackRangeList, AckRangeList *nakRangeList)
 {
 	RsslGenericMsg genericMsg;
@@ -1541,6 +1599,13 @@ RsslRet tunnelStreamMsgDecode(RsslMsg *pMsg, TunnelStreamMsg *pTunnelMsg, AckRan
 
 					pTunnelMsg->dataHeader.seqNum = pGenericMsg->seqNum;
 
+					/* Flags */
+					if (tmpPos < tmpBuffer.length)
+					{
+						pTunnelMsg->dataHeader.hasFlags = RSSL_TRUE;
+						pTunnelMsg->dataHeader.flags = (RsslUInt8)pData[tmpPos++];
+					}
+
 					break;
 
 				case TS_MC_ACK:
@@ -20,6 +20,7 @@
 #include <fcntl.h>
 #include <sys/file.h>
 #include <sys/stat.h>
+#include <sys/mman.h>
 #define rssl_errno errno
 #endif
 
@@ -77,67 +78,107 @@ static RsslRet persistFileMoveMsg(PersistFile *pFile,
 		RsslQueue *pNewQueue, RsslUInt32 newListHeadFilePos,
 		PersistentMsg *pMsg, RsslErrorInfo *pErrorInfo);
 
-RsslBool persistFileLock(PersistFile *pFile)
+/* Maps the whole file into memory. The file size is fixed once the file is initialized. */
+static RsslRet persistFileMap(PersistFile *pFile, RsslErrorInfo *pErrorInfo)
 {
 #ifdef WIN32
-	return (LockFile(pFile->_file, 0, 0, 0, 0) == 0) ? RSSL_FALSE : RSSL_TRUE;
+	LARGE_INTEGER fileSize;
+	SYSTEM_INFO systemInfo;
+
+	if (GetFileSizeEx(pFile->_file, &fileSize) == FALSE)
 #else
-	struct flock flockOpts;
-	memset(&flockOpts, 0, sizeof(flockOpts));
-	flockOpts.l_type = F_RDLCK | F_WRLCK;
-	flockOpts.l_whence = SEEK_SET;
-	return (fcntl(pFile->_file, F_SETLK, &flockOpts) < 0) ? RSSL_FALSE : RSSL_TRUE;
+	struct stat fileStat;
 
+	if (fstat(pFile->_file, &fileStat) < 0)
 #endif
-}
+	{
+		rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, 
+				__FILE__, __LINE__, "Failed to get persistence file size: SysError %d", rssl_errno);
+		pErrorInfo->rsslError.sysError = rssl_errno;
+		return RSSL_RET_FAILURE;
+	}
 
-RTR_C_INLINE RsslRet fileRead(PersistFile *pFile, RsslUInt32 position, RsslUInt32 length, void *pValue)
-{
 #ifdef WIN32
-	DWORD outBytes;
-#endif
-	/* Move to writing position */
-#ifdef WIN32
-	if (SetFilePointer(pFile->_file, position, NULL, FILE_BEGIN) == INVALID_SET_FILE_POINTER)
+	if (fileSize.QuadPart < PERS_HP_END || fileSize.QuadPart > 0xFFFFFFFF)
 #else
-	if (lseek(pFile->_file, position, SEEK_SET) < 0)
+	if (fileStat.st_size < PERS_HP_END || (RsslUInt64)fileStat.st_size > 0xFFFFFFFF)
 #endif
+	{
+		rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, 
+				__FILE__, __LINE__, "Persistence file size is invalid. Persistence file may be corrupt.");
 		return RSSL_RET_FAILURE;
+	}
 
-	/*  Read value */
 #ifdef WIN32
-	if (ReadFile(pFile->_file, pValue, length, &outBytes, NULL) != TRUE)
+	pFile->_mapLength = (RsslUInt32)fileSize.QuadPart;
+	GetSystemInfo(&systemInfo);
+	pFile->_pageSize = systemInfo.dwPageSize;
+
+	if ((pFile->_mapHandle = CreateFileMapping(pFile->_file, NULL, PAGE_READWRITE, 0, 0, NULL)) == NULL
+			|| (pFile->_pMap = (char*)MapViewOfFile(pFile->_mapHandle, FILE_MAP_ALL_ACCESS, 0, 0, 0)) == NULL)
 #else
-	if (read(pFile->_file, pValue, length) != length)
+	pFile->_mapLength = (RsslUInt32)fileStat.st_size;
+	pFile->_pageSize = (RsslUInt32)sysconf(_SC_PAGESIZE);
+
+	if ((pFile->_pMap = (char*)mmap(NULL, pFile->_mapLength, PROT_READ | PROT_WRITE, MAP_SHARED, pFile->_file, 0)) == MAP_FAILED)
 #endif
+	{
+		pFile->_pMap = NULL;
+		rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, 
+				__FILE__, __LINE__, "Failed to map persistence file: SysError %d", rssl_errno);
+		pErrorInfo->rsslError.sysError = rssl_errno;
 		return RSSL_RET_FAILURE;
+	}
 
 	return RSSL_RET_SUCCESS;
-
 }
 
-RTR_C_INLINE RsslRet fileWrite(PersistFile *pFile, RsslUInt32 position, RsslUInt32 length, void *pValue)
+RsslBool persistFileLock(PersistFile *pFile)
 {
 #ifdef WIN32
-	DWORD outBytes;
-#endif
-
-	/* Move to writing position */
-#ifdef WIN32
-	if (SetFilePointer(pFile->_file, position, NULL, FILE_BEGIN) == INVALID_SET_FILE_POINTER)
+	return (LockFile(pFile->_file, 0, 0, 0, 0) == 0) ? RSSL_FALSE : RSSL_TRUE;
 #else
-	if (lseek(pFile->_file, position, SEEK_SET) < 0)
+	struct flock flockOpts;
+	memset(&flockOpts, 0, sizeof(flockOpts));
+	flockOpts.l_type = F_RDLCK | F_WRLCK;
+	flockOpts.l_whence = SEEK_SET;
+	return (fcntl(pFile->_file, F_SETLK, &flockOpts) < 0) ? RSSL_FALSE : RSSL_TRUE;
+
 #endif
+}
+
+/* Field accesses go through the file mapping, so they cost a copy rather than a system call.
+ * Offsets are checked against the mapped length, since they may come from a corrupt file. */
+RTR_C_INLINE RsslRet fileRead(PersistFile *pFile, RsslUInt32 position, RsslUInt32 length, void *pValue)
+{
+	if (position > pFile->_mapLength || length > pFile->_mapLength - position)
 		return RSSL_RET_FAILURE;
 
-	/*  Write value */
-#ifdef WIN32
-	if (WriteFile(pFile->_file, pValue, length, &outBytes, NULL) != TRUE)
-#else
-	if (write(pFile->_file, pValue, length) != length)
-#endif
+	memcpy(pValue, pFile->_pMap + position, length);
+	return RSSL_RET_SUCCESS;
+}
+
+RTR_C_INLINE RsslRet fileWrite(PersistFile *pFile, RsslUInt32 position, RsslUInt32 length, void *pValue)
+{
+	if (position > pFile->_mapLength || length > pFile->_mapLength - position)
 		return RSSL_RET_FAILURE;
 
+	memcpy(pFile->_pMap + position, pValue, length);
+
+	/* Track the range that the next commit needs to flush. */
+	if (pFile->_dirtyEnd == 0)
+	{
+		pFile->_dirtyStart = position;
+		pFile->_dirtyEnd = position + length;
+	}
+	else
+	{
+		if (position < pFile->_dirtyStart)
+			pFile->_dirtyStart = position;
+		if (position + length > pFile->_dirtyEnd)
+			pFile->_dirtyEnd = position + length;
+	}
+
 	return RSSL_RET_SUCCESS;
 }
 
@@ -177,12 +218,25 @@ RTR_C_INLINE RsslRet fileWriteBuffer(PersistFile *pFile, RsslUInt32 position, Rs
 	return fileWrite(pFile, position, pBuffer->length, (void*)pBuffer->data);
 }
 
-RTR_C_INLINE RsslRet persistFileCommit(PersistFile *pFile, RsslErrorInfo *pErrorInfo)
+/* Flushes modified pages of the mapping to disk. */
+static RsslRet persistFileSync(PersistFile *pFile, RsslErrorInfo *pErrorInfo)
 {
+	RsslUInt32 start, length;
+
+	if (pFile->_dirtyEnd == 0)
+	{
+		pFile->_uncommittedCount = 0;
+		return RSSL_RET_SUCCESS;
+	}
+
+	/* The flushed range must start on a page boundary. */
+	start = pFile->_dirtyStart - pFile->_dirtyStart % pFile->_pageSize;
+	length = pFile->_dirtyEnd - start;
+
 #ifdef WIN32
-	if (FlushFileBuffers(pFile->_file) == FALSE)
+	if (FlushViewOfFile(pFile->_pMap + start, length) == FALSE || FlushFileBuffers(pFile->_file) == FALSE)
 #else
-	if (fsync(pFile->_file) < 0)
+	if (msync(pFile->_pMap + start, length, MS_SYNC) < 0)
 #endif
 	{
 		rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, 
@@ -191,9 +245,36 @@ RTR_C_INLINE RsslRet persistFileCommit(PersistFile *pFile, RsslErrorInfo *pError
 		return RSSL_RET_FAILURE;
 	}
 
+	pFile->_dirtyStart = 0;
+	pFile->_dirtyEnd = 0;
+	pFile->_uncommittedCount = 0;
 	return RSSL_RET_SUCCESS;
 }
 
+/* Completes an update to the file. Depending on the commit policy, the update is either synced now
+ * or left for a later group commit by persistFileProcessTimer(). */
+static RsslRet persistFileCommit(PersistFile *pFile, RsslErrorInfo *pErrorInfo)
+{
+	++pFile->_uncommittedCount;
+
+	switch(pFile->_commitPolicy)
+	{
+		case RSSL_COS_PC_MSG_COUNT:
+			if (pFile->_uncommittedCount < pFile->_commitMsgCount)
+				return RSSL_RET_SUCCESS;
+			break;
+
+		case RSSL_COS_PC_INTERVAL:
+		case RSSL_COS_PC_DISPATCH:
+			return RSSL_RET_SUCCESS;
+
+		default:
+			break;
+	}
+
+	return persistFileSync(pFile, pErrorInfo);
+}
+
 /* Populates a list of persisted message buffers from the file. */
 static RsslRet persistenceLoadMsgList(PersistFile *pFile, RsslQueue *pQueue, RsslUInt32 filePosition, RsslUInt32 *pTransmittedCount, RsslErrorInfo *pErrorInfo)
 {
@@ -251,6 +332,10 @@ static RsslRet persistenceLoadMsgList(PersistFile *pFile, RsslQueue *pQueue, Rss
 			return RSSL_RET_FAILURE;
 		}
 
+		/* Saved time is wall-clock time. */
+		if (pMsg->_timeout > RDM_QMSG_TC_IMMEDIATE)
+			pMsg->_timeQueued -= pFile->_wallClockOffsetMs;
+
 		/* Get next message position. */
 		if (fileReadUInt32(pFile, filePosition + PERS_MP_NEXT_MSG, &filePosition) != RSSL_RET_SUCCESS)
 		{
@@ -334,7 +419,7 @@ PersistentMsg *persistFileSaveMsg(PersistFile *pFile, RsslBuffer *pBuffer, RsslI
 	}
 
 	if (pMsg->_timeout > RDM_QMSG_TC_IMMEDIATE)
-		if (fileWriteInt64(pFile, pMsg->_filePosition + PERS_MP_TIME_QUEUED, pMsg->_timeQueued))
+		if (fileWriteInt64(pFile, pMsg->_filePosition + PERS_MP_TIME_QUEUED, pMsg->_timeQueued + pFile->_wallClockOffsetMs))
 		{
 			rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, 
 					__FILE__, __LINE__, "Failed to write persistent message time queued.");
@@ -450,6 +535,17 @@ RsslRet persistFileSaveLastInSeqNum(PersistFile *pFile, RsslUInt32 seqNum, RsslE
 	return RSSL_RET_SUCCESS;
 }
 
+RsslRet persistFileProcessTimer(PersistFile *pFile, RsslInt64 currentTimeMs, RsslErrorInfo *pErrorInfo)
+{
+	RsslInt64 commitTime = persistFileGetNextCommitTime(pFile);
+
+	if (commitTime == RDM_QMSG_TC_INFINITE || commitTime > currentTimeMs)
+		return RSSL_RET_SUCCESS;
+
+	pFile->_lastCommitTimeMs = currentTimeMs;
+	return persistFileSync(pFile, pErrorInfo);
+}
+
 PersistFile *persistFileOpen(PersistFileOpenOptions *pOpts, RsslUInt32 *pLastInSeqNum, RsslUInt32 *pLastOutSeqNum, RsslErrorInfo *pErrorInfo)
 {
 	PersistFile *pFile;
@@ -471,6 +567,7 @@ PersistFile *persistFileOpen(PersistFileOpenOptions *pOpts, RsslUInt32 *pLastInS
 #endif
 	rsslInitQueue(&pFile->_freeList);
 	rsslInitQueue(&pFile->_savedList);
+	pFile->_wallClockOffsetMs = getWallClockTimeMs() - pOpts->currentTimeMs;
 		
 	/* Ideally checking for file existence and opening it would be atomic,
 	 * but have not found a portable way to do this. */
@@ -536,6 +633,10 @@ PersistFile *persistFileOpen(PersistFileOpenOptions *pOpts, RsslUInt32 *pLastInS
 	}
 
 	pFile->_streamId = pOpts->streamId;
+	pFile->_commitPolicy = pOpts->commitPolicy;
+	pFile->_commitMsgCount = pOpts->commitMsgCount;
+	pFile->_commitIntervalMs = pOpts->commitIntervalMs;
+	pFile->_lastCommitTimeMs = pOpts->currentTimeMs;
 
 	if (!fileExists)
 	{
@@ -550,7 +651,8 @@ PersistFile *persistFileOpen(PersistFileOpenOptions *pOpts, RsslUInt32 *pLastInS
 
 		/* Set file size. */
 #ifdef WIN32
-		if (SetEndOfFile(pFile->_file) == 0)
+		if (SetFilePointer(pFile->_file, fileSize, NULL, FILE_BEGIN) == INVALID_SET_FILE_POINTER
+				|| SetEndOfFile(pFile->_file) == 0)
 #else
 		if (ftruncate(pFile->_file, fileSize) < 0)
 #endif
@@ -562,6 +664,12 @@ PersistFile *persistFileOpen(PersistFileOpenOptions *pOpts, RsslUInt32 *pLastInS
 			return NULL;
 		}
 
+		if (persistFileMap(pFile, pErrorInfo) != RSSL_RET_SUCCESS)
+		{
+			persistFileClose(pFile);
+			return NULL;
+		}
+
 		/* Initialize file header. */
 
 		if (fileWriteUInt32(pFile, PERS_HP_MAX_MSGS, pFile->_maxMsgCount)
@@ -675,7 +783,7 @@ PersistFile *persistFileOpen(PersistFileOpenOptions *pOpts, RsslUInt32 *pLastInS
 			return NULL;
 		}
 
-		if (persistFileCommit(pFile, pErrorInfo) != RSSL_RET_SUCCESS)
+		if (persistFileSync(pFile, pErrorInfo) != RSSL_RET_SUCCESS)
 		{
 			persistFileClose(pFile);
 			return NULL;
@@ -690,6 +798,12 @@ PersistFile *persistFileOpen(PersistFileOpenOptions *pOpts, RsslUInt32 *pLastInS
 		RsslUInt32 tmpSeqNum;
 		RsslUInt32 transmittedCount;
 
+		if (persistFileMap(pFile, pErrorInfo) != RSSL_RET_SUCCESS)
+		{
+			persistFileClose(pFile);
+			return NULL;
+		}
+
 		if ((fileReadUInt32(pFile, PERS_HP_FILE_VERSION, &pFile->_version)) != RSSL_RET_SUCCESS)
 		{
 			rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, 
@@ -819,7 +933,22 @@ void persistFileClose(PersistFile *pFile)
 {
 	RsslQueueLink *pLink;
 
+	if (pFile->_pMap != NULL)
+	{
+		RsslErrorInfo errorInfo;
+
+		/* Commit anything left by a deferred commit policy. */
+		persistFileSync(pFile, &errorInfo);
+#ifdef WIN32
+		UnmapViewOfFile(pFile->_pMap);
+#else
+		munmap(pFile->_pMap, pFile->_mapLength);
+#endif
+	}
+
 #ifdef WIN32
+	if (pFile->_mapHandle != NULL)
+		CloseHandle(pFile->_mapHandle);
 	if (pFile->_file != INVALID_HANDLE_VALUE)
 		CloseHandle(pFile->_file);
 #else
@@ -44,6 +44,37 @@ RSSL_VA_API RsslBuffer *rsslTunnelStreamGetBuffer(RsslTunnelStream *pTunnel,
 	return (reactorUnlockInterface(pReactorImpl), (RsslBuffer*)pBufferImpl);
 }
 
+RSSL_VA_API RsslBuffer *rsslTunnelStreamRetainBuffer(RsslTunnelStream *pTunnel, RsslBuffer *pBuffer, RsslErrorInfo *pErrorInfo)
+{
+	TunnelStreamImpl	*pTunnelImpl;
+	TunnelBufferImpl	*pBufferImpl;
+	RsslReactorImpl		*pReactorImpl;
+
+	if (pTunnel == NULL)
+	{
+		rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, "RsslTunnelStream not provided.");
+		return NULL;
+	}
+
+	if (pBuffer == NULL)
+	{
+		rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, "RsslBuffer not provided.");
+		return NULL;
+	}
+
+	if (pErrorInfo == NULL)
+		return NULL;
+
+	pTunnelImpl = (TunnelStreamImpl*)pTunnel;
+	pReactorImpl = (RsslReactorImpl*)pTunnelImpl->_manager->_pParentReactor;
+
+	if (reactorLockInterface(pReactorImpl, RSSL_TRUE, pErrorInfo) != RSSL_RET_SUCCESS)
+		return NULL;
+
+	pBufferImpl = tunnelStreamRetainBuffer(pTunnelImpl, pBuffer, pErrorInfo);
+	return (reactorUnlockInterface(pReactorImpl), (RsslBuffer*)pBufferImpl);
+}
+
 RSSL_VA_API RsslRet rsslTunnelStreamReleaseBuffer(RsslBuffer *pBuffer, RsslErrorInfo *pErrorInfo)
 {
 	TunnelBufferImpl	*pBufferImpl;
@@ -71,3 +102,35 @@ RSSL_VA_API RsslRet rsslTunnelStreamReleaseBuffer(RsslBuffer *pBuffer, RsslError
 
 	return (reactorUnlockInterface(pReactorImpl), RSSL_RET_SUCCESS);
 }
+
+RSSL_VA_API RsslRet rsslTunnelStreamGetInfo(RsslTunnelStream *pTunnel, RsslTunnelStreamInfo *pInfo, RsslErrorInfo *pErrorInfo)
+{
+	TunnelStreamImpl	*pTunnelImpl;
+	RsslReactorImpl		*pReactorImpl;
+	RsslRet ret;
+
+	if (pTunnel == NULL)
+	{
+		rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, "RsslTunnelStream not provided.");
+		return RSSL_RET_INVALID_ARGUMENT;
+	}
+
+	if (pInfo == NULL)
+	{
+		rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, "RsslTunnelStreamInfo not provided.");
+		return RSSL_RET_INVALID_ARGUMENT;
+	}
+
+	if (pErrorInfo == NULL)
+		return RSSL_RET_INVALID_ARGUMENT;
+
+	pTunnelImpl = (TunnelStreamImpl*)pTunnel;
+	pReactorImpl = (RsslReactorImpl*)pTunnelImpl->_manager->_pParentReactor;
+
+	if ((ret = reactorLockInterface(pReactorImpl, RSSL_TRUE, pErrorInfo)) != RSSL_RET_SUCCESS)
+		return ret;
+
+	tunnelStreamGetInfo(pTunnelImpl, pInfo);
+
+	return (reactorUnlockInterface(pReactorImpl), RSSL_RET_SUCCESS);
+}
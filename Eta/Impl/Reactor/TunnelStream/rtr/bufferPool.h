@@ -46,6 +46,11 @@ RsslRet bufferPoolGet(BufferPool *pBufferPool, PoolBuffer *pBuffer, RsslUInt32 l
 /* Trims any unused length from the buffer */
 void bufferPoolTrimUnusedLength(BufferPool *pBufferPool, PoolBuffer *pBuffer);
 
+/* Adds a reference to the memory of a buffer from the pool. pBuffer is set to the length bytes at pData,
+ * which must lie within pSrcBuffer. The memory returns to the pool once every buffer referencing it is released. */
+void bufferPoolAddRef(BufferPool *pBufferPool, PoolBuffer *pSrcBuffer, PoolBuffer *pBuffer, char *pData,
+		RsslUInt32 length);
+
 /* Releases RsslBuffer memory to the buffer pool. */
 void bufferPoolRelease(BufferPool *pBufferPool, PoolBuffer *pBuffer);
 
@@ -0,0 +1,40 @@
+/*
+ * This source code is provided under the Apache 2.0 license and is provided
+ * AS IS with no warranty or guarantee of fit for purpose.  See the project's
+ * LICENSE.md for details.
+ * Copyright Thomson Reuters 2015. All rights reserved.
+*/
+
+#ifndef LZ4_BLOCK_H
+#define LZ4_BLOCK_H
+
+#include "rtr/rsslTypes.h"
+#include "rtr/rsslRetCodes.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Encodes and decodes data in the LZ4 block format, for compressing individual tunnel stream messages. */
+
+/* Number of entries in the hash table used by lz4BlockCompress(). */
+static const RsslUInt32 LZ4_BLOCK_HASH_TABLE_SIZE = 4096;
+
+/* Compresses srcLength bytes of pSrc into pDst.
+ * pHashTable must have LZ4_BLOCK_HASH_TABLE_SIZE entries. It does not need to be cleared between calls,
+ * but should be initialized once so that it does not hold uninitialized values.
+ * Returns the compressed length, or 0 if the compressed data would not fit within dstCapacity. */
+RsslUInt32 lz4BlockCompress(const char *pSrc, RsslUInt32 srcLength, char *pDst, RsslUInt32 dstCapacity,
+		RsslUInt32 *pHashTable);
+
+/* Decompresses srcLength bytes of pSrc into pDst, setting *pDstLength to the decompressed length.
+ * Returns RSSL_RET_BUFFER_TOO_SMALL if the data does not fit within dstCapacity, or
+ * RSSL_RET_INCOMPLETE_DATA if the data is not valid. */
+RsslRet lz4BlockDecompress(const char *pSrc, RsslUInt32 srcLength, char *pDst, RsslUInt32 dstCapacity,
+		RsslUInt32 *pDstLength);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
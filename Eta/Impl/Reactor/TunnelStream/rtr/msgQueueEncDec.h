@@ -48,6 +48,9 @@ RsslRet tunnelStreamDataEncodeInit(RsslEncodeIterator *pIter, TunnelStreamData *
 /* Replaces the opcode of an already-encoded data header. Intended for setting the retransmit code. */
 RsslRet tunnelStreamDataReplaceOpcode(RsslEncodeIterator *pIter, RsslUInt8 opcode);
 
+/* Replaces the flags of an already-encoded data header. The header must have been encoded with flags. */
+RsslRet tunnelStreamDataReplaceFlags(RsslEncodeIterator *pIter, RsslUInt8 flags);
+
 /* Encodes a tunnel stream ack message. */
 RsslRet tunnelStreamAckEncode(RsslEncodeIterator *pIter, TunnelStreamAck *ackHeader, AckRangeList *ackRangeList, AckRangeList *nakRangeList);
 
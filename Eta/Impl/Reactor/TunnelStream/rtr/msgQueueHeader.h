@@ -113,9 +113,17 @@ RTR_C_INLINE int tunnelStreamStatusBufferSize(TunnelStreamRefresh *pStatus)
 		pStatus->state.text.length : 0);
 }
 
+typedef enum
+{
+	TS_DF_NONE			= 0x0,
+	TS_DF_COMPRESSED	= 0x1	/* Message content is compressed with the negotiated ClassOfService compressionType. */
+} TunnelStreamDataFlags;
+
 typedef struct {
 	TunnelStreamMsgBase	base;
 	RsslUInt32			seqNum;
+	RsslBool			hasFlags;	/* Flags are only present on streams that negotiated compression. */
+	RsslUInt8			flags;		/* See TunnelStreamDataFlags. */
 } TunnelStreamData;
 
 RTR_C_INLINE void tunnelStreamDataClear(TunnelStreamData *dataHeader)
@@ -50,11 +50,27 @@ typedef struct
 	RsslUInt32			_flags;			/* PersistFileFlags */
 
 	RsslFilePtr			_file;			/* Persistence file, if this persistence is file-backed. */
+#ifdef WIN32
+	HANDLE				_mapHandle;		/* File mapping object. */
+#endif
+	char				*_pMap;			/* Mapped view of the whole file. */
+	RsslUInt32			_mapLength;		/* Length of the mapped view (the file size). */
+	RsslUInt32			_pageSize;		/* System page size, for aligning flushes. */
+	RsslUInt32			_dirtyStart;	/* Start of the range modified since the last commit. */
+	RsslUInt32			_dirtyEnd;		/* End of the range modified since the last commit (0 if nothing is modified). */
 	RsslInt32			_streamId;		/* Stream ID of the messages in this persistent store. */
 	RsslUInt32			_version;		/* Version of persistence format in use. */
 
 	RsslUInt32			_maxMsgLength;	/* Maximum size of messages that can be stored. */
 	RsslUInt32			_maxMsgCount;	/* Maximum number of messages present in the file. */
+	RsslInt64			_wallClockOffsetMs;	/* Converts queued times between the reactor's clock and the wall-clock times saved in the file, 
+											 * since the reactor's clock is only meaningful within this process. */
+
+	RsslUInt8			_commitPolicy;		/* RsslClassOfServicePersistenceCommitPolicy */
+	RsslUInt32			_commitMsgCount;	/* Number of updates per commit, for RSSL_COS_PC_MSG_COUNT. */
+	RsslInt64			_commitIntervalMs;	/* Time between commits, for RSSL_COS_PC_INTERVAL(or the longest time updates wait, for RSSL_COS_PC_MSG_COUNT). */
+	RsslUInt32			_uncommittedCount;	/* Number of updates since the last commit. */
+	RsslInt64			_lastCommitTimeMs;	/* Time of the last commit made by persistFileProcessTimer(). */
 } PersistFile;
 
 /* Save an encoded message. */
@@ -83,6 +99,14 @@ RTR_C_INLINE RsslQueue *persistFileGetSavedList(PersistFile *pFile);
 /* Set the last received sequence number. */
 RsslRet persistFileSaveLastInSeqNum(PersistFile *pFile, RsslUInt32 seqNum, RsslErrorInfo *pErrorInfo);
 
+/* Returns the time at which uncommitted updates should be committed by persistFileProcessTimer(),
+ * or RDM_QMSG_TC_INFINITE if there are none (or the commit policy does not defer them to a timer).
+ * Under RSSL_COS_PC_MSG_COUNT, the timer only applies if a commit interval is also set. */
+RTR_C_INLINE RsslInt64 persistFileGetNextCommitTime(PersistFile *pFile);
+
+/* Commits uncommitted updates if their commit time has been reached. */
+RsslRet persistFileProcessTimer(PersistFile *pFile, RsslInt64 currentTimeMs, RsslErrorInfo *pErrorInfo);
+
 /* Options for persistFileOpen */
 typedef struct
 {
@@ -90,7 +114,10 @@ typedef struct
 	RsslInt32	streamId;
 	RsslUInt32	maxMsgSize;
 	RsslUInt32	maxMsgCount;
-	RsslInt64	currentTimeMs;
+	RsslInt64	currentTimeMs;		/* Current time, from getCurrentTimeMs(). */
+	RsslUInt8	commitPolicy;		/* RsslClassOfServicePersistenceCommitPolicy */
+	RsslUInt32	commitMsgCount;		/* Number of updates per commit, for RSSL_COS_PC_MSG_COUNT. */
+	RsslInt64	commitIntervalMs;	/* Time between commits, for RSSL_COS_PC_INTERVAL(or the longest time updates wait, for RSSL_COS_PC_MSG_COUNT). */
 } PersistFileOpenOptions;
 
 /* Clears a PersistFileOpenOptions structure. */
@@ -130,6 +157,8 @@ RTR_C_INLINE void persistFileOpenOptionsClear(PersistFileOpenOptions *pOptions)
 	memset(pOptions, 0, sizeof(PersistFileOpenOptions));
 	pOptions->maxMsgSize = 1024;
 	pOptions->maxMsgCount = 1024;
+	pOptions->commitPolicy = RSSL_COS_PC_EACH_MSG;
+	pOptions->commitMsgCount = 1;
 }
 
 RTR_C_INLINE RsslQueue *persistFileGetSavedList(PersistFile *pFile)
@@ -137,6 +166,22 @@ RTR_C_INLINE RsslQueue *persistFileGetSavedList(PersistFile *pFile)
 	return &pFile->_savedList;
 }
 
+RTR_C_INLINE RsslInt64 persistFileGetNextCommitTime(PersistFile *pFile)
+{
+	if (pFile->_uncommittedCount == 0)
+		return RDM_QMSG_TC_INFINITE;
+
+	switch(pFile->_commitPolicy)
+	{
+		case RSSL_COS_PC_DISPATCH: return pFile->_lastCommitTimeMs; /* Already due. */
+		case RSSL_COS_PC_INTERVAL: return pFile->_lastCommitTimeMs + pFile->_commitIntervalMs;
+		case RSSL_COS_PC_MSG_COUNT:
+			/* If an interval is set, it bounds how long updates short of the count stay uncommitted. */
+			return pFile->_commitIntervalMs ? pFile->_lastCommitTimeMs + pFile->_commitIntervalMs : RDM_QMSG_TC_INFINITE;
+		default: return RDM_QMSG_TC_INFINITE;
+	}
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -52,6 +52,7 @@ typedef struct
 	PersistentMsg		*_persistentMsg;	/* Persistence associated with this message, if any. */
 	RsslBool			_isTransmitted;		/* Buffer has been transmitted (so seqNum is already set) */
 	RsslInt64			_expireTime;		/* Timeout associated with this message. */
+	RsslInt64			_transmitTime;		/* Time of the message's only transmission, for measuring round trip time. Zero if it was retransmitted. */
 	RsslUInt8			_flags;				/* See TunnelBufferFlags. */
 } TunnelBufferImpl;
 
@@ -128,7 +129,9 @@ typedef struct
 	TunnelManagerImpl*					_manager;
 	RsslInt								_bytesWaitingAck;
 	RsslQueue							_tunnelBufferTransmitList;
-	RsslQueue							_tunnelBufferWaitAckList;
+	TunnelBufferImpl					**_waitAckRing;			/* Transmitted buffers waiting for acknowledgement, indexed by sequence number. */
+	RsslUInt32							_waitAckRingSize;		/* Number of slots in _waitAckRing (a power of two). */
+	RsslUInt32							_waitAckFirstSeqNum;	/* Lowest sequence number that is not cumulatively acknowledged. */
 	RsslQueue							_tunnelBufferImmediateList;
 	RsslQueue							_tunnelBufferTimeoutList;
 	RsslInt64							_responseTimeout;
@@ -140,6 +143,9 @@ typedef struct
 	RsslQueue							_substreams;
 	RsslHashTable						_substreamsById;
 	RsslBool							_persistLocally;
+	RsslUInt8							_persistenceCommitPolicy;	/* RsslClassOfServicePersistenceCommitPolicy */
+	RsslUInt32							_persistenceCommitCount;
+	RsslUInt32							_persistenceCommitInterval;
 	RsslBool							_needsDispatch;
 	RsslBool							_queuedFirstMsg;
 	RsslBool							_interfaceError;
@@ -155,8 +161,36 @@ typedef struct
 	RsslUInt32							_retransRetryCount;	/* Number of retries attempted when sending certain messages. */
 	BufferPool							_memoryBufferPool;
 	RsslUInt32							_guaranteedOutputBuffersAppLimit;
+	char								*_pCompressBuffer;		/* Output of compressing a message, if compression was negotiated. */
+	RsslBuffer							_recvData;				/* Content of the received message being delivered to the application. Empty outside of its callbacks. */
+	PoolBuffer							_recvPoolBuffer;		/* Pool memory holding _recvData, if any (decompressed content, or content copied when first retained). Retained buffers reference it. */
+	RsslUInt32							*_pCompressHashTable;
+	RsslBool							_adaptiveSendWindow;	/* Limit data waiting for acknowledgement to _effectiveSendWindow. */
+	RsslInt								_effectiveSendWindow;	/* Adaptive limit on _bytesWaitingAck (classOfService.flowControl.sendWindowSize still applies). */
+	RsslInt								_slowStartThreshold;	/* Below this, _effectiveSendWindow grows by each acknowledged length; above it, by about one message per round trip. */
+	RsslUInt32							_recoverySeqNum;		/* Last sequence number sent when _effectiveSendWindow was reduced. Losses up to it do not reduce it again. */
+	RsslBool							_rttMeasured;
+	RsslInt64							_smoothedRtt;			/* Round trip time of data messages, in microseconds. */
+	RsslInt64							_rttVariance;			/* Mean deviation of the round trip time, in microseconds. */
+	RsslInt64							_minRtt;				/* Lowest round trip time measured recently(see TS_MIN_RTT_WINDOW), in microseconds. */
+	RsslInt64							_minRttTime;			/* Time _minRtt was measured, in milliseconds. */
+	RsslUInt64							_ackRate;				/* Bytes per second acknowledged by the remote end. */
+	RsslUInt64							_ackRateBytes;			/* Bytes acknowledged since _ackRateStartTime. */
+	RsslInt64							_ackRateStartTime;
+	RsslUInt64							_retransmitCount;
 } TunnelStreamImpl;
 
+/* Returns the buffer with the given sequence number if it is waiting for acknowledgement.
+ * The ring covers sequence numbers _waitAckFirstSeqNum through _lastOutSeqNum; a slot is empty
+ * if its buffer was selectively acknowledged or moved back to the transmit list. */
+RTR_C_INLINE TunnelBufferImpl *tunnelStreamGetWaitAckBuffer(TunnelStreamImpl *pTunnelImpl, RsslUInt32 seqNum)
+{
+	if (seqNum - pTunnelImpl->_waitAckFirstSeqNum >= pTunnelImpl->_lastOutSeqNum + 1 - pTunnelImpl->_waitAckFirstSeqNum)
+		return NULL;
+
+	return pTunnelImpl->_waitAckRing[seqNum & (pTunnelImpl->_waitAckRingSize - 1)];
+}
+
 RsslRet tunnelStreamEnqueueBuffer(RsslTunnelStream *pTunnelStream,
 		RsslBuffer *pBuffer, RsslUInt8 containerType, RsslErrorInfo *pErrorInfo);
 
@@ -237,6 +271,14 @@ TunnelBufferImpl* tunnelStreamGetBuffer(
 void tunnelStreamReleaseBuffer(
 		TunnelStreamImpl *pTunnelImpl, TunnelBufferImpl *pBufferImpl);
 
+/* Copies received content into a buffer from the tunnel stream's pool, so the application can keep it
+ * after its callback returns. The buffer is released with tunnelStreamReleaseBuffer(). */
+TunnelBufferImpl* tunnelStreamRetainBuffer(
+		TunnelStreamImpl *pTunnelImpl, RsslBuffer *pBuffer, RsslErrorInfo *pErrorInfo);
+
+/* Gets the tunnel stream's flow control statistics. */
+void tunnelStreamGetInfo(TunnelStreamImpl *pTunnelImpl, RsslTunnelStreamInfo *pInfo);
+
 /* Close a tunnel stream.
  * Returns TunnelStreamReturnCodes. */
 RsslRet tunnelStreamClose(RsslTunnelStream *pTunnel, RsslTunnelStreamCloseOptions *pOptions, RsslErrorInfo *pErrorInfo);
@@ -65,6 +65,13 @@ RsslRet tunnelSubstreamExpireBuffer(TunnelSubstream *pSubstream, RsslBuffer *pTu
 /* Updates a buffer for transmission (ensures persistence is updated and updates any timeout */
 RsslRet	tunnelSubstreamUpdateMsgForTransmit(TunnelSubstream *pSubstream, RsslBuffer *pBuffer, RsslErrorInfo *pErrorInfo);
 
+/* Returns the time at which the substream's persistence file has updates to commit,
+ * or RDM_QMSG_TC_INFINITE if none are waiting on a timer. */
+RsslInt64 tunnelSubstreamGetNextExpireTime(TunnelSubstream *pSubstream);
+
+/* Commits the substream's persistence file updates, if their commit time has been reached. */
+RsslRet tunnelSubstreamProcessTimer(TunnelSubstream *pSubstream, RsslInt64 currentTime, RsslErrorInfo *pErrorInfo);
+
 /* Closes a substream. */
 RsslRet tunnelSubstreamClose(TunnelSubstream *pSubstream,
 		RsslErrorInfo *pErrorInfo);
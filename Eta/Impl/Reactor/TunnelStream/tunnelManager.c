@@ -476,6 +476,15 @@ RsslRet tunnelManagerAcceptStream(TunnelManager *pManager, RsslTunnelStreamReque
 	if (!tunnelManagerValidateCos(&pOptions->classOfService, RSSL_TRUE, pErrorInfo))
 		return RSSL_RET_INVALID_ARGUMENT;
 
+	/* The provider can only use compression the consumer asked for. */
+	if (pOptions->classOfService.common.compressionType != RSSL_COMP_NONE
+			&& pOptions->classOfService.common.compressionType != pRequest->classOfService.common.compressionType)
+	{
+		rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_INVALID_ARGUMENT, 
+				__FILE__, __LINE__, "ClassOfService.common.compressionType %u was not requested by the consumer.", pOptions->classOfService.common.compressionType);
+		return RSSL_RET_INVALID_ARGUMENT;
+	}
+
 	rsslClearTunnelStreamOpenOptions(&tsOpts);
 	tsOpts.defaultMsgCallback = pOptions->defaultMsgCallback;
 	tsOpts.domainType = pEvent->domainType;
@@ -723,7 +732,18 @@ RSSL_VA_API RsslRet rsslTunnelStreamRequestGetCos(RsslTunnelStreamRequestEvent *
 
 RsslBool tunnelManagerValidateCos(RsslClassOfService *pCos, RsslBool isProvider, RsslErrorInfo *pErrorInfo)
 {
-	/* Common (Nothing) */
+	/* Common */
+	switch (pCos->common.compressionType)
+	{
+		case RSSL_COMP_NONE:
+		case RSSL_COMP_LZ4:
+			break;
+
+		default:
+			rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_INVALID_ARGUMENT, 
+					__FILE__, __LINE__, "ClassOfService.common.compressionType %u is not supported for tunnel streams.", pCos->common.compressionType);
+			return RSSL_FALSE;
+	}
 
 	/* Authentication */
 	switch (pCos->authentication.type)
@@ -799,6 +819,14 @@ RsslBool tunnelManagerValidateCos(RsslClassOfService *pCos, RsslBool isProvider,
 						__FILE__, __LINE__, "ClassOfService.guarantee.type of RDM_COS_GU_PERSISTENT_QUEUE requires ClassOfService.common.protocolType of RSSL_RWF_PROTOCOL_TYPE");
 				return RSSL_FALSE;
 			}
+
+			if (pCos->guarantee.persistenceCommitPolicy > RSSL_COS_PC_DISPATCH
+					|| (pCos->guarantee.persistenceCommitPolicy == RSSL_COS_PC_MSG_COUNT && pCos->guarantee.persistenceCommitCount == 0))
+			{
+				rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_INVALID_ARGUMENT, 
+						__FILE__, __LINE__, "ClassOfService.guarantee.persistenceCommitPolicy is invalid, or persistenceCommitCount is zero.");
+				return RSSL_FALSE;
+			}
 			break;
 
 		default:
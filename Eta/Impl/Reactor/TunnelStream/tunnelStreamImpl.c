@@ -11,6 +11,7 @@
 #include "rtr/rsslReactorImpl.h"
 #include "rtr/rsslHeapBuffer.h"
 #include "rtr/rsslReactorUtils.h"
+#include "rtr/lz4Block.h"
 
 #include <assert.h>
 
@@ -28,6 +29,9 @@ static const RsslInt32 TS_DEFAULT_BIDRECTIONAL_WINDOW_SIZE = 6144 * 2;
 /* Position of the containerType in an encoded RSSL message. */
 static const RsslUInt32 TS_CONTAINER_TYPE_POS = 9;
 
+/* Messages with less content than this are not compressed. */
+static const RsslUInt32 TS_COMPRESSION_THRESHOLD = 30;
+
 /* Number used to validate whether a buffer is a TunnelStream buffer. */
 static const RsslUInt32 TS_BUFFER_INTEGRITY = 0x2a030d20;
 
@@ -36,6 +40,27 @@ static const RsslUInt32 TS_RETRANSMIT_TIMEOUT = 150;
 
 static const RsslUInt32 TS_RETRANSMIT_MAX_ATTEMPTS = 4;
 
+/* Initial number of slots in the ring of buffers waiting for acknowledgement. */
+static const RsslUInt32 TS_WAIT_ACK_RING_INITIAL_SIZE = 64;
+
+/* Initial and smallest adaptive send windows, in messages of the negotiated maxMsgSize. */
+static const RsslInt TS_ADAPTIVE_INITIAL_WINDOW_MSGS = 4;
+static const RsslInt TS_ADAPTIVE_MIN_WINDOW_MSGS = 2;
+
+/* Shortest interval, in milliseconds, over which the acknowledgement rate is measured. */
+static const RsslInt64 TS_ACK_RATE_MIN_INTERVAL = 100;
+
+/* Queueing delay, in milliseconds, above which the adaptive send window is trimmed to what is being acknowledged. */
+static const RsslInt64 TS_ADAPTIVE_QUEUE_DELAY = 10;
+
+/* Smallest round trip time sample, in microseconds. The clock has millisecond resolution, so a message acknowledged
+ * within the same millisecond is counted as taking one. */
+static const RsslInt64 TS_RTT_MIN_SAMPLE = 1000;
+
+/* Time, in milliseconds, after which the lowest round trip time is replaced by the next sample, so that it follows
+ * changes in the path. */
+static const RsslInt64 TS_MIN_RTT_WINDOW = 10000;
+
 static RsslRet _tunnelStreamSubmitChannelMsg(TunnelStreamImpl *pTunnelImpl,
 		RsslMsg *pRsslMsg, RsslErrorInfo *pErrorInfo);
 
@@ -63,10 +88,38 @@ static RsslRet _tunnelStreamCheckReceivedCos(RsslClassOfService *pLocalCos, Rssl
 /* Returns a TunnelBufferImpl for use (no buffer space attached yet) */
 static TunnelBufferImpl *_tunnelStreamGetBufferImplObject(TunnelStreamImpl *pTunnelImpl, RsslErrorInfo *pErrorInfo);
 
+/* Sets the expire time for a substream's deferred persistence commit, if it has one. */
+static void _tunnelStreamSchedulePersistenceCommit(TunnelStreamImpl *pTunnelImpl, TunnelSubstream *pSubstream);
+
+/* Compresses the content of a data message before its first transmission, if that makes it smaller. */
+static void _tunnelStreamCompressBuffer(TunnelStreamImpl *pTunnelImpl, TunnelBufferImpl *pBufferImpl, RsslEncodeIterator *pIter);
+
+/* Decompresses the content of a received data message into _recvPoolBuffer, and points pDataBody to the result. */
+static RsslRet _tunnelStreamDecompressData(TunnelStreamImpl *pTunnelImpl, RsslBuffer *pDataBody, RsslErrorInfo *pErrorInfo);
+
+/* Delivers the content of a received data message to the application, or to its substream. */
+static RsslRet _tunnelStreamReadData(TunnelStreamImpl *pTunnelImpl, RsslMsg *pMsg, TunnelStreamMsg *pStreamMsg,
+		RsslErrorInfo *pErrorInfo);
+
+/* Releases the read path's reference to the content of the received message, once it has been delivered. */
+static void _tunnelStreamReleaseReceivedData(TunnelStreamImpl *pTunnelImpl);
+
+/* Updates the round trip time, acknowledgement rate, and adaptive send window for an acknowledged data message. */
+static void _tunnelStreamHandleAckedData(TunnelStreamImpl *pTunnelImpl, TunnelBufferImpl *pBufferImpl);
+
+/* Reduces the adaptive send window when a data message needs to be retransmitted. */
+static void _tunnelStreamHandleLostData(TunnelStreamImpl *pTunnelImpl, TunnelBufferImpl *pBufferImpl);
+
 static void _tunnelStreamSetResponseTimerWithBackoff(TunnelStreamImpl *pTunnelImpl)
 {
 	RsslUInt32 i;
 	pTunnelImpl->_responseExpireTime = TS_RETRANSMIT_TIMEOUT;
+
+	/* With an adaptive window, don't retransmit before an acknowledgement could be expected. */
+	if (pTunnelImpl->_adaptiveSendWindow && pTunnelImpl->_rttMeasured
+			&& (pTunnelImpl->_smoothedRtt + 4 * pTunnelImpl->_rttVariance) / 1000 > pTunnelImpl->_responseExpireTime)
+		pTunnelImpl->_responseExpireTime = (pTunnelImpl->_smoothedRtt + 4 * pTunnelImpl->_rttVariance) / 1000;
+
 	for (i = 0; i < pTunnelImpl->_retransRetryCount; ++i)
 	{
 		pTunnelImpl->_responseExpireTime *= 2;
@@ -89,33 +142,51 @@ static void _tunnelStreamUnsetResponseTimer(TunnelStreamImpl *pTunnelImpl)
 
 static void _tunnelStreamFreeAckedBuffer(TunnelStreamImpl *pTunnelImpl, TunnelBufferImpl *pBufferImpl)
 {
-	rsslQueueRemoveLink(&pTunnelImpl->_tunnelBufferWaitAckList, &pBufferImpl->_tbpLink);
+	pTunnelImpl->_waitAckRing[pBufferImpl->_seqNum & (pTunnelImpl->_waitAckRingSize - 1)] = NULL;
+	if (pBufferImpl->_bufferType == TS_BT_DATA)
+		_tunnelStreamHandleAckedData(pTunnelImpl, pBufferImpl);
 	pTunnelImpl->_bytesWaitingAck -= pBufferImpl->_poolBuffer.buffer.length;
 	if (tunnelStreamDebugFlags & TS_DBG_ACKS)
 		printf("<TunnelStreamDebug streamId:%d> Inbound AckMsg freed buffer seqNum: %u, length: %u, bytes waiting ack: %u\n", pTunnelImpl->base.streamId, pBufferImpl->_seqNum, pBufferImpl->_poolBuffer.buffer.length, pTunnelImpl->_bytesWaitingAck);
 	tunnelStreamReleaseBuffer(pTunnelImpl, pBufferImpl);
 }
 
-/* Search the given list for a buffer with this sequence number. */
-static TunnelBufferImpl *_tunnelStreamGetBufferWithSeqNum(RsslQueue *pQueue, RsslUInt32 seqNum)
+/* Ensures the wait-ack ring has a slot for the next outbound sequence number, growing it if needed. */
+static RsslRet _tunnelStreamReserveWaitAckSlot(TunnelStreamImpl *pTunnelImpl, RsslErrorInfo *pErrorInfo)
 {
-	RsslQueueLink *pLink;
+	RsslUInt32 span = pTunnelImpl->_lastOutSeqNum + 1 - pTunnelImpl->_waitAckFirstSeqNum;
+	RsslUInt32 newSize, seqNum;
+	TunnelBufferImpl **newRing;
 
-	for(pLink = rsslQueueStart(pQueue);
-			pLink != NULL;
-			pLink = rsslQueueForth(pQueue))
+	if (span < pTunnelImpl->_waitAckRingSize)
+		return RSSL_RET_SUCCESS;
+
+	newSize = pTunnelImpl->_waitAckRingSize ? pTunnelImpl->_waitAckRingSize * 2 : TS_WAIT_ACK_RING_INITIAL_SIZE;
+
+	if ((newRing = (TunnelBufferImpl**)malloc(newSize * sizeof(TunnelBufferImpl*))) == NULL)
 	{
-		TunnelBufferImpl *pBufferImpl = RSSL_QUEUE_LINK_TO_OBJECT(TunnelBufferImpl, _tbpLink, pLink);
-		if (pBufferImpl->_seqNum == seqNum)
-			return pBufferImpl;
+		rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__,
+				"Failed to allocate tunnel stream acknowledgement ring.");
+		return RSSL_RET_FAILURE;
 	}
 
-	return NULL;
+	memset(newRing, 0, newSize * sizeof(TunnelBufferImpl*));
+
+	/* Re-index outstanding slots by the new mask. */
+	for (seqNum = pTunnelImpl->_waitAckFirstSeqNum; seqNum != pTunnelImpl->_lastOutSeqNum + 1; ++seqNum)
+		newRing[seqNum & (newSize - 1)] = pTunnelImpl->_waitAckRing[seqNum & (pTunnelImpl->_waitAckRingSize - 1)];
+
+	free(pTunnelImpl->_waitAckRing);
+	pTunnelImpl->_waitAckRing = newRing;
+	pTunnelImpl->_waitAckRingSize = newSize;
+	return RSSL_RET_SUCCESS;
 }
 
 /* Returns if there is room in the send window to do send this message. */
 static RsslBool _tunnelStreamCanSendMessage(TunnelStreamImpl *pTunnelImpl, TunnelBufferImpl *pBufferImpl)
 {
+	RsslInt sendWindowSize = pTunnelImpl->base.classOfService.flowControl.sendWindowSize;
+
 	/* Flow control is not enabled, safe to send */
 	if (pTunnelImpl->base.classOfService.flowControl.type == RDM_COS_FC_NONE)
 		return RSSL_TRUE;
@@ -126,8 +197,12 @@ static RsslBool _tunnelStreamCanSendMessage(TunnelStreamImpl *pTunnelImpl, Tunne
 
 	/* Check if there is room for the content of the message 
 	 * (not including the tunnel stream message header) */
+	/* The adaptive window can only narrow the window allowed by the remote end. */
+	if (pTunnelImpl->_adaptiveSendWindow && pTunnelImpl->_effectiveSendWindow < sendWindowSize)
+		sendWindowSize = pTunnelImpl->_effectiveSendWindow;
+
 	if (pBufferImpl->_poolBuffer.buffer.length - (pBufferImpl->_dataStartPos - pBufferImpl->_startPos) + pTunnelImpl->_bytesWaitingAck
-			<= pTunnelImpl->base.classOfService.flowControl.sendWindowSize)
+			<= sendWindowSize)
 		return RSSL_TRUE;
 
 	return RSSL_FALSE;
@@ -179,7 +254,6 @@ RsslTunnelStream* tunnelStreamOpen(TunnelManager *pManager, RsslTunnelStreamOpen
 	memset(pTunnelImpl, 0, sizeof(TunnelStreamImpl));
 
 	rsslInitQueue(&pTunnelImpl->_tunnelBufferTransmitList);
-	rsslInitQueue(&pTunnelImpl->_tunnelBufferWaitAckList);
 	rsslInitQueue(&pTunnelImpl->_tunnelBufferTimeoutList);
 	rsslInitQueue(&pTunnelImpl->_tunnelBufferImmediateList);
 
@@ -188,7 +262,12 @@ RsslTunnelStream* tunnelStreamOpen(TunnelManager *pManager, RsslTunnelStreamOpen
 	pTunnelImpl->base.serviceId = pOpts->serviceId;
 	pTunnelImpl->base.userSpecPtr = pOpts->userSpecPtr;
 	pTunnelImpl->_persistLocally = pOpts->classOfService.guarantee.persistLocally;
+	pTunnelImpl->_persistenceCommitPolicy = pOpts->classOfService.guarantee.persistenceCommitPolicy;
+	pTunnelImpl->_persistenceCommitCount = pOpts->classOfService.guarantee.persistenceCommitCount;
+	pTunnelImpl->_persistenceCommitInterval = pOpts->classOfService.guarantee.persistenceCommitInterval;
+	pTunnelImpl->_adaptiveSendWindow = pOpts->classOfService.flowControl.adaptiveSendWindow;
 	pTunnelImpl->_nextExpireTime = RDM_QMSG_TC_INFINITE;
+	pTunnelImpl->_waitAckFirstSeqNum = pTunnelImpl->_lastOutSeqNum + 1;
 	pTunnelImpl->_guaranteedOutputBuffersAppLimit = pOpts->guaranteedOutputBuffers;
 
 	/* Add to manager's list now (tunnelStreamDestroy will remove the link) */
@@ -229,7 +308,7 @@ RsslTunnelStream* tunnelStreamOpen(TunnelManager *pManager, RsslTunnelStreamOpen
 	if (pOpts->classOfService.guarantee.type == RDM_COS_GU_PERSISTENT_QUEUE)
 	{
 		rsslInitQueue(&pTunnelImpl->_substreams);
-		if (rsslHashTableInit(&pTunnelImpl->_substreamsById, 101, rsslHashU32Sum, rsslHashU32Compare,
+		if (rsslHashTableInitOpenAddressing(&pTunnelImpl->_substreamsById, 101, rsslHashU32Sum, rsslHashU32Compare,
 					RSSL_TRUE, pErrorInfo) != RSSL_RET_SUCCESS)
 		{
 			tunnelStreamDestroy((RsslTunnelStream*)pTunnelImpl);
@@ -528,6 +607,8 @@ RsslRet tunnelStreamSubmitMsg(RsslTunnelStream *pTunnel,
 
 						return ret;
 					}
+
+					_tunnelStreamSchedulePersistenceCommit(pTunnelImpl, pSubstream);
 					break;
 				}
 
@@ -787,7 +868,6 @@ RsslRet tunnelStreamRead(RsslTunnelStream *pTunnel, RsslMsg *pMsg, RsslErrorInfo
 		case TS_MC_ACK:
 		{
 			TunnelStreamAck *pAckMsg = (TunnelStreamAck*)&streamMsg;
-			RsslQueueLink *pLink;
 			RsslUInt32 ui;
 			RsslQueue retransmitQueue;
 			RsslRet ret;
@@ -820,16 +900,16 @@ RsslRet tunnelStreamRead(RsslTunnelStream *pTunnel, RsslMsg *pMsg, RsslErrorInfo
 
 						pTunnelImpl->base.classOfService.flowControl.sendWindowSize = pAckMsg->recvWindow;
 
-						/* Acknowledge messages up to the cumulative sequence number. */
-						for (pLink = rsslQueueStart(&pTunnelImpl->_tunnelBufferWaitAckList);
-								pLink != NULL;
-								pLink = rsslQueueForth(&pTunnelImpl->_tunnelBufferWaitAckList))
+						/* Acknowledge messages up to the cumulative sequence number, and advance the start of the ring past them. */
+						while (rsslSeqNumCompare(pTunnelImpl->_waitAckFirstSeqNum, pAckMsg->seqNum) <= 0
+								&& rsslSeqNumCompare(pTunnelImpl->_waitAckFirstSeqNum, pTunnelImpl->_lastOutSeqNum) <= 0)
 						{
-							TunnelBufferImpl *pBufferImpl =
-								RSSL_QUEUE_LINK_TO_OBJECT(TunnelBufferImpl, _tbpLink, pLink);
+							TunnelBufferImpl *pBufferImpl;
 
-							if (rsslSeqNumCompare(pBufferImpl->_seqNum, pAckMsg->seqNum) <= 0)
+							if ((pBufferImpl = tunnelStreamGetWaitAckBuffer(pTunnelImpl, pTunnelImpl->_waitAckFirstSeqNum)) != NULL)
 								_tunnelStreamFreeAckedBuffer(pTunnelImpl, pBufferImpl);
+
+							++pTunnelImpl->_waitAckFirstSeqNum;
 						}
 
 						/* Acknowledge buffers in ack ranges. */
@@ -844,25 +924,21 @@ RsslRet tunnelStreamRead(RsslTunnelStream *pTunnel, RsslMsg *pMsg, RsslErrorInfo
 							printf ("\n");
 						}
 
-						pLink = rsslQueueStart(&pTunnelImpl->_tunnelBufferWaitAckList);
-
 						for(ui = 0; ui < ackRangeList.count * 2; ui += 2)
 						{
-							while(pLink != NULL)
-							{
-								/* Remove each buffer within the ack range.
-								 * Have to check the whole list, as the buffers in 
-								 * _tunnelBufferWaitAckList aren't necessarily in order. */
+							RsslUInt32 uj = ackRangeList.rangeArray[ui];
 
-								TunnelBufferImpl *pBufferImpl =
-									RSSL_QUEUE_LINK_TO_OBJECT(TunnelBufferImpl, _tbpLink, pLink);
+							/* Only sequence numbers still covered by the ring can be waiting. */
+							if (rsslSeqNumCompare(uj, pTunnelImpl->_waitAckFirstSeqNum) < 0)
+								uj = pTunnelImpl->_waitAckFirstSeqNum;
 
-								/* If buffer is in current range, free it. */
-								if (rsslSeqNumCompare(pBufferImpl->_seqNum, ackRangeList.rangeArray[ui]) >= 0
-										&& rsslSeqNumCompare(pBufferImpl->_seqNum, ackRangeList.rangeArray[ui + 1]) <= 0)
-									_tunnelStreamFreeAckedBuffer(pTunnelImpl, pBufferImpl);
+							for (; rsslSeqNumCompare(uj, ackRangeList.rangeArray[ui + 1]) <= 0
+									&& rsslSeqNumCompare(uj, pTunnelImpl->_lastOutSeqNum) <= 0; ++uj)
+							{
+								TunnelBufferImpl *pBufferImpl;
 
-								pLink = rsslQueueForth(&pTunnelImpl->_tunnelBufferWaitAckList);
+								if ((pBufferImpl = tunnelStreamGetWaitAckBuffer(pTunnelImpl, uj)) != NULL)
+									_tunnelStreamFreeAckedBuffer(pTunnelImpl, pBufferImpl);
 							}
 						}
 
@@ -888,8 +964,7 @@ RsslRet tunnelStreamRead(RsslTunnelStream *pTunnel, RsslMsg *pMsg, RsslErrorInfo
 							{
 								TunnelBufferImpl *pBufferImpl;
 
-								if ((pBufferImpl = _tunnelStreamGetBufferWithSeqNum(
-												&pTunnelImpl->_tunnelBufferWaitAckList, uj)) != NULL)
+								if ((pBufferImpl = tunnelStreamGetWaitAckBuffer(pTunnelImpl, uj)) != NULL)
 								{
 									RsslEncodeIterator eIter;
 
@@ -912,10 +987,11 @@ RsslRet tunnelStreamRead(RsslTunnelStream *pTunnel, RsslMsg *pMsg, RsslErrorInfo
 											return RSSL_RET_FAILURE;
 										}
 
+										_tunnelStreamHandleLostData(pTunnelImpl, pBufferImpl);
 										pTunnelImpl->_bytesWaitingAck -= pBufferImpl->_poolBuffer.buffer.length;
 									}
 
-									rsslQueueRemoveLink(&pTunnelImpl->_tunnelBufferWaitAckList, &pBufferImpl->_tbpLink);
+									pTunnelImpl->_waitAckRing[uj & (pTunnelImpl->_waitAckRingSize - 1)] = NULL;
 									rsslQueueAddLinkToBack(&retransmitQueue, &pBufferImpl->_tbpLink);
 
 									if (tunnelStreamDebugFlags & TS_DBG_ACKS)
@@ -924,10 +1000,10 @@ RsslRet tunnelStreamRead(RsslTunnelStream *pTunnel, RsslMsg *pMsg, RsslErrorInfo
 												pBufferImpl->_seqNum);
 									}
 								}
-								else if ((_tunnelStreamGetBufferWithSeqNum(
-												&pTunnelImpl->_tunnelBufferTransmitList, uj)) != NULL)
+								else if (rsslSeqNumCompare(uj, pTunnelImpl->_waitAckFirstSeqNum) >= 0
+										&& rsslSeqNumCompare(uj, pTunnelImpl->_lastOutSeqNum) <= 0)
 								{
-									/* Ignore -- message already queued for retransmission. */
+									/* Ignore -- message already queued for retransmission (or selectively acknowledged). */
 								}
 								else
 								{
@@ -1081,9 +1157,6 @@ RsslRet tunnelStreamRead(RsslTunnelStream *pTunnel, RsslMsg *pMsg, RsslErrorInfo
 
 			if (diff == 1)
 			{
-				RsslDecodeIterator dIter;
-				RsslMsg substreamMsg;
-
 				/* Will need to send ack for this message. */
 				++pTunnelImpl->_lastInSeqNumAccepted;
 				if (rsslSeqNumCompare(pTunnelImpl->_lastInSeqNumAccepted, pTunnelImpl->_lastInSeqNum) > 0)
@@ -1093,184 +1166,209 @@ RsslRet tunnelStreamRead(RsslTunnelStream *pTunnel, RsslMsg *pMsg, RsslErrorInfo
 				if (!(pTunnelImpl->_flags & (TSF_ACTIVE | TSF_NEED_FINAL_STATUS_EVENT)))
 					return RSSL_RET_SUCCESS; /* Client is no longer expecting events; do not process this message beyond acknowledging. */
 
-				if (pTunnelImpl->base.classOfService.common.protocolType == RSSL_RWF_PROTOCOL_TYPE
-						&& pMsg->msgBase.containerType == RSSL_DT_MSG)
-				{
-					rsslClearDecodeIterator(&dIter);
-					rsslSetDecodeIteratorRWFVersion(&dIter, pTunnel->classOfService.common.protocolMajorVersion,
-						pTunnel->classOfService.common.protocolMinorVersion);
-					rsslSetDecodeIteratorBuffer(&dIter, &pMsg->msgBase.encDataBody);
+				if (pDataMsg->flags & TS_DF_COMPRESSED
+						&& _tunnelStreamDecompressData(pTunnelImpl, &pMsg->msgBase.encDataBody, pErrorInfo) != RSSL_RET_SUCCESS)
+					return RSSL_RET_FAILURE;
 
-					if ((ret = rsslDecodeMsg(&dIter, &substreamMsg)) != RSSL_RET_SUCCESS)
-					{
-						rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, ret, 
-							__FILE__, __LINE__, "Failed to decode substream message.");
-						return RSSL_RET_FAILURE;
-					}
+				/* Buffers retained by the application while the content is delivered reference _recvPoolBuffer. */
+				pTunnelImpl->_recvData = pMsg->msgBase.encDataBody;
+				ret = _tunnelStreamReadData(pTunnelImpl, pMsg, &streamMsg, pErrorInfo);
+				_tunnelStreamReleaseReceivedData(pTunnelImpl);
 
-					switch(substreamMsg.msgBase.domainType)
-					{
-						case RSSL_DMT_LOGIN:
-						{
-							if (((RsslReactorChannelImpl*)pReactorChannel)->channelRole.base.roleType != RSSL_RC_RT_OMM_PROVIDER
-								&& pTunnelImpl->_state >= TSS_WAIT_AUTH_LOGIN_RESPONSE
-								&& pTunnelImpl->base.classOfService.authentication.type == RDM_COS_AU_OMM_LOGIN
-								&& pTunnelImpl->_authLoginStreamId == substreamMsg.msgBase.streamId)
-							{
-								RsslRDMLoginMsg loginMsg;
-								RsslBuffer memoryBuffer = pTunnelImpl->_memoryBuffer;
-								RsslTunnelStreamAuthInfo authInfo;
+				if (ret != RSSL_RET_SUCCESS)
+					return ret;
+			}
+			else if (diff < 1)
+			{
+				/* Old data. Ignore. */
+			}
+			else
+			{
+				/* Missing messages. Need to send a nack for them. */
+				if (rsslSeqNumCompare(pDataMsg->seqNum, pTunnelImpl->_lastInSeqNum) > 0)
+					pTunnelImpl->_lastInSeqNum = pDataMsg->seqNum;
+				pTunnelImpl->_flags |= TSF_SEND_NACK;
+				tunnelStreamSetNeedsDispatch(pTunnelImpl);
+			}
 
-								do
-								{
-									if ((ret = rsslDecodeRDMLoginMsg(&dIter, &substreamMsg, &loginMsg, &memoryBuffer, pErrorInfo))
-										== RSSL_RET_SUCCESS)
-										break;
 
-									if (pErrorInfo->rsslError.rsslErrorId == RSSL_RET_BUFFER_TOO_SMALL)
-									{
-										if (rsslHeapBufferResize(&pTunnelImpl->_memoryBuffer,
-											pTunnelImpl->_memoryBuffer.length * 2, RSSL_FALSE)
-											!= RSSL_RET_SUCCESS)
-										{
-											rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, 
-												"Memory allocation failed.");
-											return RSSL_RET_FAILURE;
-										}
-									}
-									else
-									{
-										rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, 
-											"Failed to decode login authentication response: %d", pErrorInfo->rsslError.rsslErrorId);
-										return RSSL_RET_FAILURE;
-									}
-								} while (ret != RSSL_RET_SUCCESS);
+			break;
+		}
 
-								switch(loginMsg.rdmMsgBase.rdmMsgType)
-								{
-								case RDM_LG_MT_REFRESH:
-									memset(&authInfo, 0, sizeof(RsslTunnelStreamAuthInfo));
-									authInfo.pLoginMsg = &loginMsg;
+		default:
+		{
+			rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, 
+					RSSL_RET_FAILURE, __FILE__, __LINE__,
+					"Received unhandled stream message class.");
+			return RSSL_RET_FAILURE;
+		}
+	}
 
-									return tunnelStreamHandleState(pTunnelImpl, &loginMsg.refresh.state,
-										pMsg, &streamMsg, &authInfo, RSSL_FALSE, pErrorInfo);
+	return RSSL_RET_SUCCESS;
+}
+
+static RsslRet _tunnelStreamReadData(TunnelStreamImpl *pTunnelImpl, RsslMsg *pMsg, TunnelStreamMsg *pStreamMsg,
+		RsslErrorInfo *pErrorInfo)
+{
+	RsslDecodeIterator	dIter;
+	RsslMsg				substreamMsg;
+	RsslRet				ret;
+	RsslReactorChannel	*pReactorChannel = pTunnelImpl->_manager->base._pReactorChannel;
 
-								case RDM_LG_MT_STATUS:
-									memset(&authInfo, 0, sizeof(RsslTunnelStreamAuthInfo));
-									authInfo.pLoginMsg = &loginMsg;
+	if (pTunnelImpl->base.classOfService.common.protocolType == RSSL_RWF_PROTOCOL_TYPE
+			&& pMsg->msgBase.containerType == RSSL_DT_MSG)
+	{
+		rsslClearDecodeIterator(&dIter);
+		rsslSetDecodeIteratorRWFVersion(&dIter, pTunnelImpl->base.classOfService.common.protocolMajorVersion,
+			pTunnelImpl->base.classOfService.common.protocolMinorVersion);
+		rsslSetDecodeIteratorBuffer(&dIter, &pMsg->msgBase.encDataBody);
 
-									return tunnelStreamHandleState(pTunnelImpl, 
-										(loginMsg.status.flags & RDM_LG_STF_HAS_STATE) ? &loginMsg.status.state : NULL, 
-										pMsg, &streamMsg, &authInfo, RSSL_FALSE, pErrorInfo);
-								default:
-									rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, 
-										RSSL_RET_FAILURE, __FILE__, __LINE__,
-										"Received unexpected login rdmMsgType %u on authentication stream", 
-										loginMsg.rdmMsgBase.rdmMsgType);
-									return RSSL_RET_FAILURE;
-								}
+		if ((ret = rsslDecodeMsg(&dIter, &substreamMsg)) != RSSL_RET_SUCCESS)
+		{
+			rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, ret, 
+				__FILE__, __LINE__, "Failed to decode substream message.");
+			return RSSL_RET_FAILURE;
+		}
 
-							}
-							else
-							{
-								if (tunnelStreamCallMsgCallback(pTunnelImpl, &pMsg->msgBase.encDataBody, &substreamMsg, RSSL_DT_MSG, pErrorInfo)
-									!= RSSL_RET_SUCCESS)
-									return RSSL_RET_FAILURE;
+		switch(substreamMsg.msgBase.domainType)
+		{
+			case RSSL_DMT_LOGIN:
+			{
+				if (((RsslReactorChannelImpl*)pReactorChannel)->channelRole.base.roleType != RSSL_RC_RT_OMM_PROVIDER
+					&& pTunnelImpl->_state >= TSS_WAIT_AUTH_LOGIN_RESPONSE
+					&& pTunnelImpl->base.classOfService.authentication.type == RDM_COS_AU_OMM_LOGIN
+					&& pTunnelImpl->_authLoginStreamId == substreamMsg.msgBase.streamId)
+				{
+					RsslRDMLoginMsg loginMsg;
+					RsslBuffer memoryBuffer = pTunnelImpl->_memoryBuffer;
+					RsslTunnelStreamAuthInfo authInfo;
 
-							}
+					do
+					{
+						if ((ret = rsslDecodeRDMLoginMsg(&dIter, &substreamMsg, &loginMsg, &memoryBuffer, pErrorInfo))
+							== RSSL_RET_SUCCESS)
 							break;
-						}
 
-						default:
+						if (pErrorInfo->rsslError.rsslErrorId == RSSL_RET_BUFFER_TOO_SMALL)
 						{
-							if (pTunnelImpl->base.classOfService.guarantee.type == RDM_COS_GU_PERSISTENT_QUEUE)
+							if (rsslHeapBufferResize(&pTunnelImpl->_memoryBuffer,
+								pTunnelImpl->_memoryBuffer.length * 2, RSSL_FALSE)
+								!= RSSL_RET_SUCCESS)
 							{
-								switch(substreamMsg.msgBase.domainType)
-								{
-									case RSSL_DMT_SOURCE:
-									case RSSL_DMT_DICTIONARY:
-									case RSSL_DMT_SYMBOL_LIST:
-									{
-										/* Ignore non-login messages if waiting for refresh or authentication */
-										if (pTunnelImpl->_state < TSS_OPEN)
-											break;
+								rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, 
+									"Memory allocation failed.");
+								return RSSL_RET_FAILURE;
+							}
+						}
+						else
+						{
+							rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, 
+								"Failed to decode login authentication response: %d", pErrorInfo->rsslError.rsslErrorId);
+							return RSSL_RET_FAILURE;
+						}
+					} while (ret != RSSL_RET_SUCCESS);
 
-										if (tunnelStreamCallMsgCallback(pTunnelImpl, &pMsg->msgBase.encDataBody, &substreamMsg, RSSL_DT_MSG, pErrorInfo)
-												!= RSSL_RET_SUCCESS)
-											return RSSL_RET_FAILURE;
-										break;
-									}
+					switch(loginMsg.rdmMsgBase.rdmMsgType)
+					{
+					case RDM_LG_MT_REFRESH:
+						memset(&authInfo, 0, sizeof(RsslTunnelStreamAuthInfo));
+						authInfo.pLoginMsg = &loginMsg;
+
+						return tunnelStreamHandleState(pTunnelImpl, &loginMsg.refresh.state,
+							pMsg, pStreamMsg, &authInfo, RSSL_FALSE, pErrorInfo);
+
+					case RDM_LG_MT_STATUS:
+						memset(&authInfo, 0, sizeof(RsslTunnelStreamAuthInfo));
+						authInfo.pLoginMsg = &loginMsg;
+
+						return tunnelStreamHandleState(pTunnelImpl, 
+							(loginMsg.status.flags & RDM_LG_STF_HAS_STATE) ? &loginMsg.status.state : NULL, 
+							pMsg, pStreamMsg, &authInfo, RSSL_FALSE, pErrorInfo);
+					default:
+						rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, 
+							RSSL_RET_FAILURE, __FILE__, __LINE__,
+							"Received unexpected login rdmMsgType %u on authentication stream", 
+							loginMsg.rdmMsgBase.rdmMsgType);
+						return RSSL_RET_FAILURE;
+					}
 
-									default:
-									{
-										RsslHashLink *pHashLink;
-										TunnelSubstream *pSubstream;
+				}
+				else
+				{
+					if (tunnelStreamCallMsgCallback(pTunnelImpl, &pMsg->msgBase.encDataBody, &substreamMsg, RSSL_DT_MSG, pErrorInfo)
+						!= RSSL_RET_SUCCESS)
+						return RSSL_RET_FAILURE;
 
-										/* Ignore non-login messages if waiting for refresh or authentication */
-										if (pTunnelImpl->_state < TSS_OPEN)
-											break;
+				}
+				break;
+			}
 
-										if ((pHashLink = rsslHashTableFind(&pTunnelImpl->_substreamsById,
-											&substreamMsg.msgBase.streamId, NULL)) != NULL)
-										{
-											pSubstream = RSSL_HASH_LINK_TO_OBJECT(TunnelSubstream,
-												_tunnelTableLink, pHashLink);
+			default:
+			{
+				if (pTunnelImpl->base.classOfService.guarantee.type == RDM_COS_GU_PERSISTENT_QUEUE)
+				{
+					switch(substreamMsg.msgBase.domainType)
+					{
+						case RSSL_DMT_SOURCE:
+						case RSSL_DMT_DICTIONARY:
+						case RSSL_DMT_SYMBOL_LIST:
+						{
+							/* Ignore non-login messages if waiting for refresh or authentication */
+							if (pTunnelImpl->_state < TSS_OPEN)
+								break;
 
-											if ((ret = tunnelSubstreamRead(pSubstream, &substreamMsg, pErrorInfo))
-												!= RSSL_RET_SUCCESS)
-												return RSSL_RET_FAILURE;
-										}
-										/* Otherwise ignore. */
+							if (tunnelStreamCallMsgCallback(pTunnelImpl, &pMsg->msgBase.encDataBody, &substreamMsg, RSSL_DT_MSG, pErrorInfo)
+									!= RSSL_RET_SUCCESS)
+								return RSSL_RET_FAILURE;
+							break;
+						}
 
-										break;
-									}
-								}
-							}
-							else
+						default:
+						{
+							RsslHashLink *pHashLink;
+							TunnelSubstream *pSubstream;
+
+							/* Ignore non-login messages if waiting for refresh or authentication */
+							if (pTunnelImpl->_state < TSS_OPEN)
+								break;
+
+							if ((pHashLink = rsslHashTableFind(&pTunnelImpl->_substreamsById,
+								&substreamMsg.msgBase.streamId, NULL)) != NULL)
 							{
-								/* Ignore non-login messages if waiting for refresh or authentication */
-								if (pTunnelImpl->_state < TSS_OPEN)
-									break;
+								pSubstream = RSSL_HASH_LINK_TO_OBJECT(TunnelSubstream,
+									_tunnelTableLink, pHashLink);
 
-								if (tunnelStreamCallMsgCallback(pTunnelImpl, &pMsg->msgBase.encDataBody, &substreamMsg, RSSL_DT_MSG, pErrorInfo)
-										!= RSSL_RET_SUCCESS)
+								if ((ret = tunnelSubstreamRead(pSubstream, &substreamMsg, pErrorInfo))
+									!= RSSL_RET_SUCCESS)
 									return RSSL_RET_FAILURE;
-								break;
+
+								_tunnelStreamSchedulePersistenceCommit(pTunnelImpl, pSubstream);
 							}
+							/* Otherwise ignore. */
+
+							break;
 						}
 					}
 				}
 				else
 				{
-					if (tunnelStreamCallMsgCallback(pTunnelImpl, &pMsg->msgBase.encDataBody, NULL, pMsg->msgBase.containerType, pErrorInfo)
-						!= RSSL_RET_SUCCESS)
+					/* Ignore non-login messages if waiting for refresh or authentication */
+					if (pTunnelImpl->_state < TSS_OPEN)
+						break;
+
+					if (tunnelStreamCallMsgCallback(pTunnelImpl, &pMsg->msgBase.encDataBody, &substreamMsg, RSSL_DT_MSG, pErrorInfo)
+							!= RSSL_RET_SUCCESS)
 						return RSSL_RET_FAILURE;
+					break;
 				}
 			}
-			else if (diff < 1)
-			{
-				/* Old data. Ignore. */
-			}
-			else
-			{
-				/* Missing messages. Need to send a nack for them. */
-				if (rsslSeqNumCompare(pDataMsg->seqNum, pTunnelImpl->_lastInSeqNum) > 0)
-					pTunnelImpl->_lastInSeqNum = pDataMsg->seqNum;
-				pTunnelImpl->_flags |= TSF_SEND_NACK;
-				tunnelStreamSetNeedsDispatch(pTunnelImpl);
-			}
-
-
-			break;
 		}
-
-		default:
-		{
-			rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, 
-					RSSL_RET_FAILURE, __FILE__, __LINE__,
-					"Received unhandled stream message class.");
+	}
+	else
+	{
+		if (tunnelStreamCallMsgCallback(pTunnelImpl, &pMsg->msgBase.encDataBody, NULL, pMsg->msgBase.containerType, pErrorInfo)
+			!= RSSL_RET_SUCCESS)
 			return RSSL_RET_FAILURE;
-		}
 	}
 
 	return RSSL_RET_SUCCESS;
@@ -2010,16 +2108,18 @@ RsslRet tunnelStreamProcessTimer(TunnelStreamImpl *pTunnelImpl, RsslInt64 curren
 			case TSS_WAIT_ACK_OF_FIN:
 				if (pTunnelImpl->_retransRetryCount <= TS_RETRANSMIT_MAX_ATTEMPTS)
 				{
+					RsslUInt32 seqNum;
+
 					/* If the FIN is sent but unacked, retransmit it. */
-					for(pLink = rsslQueuePeekBack(&pTunnelImpl->_tunnelBufferWaitAckList);
-							pLink != NULL;
-							pLink = rsslQueuePeekPrev(&pTunnelImpl->_tunnelBufferWaitAckList, pLink))
+					for(seqNum = pTunnelImpl->_lastOutSeqNum;
+							rsslSeqNumCompare(seqNum, pTunnelImpl->_waitAckFirstSeqNum) >= 0;
+							--seqNum)
 					{
-						TunnelBufferImpl *pBufferImpl = RSSL_QUEUE_LINK_TO_OBJECT(TunnelBufferImpl, _tbpLink, pLink);
-						if (pBufferImpl->_bufferType == TS_BT_FIN)
+						TunnelBufferImpl *pBufferImpl = tunnelStreamGetWaitAckBuffer(pTunnelImpl, seqNum);
+						if (pBufferImpl != NULL && pBufferImpl->_bufferType == TS_BT_FIN)
 						{
-							rsslQueueRemoveLink(&pTunnelImpl->_tunnelBufferWaitAckList, pLink);
-							rsslQueueAddLinkToBack(&pTunnelImpl->_tunnelBufferTransmitList, pLink);
+							pTunnelImpl->_waitAckRing[seqNum & (pTunnelImpl->_waitAckRingSize - 1)] = NULL;
+							rsslQueueAddLinkToBack(&pTunnelImpl->_tunnelBufferTransmitList, &pBufferImpl->_tbpLink);
 							break;
 						}
 					}
@@ -2077,7 +2177,25 @@ RsslRet tunnelStreamProcessTimer(TunnelStreamImpl *pTunnelImpl, RsslInt64 curren
 		if (nextExpireTime == RDM_QMSG_TC_INFINITE)
 			nextExpireTime = pTunnelImpl->_responseExpireTime;
 		else if (pTunnelImpl->_responseExpireTime < nextExpireTime)
-			nextExpireTime = pTunnelImpl->_nextExpireTime;
+			nextExpireTime = pTunnelImpl->_responseExpireTime;
+	}
+
+	/* Commit persistence files whose group commit is due, and keep the timer for any that are not. */
+	if (pTunnelImpl->base.classOfService.guarantee.type == RDM_COS_GU_PERSISTENT_QUEUE)
+	{
+		for (pLink = rsslQueueStart(&pTunnelImpl->_substreams); pLink != NULL;
+				pLink = rsslQueueForth(&pTunnelImpl->_substreams))
+		{
+			TunnelSubstream *pSubstream = RSSL_QUEUE_LINK_TO_OBJECT(TunnelSubstream, _tunnelQueueLink, pLink);
+			RsslInt64 commitTime;
+
+			if (tunnelSubstreamProcessTimer(pSubstream, currentTime, pErrorInfo) != RSSL_RET_SUCCESS)
+				return RSSL_RET_FAILURE;
+
+			if ((commitTime = tunnelSubstreamGetNextExpireTime(pSubstream)) != RDM_QMSG_TC_INFINITE
+					&& (nextExpireTime == RDM_QMSG_TC_INFINITE || commitTime < nextExpireTime))
+				nextExpireTime = commitTime;
+		}
 	}
 
 	if (nextExpireTime != RDM_QMSG_TC_INFINITE)
@@ -2121,6 +2239,14 @@ static RsslRet _tunnelStreamCheckReceivedCos(RsslClassOfService *pLocalCos, Rssl
 		return RSSL_RET_FAILURE;
 	}
 
+	if (pRemoteCos->common.compressionType != RSSL_COMP_NONE
+			&& pRemoteCos->common.compressionType != pLocalCos->common.compressionType)
+	{
+		rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, 
+				__FILE__, __LINE__, "Negotiated ClassOfService.common.compressionType %u was not requested.", pRemoteCos->common.compressionType);
+		return RSSL_RET_FAILURE;
+	}
+
 	switch (pRemoteCos->dataIntegrity.type)
 	{
 		case RDM_COS_DI_BEST_EFFORT:
@@ -2498,15 +2624,19 @@ void tunnelStreamDestroy(RsslTunnelStream *pTunnel)
 		tunnelStreamReleaseBuffer(pTunnelImpl, pBufferImpl);
 	}
 
-	while((pLink = rsslQueueRemoveFirstLink(&pTunnelImpl->_tunnelBufferWaitAckList))
-			!= NULL)
+	for (; pTunnelImpl->_waitAckFirstSeqNum != pTunnelImpl->_lastOutSeqNum + 1; ++pTunnelImpl->_waitAckFirstSeqNum)
 	{
-		TunnelBufferImpl *pBufferImpl = RSSL_QUEUE_LINK_TO_OBJECT(TunnelBufferImpl, _tbpLink, pLink);
-		tunnelStreamReleaseBuffer(pTunnelImpl, pBufferImpl);
+		TunnelBufferImpl *pBufferImpl;
+
+		if ((pBufferImpl = tunnelStreamGetWaitAckBuffer(pTunnelImpl, pTunnelImpl->_waitAckFirstSeqNum)) != NULL)
+			tunnelStreamReleaseBuffer(pTunnelImpl, pBufferImpl);
 	}
+	free(pTunnelImpl->_waitAckRing);
 
 
 	bufferPoolCleanup(&pTunnelImpl->_memoryBufferPool);
+	free(pTunnelImpl->_pCompressBuffer);
+	free(pTunnelImpl->_pCompressHashTable);
 
 	rsslHeapBufferCleanup(&pTunnelImpl->_memoryBuffer);
 	rsslHashTableCleanup(&pTunnelImpl->_substreamsById);
@@ -2569,6 +2699,14 @@ static void _tunnelStreamRemoveTimeoutBuffer(TunnelStreamImpl *pTunnelImpl,
 				&pBufferImpl->_timeoutLink);
 }
 
+static void _tunnelStreamSchedulePersistenceCommit(TunnelStreamImpl *pTunnelImpl, TunnelSubstream *pSubstream)
+{
+	RsslInt64 commitTime;
+
+	if ((commitTime = tunnelSubstreamGetNextExpireTime(pSubstream)) != RDM_QMSG_TC_INFINITE)
+		tunnelStreamSetNextExpireTime(pTunnelImpl, commitTime);
+}
+
 static TunnelBufferImpl *_tunnelStreamGetBufferImplObject(TunnelStreamImpl *pTunnelImpl, RsslErrorInfo *pErrorInfo)
 {
 	RsslQueueLink *pLink;
@@ -2645,6 +2783,7 @@ TunnelBufferImpl* tunnelStreamGetBuffer(
 	dataMsg.base.streamId = pTunnelImpl->base.streamId;
 	dataMsg.base.domainType = pTunnelImpl->base.domainType;
 	dataMsg.seqNum = 0; /* (This will be replaced later) */
+	dataMsg.hasFlags = (pTunnelImpl->base.classOfService.common.compressionType != RSSL_COMP_NONE);
 
 	rsslClearEncodeIterator(&eIter);
 	rsslSetEncodeIteratorRWFVersion(&eIter, pTunnelImpl->base.pReactorChannel->majorVersion,
@@ -2675,6 +2814,83 @@ TunnelBufferImpl* tunnelStreamGetBuffer(
 	return pBufferImpl;
 }
 
+TunnelBufferImpl* tunnelStreamRetainBuffer(
+		TunnelStreamImpl *pTunnelImpl, RsslBuffer *pBuffer, RsslErrorInfo *pErrorInfo)
+{
+	TunnelBufferImpl *pBufferImpl;
+
+	/* The buffer pool is created when the stream is established. */
+	if (pTunnelImpl->_state < TSS_OPEN)
+	{
+		rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_INVALID_ARGUMENT, 
+				__FILE__, __LINE__, "This stream is not open. Only open tunnel streams can retain buffers.");
+		return NULL;
+	}
+
+	if (pBuffer->length == 0 || pBuffer->data == NULL)
+	{
+		rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_INVALID_ARGUMENT, 
+				__FILE__, __LINE__, "Cannot retain an empty buffer.");
+		return NULL;
+	}
+
+	if ((pBufferImpl = _tunnelStreamGetBufferImplObject(pTunnelImpl, pErrorInfo)) == NULL)
+		return NULL;
+
+	if (pBuffer->data >= pTunnelImpl->_recvData.data
+			&& pBuffer->data + pBuffer->length <= pTunnelImpl->_recvData.data + pTunnelImpl->_recvData.length)
+	{
+		/* Content of the message being delivered. Retained buffers are views of one pooled copy of it,
+		 * counted by the pool's block, so that the block is reused only once every view is released. */
+		if (pTunnelImpl->_recvPoolBuffer._pSliceableBuffer == NULL)
+		{
+			/* Content is still in the channel's read buffer; move it into the pool on the first retain. */
+			if (bufferPoolGet(&pTunnelImpl->_memoryBufferPool, &pTunnelImpl->_recvPoolBuffer,
+						pTunnelImpl->_recvData.length, RSSL_FALSE, RSSL_FALSE, pErrorInfo) != RSSL_RET_SUCCESS)
+			{
+				rsslQueueAddLinkToBack(&pTunnelImpl->_manager->_tunnelBufferPool,
+						&pBufferImpl->_tbpLink);
+				return NULL;
+			}
+
+			memcpy(pTunnelImpl->_recvPoolBuffer.buffer.data, pTunnelImpl->_recvData.data, pTunnelImpl->_recvData.length);
+		}
+
+		bufferPoolAddRef(&pTunnelImpl->_memoryBufferPool, &pTunnelImpl->_recvPoolBuffer, &pBufferImpl->_poolBuffer,
+				pTunnelImpl->_recvPoolBuffer.buffer.data + (pBuffer->data - pTunnelImpl->_recvData.data), pBuffer->length);
+	}
+	else
+	{
+		/* Not part of the message being delivered, so copy it. Retained buffers are sliced from the pool's
+		 * internal blocks, and do not count against the application's guaranteed output buffers. */
+		if (bufferPoolGet(&pTunnelImpl->_memoryBufferPool, &pBufferImpl->_poolBuffer, pBuffer->length,
+					RSSL_FALSE, RSSL_FALSE, pErrorInfo) != RSSL_RET_SUCCESS)
+		{
+			rsslQueueAddLinkToBack(&pTunnelImpl->_manager->_tunnelBufferPool,
+					&pBufferImpl->_tbpLink);
+			return NULL;
+		}
+
+		memcpy(pBufferImpl->_poolBuffer.buffer.data, pBuffer->data, pBuffer->length);
+	}
+
+	pBufferImpl->_startPos = pBufferImpl->_dataStartPos = pBufferImpl->_poolBuffer.buffer.data;
+	pBufferImpl->_tunnel = (RsslTunnelStream*)pTunnelImpl;
+	pBufferImpl->_maxLength = pBuffer->length;
+
+	/* _integrity is left unset, since this buffer has no room for a tunnel stream header and cannot be submitted. */
+	return pBufferImpl;
+}
+
+static void _tunnelStreamReleaseReceivedData(TunnelStreamImpl *pTunnelImpl)
+{
+	/* Memory referenced by retained buffers stays out of the pool until they are released. */
+	if (pTunnelImpl->_recvPoolBuffer._pSliceableBuffer != NULL)
+		bufferPoolRelease(&pTunnelImpl->_memoryBufferPool, &pTunnelImpl->_recvPoolBuffer);
+
+	rsslClearBuffer(&pTunnelImpl->_recvData);
+}
+
 void tunnelStreamReleaseBuffer(
 		TunnelStreamImpl *pTunnelImpl, TunnelBufferImpl *pBufferImpl)
 {
@@ -2712,6 +2928,201 @@ static RsslRet _tunnelStreamHandleEstablished(TunnelStreamImpl *pTunnelImpl, Rss
 		!= RSSL_RET_SUCCESS)
 		return RSSL_RET_FAILURE;
 
+	if (pCos->common.compressionType == RSSL_COMP_LZ4)
+	{
+		/* Message content is never larger than maxMsgSize. Received messages are decompressed into the buffer pool. */
+		pTunnelImpl->_pCompressBuffer = (char*)malloc((size_t)pCos->common.maxMsgSize);
+		pTunnelImpl->_pCompressHashTable = (RsslUInt32*)malloc(LZ4_BLOCK_HASH_TABLE_SIZE * sizeof(RsslUInt32));
+
+		if (pTunnelImpl->_pCompressBuffer == NULL || pTunnelImpl->_pCompressHashTable == NULL)
+		{
+			rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, 
+					__FILE__, __LINE__, "Failed to allocate tunnel stream compression buffers.");
+			return RSSL_RET_FAILURE;
+		}
+
+		memset(pTunnelImpl->_pCompressHashTable, 0, LZ4_BLOCK_HASH_TABLE_SIZE * sizeof(RsslUInt32));
+	}
+
+	/* Start the adaptive window small, and grow it quickly until a loss or queueing shows the limit of the stream. */
+	pTunnelImpl->_effectiveSendWindow = TS_ADAPTIVE_INITIAL_WINDOW_MSGS * pCos->common.maxMsgSize;
+	pTunnelImpl->_slowStartThreshold = pCos->flowControl.sendWindowSize;
+	pTunnelImpl->_recoverySeqNum = pTunnelImpl->_lastOutSeqNum;
+
+	return RSSL_RET_SUCCESS;
+}
+
+static void _tunnelStreamHandleAckedData(TunnelStreamImpl *pTunnelImpl, TunnelBufferImpl *pBufferImpl)
+{
+	RsslInt64 currentTime = tunnelStreamGetCurrentTimeMs(pTunnelImpl);
+	RsslInt64 rateInterval;
+	RsslInt length = pBufferImpl->_poolBuffer.buffer.length;
+	RsslInt maxMsgSize = pTunnelImpl->base.classOfService.common.maxMsgSize;
+	RsslInt minWindow = TS_ADAPTIVE_MIN_WINDOW_MSGS * maxMsgSize;
+
+	/* Estimate the round trip time as TCP does. Retransmitted messages are not measured, since the
+	 * acknowledgement could be for any of their transmissions. */
+	if (pBufferImpl->_transmitTime != 0)
+	{
+		RsslInt64 rtt = (currentTime - pBufferImpl->_transmitTime) * 1000;
+
+		if (rtt < TS_RTT_MIN_SAMPLE)
+			rtt = TS_RTT_MIN_SAMPLE;
+
+		if (!pTunnelImpl->_rttMeasured)
+		{
+			pTunnelImpl->_smoothedRtt = rtt;
+			pTunnelImpl->_rttVariance = rtt / 2;
+			pTunnelImpl->_minRtt = rtt;
+			pTunnelImpl->_minRttTime = currentTime;
+			pTunnelImpl->_rttMeasured = RSSL_TRUE;
+		}
+		else
+		{
+			RsslInt64 delta = rtt - pTunnelImpl->_smoothedRtt;
+
+			pTunnelImpl->_rttVariance += ((delta < 0 ? -delta : delta) - pTunnelImpl->_rttVariance) / 4;
+			pTunnelImpl->_smoothedRtt += delta / 8;
+			if (rtt <= pTunnelImpl->_minRtt || currentTime - pTunnelImpl->_minRttTime > TS_MIN_RTT_WINDOW)
+			{
+				pTunnelImpl->_minRtt = rtt;
+				pTunnelImpl->_minRttTime = currentTime;
+			}
+		}
+	}
+
+	/* Measure the acknowledgement rate over about one round trip. */
+	pTunnelImpl->_ackRateBytes += length;
+	rateInterval = pTunnelImpl->_smoothedRtt / 1000;
+	if (rateInterval < TS_ACK_RATE_MIN_INTERVAL)
+		rateInterval = TS_ACK_RATE_MIN_INTERVAL;
+
+	if (currentTime - pTunnelImpl->_ackRateStartTime >= rateInterval)
+	{
+		RsslUInt64 ackRate = pTunnelImpl->_ackRateBytes * 1000 / (RsslUInt64)(currentTime - pTunnelImpl->_ackRateStartTime);
+
+		pTunnelImpl->_ackRate = pTunnelImpl->_ackRate ? (pTunnelImpl->_ackRate * 3 + ackRate) / 4 : ackRate;
+		pTunnelImpl->_ackRateBytes = 0;
+		pTunnelImpl->_ackRateStartTime = currentTime;
+
+		/* If messages are waiting in queues well beyond the shortest round trip, more data in flight is not getting
+		 * through any faster. Trim the window to twice what is acknowledged in the shortest round trip. */
+		if (pTunnelImpl->_adaptiveSendWindow && pTunnelImpl->_rttMeasured
+				&& pTunnelImpl->_smoothedRtt - pTunnelImpl->_minRtt > TS_ADAPTIVE_QUEUE_DELAY * 1000
+				&& pTunnelImpl->_smoothedRtt > 2 * pTunnelImpl->_minRtt)
+		{
+			RsslInt pipeSize = (RsslInt)(pTunnelImpl->_ackRate * (RsslUInt64)pTunnelImpl->_minRtt / 1000000) * 2;
+
+			if (pipeSize < minWindow)
+				pipeSize = minWindow;
+
+			if (pTunnelImpl->_effectiveSendWindow > pipeSize)
+			{
+				pTunnelImpl->_effectiveSendWindow = pipeSize;
+				pTunnelImpl->_slowStartThreshold = pipeSize;
+			}
+		}
+	}
+
+	if (!pTunnelImpl->_adaptiveSendWindow)
+		return;
+
+	/* Only grow the window while it is being used. */
+	if (pTunnelImpl->_bytesWaitingAck * 2 < pTunnelImpl->_effectiveSendWindow)
+		return;
+
+	if (pTunnelImpl->_effectiveSendWindow < pTunnelImpl->_slowStartThreshold)
+		pTunnelImpl->_effectiveSendWindow += length;
+	else
+		pTunnelImpl->_effectiveSendWindow += maxMsgSize * length / pTunnelImpl->_effectiveSendWindow + 1;
+
+	if (pTunnelImpl->_effectiveSendWindow > pTunnelImpl->base.classOfService.flowControl.sendWindowSize)
+		pTunnelImpl->_effectiveSendWindow = pTunnelImpl->base.classOfService.flowControl.sendWindowSize;
+	if (pTunnelImpl->_effectiveSendWindow < minWindow)
+		pTunnelImpl->_effectiveSendWindow = minWindow;
+}
+
+static void _tunnelStreamHandleLostData(TunnelStreamImpl *pTunnelImpl, TunnelBufferImpl *pBufferImpl)
+{
+	RsslInt minWindow = TS_ADAPTIVE_MIN_WINDOW_MSGS * pTunnelImpl->base.classOfService.common.maxMsgSize;
+
+	if (!pTunnelImpl->_adaptiveSendWindow)
+		return;
+
+	/* Messages sent before the last reduction were sent with the larger window, so their loss is part of the same event. */
+	if (rsslSeqNumCompare(pBufferImpl->_seqNum, pTunnelImpl->_recoverySeqNum) <= 0)
+		return;
+
+	pTunnelImpl->_slowStartThreshold = pTunnelImpl->_effectiveSendWindow / 2;
+	if (pTunnelImpl->_slowStartThreshold < minWindow)
+		pTunnelImpl->_slowStartThreshold = minWindow;
+
+	pTunnelImpl->_effectiveSendWindow = pTunnelImpl->_slowStartThreshold;
+	pTunnelImpl->_recoverySeqNum = pTunnelImpl->_lastOutSeqNum;
+}
+
+void tunnelStreamGetInfo(TunnelStreamImpl *pTunnelImpl, RsslTunnelStreamInfo *pInfo)
+{
+	pInfo->bytesWaitingAck = pTunnelImpl->_bytesWaitingAck;
+	pInfo->effectiveSendWindowSize = pTunnelImpl->base.classOfService.flowControl.sendWindowSize;
+	if (pTunnelImpl->_adaptiveSendWindow && pTunnelImpl->_effectiveSendWindow < pInfo->effectiveSendWindowSize)
+		pInfo->effectiveSendWindowSize = pTunnelImpl->_effectiveSendWindow;
+	pInfo->roundTripTime = (RsslUInt32)(pTunnelImpl->_smoothedRtt / 1000);
+	pInfo->roundTripTimeVariance = (RsslUInt32)(pTunnelImpl->_rttVariance / 1000);
+	pInfo->ackRate = pTunnelImpl->_ackRate;
+	pInfo->retransmitCount = pTunnelImpl->_retransmitCount;
+}
+
+static void _tunnelStreamCompressBuffer(TunnelStreamImpl *pTunnelImpl, TunnelBufferImpl *pBufferImpl, RsslEncodeIterator *pIter)
+{
+	RsslUInt32 headerLength = (RsslUInt32)(pBufferImpl->_dataStartPos - pBufferImpl->_startPos);
+	RsslUInt32 dataLength = pBufferImpl->_poolBuffer.buffer.length - headerLength;
+	RsslUInt32 compressedLength;
+
+	if (dataLength < TS_COMPRESSION_THRESHOLD)
+		return;
+
+	/* Only keep the result if it is smaller; otherwise the content is sent as-is. */
+	if ((compressedLength = lz4BlockCompress(pBufferImpl->_dataStartPos, dataLength, pTunnelImpl->_pCompressBuffer,
+					dataLength - 1, pTunnelImpl->_pCompressHashTable)) == 0)
+		return;
+
+	memcpy(pBufferImpl->_dataStartPos, pTunnelImpl->_pCompressBuffer, compressedLength);
+	pBufferImpl->_poolBuffer.buffer.length = headerLength + compressedLength;
+	tunnelStreamDataReplaceFlags(pIter, TS_DF_COMPRESSED);
+}
+
+static RsslRet _tunnelStreamDecompressData(TunnelStreamImpl *pTunnelImpl, RsslBuffer *pDataBody, RsslErrorInfo *pErrorInfo)
+{
+	RsslUInt32 dataLength;
+	RsslRet ret;
+
+	if (pTunnelImpl->base.classOfService.common.compressionType != RSSL_COMP_LZ4)
+	{
+		rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, 
+				__FILE__, __LINE__, "Received a compressed message, but compression was not negotiated.");
+		return RSSL_RET_FAILURE;
+	}
+
+	/* Decompress into the buffer pool, so that the application can retain the result without copying it. */
+	if (bufferPoolGet(&pTunnelImpl->_memoryBufferPool, &pTunnelImpl->_recvPoolBuffer,
+				(RsslUInt32)pTunnelImpl->base.classOfService.common.maxMsgSize, RSSL_FALSE, RSSL_FALSE, pErrorInfo)
+			!= RSSL_RET_SUCCESS)
+		return RSSL_RET_FAILURE;
+
+	if ((ret = lz4BlockDecompress(pDataBody->data, pDataBody->length, pTunnelImpl->_recvPoolBuffer.buffer.data,
+					(RsslUInt32)pTunnelImpl->base.classOfService.common.maxMsgSize, &dataLength)) != RSSL_RET_SUCCESS)
+	{
+		bufferPoolRelease(&pTunnelImpl->_memoryBufferPool, &pTunnelImpl->_recvPoolBuffer);
+		rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, ret, 
+				__FILE__, __LINE__, "Failed to decompress received message.");
+		return RSSL_RET_FAILURE;
+	}
+
+	pTunnelImpl->_recvPoolBuffer.buffer.length = dataLength;
+	bufferPoolTrimUnusedLength(&pTunnelImpl->_memoryBufferPool, &pTunnelImpl->_recvPoolBuffer);
+
+	*pDataBody = pTunnelImpl->_recvPoolBuffer.buffer;
 	return RSSL_RET_SUCCESS;
 }
 
@@ -2731,6 +3142,20 @@ static RsslRet _tunnelStreamSendMessages(TunnelStreamImpl *pTunnelImpl, RsslErro
 
 		RsslBuffer *pChannelBuffer;
 		RsslEncodeIterator eIter;
+		RsslBool isRetransmission = tunnelBufferImplIsTransmitted(pBufferImpl);
+
+		if (isRetransmission)
+		{
+			/* A retransmission that was cumulatively acknowledged while queued no longer needs to be sent. */
+			if (rsslSeqNumCompare(pBufferImpl->_seqNum, pTunnelImpl->_waitAckFirstSeqNum) < 0)
+			{
+				rsslQueueRemoveLink(&pTunnelImpl->_tunnelBufferTransmitList, pLink);
+				tunnelStreamReleaseBuffer(pTunnelImpl, pBufferImpl);
+				continue;
+			}
+		}
+		else if (_tunnelStreamReserveWaitAckSlot(pTunnelImpl, pErrorInfo) != RSSL_RET_SUCCESS)
+			return RSSL_RET_FAILURE;
 
 		if (pBufferImpl->_bufferType == TS_BT_DATA)
 		{
@@ -2791,12 +3216,22 @@ static RsslRet _tunnelStreamSendMessages(TunnelStreamImpl *pTunnelImpl, RsslErro
 								!= RSSL_RET_SUCCESS)
 							return tunnelStreamHandleError(pTunnelImpl, pErrorInfo);
 
+						_tunnelStreamSchedulePersistenceCommit(pTunnelImpl, pBufferImpl->_substream);
+
 						/* Timeout should not be processed now. */
 						_tunnelStreamRemoveTimeoutBuffer(pTunnelImpl, pBufferImpl);
 						pBufferImpl->_poolBuffer.buffer = tmpBuffer;
 					}
 				}
 
+				/* Compress after any updates above, so the same content is sent if retransmitted. Content
+				 * waiting for acknowledgement counts against the send window at its compressed length. */
+				if (pTunnelImpl->_pCompressHashTable != NULL)
+				{
+					_tunnelStreamCompressBuffer(pTunnelImpl, pBufferImpl, &eIter);
+					pChannelBuffer->length = pBufferImpl->_poolBuffer.buffer.length;
+				}
+
 				tunnelBufferImplSetIsTransmitted(pBufferImpl, RSSL_TRUE);
 			}
 
@@ -2814,7 +3249,15 @@ static RsslRet _tunnelStreamSendMessages(TunnelStreamImpl *pTunnelImpl, RsslErro
 				return RSSL_RET_CHANNEL_ERROR;
 			}
 
+			/* The acknowledgement rate is measured only while data is waiting for acknowledgement. */
+			if (pTunnelImpl->_bytesWaitingAck == 0)
+			{
+				pTunnelImpl->_ackRateBytes = 0;
+				pTunnelImpl->_ackRateStartTime = tunnelStreamGetCurrentTimeMs(pTunnelImpl);
+			}
+
 			pTunnelImpl->_bytesWaitingAck += pBufferImpl->_poolBuffer.buffer.length;
+			pBufferImpl->_transmitTime = isRetransmission ? 0 : tunnelStreamGetCurrentTimeMs(pTunnelImpl);
 		}
 		else /* TS_BT_FIN */
 		{
@@ -2844,8 +3287,10 @@ static RsslRet _tunnelStreamSendMessages(TunnelStreamImpl *pTunnelImpl, RsslErro
 		rsslQueueRemoveLink(&pTunnelImpl->_tunnelBufferTransmitList,
 				pLink);
 
-		rsslQueueAddLinkToBack(&pTunnelImpl->_tunnelBufferWaitAckList,
-				pLink);
+		if (isRetransmission)
+			++pTunnelImpl->_retransmitCount;
+
+		pTunnelImpl->_waitAckRing[pBufferImpl->_seqNum & (pTunnelImpl->_waitAckRingSize - 1)] = pBufferImpl;
 
 		if (tunnelStreamDebugFlags & TS_DBG_ACKS)
 			printf("<TunnelStreamDebug streamId:%d> Sent message seqNum: %u, Latest received seqNum: %u, latest accepted seqNum: %u, last acked seqNum: %u, bytes waiting ack: %lld, send window: %lld\n", 
@@ -132,6 +132,9 @@ TunnelSubstream *tunnelSubstreamOpen(RsslTunnelStream *pTunnel,
 
 		pfOpts.currentTimeMs = tunnelStreamGetCurrentTimeMs(pSubstreamImpl->_tunnelImpl);
 		pfOpts.maxMsgSize = (RsslUInt32)pSubstreamImpl->_tunnelImpl->base.classOfService.common.maxMsgSize;
+		pfOpts.commitPolicy = pSubstreamImpl->_tunnelImpl->_persistenceCommitPolicy;
+		pfOpts.commitMsgCount = pSubstreamImpl->_tunnelImpl->_persistenceCommitCount;
+		pfOpts.commitIntervalMs = pSubstreamImpl->_tunnelImpl->_persistenceCommitInterval;
 
 		pSubstreamImpl->_pPersistFile = persistFileOpen(&pfOpts, &pSubstreamImpl->_lastInSeqNum, &pSubstreamImpl->_lastOutSeqNum, pErrorInfo);
 
@@ -1151,6 +1154,26 @@ RsslRet tunnelSubstreamClose(TunnelSubstream *pSubstream,
 	return RSSL_RET_SUCCESS;
 }
 
+RsslInt64 tunnelSubstreamGetNextExpireTime(TunnelSubstream *pSubstream)
+{
+	TunnelSubstreamImpl *pSubstreamImpl = (TunnelSubstreamImpl*)pSubstream;
+
+	if (pSubstreamImpl->_pPersistFile == NULL)
+		return RDM_QMSG_TC_INFINITE;
+
+	return persistFileGetNextCommitTime(pSubstreamImpl->_pPersistFile);
+}
+
+RsslRet tunnelSubstreamProcessTimer(TunnelSubstream *pSubstream, RsslInt64 currentTime, RsslErrorInfo *pErrorInfo)
+{
+	TunnelSubstreamImpl *pSubstreamImpl = (TunnelSubstreamImpl*)pSubstream;
+
+	if (pSubstreamImpl->_pPersistFile == NULL)
+		return RSSL_RET_SUCCESS;
+
+	return persistFileProcessTimer(pSubstreamImpl->_pPersistFile, currentTime, pErrorInfo);
+}
+
 void tunnelSubstreamDestroy(TunnelSubstream *pSubstream)
 {
 	TunnelSubstreamImpl *pSubstreamImpl = (TunnelSubstreamImpl*)pSubstream;
@@ -19,6 +19,7 @@ extern "C" {
 #include <windows.h>
 #else
 #include <sys/time.h>
+#include <time.h>
 #endif
 #include <stdlib.h>
 
@@ -35,17 +36,47 @@ RTR_C_INLINE RsslInt32 rsslSeqNumCompare(RsslUInt32 seqNum1, RsslUInt32 seqNum2)
 }
 
 
-/* Gets the current time. ticksPerMsec is used only on windows. */
-RTR_C_INLINE RsslInt64 getCurrentTimeMs(RsslInt64 ticksPerMsec)
+/* Gets the current time in microseconds, from a clock that is not affected by changes to the system time. 
+ * Only differences between values are meaningful. ticksPerMsec is used only on windows. 
+ * On Linux, CLOCK_MONOTONIC is normally read without a system call. */
+RTR_C_INLINE RsslInt64 getCurrentTimeUsec(RsslInt64 ticksPerMsec)
 {
-	RsslInt64 timeMs;
-#ifdef WIN32
+#if defined(WIN32)
 	LARGE_INTEGER	queryTime;
 
-
 	QueryPerformanceCounter(&queryTime);
-	timeMs = (RsslInt64)((double)queryTime.QuadPart / ticksPerMsec);
-	return timeMs;
+	return (RsslInt64)((double)queryTime.QuadPart * 1000 / ticksPerMsec);
+#elif defined(SOLARIS2)
+	return (RsslInt64)(gethrtime() / 1000);
+#else
+	struct timespec currentTime;
+
+	clock_gettime(CLOCK_MONOTONIC, &currentTime);
+	return (RsslInt64)currentTime.tv_sec * 1000000 + currentTime.tv_nsec / 1000;
+#endif
+}
+
+/* Gets the current time in milliseconds, from the same clock as getCurrentTimeUsec(). 
+ * Timeouts are measured with this clock, so they are not distorted when the system time is changed. */
+RTR_C_INLINE RsslInt64 getCurrentTimeMs(RsslInt64 ticksPerMsec)
+{
+	return getCurrentTimeUsec(ticksPerMsec) / 1000;
+}
+
+/* Gets the system(wall-clock) time in milliseconds since the epoch. Use only for times that must be meaningful 
+ * outside of this process, such as those saved to a file; use getCurrentTimeMs() for measuring time. */
+RTR_C_INLINE RsslInt64 getWallClockTimeMs()
+{
+	RsslInt64 timeMs;
+#ifdef WIN32
+	FILETIME		fileTime;
+	ULARGE_INTEGER	fileTime64;
+
+	/* FILETIME counts 100-nanosecond intervals since 1601. */
+	GetSystemTimeAsFileTime(&fileTime);
+	fileTime64.LowPart = fileTime.dwLowDateTime;
+	fileTime64.HighPart = fileTime.dwHighDateTime;
+	timeMs = (RsslInt64)(fileTime64.QuadPart / 10000) - 11644473600000LL;
 #else
 	struct timeval currentTime;
 
@@ -42,6 +42,9 @@ RsslWatchlist *rsslWatchlistCreate(RsslWatchlistCreateOptions *pCreateOptions,
 	baseInitOpts.streamPoolCount = pCreateOptions->itemCountHint;
 	baseInitOpts.obeyOpenWindow = pCreateOptions->obeyOpenWindow;
 	baseInitOpts.requestTimeout = pCreateOptions->requestTimeout;
+	baseInitOpts.requestRate = pCreateOptions->requestRate;
+	baseInitOpts.requestBurst = pCreateOptions->requestBurst;
+	baseInitOpts.requestPacingOrder = pCreateOptions->requestPacingOrder;
 	baseInitOpts.ticksPerMsec = pCreateOptions->ticksPerMsec;
 
 	if ((ret = wlBaseInit(&pWatchlistImpl->base, &baseInitOpts, pErrorInfo)) != RSSL_RET_SUCCESS)
@@ -53,6 +56,7 @@ RsslWatchlist *rsslWatchlistCreate(RsslWatchlistCreateOptions *pCreateOptions,
 	wlClearItemsInitOptions(&itemsInitOpts);
 	itemsInitOpts.maxOutstandingPosts = pCreateOptions->maxOutstandingPosts;
 	itemsInitOpts.postAckTimeout = pCreateOptions->postAckTimeout;
+	itemsInitOpts.enableFanoutList = pCreateOptions->enableFanoutList;
 	if (wlItemsInit(&pWatchlistImpl->items, &itemsInitOpts, pErrorInfo) != RSSL_RET_SUCCESS)
 	{
 		rsslWatchlistDestroy((RsslWatchlist*)pWatchlistImpl);
@@ -104,12 +108,21 @@ RsslInt64 rsslWatchlistProcessFTGroupPing(RsslWatchlist *pWatchlist, RsslUInt8 f
 
 	/* Received a ping for an FTGroup we're using. Reset the timer and put it on
 	 * the back of the timeout queue. */
-	rsslQueueRemoveLink(&pWatchlistImpl->items.ftGroupTimerQueue, &pGroup->qlGroups);
-	rsslQueueAddLinkToBack(&pWatchlistImpl->items.ftGroupTimerQueue, &pGroup->qlGroups);
-	pGroup->expireTime = currentTime + pWatchlistImpl->base.pRsslChannel->pingTimeout * 1000;
+	wlTimeoutQueueRemove(&pWatchlistImpl->base.ftGroupTimeouts, &pGroup->pingTimer);
+	wlTimeoutQueueAdd(&pWatchlistImpl->base.ftGroupTimeouts, &pGroup->pingTimer,
+			currentTime + pWatchlistImpl->base.pRsslChannel->pingTimeout * 1000);
 	pWatchlist->state |= RSSLWL_STF_NEED_TIMER;
 
-	return pGroup->expireTime;
+	return pGroup->pingTimer.expireTime;
+}
+
+void rsslWatchlistGetPoolStats(RsslWatchlist *pWatchlist, RsslMemoryPoolStats *pRequestPoolStats,
+		RsslMemoryPoolStats *pStreamPoolStats)
+{
+	RsslWatchlistImpl *pWatchlistImpl = (RsslWatchlistImpl*)pWatchlist;
+
+	rsslMemoryPoolGetStats(&pWatchlistImpl->base.requestPool, pRequestPoolStats);
+	rsslMemoryPoolGetStats(&pWatchlistImpl->base.streamPool, pStreamPoolStats);
 }
 
 void rsslWatchlistDestroy(RsslWatchlist *pWatchlist)
@@ -177,7 +190,7 @@ void rsslWatchlistDestroy(RsslWatchlist *pWatchlist)
 	for(i = 0; i < WL_FTGROUP_TABLE_SIZE; ++i)
 	{
 		if (pWatchlistImpl->items.ftGroupTable[i])
-			wlFTGroupRemove(&pWatchlistImpl->items, pWatchlistImpl->items.ftGroupTable[i]);
+			wlFTGroupRemove(&pWatchlistImpl->base, &pWatchlistImpl->items, pWatchlistImpl->items.ftGroupTable[i]);
 	}
 
 	while(pLink = rsslQueueRemoveFirstLink(&pWatchlistImpl->base.openStreams))
@@ -207,6 +220,7 @@ RsslRet rsslWatchlistDispatch(RsslWatchlist *pWatchlist, RsslInt64 currentTime,
 	RsslWatchlistImpl *pWatchlistImpl = (RsslWatchlistImpl*)pWatchlist;
 	RsslRet ret;
 	RsslQueueLink *pLink;
+	RsslUInt32 streamsAwaitingLogin = 0;
 
 	pWatchlistImpl->base.currentTime = currentTime;
 
@@ -432,56 +446,73 @@ RsslRet rsslWatchlistDispatch(RsslWatchlist *pWatchlist, RsslInt64 currentTime,
 		}
 	}
 
-	/* Send any item requests. */
-	RSSL_QUEUE_FOR_EACH_LINK(&pWatchlistImpl->base.streamsPendingRequest,
-			pLink)
+	/* Release any streams the request pacer now has tokens for. */
+	wlItemStreamReleasePaced(&pWatchlistImpl->base);
+
+	/* Send any item requests. Where the channel allows it, requests are packed together
+	 * into buffers of up to the channel's maxFragmentSize, and closes are sent as batches. */
+	ret = RSSL_RET_SUCCESS;
+	pWatchlistImpl->base.packRequests = (pWatchlistImpl->base.channelMaxFragmentSize > 0
+			&& wlChannelSupportsPacking(pWatchlistImpl->base.pRsslChannel)) ? RSSL_TRUE : RSSL_FALSE;
+
+	if (pWatchlistImpl->base.config.providerSupportBatch & RDM_LOGIN_BATCH_SUPPORT_CLOSES)
+		ret = wlSubmitBatchCloses(pWatchlistImpl, pErrorInfo);
+
+	if (ret >= RSSL_RET_SUCCESS)
 	{
-		WlStream *pStream = RSSL_QUEUE_LINK_TO_OBJECT(WlStream,
-				base.qlStreamsPendingRequest, pLink);
-		if ((ret = wlStreamSubmitMsg(pWatchlistImpl, pStream,
-						pErrorInfo)) < RSSL_RET_SUCCESS)
+		RSSL_QUEUE_FOR_EACH_LINK(&pWatchlistImpl->base.streamsPendingRequest,
+				pLink)
 		{
-			switch(ret)
-			{
-				case RSSL_RET_BUFFER_NO_BUFFERS:
-					pWatchlistImpl->base.watchlist.state |= RSSLWL_STF_NEED_FLUSH;
-					return RSSL_RET_SUCCESS;
-				default:
-					return ret;
+			WlStream *pStream = RSSL_QUEUE_LINK_TO_OBJECT(WlStream,
+					base.qlStreamsPendingRequest, pLink);
 
+			/* Item streams opened on services preloaded from a snapshot wait for the login 
+			 * refresh; they are sent when login processing dispatches the watchlist again. */
+			if (pWatchlistImpl->base.channelState < WL_CHS_LOGGED_IN
+					&& pStream->base.domainType != RSSL_DMT_LOGIN)
+			{
+				++streamsAwaitingLogin;
+				continue;
 			}
+
+			if ((ret = wlStreamSubmitMsg(pWatchlistImpl, pStream,
+							pErrorInfo)) < RSSL_RET_SUCCESS)
+				break;
 		}
 	}
 
-	return (pWatchlistImpl->base.streamsPendingRequest.count 
-			|| pWatchlistImpl->base.newRequests.count) ? 1 : RSSL_RET_SUCCESS;
-}
-
-RsslInt64 rsslWatchlistGetNextTimeout(RsslWatchlist *pWatchlist)
-{
-	RsslWatchlistImpl *pWatchlistImpl = (RsslWatchlistImpl*)pWatchlist;
-	RsslQueueLink *pLink;
-	RsslInt64 time = WL_TIME_UNSET;
-	
-	if ((pLink = rsslQueuePeekFront(&pWatchlistImpl->base.streamsPendingResponse)))
+	pWatchlistImpl->base.packRequests = RSSL_FALSE;
+	if (ret >= RSSL_RET_SUCCESS || ret == RSSL_RET_BUFFER_NO_BUFFERS)
 	{
-		WlStreamBase *pStream = RSSL_QUEUE_LINK_TO_OBJECT(WlStreamBase, qlStreamsPendingResponse, 
-				pLink);
-		time = pStream->requestExpireTime;
+		RsslRet writeRet;
+		if ((writeRet = wlWritePackedBuffer(pWatchlistImpl, pErrorInfo)) < RSSL_RET_SUCCESS)
+			ret = writeRet;
 	}
+	else
+		wlReleasePackedBuffer(pWatchlistImpl);
 
-	if ((pLink = rsslQueuePeekFront(&pWatchlistImpl->items.ftGroupTimerQueue)))
+	if (ret < RSSL_RET_SUCCESS)
 	{
-		WlFTGroup *pGroup = RSSL_QUEUE_LINK_TO_OBJECT(WlFTGroup, qlGroups, pLink);
-		if (pGroup->expireTime < time) time = pGroup->expireTime;
-	}
+		switch(ret)
+		{
+			case RSSL_RET_BUFFER_NO_BUFFERS:
+				pWatchlistImpl->base.watchlist.state |= RSSLWL_STF_NEED_FLUSH;
+				return RSSL_RET_SUCCESS;
+			default:
+				return ret;
 
-	if ((pLink = rsslQueuePeekFront(&pWatchlistImpl->items.postTable.timeoutQueue)))
-	{
-		WlPostRecord *pRecord = RSSL_QUEUE_LINK_TO_OBJECT(WlPostRecord, qlTimeout, pLink);
-		if (pRecord->expireTime < time) time = pRecord->expireTime;
+		}
 	}
 
+	return (pWatchlistImpl->base.streamsPendingRequest.count > streamsAwaitingLogin
+			|| pWatchlistImpl->base.newRequests.count) ? 1 : RSSL_RET_SUCCESS;
+}
+
+RsslInt64 rsslWatchlistGetNextTimeout(RsslWatchlist *pWatchlist)
+{
+	RsslWatchlistImpl *pWatchlistImpl = (RsslWatchlistImpl*)pWatchlist;
+	RsslInt64 time = wlBaseGetNextTimeout(&pWatchlistImpl->base);
+
 	if (pWatchlistImpl->items.gapExpireTime < time) time = pWatchlistImpl->items.gapExpireTime;
 
 	return time;
@@ -492,15 +523,16 @@ RsslRet rsslWatchlistProcessTimer(RsslWatchlist *pWatchlist, RsslInt64 currentTi
 {
 	RsslWatchlistImpl		*pWatchlistImpl = (RsslWatchlistImpl*)pWatchlist;
 	RsslQueueLink			*pLink;
+	WlTimeout				*pTimeout;
 	RsslStatusMsg			statusMsg;
 	RsslAckMsg				ackMsg;
 	RsslWatchlistMsgEvent	msgEvent;
 	RsslRet					ret;
 
-	if (!rsslQueueGetElementCount(&pWatchlistImpl->base.streamsPendingResponse)
-			&& !rsslQueueGetElementCount(&pWatchlistImpl->items.ftGroupTimerQueue)
+	if (!wlTimeoutQueueGetCount(&pWatchlistImpl->base.streamsPendingResponse)
+			&& !wlTimeoutQueueGetCount(&pWatchlistImpl->base.ftGroupTimeouts)
 			&& !rsslQueueGetElementCount(&pWatchlistImpl->items.gapStreamQueue)
-			&& !rsslQueueGetElementCount(&pWatchlistImpl->items.postTable.timeoutQueue)
+			&& !wlTimeoutQueueGetCount(&pWatchlistImpl->base.postAckTimeouts)
 			)
 		return RSSL_RET_SUCCESS;
 
@@ -520,20 +552,13 @@ RsslRet rsslWatchlistProcessTimer(RsslWatchlist *pWatchlist, RsslInt64 currentTi
 	/* Check stream timeouts. */
 	rssl_set_buffer_to_string(statusMsg.state.text, "Request timed out.");
 	statusMsg.state.code = RSSL_SC_TIMEOUT;
-	while ((pLink = rsslQueuePeekFront(&pWatchlistImpl->base.streamsPendingResponse)))
+	while ((pTimeout = wlTimeoutQueuePeekExpired(&pWatchlistImpl->base.streamsPendingResponse, currentTime)))
 	{
 		WlStream *pStream = (WlStream*)RSSL_QUEUE_LINK_TO_OBJECT(WlStream,
-				base.qlStreamsPendingResponse, pLink);
+				base.responseTimer, pTimeout);
 
 		statusMsg.msgBase.domainType = pStream->base.domainType;
 
-		/* Next timeout in queue has not expired yet. */
-		if (pStream->base.requestExpireTime > currentTime)
-		{
-			pWatchlistImpl->base.watchlist.state |= RSSLWL_STF_NEED_TIMER;
-			break;
-		}
-		
 		wlUnsetStreamMsgPending(&pWatchlistImpl->base, &pStream->base);
 
 		switch(pStream->base.domainType)
@@ -628,17 +653,10 @@ RsslRet rsslWatchlistProcessTimer(RsslWatchlist *pWatchlist, RsslInt64 currentTi
 	/* Check FTGroups. */
 	rssl_set_buffer_to_string(statusMsg.state.text, "Fault-tolerant Group timeout.");
 	statusMsg.state.code = RSSL_SC_TIMEOUT;
-	while ((pLink = rsslQueuePeekFront(&pWatchlistImpl->items.ftGroupTimerQueue)))
+	while ((pTimeout = wlTimeoutQueuePeekExpired(&pWatchlistImpl->base.ftGroupTimeouts, currentTime)))
 	{
 		RsslQueueLink *pStreamLink;
-		WlFTGroup *pGroup = RSSL_QUEUE_LINK_TO_OBJECT(WlFTGroup, qlGroups, pLink);
-
-		/* Next timeout in queue has not expired yet. */
-		if (pGroup->expireTime > currentTime)
-		{
-			pWatchlistImpl->base.watchlist.state |= RSSLWL_STF_NEED_TIMER;
-			break;
-		}
+		WlFTGroup *pGroup = RSSL_QUEUE_LINK_TO_OBJECT(WlFTGroup, pingTimer, pTimeout);
 
 		pWatchlistImpl->items.pCurrentFanoutFTGroup = pGroup;
 
@@ -657,7 +675,7 @@ RsslRet rsslWatchlistProcessTimer(RsslWatchlist *pWatchlist, RsslInt64 currentTi
 		pWatchlistImpl->items.pCurrentFanoutFTGroup = NULL;
 
 		if (!rsslQueueGetElementCount(&pGroup->openStreamList))
-			wlFTGroupRemove(&pWatchlistImpl->items, pGroup); 
+			wlFTGroupRemove(&pWatchlistImpl->base, &pWatchlistImpl->items, pGroup);
 
 	}
 
@@ -751,17 +769,11 @@ RsslRet rsslWatchlistProcessTimer(RsslWatchlist *pWatchlist, RsslInt64 currentTi
 	ackMsg.nakCode = RSSL_NAKC_NO_RESPONSE;
 	rssl_set_buffer_to_string(ackMsg.text, "Acknowledgement timed out.");
 
-	while ((pLink = rsslQueuePeekFront(&pWatchlistImpl->items.postTable.timeoutQueue)))
+	while ((pTimeout = wlTimeoutQueuePeekExpired(&pWatchlistImpl->base.postAckTimeouts, currentTime)))
 	{
-		WlPostRecord *pRecord = RSSL_QUEUE_LINK_TO_OBJECT(WlPostRecord, qlTimeout, pLink);
+		WlPostRecord *pRecord = RSSL_QUEUE_LINK_TO_OBJECT(WlPostRecord, ackTimer, pTimeout);
 		WlItemRequest *pItemRequest;
 
-		if (pRecord->expireTime > currentTime) 
-		{
-			pWatchlistImpl->base.watchlist.state |= RSSLWL_STF_NEED_TIMER;
-			break;
-		}
-
 		pItemRequest = (WlItemRequest*)pRecord->pUserSpec;
 		ackMsg.msgBase.domainType = pItemRequest->base.domainType;
 		ackMsg.flags = RSSL_AKMF_HAS_TEXT | RSSL_AKMF_HAS_NAK_CODE;
@@ -774,7 +786,7 @@ RsslRet rsslWatchlistProcessTimer(RsslWatchlist *pWatchlist, RsslInt64 currentTi
 		}
 
 		rsslQueueRemoveLink(&pItemRequest->openPosts, &pRecord->qlUser);
-		wlPostTableRemoveRecord(&pWatchlistImpl->items.postTable, pRecord);
+		wlPostTableRemoveRecord(&pWatchlistImpl->base, &pWatchlistImpl->items.postTable, pRecord);
 
 		if ((ret = wlSendMsgEventToItemRequest(pWatchlistImpl, &msgEvent, pItemRequest, pErrorInfo))
 				!= RSSL_RET_SUCCESS)
@@ -792,6 +804,10 @@ RsslRet rsslWatchlistProcessTimer(RsslWatchlist *pWatchlist, RsslInt64 currentTi
 	else
 		pWatchlistImpl->items.gapExpireTime = WL_TIME_UNSET;
 
+	/* Any timers that remain have not expired yet. */
+	if (wlBaseGetNextTimeout(&pWatchlistImpl->base) != WL_TIME_UNSET)
+		pWatchlistImpl->base.watchlist.state |= RSSLWL_STF_NEED_TIMER;
+
 	return RSSL_RET_SUCCESS;
 }
 
@@ -2055,6 +2071,89 @@ static RsslRet wlItemStreamOrderBroadcastSynchMsg(RsslWatchlistImpl *pWatchlistI
 	}
 }
 
+/* Delivers an update to all requests of an item stream as a single event, listing the
+ * requests' user-specified pointers in the stream info. Sets *pSent to RSSL_FALSE if the
+ * requests must instead be given the update individually. */
+static RsslRet wlFanoutItemUpdateList(RsslWatchlistImpl *pWatchlistImpl, WlItemStream *pItemStream,
+		RsslWatchlistMsgEvent *pEvent, RsslBool *pSent, RsslErrorInfo *pErrorInfo)
+{
+	WlItems *pItems = &pWatchlistImpl->items;
+	RsslQueue *requestQueues[2];
+	RsslUInt32 queueCount = 0, requestCount = 0, i;
+	RsslQueueLink *pLink;
+	WlItemRequest *pFirstRequest = NULL;
+	RsslWatchlistStreamInfo streamInfo;
+	RsslRet ret;
+
+	*pSent = RSSL_FALSE;
+
+	/* The list is only valid for the duration of the callback, so nested fanouts use the
+	 * normal path. Symbol list requests need to process each message themselves. */
+	if (pItems->fanoutListInUse || pItemStream->base.domainType == RSSL_DMT_SYMBOL_LIST)
+		return RSSL_RET_SUCCESS;
+
+	requestQueues[queueCount++] = &pItemStream->requestsOpen;
+	if (pItemStream->refreshState == WL_ISRS_PENDING_REFRESH_COMPLETE)
+		requestQueues[queueCount++] = &pItemStream->requestsPendingRefresh;
+
+	for (i = 0; i < queueCount; ++i)
+		requestCount += requestQueues[i]->count;
+
+	if (requestCount < 2)
+		return RSSL_RET_SUCCESS;
+
+	if (requestCount > pItems->fanoutListSize)
+	{
+		RsslUInt32 newSize = pItems->fanoutListSize ? pItems->fanoutListSize : 16;
+		void **newList;
+
+		while (newSize < requestCount)
+			newSize *= 2;
+
+		newList = (void**)realloc(pItems->fanoutList, newSize * sizeof(void*));
+		verify_malloc(newList, pErrorInfo, RSSL_RET_FAILURE);
+		pItems->fanoutList = newList;
+		pItems->fanoutListSize = newSize;
+	}
+
+	requestCount = 0;
+	for (i = 0; i < queueCount; ++i)
+	{
+		RSSL_QUEUE_FOR_EACH_LINK(requestQueues[i], pLink)
+		{
+			WlItemRequest *pItemRequest = 
+				RSSL_QUEUE_LINK_TO_OBJECT(WlItemRequest, base.qlStateQueue, pLink);
+
+			/* Requests that need their key added to the message must be sent it individually. */
+			if (wlItemRequestNeedsMsgKey(pItemRequest))
+				return RSSL_RET_SUCCESS;
+
+			if (!pFirstRequest)
+				pFirstRequest = pItemRequest;
+
+			pItems->fanoutList[requestCount++] = pItemRequest->base.pUserSpec;
+		}
+	}
+
+	pEvent->pRsslMsg->msgBase.streamId = pFirstRequest->base.streamId;
+
+	wlStreamInfoClear(&streamInfo);
+	streamInfo.pUserSpec = pFirstRequest->base.pUserSpec;
+	streamInfo.pUserSpecList = pItems->fanoutList;
+	streamInfo.userSpecCount = requestCount;
+	if (pFirstRequest->pRequestedService->flags & WL_RSVC_HAS_NAME)
+		streamInfo.pServiceName = &pFirstRequest->pRequestedService->serviceName;
+
+	pEvent->pStreamInfo = &streamInfo;
+	pItems->fanoutListInUse = RSSL_TRUE;
+	ret = (*pWatchlistImpl->base.config.msgCallback)(&pWatchlistImpl->base.watchlist, pEvent, pErrorInfo);
+	pItems->fanoutListInUse = RSSL_FALSE;
+	pEvent->pStreamInfo = NULL;
+
+	*pSent = RSSL_TRUE;
+	return ret;
+}
+
 static RsslRet wlFanoutItemMsgEvent(RsslWatchlistImpl *pWatchlistImpl, WlItemStream *pItemStream,
 		RsslWatchlistMsgEvent *pEvent, RsslErrorInfo *pErrorInfo)
 {
@@ -2088,6 +2187,22 @@ static RsslRet wlFanoutItemMsgEvent(RsslWatchlistImpl *pWatchlistImpl, WlItemStr
 	{
 		case RSSL_MC_UPDATE:
 
+			if (pWatchlistImpl->items.enableFanoutList)
+			{
+				RsslBool sent;
+
+				if ((ret = wlFanoutItemUpdateList(pWatchlistImpl, pItemStream, pEvent, &sent, 
+								pErrorInfo)) != RSSL_RET_SUCCESS)
+					return ret;
+
+				if (sent)
+				{
+					if (pWatchlistImpl->items.pCurrentFanoutStream != NULL) return RSSL_RET_SUCCESS;
+					else return wlItemStreamClose(&pWatchlistImpl->base, &pWatchlistImpl->items,
+							pItemStream, pErrorInfo);
+				}
+			}
+
 			RSSL_QUEUE_FOR_EACH_LINK(&pItemStream->requestsOpen, pLink)
 			{
 				WlItemRequest *pItemRequest = 
@@ -2328,7 +2443,7 @@ static RsslRet wlFanoutItemMsgEvent(RsslWatchlistImpl *pWatchlistImpl, WlItemStr
 								if (pItemStream->requestsRecovering.count)
 								{
 									/* Reset the stream since it is being freshly opened. */
-									wlItemStreamResetState(pItemStream);
+									wlItemStreamResetState(&pWatchlistImpl->base, pItemStream);
 
 									wlItemStreamSetMsgPending(&pWatchlistImpl->base, pItemStream, RSSL_TRUE);
 								}
@@ -2500,7 +2615,7 @@ static RsslRet wlFanoutItemMsgEvent(RsslWatchlistImpl *pWatchlistImpl, WlItemStr
 						return ret;
 
 				rsslQueueRemoveLink(&pItemRequest->openPosts, &pRecord->qlUser);
-				wlPostTableRemoveRecord(&pWatchlistImpl->items.postTable, pRecord);
+				wlPostTableRemoveRecord(&pWatchlistImpl->base, &pWatchlistImpl->items.postTable, pRecord);
 			}
 			/* Otherwise ignore it. */
 
@@ -2566,7 +2681,7 @@ static RsslRet wlFanoutItemMsgEvent(RsslWatchlistImpl *pWatchlistImpl, WlItemStr
 		while (pLink = rsslQueueRemoveFirstLink(&pItemRequest->openPosts))
 		{
 			WlPostRecord *pPostRecord = RSSL_QUEUE_LINK_TO_OBJECT(WlPostRecord, qlUser, pLink);
-			wlPostTableRemoveRecord(&pWatchlistImpl->items.postTable, pPostRecord);
+			wlPostTableRemoveRecord(&pWatchlistImpl->base, &pWatchlistImpl->items.postTable, pPostRecord);
 		}
 
 		if ( 
@@ -2842,6 +2957,7 @@ RsslRet rsslWatchlistSubmitMsg(RsslWatchlist *pWatchlist,
 						opts.pRequestMsg = (RsslRequestMsg*)pOptions->pRsslMsg;
 						opts.pServiceName = pOptions->pServiceName;
 						opts.pUserSpec = pOptions->pUserSpec;
+						opts.requestRank = pOptions->requestRank;
 						opts.majorVersion = pOptions->majorVersion;
 						opts.minorVersion = pOptions->minorVersion;
 
@@ -3017,7 +3133,7 @@ RsslRet rsslWatchlistSubmitMsg(RsslWatchlist *pWatchlist,
 									if ((ret = wlEncodeAndSubmitMsg(pWatchlistImpl, (RsslMsg*)&postMsg,
 													NULL, RSSL_FALSE, NULL, pErrorInfo)) < RSSL_RET_SUCCESS)
 									{
-										wlPostTableRemoveRecord(&pWatchlistImpl->items.postTable, pPostRecord);
+										wlPostTableRemoveRecord(&pWatchlistImpl->base, &pWatchlistImpl->items.postTable, pPostRecord);
 										return ret;
 									}
 
@@ -3490,6 +3606,7 @@ RsslRet rsslWatchlistSubmitMsg(RsslWatchlist *pWatchlist,
 				opts.pRequestMsg = (RsslRequestMsg*)&requestMsg;
 				opts.pServiceName = pOptions->pServiceName;
 				opts.pUserSpec = pOptions->pUserSpec;
+				opts.requestRank = pOptions->requestRank;
 				opts.majorVersion = pOptions->majorVersion;
 				opts.minorVersion = pOptions->minorVersion;
 
@@ -3588,6 +3705,20 @@ static RsslRet wlEncodeAndSubmitMsg(RsslWatchlistImpl *pWatchlistImpl,
 			pWatchlistImpl->base.pWriteCallAgainBuffer = NULL;
 	}
 
+	if (pRsslMsg && !pView && pWatchlistImpl->base.packRequests)
+	{
+		if (hasView)
+			pRsslMsg->requestMsg.flags |= RSSL_RQMF_HAS_VIEW;
+
+		/* If the message cannot fit in a packed buffer, it is written on its own. */
+		if ((ret = wlPackMsg(pWatchlistImpl, pRsslMsg, pError)) != RSSL_RET_BUFFER_TOO_SMALL)
+			return ret;
+	}
+
+	/* Write anything already packed first, so that messages are sent in order. */
+	if ((ret = wlWritePackedBuffer(pWatchlistImpl, pError)) < RSSL_RET_SUCCESS)
+		return ret;
+
 	/* Estimate the encoded message size. */
 	if (pRsslMsg)
 	{
@@ -3745,6 +3876,300 @@ static RsslRet wlEncodeAndSubmitMsg(RsslWatchlistImpl *pWatchlistImpl,
 	} while (1);
 }
 
+static void wlStreamCloseSent(RsslWatchlistImpl *pWatchlistImpl, WlStream *pStream)
+{
+	if (!pStream->base.tempStream)
+	{
+		switch(pStream->base.domainType)
+		{
+			case RSSL_DMT_LOGIN:
+			{
+				WlLoginStream *pLoginStream = (WlLoginStream*)pStream;
+				wlUnsetStreamFromPendingLists(&pWatchlistImpl->base, &pStream->base);
+				wlLoginStreamDestroy(pLoginStream);
+				break;
+			}
+			case RSSL_DMT_SOURCE:
+			{
+				WlDirectoryStream *pDirectoryStream = (WlDirectoryStream*)pStream;
+				wlUnsetStreamFromPendingLists(&pWatchlistImpl->base, &pStream->base);
+				wlDirectoryStreamDestroy(pDirectoryStream);
+				break;
+			}
+			default:
+			{
+				WlItemStream *pItemStream = (WlItemStream*)pStream;
+				wlUnsetStreamFromPendingLists(&pWatchlistImpl->base, &pItemStream->base);
+				wlItemStreamDestroy(&pWatchlistImpl->base, pItemStream);
+				break;
+			}
+		}
+	}
+	else
+	{
+		/* Stream was created only for closing, so only the base structure is allocated. */
+		wlUnsetStreamFromPendingLists(&pWatchlistImpl->base, &pStream->base);
+		free(pStream);
+	}
+}
+
+static RsslBool wlChannelSupportsPacking(RsslChannel *pChannel)
+{
+	if (!pChannel)
+		return RSSL_FALSE;
+
+	switch(pChannel->connectionType)
+	{
+		case RSSL_CONN_TYPE_SOCKET:
+		case RSSL_CONN_TYPE_ENCRYPTED:
+		case RSSL_CONN_TYPE_HTTP:
+			return RSSL_TRUE;
+		default:
+			return RSSL_FALSE;
+	}
+}
+
+static RsslRet wlWritePackedBuffer(RsslWatchlistImpl *pWatchlistImpl, RsslErrorInfo *pError)
+{
+	RsslBuffer *pBuffer = pWatchlistImpl->base.pPackedBuffer;
+	RsslError releaseError;
+	RsslRet ret;
+
+	if (!pBuffer)
+		return RSSL_RET_SUCCESS;
+
+	pWatchlistImpl->base.pPackedBuffer = NULL;
+	pWatchlistImpl->base.packedBufferMsgCount = 0;
+
+	/* Every message in the buffer has already been packed, so nothing follows the last one. */
+	pBuffer->length = 0;
+
+	if ((ret = wlWriteBuffer(pWatchlistImpl, pBuffer, pError)) < RSSL_RET_SUCCESS)
+		rsslReleaseBuffer(pBuffer, &releaseError);
+
+	return ret;
+}
+
+static void wlReleasePackedBuffer(RsslWatchlistImpl *pWatchlistImpl)
+{
+	RsslError releaseError;
+
+	if (!pWatchlistImpl->base.pPackedBuffer)
+		return;
+
+	rsslReleaseBuffer(pWatchlistImpl->base.pPackedBuffer, &releaseError);
+	pWatchlistImpl->base.pPackedBuffer = NULL;
+	pWatchlistImpl->base.packedBufferMsgCount = 0;
+}
+
+static RsslRet wlPackMsg(RsslWatchlistImpl *pWatchlistImpl, RsslMsg *pRsslMsg, RsslErrorInfo *pError)
+{
+	WlBase *pBase = &pWatchlistImpl->base;
+	RsslChannel *pChannel = pBase->pRsslChannel;
+	RsslEncodeIterator encodeIter;
+	RsslRet ret;
+
+	while (1)
+	{
+		if (!pBase->pPackedBuffer)
+		{
+			/* Packed buffers cannot be fragmented, so limit them to the channel's maxFragmentSize. */
+			if (!(pBase->pPackedBuffer = rsslGetBuffer(pChannel, pBase->channelMaxFragmentSize, 
+							RSSL_TRUE, &pError->rsslError)))
+			{
+				switch(pError->rsslError.rsslErrorId)
+				{
+					case RSSL_RET_BUFFER_NO_BUFFERS:
+						return RSSL_RET_BUFFER_NO_BUFFERS;
+					default:
+						rsslSetErrorInfoLocation(pError, __FILE__, __LINE__);
+						return pError->rsslError.rsslErrorId;
+				}
+			}
+		}
+
+		rsslClearEncodeIterator(&encodeIter);
+		rsslSetEncodeIteratorRWFVersion(&encodeIter, pChannel->majorVersion,
+				pChannel->minorVersion);
+		rsslSetEncodeIteratorBuffer(&encodeIter, pBase->pPackedBuffer);
+
+		if ((ret = rsslEncodeMsg(&encodeIter, pRsslMsg)) == RSSL_RET_SUCCESS)
+			break;
+
+		if (ret != RSSL_RET_BUFFER_TOO_SMALL)
+		{
+			rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, ret, __FILE__, __LINE__, 
+					"Message encoding failure -- %d.", ret);
+			return (ret > 0) ? RSSL_RET_FAILURE : ret;
+		}
+
+		if (pBase->packedBufferMsgCount == 0)
+		{
+			/* Message does not fit even in an empty buffer. */
+			wlReleasePackedBuffer(pWatchlistImpl);
+			return RSSL_RET_BUFFER_TOO_SMALL;
+		}
+
+		/* Not enough room left in this buffer; write it and try again with a new one. */
+		if ((ret = wlWritePackedBuffer(pWatchlistImpl, pError)) < RSSL_RET_SUCCESS)
+			return ret;
+	}
+
+	pBase->pPackedBuffer->length = rsslGetEncodedBufferLength(&encodeIter);
+
+	if (!(pBase->pPackedBuffer = rsslPackBuffer(pChannel, pBase->pPackedBuffer, &pError->rsslError)))
+	{
+		pBase->packedBufferMsgCount = 0;
+		rsslSetErrorInfoLocation(pError, __FILE__, __LINE__);
+		return pError->rsslError.rsslErrorId;
+	}
+
+	++pBase->packedBufferMsgCount;
+
+	if (pBase->pPackedBuffer->length == 0)
+		return wlWritePackedBuffer(pWatchlistImpl, pError);
+
+	return RSSL_RET_SUCCESS;
+}
+
+/* Space reserved in a batch close for the message header and the payload's containers. */
+#define WL_BATCH_CLOSE_OVERHEAD 64
+
+/* Largest space taken by one stream ID in a batch close(length and value). */
+#define WL_BATCH_CLOSE_ID_SIZE 5
+
+static RsslBool wlStreamCanBatchClose(WlStream *pStream, RsslUInt8 domainType)
+{
+	return (pStream->base.isClosing && pStream->base.domainType == domainType
+			&& domainType != RSSL_DMT_LOGIN && domainType != RSSL_DMT_SOURCE) ? RSSL_TRUE : RSSL_FALSE;
+}
+
+static RsslRet wlSubmitBatchCloses(RsslWatchlistImpl *pWatchlistImpl, RsslErrorInfo *pError)
+{
+	WlBase *pBase = &pWatchlistImpl->base;
+	RsslUInt32 maxCount;
+
+	if (!pBase->pRsslChannel || pBase->channelMaxFragmentSize <= WL_BATCH_CLOSE_OVERHEAD)
+		return RSSL_RET_SUCCESS;
+
+	maxCount = (pBase->channelMaxFragmentSize - WL_BATCH_CLOSE_OVERHEAD) / WL_BATCH_CLOSE_ID_SIZE;
+	if (maxCount > pBase->tempEncodeBuffer.length / WL_BATCH_CLOSE_ID_SIZE)
+		maxCount = pBase->tempEncodeBuffer.length / WL_BATCH_CLOSE_ID_SIZE;
+
+	while (1)
+	{
+		RsslQueueLink *pLink;
+		RsslUInt32 count = 0;
+		WlStream *pFirstStream = NULL;
+		RsslCloseMsg closeMsg;
+		RsslEncodeIterator encodeIter;
+		RsslElementList elementList;
+		RsslElementEntry elementEntry;
+		RsslArray streamIdArray;
+		RsslBuffer payload;
+		RsslRet ret;
+
+		/* Find the first item stream that needs closing. */
+		RSSL_QUEUE_FOR_EACH_LINK(&pBase->streamsPendingRequest, pLink)
+		{
+			WlStream *pStream = RSSL_QUEUE_LINK_TO_OBJECT(WlStream, base.qlStreamsPendingRequest, pLink);
+			if (wlStreamCanBatchClose(pStream, pStream->base.domainType))
+			{
+				pFirstStream = pStream;
+				break;
+			}
+		}
+
+		if (!pFirstStream)
+			return RSSL_RET_SUCCESS;
+
+		/* Encode the IDs of closing streams of the same domain. */
+		payload = pBase->tempEncodeBuffer;
+		rsslClearEncodeIterator(&encodeIter);
+		rsslSetEncodeIteratorRWFVersion(&encodeIter, pBase->pRsslChannel->majorVersion,
+				pBase->pRsslChannel->minorVersion);
+		rsslSetEncodeIteratorBuffer(&encodeIter, &payload);
+
+		rsslClearElementList(&elementList);
+		elementList.flags = RSSL_ELF_HAS_STANDARD_DATA;
+		rsslClearElementEntry(&elementEntry);
+		elementEntry.name = RSSL_ENAME_BATCH_STREAMID_LIST;
+		elementEntry.dataType = RSSL_DT_ARRAY;
+		rsslClearArray(&streamIdArray);
+		streamIdArray.primitiveType = RSSL_DT_INT;
+		streamIdArray.itemLength = 0;
+
+		if ((ret = rsslEncodeElementListInit(&encodeIter, &elementList, NULL, 0)) != RSSL_RET_SUCCESS
+				|| (ret = rsslEncodeElementEntryInit(&encodeIter, &elementEntry, 0)) != RSSL_RET_SUCCESS
+				|| (ret = rsslEncodeArrayInit(&encodeIter, &streamIdArray)) != RSSL_RET_SUCCESS)
+		{
+			rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, 
+					"Batch close encoding failure -- %d.", ret);
+			return RSSL_RET_FAILURE;
+		}
+
+		RSSL_QUEUE_FOR_EACH_LINK(&pBase->streamsPendingRequest, pLink)
+		{
+			WlStream *pStream = RSSL_QUEUE_LINK_TO_OBJECT(WlStream, base.qlStreamsPendingRequest, pLink);
+			RsslInt streamId;
+
+			if (!wlStreamCanBatchClose(pStream, pFirstStream->base.domainType))
+				continue;
+
+			streamId = pStream->base.streamId;
+			if ((ret = rsslEncodeArrayEntry(&encodeIter, NULL, &streamId)) != RSSL_RET_SUCCESS)
+			{
+				rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, 
+						"Batch close encoding failure -- %d.", ret);
+				return RSSL_RET_FAILURE;
+			}
+
+			if (++count == maxCount)
+				break;
+		}
+
+		/* A single close is sent normally. */
+		if (count < 2)
+			return RSSL_RET_SUCCESS;
+
+		if ((ret = rsslEncodeArrayComplete(&encodeIter, RSSL_TRUE)) != RSSL_RET_SUCCESS
+				|| (ret = rsslEncodeElementEntryComplete(&encodeIter, RSSL_TRUE)) != RSSL_RET_SUCCESS
+				|| (ret = rsslEncodeElementListComplete(&encodeIter, RSSL_TRUE)) != RSSL_RET_SUCCESS)
+		{
+			rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, 
+					"Batch close encoding failure -- %d.", ret);
+			return RSSL_RET_FAILURE;
+		}
+
+		payload.length = rsslGetEncodedBufferLength(&encodeIter);
+
+		rsslClearCloseMsg(&closeMsg);
+		closeMsg.msgBase.streamId = pFirstStream->base.streamId;
+		closeMsg.msgBase.domainType = pFirstStream->base.domainType;
+		closeMsg.msgBase.containerType = RSSL_DT_ELEMENT_LIST;
+		closeMsg.msgBase.encDataBody = payload;
+		closeMsg.flags |= RSSL_CLMF_HAS_BATCH;
+
+		if ((ret = wlEncodeAndSubmitMsg(pWatchlistImpl, (RsslMsg*)&closeMsg, NULL, RSSL_FALSE, NULL, 
+						pError)) < RSSL_RET_SUCCESS)
+			return ret;
+
+		/* Clean up the closed streams, which are the first count matching streams again. */
+		RSSL_QUEUE_FOR_EACH_LINK(&pBase->streamsPendingRequest, pLink)
+		{
+			WlStream *pStream = RSSL_QUEUE_LINK_TO_OBJECT(WlStream, base.qlStreamsPendingRequest, pLink);
+
+			if (!wlStreamCanBatchClose(pStream, closeMsg.msgBase.domainType))
+				continue;
+
+			wlStreamCloseSent(pWatchlistImpl, pStream);
+
+			if (--count == 0)
+				break;
+		}
+	}
+}
+
 static RsslRet wlStreamSubmitMsg(RsslWatchlistImpl *pWatchlistImpl,
 		WlStream *pStream, RsslErrorInfo *pError)
 {
@@ -3763,46 +4188,8 @@ static RsslRet wlStreamSubmitMsg(RsslWatchlistImpl *pWatchlistImpl,
 		closeMsg.msgBase.domainType = pStream->base.domainType;
 
 		if ((ret = wlEncodeAndSubmitMsg(pWatchlistImpl, (RsslMsg*)&closeMsg, NULL, RSSL_FALSE, NULL, 
-						pError) 
-					>= RSSL_RET_SUCCESS))
-		{
-			/* Stream is now closed. */
-			if (!pStream->base.tempStream)
-			{
-				switch(pStream->base.domainType)
-				{
-					case RSSL_DMT_LOGIN:
-					{
-						WlLoginStream *pLoginStream = (WlLoginStream*)pStream;
-						wlUnsetStreamFromPendingLists(&pWatchlistImpl->base, &pStream->base);
-						wlLoginStreamDestroy(pLoginStream);
-						break;
-					}
-					case RSSL_DMT_SOURCE:
-					{
-						WlDirectoryStream *pDirectoryStream = (WlDirectoryStream*)pStream;
-						wlUnsetStreamFromPendingLists(&pWatchlistImpl->base, &pStream->base);
-						wlDirectoryStreamDestroy(pDirectoryStream);
-						break;
-					}
-					default:
-					{
-						WlItemStream *pItemStream = (WlItemStream*)pStream;
-						wlUnsetStreamFromPendingLists(&pWatchlistImpl->base, &pItemStream->base);
-						wlItemStreamDestroy(&pWatchlistImpl->base, pItemStream);
-						break;
-					}
-				}
-				return ret;
-			}
-			else
-			{
-				/* Stream was created only for closing, so only the base structure is allocated. */
-				wlUnsetStreamFromPendingLists(&pWatchlistImpl->base, &pStream->base);
-				free(pStream);
-			}
-
-		}
+						pError)) >= RSSL_RET_SUCCESS)
+			wlStreamCloseSent(pWatchlistImpl, pStream);
 	}
 	else
 	{
@@ -11,6 +11,7 @@
 #include "rtr/wlServiceCache.h"
 #include "rtr/rsslRDMMsg.h"
 #include "rtr/rsslMessagePackage.h"
+#include "rtr/rsslMemoryPool.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -29,6 +30,9 @@ struct RsslWatchlistStreamInfo
 {
 	const RsslBuffer	*pServiceName;	/* Service name used to request the item, if any. */
 	void				*pUserSpec;		/* Pointer user provided when requesting this item. */
+	void				**pUserSpecList;	/* User-specified pointers of all requests receiving this message, when
+										 * fanned out as a list. Must match the layout of RsslStreamInfo. */
+	RsslUInt32			userSpecCount;	/* Number of entries in pUserSpecList. */
 };
 
 RTR_C_INLINE void wlStreamInfoClear(RsslWatchlistStreamInfo *pStreamInfo)
@@ -99,8 +103,20 @@ typedef struct
 	RsslUInt32					maxOutstandingPosts;
 	RsslUInt32					postAckTimeout;
 	RsslInt64					ticksPerMsec;
+	RsslBool					enableFanoutList;
+	RsslUInt32					requestRate;
+	RsslUInt32					requestBurst;
+	RsslUInt8					requestPacingOrder;
 } RsslWatchlistCreateOptions;
 
+/* Order in which the request pacer releases streams waiting to request. */
+typedef enum
+{
+	RSSLWL_RPO_FIFO				= 0,	/* Order in which the streams started waiting. */
+	RSSLWL_RPO_PRIORITY_CLASS	= 1,	/* Highest priority class first. */
+	RSSLWL_RPO_RANK				= 2		/* Highest user-supplied request rank first. */
+} RsslWatchlistRequestPacingOrder;
+
 /* Reactor-facing watchlist structure. */
 struct RsslWatchlist
 {
@@ -120,6 +136,15 @@ RTR_C_INLINE void rsslWatchlistClearCreateOptions(RsslWatchlistCreateOptions *pO
 RsslWatchlist *rsslWatchlistCreate(RsslWatchlistCreateOptions *pCreateOptions, 
 		RsslErrorInfo *pErrorInfo);
 
+/* Writes the watchlist's streaming item requests and cached directory to a snapshot file. */
+RsslRet rsslWatchlistSaveSnapshot(RsslWatchlist *pWatchlist, const char *fileName, 
+		RsslErrorInfo *pErrorInfo);
+
+/* Preloads the directory and submits the item requests saved in a snapshot file. 
+ * A missing file is not an error. */
+RsslRet rsslWatchlistLoadSnapshot(RsslWatchlist *pWatchlist, const char *fileName, 
+		RsslErrorInfo *pErrorInfo);
+
 /* Sets the RsslChannel used by the watchlist. Set the channel to NULL to indicate
  * disconnection. */
 RsslRet rsslWatchlistSetChannel(RsslWatchlist *pWatchlist, RsslChannel *pChannel,
@@ -128,6 +153,10 @@ RsslRet rsslWatchlistSetChannel(RsslWatchlist *pWatchlist, RsslChannel *pChannel
 /* Cleans up an RsslWatchlist. */
 void rsslWatchlistDestroy(RsslWatchlist *pWatchlist);
 
+/* Retrieves statistics about the watchlist's pools of item requests and streams. */
+void rsslWatchlistGetPoolStats(RsslWatchlist *pWatchlist, RsslMemoryPoolStats *pRequestPoolStats,
+		RsslMemoryPoolStats *pStreamPoolStats);
+
 
 /* Options for processing an RsslMsg in the watchlist. */
 typedef struct
@@ -147,6 +176,7 @@ typedef struct
 	RsslUInt32			minorVersion;
 	RsslUInt8			*pFTGroupId;
 	RsslUInt32			*pSeqNum;
+	RsslUInt8			requestRank;
 } RsslWatchlistProcessMsgOptions;
 
 RTR_C_INLINE void rsslWatchlistClearProcessMsgOptions(RsslWatchlistProcessMsgOptions *pOptions)
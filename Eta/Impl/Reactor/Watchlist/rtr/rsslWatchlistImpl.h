@@ -10,10 +10,7 @@
 
 #include "rtr/wlView.h"
 
-#include "rtr/wlService.h"
-#include "rtr/wlStream.h"
-
-#include "rtr/rsslWatchlist.h"
+#include "rtr/wlWatchlist.h"
 #include "rtr/rsslHeapBuffer.h"
 
 
@@ -23,20 +20,6 @@ extern "C" {
 
 /* Main header for the watchlist implementation. */
 
-typedef struct RsslWatchlistImpl RsslWatchlistImpl;
-
-/*** Watchlist ***/
-
-/* The watchlist structure. */
-struct RsslWatchlistImpl
-{
-	WlBase						base;
-	WlItems						items;
-	WlLogin						login;
-	WlDirectory					directory;
-	RsslQueue					services;
-};
-
 /* Callback used to process service cache updates. */
 static RsslRet wlServiceUpdateCallback(WlServiceCache *pServiceCache,
 		WlServiceCacheUpdateEvent *pEvent, RsslErrorInfo *pErrorInfo);
@@ -75,6 +58,25 @@ static RsslRet wlFanoutItemMsgEvent(RsslWatchlistImpl *pWatchlistImpl, WlItemStr
 static RsslRet wlStreamSubmitMsg(RsslWatchlistImpl *pWatchlistImpl,
 		WlStream *pStream, RsslErrorInfo *pError);
 
+/* Cleans up a stream once its close message has been sent. */
+static void wlStreamCloseSent(RsslWatchlistImpl *pWatchlistImpl, WlStream *pStream);
+
+/* Indicates whether messages can be packed on the given channel. */
+static RsslBool wlChannelSupportsPacking(RsslChannel *pChannel);
+
+/* Encodes a message into the current packed buffer, getting a new one as needed. 
+ * Returns RSSL_RET_BUFFER_TOO_SMALL if the message is too large to be packed. */
+static RsslRet wlPackMsg(RsslWatchlistImpl *pWatchlistImpl, RsslMsg *pRsslMsg, RsslErrorInfo *pError);
+
+/* Writes the current packed buffer, if any. */
+static RsslRet wlWritePackedBuffer(RsslWatchlistImpl *pWatchlistImpl, RsslErrorInfo *pError);
+
+/* Releases the current packed buffer without writing it. */
+static void wlReleasePackedBuffer(RsslWatchlistImpl *pWatchlistImpl);
+
+/* Sends closes for pending item streams as batch closes(for providers that support them). */
+static RsslRet wlSubmitBatchCloses(RsslWatchlistImpl *pWatchlistImpl, RsslErrorInfo *pError);
+
 static RsslRet wlProcessRemovedService(RsslWatchlistImpl *pWatchlistImpl,
 		WlService *pWlService, RsslErrorInfo *pErrorInfo);
 
@@ -33,6 +33,74 @@ RsslRDMMsg *wlCreateRdmMsgCopy(RsslRDMMsg *pRdmMsg, RsslBuffer *pMemoryBuffer,
 
 typedef struct WlStreamBase WlStreamBase;
 
+/* A watchlist timer. */
+typedef struct
+{
+	RsslQueueLink	qlTimeouts;
+	RsslInt64		expireTime;		/* Time at which the timer expires. */
+} WlTimeout;
+
+/* Queue of timers, ordered by expire time. Each kind of watchlist timer uses a fixed duration, 
+ * so new timers nearly always belong at the back of their queue; adding and removing a timer, 
+ * and finding the next one to expire, are constant-time. */
+typedef struct
+{
+	RsslQueue		timeouts;
+} WlTimeoutQueue;
+
+/* Initializes a timer queue. */
+RTR_C_INLINE void wlTimeoutQueueInit(WlTimeoutQueue *pQueue)
+{
+	rsslInitQueue(&pQueue->timeouts);
+}
+
+/* Adds a timer to a queue. */
+RTR_C_INLINE void wlTimeoutQueueAdd(WlTimeoutQueue *pQueue, WlTimeout *pTimeout, RsslInt64 expireTime)
+{
+	RsslQueueLink *pLink = rsslQueuePeekBack(&pQueue->timeouts);
+
+	pTimeout->expireTime = expireTime;
+
+	/* Timers may be started using slightly different clocks, so walk back past any that expire later. */
+	while (pLink && RSSL_QUEUE_LINK_TO_OBJECT(WlTimeout, qlTimeouts, pLink)->expireTime > expireTime)
+		pLink = rsslQueuePeekPrev(&pQueue->timeouts, pLink);
+
+	rsslQueueInsertAfter(&pQueue->timeouts, pLink ? pLink : &pQueue->timeouts.head, &pTimeout->qlTimeouts);
+}
+
+/* Removes a timer from a queue. */
+RTR_C_INLINE void wlTimeoutQueueRemove(WlTimeoutQueue *pQueue, WlTimeout *pTimeout)
+{
+	rsslQueueRemoveLink(&pQueue->timeouts, &pTimeout->qlTimeouts);
+}
+
+/* Returns the next timer to expire, if any. */
+RTR_C_INLINE WlTimeout *wlTimeoutQueuePeek(WlTimeoutQueue *pQueue)
+{
+	RsslQueueLink *pLink = rsslQueuePeekFront(&pQueue->timeouts);
+	return pLink ? RSSL_QUEUE_LINK_TO_OBJECT(WlTimeout, qlTimeouts, pLink) : NULL;
+}
+
+/* Returns the next timer that has expired as of currentTime, if any. */
+RTR_C_INLINE WlTimeout *wlTimeoutQueuePeekExpired(WlTimeoutQueue *pQueue, RsslInt64 currentTime)
+{
+	WlTimeout *pTimeout = wlTimeoutQueuePeek(pQueue);
+	return (pTimeout && pTimeout->expireTime <= currentTime) ? pTimeout : NULL;
+}
+
+/* Returns the time at which the next timer in the queue expires, or WL_TIME_UNSET if it is empty. */
+RTR_C_INLINE RsslInt64 wlTimeoutQueueGetNextExpireTime(WlTimeoutQueue *pQueue)
+{
+	WlTimeout *pTimeout = wlTimeoutQueuePeek(pQueue);
+	return pTimeout ? pTimeout->expireTime : WL_TIME_UNSET;
+}
+
+/* Returns the number of timers in a queue. */
+RTR_C_INLINE RsslUInt32 wlTimeoutQueueGetCount(WlTimeoutQueue *pQueue)
+{
+	return rsslQueueGetElementCount(&pQueue->timeouts);
+}
+
 static const RsslInt32 LOGIN_STREAM_ID = 1;
 static const RsslInt32 DIRECTORY_STREAM_ID = 2;
 static const RsslInt32 MIN_STREAM_ID = 3;
@@ -88,10 +156,9 @@ struct WlStreamBase
 	RsslHashLink	hlStreamId;
 	RsslQueueLink	qlStreamsList;
 	RsslQueueLink	qlStreamsPendingRequest;
-	RsslQueueLink	qlStreamsPendingResponse;
+	WlTimeout		responseTimer;				/* Timer for the response to the request, if waiting for one. */
 	RsslInt32		streamId;
 	RsslUInt8		domainType;
-	RsslInt64		requestExpireTime;			/* Time at which the request is considered timed out. */
 	RsslBool		isClosing;
 	RsslBool		tempStream;
 	RsslUInt8		requestState;
@@ -115,6 +182,7 @@ typedef struct
 	RsslWatchlistMsgCallback	*msgCallback;					/* Callback the watchlist should use to forward messages. */
 	RsslBool					obeyOpenWindow;					/* Whether the watchlist obeys a service's OpenWindow. */
 	RsslUInt32					requestTimeout;					/* Request timeout, in milliseconds. */
+	RsslUInt					providerSupportBatch;			/* Login refresh parameter, SupportBatchRequests, as sent by the provider. */
 } WlConfig;
 
 /* Represents the state of the current channel session. */
@@ -128,6 +196,57 @@ typedef enum
 									  * or directory stream receiving a CLOSED state). */
 } WlChannelState;
 
+/* Number of levels by which the request pacer orders waiting streams. */
+#define WL_RP_LEVEL_COUNT 256
+
+/* Paces item refresh requests with a token bucket, so that requesting or recovering a large number
+ * of items does not flood the provider. Tokens are counted in thousandths of a request. */
+typedef struct
+{
+	RsslUInt32			requestRate;			/* Requests per second. Pacing is disabled when zero. */
+	RsslUInt32			requestBurst;			/* Most requests that may be sent at once. */
+	RsslUInt8			order;					/* RsslWatchlistRequestPacingOrder. */
+	RsslInt64			tokens;					/* Available tokens, in thousandths of a request. */
+	RsslInt64			lastRefillTime;			/* Time at which tokens were last added, in milliseconds. */
+	RsslUInt32			waitingCount;			/* Number of streams waiting in all levels. */
+	RsslUInt8			highestLevel;			/* No waiting stream is above this level. */
+	RsslQueue			*waitingStreams;		/* Waiting streams, one queue per level(highest is released first). */
+} WlRequestPacer;
+
+/* Adds tokens for the time elapsed since the pacer was last refilled. */
+RTR_C_INLINE void wlRequestPacerRefill(WlRequestPacer *pPacer, RsslInt64 currentTime)
+{
+	RsslInt64 maxTokens = (RsslInt64)pPacer->requestBurst * 1000;
+
+	if (currentTime > pPacer->lastRefillTime)
+	{
+		pPacer->tokens += (currentTime - pPacer->lastRefillTime) * pPacer->requestRate;
+		if (pPacer->tokens > maxTokens) pPacer->tokens = maxTokens;
+	}
+
+	pPacer->lastRefillTime = currentTime;
+}
+
+/* Returns the time at which the pacer can release its next waiting stream, or WL_TIME_UNSET if none are waiting. */
+RTR_C_INLINE RsslInt64 wlRequestPacerGetNextTime(WlRequestPacer *pPacer)
+{
+	if (!pPacer->waitingCount)
+		return WL_TIME_UNSET;
+
+	if (pPacer->tokens >= 1000)
+		return pPacer->lastRefillTime;
+
+	return pPacer->lastRefillTime + (1000 - pPacer->tokens + pPacer->requestRate - 1) / pPacer->requestRate;
+}
+
+/* Tracks when to trim a slab pool(see wlBaseTrimPool()). */
+typedef struct
+{
+	RsslUInt32	watermark;		/* Number of free blocks the pool may keep. */
+	RsslUInt32	trimThreshold;	/* Number of free blocks above which the pool is next trimmed. Doubles while chunks
+								 * cannot be released, so that searching them costs little per block freed. */
+} WlPoolTrim;
+
 /* Watchlist base structure.
  * Contains elements commonly operated on by the different domain handlers. */
 typedef struct
@@ -149,11 +268,20 @@ typedef struct
 	WlChannelState		channelState;			/* Channel state. */
 	RsslChannel			*pRsslChannel;			/* Current channel, if any. */
 	RsslBuffer			*pWriteCallAgainBuffer;	/* Used to handle RSSL_RET_WRITE_CALL_AGAIN codes from rsslWrite. */
+	RsslBool			packRequests;			/* Whether stream requests are currently being packed together. */
+	RsslBuffer			*pPackedBuffer;			/* Buffer into which stream requests are being packed, if any. */
+	RsslUInt32			packedBufferMsgCount;	/* Number of messages in pPackedBuffer. */
 	WlServiceCache		*pServiceCache;			/* Serivce cache. */
 	RsslQueue			streamsPendingRequest;	/* Streams that need to send a request. */
-	RsslQueue			streamsPendingResponse;	/* Streams opened but waiting for a response. */
+	WlTimeoutQueue		streamsPendingResponse;	/* Streams opened but waiting for a response, by request timeout. */
+	WlTimeoutQueue		ftGroupTimeouts;		/* Multicast: FTGroups, by the time before which the next ping is expected. */
+	WlTimeoutQueue		postAckTimeouts;		/* Posts awaiting acknowledgement, by timeout. */
+	WlRequestPacer		requestPacer;			/* Paces item refresh requests. */
 	RsslMemoryPool		requestPool;			/* Pool of WlRequest structures. */
 	RsslMemoryPool		streamPool;				/* Pool of WlStream structures. */
+	RsslMemoryPool		bufferedMsgPool;		/* Multicast: Pool of blocks for messages buffered for reordering. */
+	WlPoolTrim			requestPoolTrim;		/* Releases memory from requestPool after a burst of requests is closed. */
+	WlPoolTrim			streamPoolTrim;			/* Releases memory from streamPool after a burst of streams is closed. */
 	RsslInt64			currentTime;			/* Latest timestamp set by caller, in milliseconds. */
 	RsslUInt			gapRecovery;			/* Multicast: Whether to recover from sequence number gaps. */
 	RsslUInt			gapTimeout;				/* Multicast: Time to wait for a sequence gap to resolve itself before recovering. */
@@ -163,6 +291,10 @@ typedef struct
 	RsslInt64			ticksPerMsec;			/* Ticks per millisecond. Used when getting current time (windows only) */
 } WlBase;
 
+/* Size of the blocks used for buffering multicast messages, including the WlBufferedMsg header. 
+ * Larger messages are allocated individually. */
+#define WL_BUFFERED_MSG_BLOCK_SIZE 2048
+
 /* Options for initializing the base structure. */
 typedef struct
 {
@@ -174,6 +306,9 @@ typedef struct
 	int								streamPoolCount;		/* Size of WlStream pool. */
 	RsslBool						obeyOpenWindow;			/* Whether the watchlist should obey a service's OpenWinow. */
 	RsslUInt32						requestTimeout;			/* Time a stream will wait for a response, in milliseconds. */
+	RsslUInt32						requestRate;			/* Item refresh requests per second, or 0 to send them as soon as possible. */
+	RsslUInt32						requestBurst;			/* Most item refresh requests the pacer sends at once. */
+	RsslUInt8						requestPacingOrder;		/* RsslWatchlistRequestPacingOrder. */
 	RsslInt64						ticksPerMsec;			/* Ticks per millisecond. Used when getting current time (windows only) */
 } WlBaseInitOptions;
 
@@ -183,6 +318,18 @@ RsslRet wlBaseInit(WlBase *pBase, WlBaseInitOptions *pOpts, RsslErrorInfo *pErro
 /* Cleans up a WlBase structure. */
 void wlBaseCleanup(WlBase *pBase);
 
+/* Returns the time at which the next of the watchlist's timers expires, or WL_TIME_UNSET if none are running. */
+RTR_C_INLINE RsslInt64 wlBaseGetNextTimeout(WlBase *pBase)
+{
+	RsslInt64 time = wlTimeoutQueueGetNextExpireTime(&pBase->streamsPendingResponse), nextTime;
+
+	if ((nextTime = wlTimeoutQueueGetNextExpireTime(&pBase->ftGroupTimeouts)) < time) time = nextTime;
+	if ((nextTime = wlTimeoutQueueGetNextExpireTime(&pBase->postAckTimeouts)) < time) time = nextTime;
+	if ((nextTime = wlRequestPacerGetNextTime(&pBase->requestPacer)) < time) time = nextTime;
+
+	return time;
+}
+
 /* Adds a request to the watchlist. */
 void wlAddRequest(WlBase *pBase, WlRequestBase *pRequestBase);
 
@@ -232,6 +379,9 @@ void wlUnsetStreamFromPendingLists(WlBase *pBase, WlStreamBase *pStreamBase);
 /* Retrieves an unused stream ID. */
 RsslInt32 wlBaseTakeStreamId(WlBase *pBase);
 
+/* Releases memory from a pool whose blocks were freed, once it holds more free blocks than its watermark. */
+void wlBaseTrimPool(RsslMemoryPool *pPool, WlPoolTrim *pPoolTrim);
+
 /* Retrieves an unused stream ID. */
 RsslInt32 wlBaseTakeProviderStreamId(WlBase *pBase);
 
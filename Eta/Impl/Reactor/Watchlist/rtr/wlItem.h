@@ -37,7 +37,9 @@ typedef enum
 												 * but currently in excess of service OpenWindow. */
 	WL_ISRS_REQUEST_REFRESH				= 2,	/* Need to request a refresh. */
 	WL_ISRS_PENDING_REFRESH				= 3,	/* Currently waiting for a refresh .*/
-	WL_ISRS_PENDING_REFRESH_COMPLETE	= 4		/* Recevied partial refresh, need the rest. */
+	WL_ISRS_PENDING_REFRESH_COMPLETE	= 4,	/* Recevied partial refresh, need the rest. */
+	WL_ISRS_PENDING_PACER				= 5		/* Need to request a refresh, 
+												 * but waiting for the request pacer. */
 } WlItemStreamRefreshState;
 
 /* Indicates current status of the stream. */
@@ -77,6 +79,7 @@ struct WlItemStream
 	WlStreamAttributes	streamAttributes;			/* Stream attributes. */
 	RsslUInt8			priorityClass;				/* Stream's current priority class. */
 	RsslUInt16			priorityCount;				/* Stream's current priority count. */
+	RsslUInt8			pacerLevel;					/* Level at which the stream waits in the request pacer. */
 	RsslQueue			requestsRecovering;			/* Requests waiting to send a request message. */
 	RsslQueue			requestsPendingRefresh;		/* Requests waiting for a refresh. */
 	RsslQueue			requestsOpen;				/* Requests that have received their complete refresh. */
@@ -102,7 +105,7 @@ RsslRet wlItemStreamInit(WlItemStream *pItemStream, WlStreamAttributes *pStreamA
 
 /* Resets a stream to its initial state (generally used when transitioning a stream
  * from non-streaming to streaming). */
-void wlItemStreamResetState(WlItemStream *pItemStream);
+void wlItemStreamResetState(WlBase *pBase, WlItemStream *pItemStream);
 
 
 /* Creates an item stream. */
@@ -142,6 +145,7 @@ struct WlItemRequest
 	RsslUInt8				containerType;			/* Container type of the request. */
 	RsslUInt8				priorityClass;			/* Priority class of this request. */
 	RsslUInt16				priorityCount;			/* Priority count of this request. */
+	RsslUInt8				requestRank;			/* User-supplied rank, used to order paced requests. */
 	RsslQos					qos;					/* Qos of this request, if any. */
 	RsslQos					worstQos;				/* Worst Qos of this request, if any. */
 	RsslQos					staticQos;				/* Static QoS, if established. */
@@ -215,11 +219,10 @@ void wlItemGroupRemove(WlItemGroup *pItemGroup);
 /* Represents a fault-tolerant multicast group. */
 struct WlFTGroup
 {
-	RsslQueueLink	qlGroups;			/* Group list list. */
+	WlTimeout		pingTimer;			/* Expires at the next time before which we should receive 
+										 * a ping for this group. */
 	RsslUInt8		ftGroupId;			/* FTGroup ID. */
 	RsslQueue		openStreamList;		/* List of streams provided by this group. */
-	RsslInt64		expireTime;			/* Next time before which we should receive a ping for
-										 * this group. */
 };
 
 /* Adds an item stream to an FTGroup. Creates the FTGroup if it does not exist. */
@@ -227,10 +230,10 @@ RsslRet wlFTGroupAddStream(WlBase *pBase, WlItems *pItems, RsslUInt8 ftGroupId,
 		WlItemStream *pItemStream, RsslErrorInfo *pErrorInfo);
 
 /* Removes an item stream from an FTGroup. Destroys the FTGroup if it is emptied. */
-void wlFTGroupRemoveStream(WlItems *pItems, WlItemStream *pItemStream);
+void wlFTGroupRemoveStream(WlBase *pBase, WlItems *pItems, WlItemStream *pItemStream);
 
 /* Removes an FTGroup from the table of groups and destroys it (used during general cleanup). */
-void wlFTGroupRemove(WlItems *pItems, WlFTGroup *pGroup);
+void wlFTGroupRemove(WlBase *pBase, WlItems *pItems, WlFTGroup *pGroup);
 
 
 /* Handles item requests. */
@@ -241,8 +244,6 @@ struct WlItems
 	WlPostTable		postTable;					/* Pool of posts awaiting acknowledgements. */
 	WlFTGroup*		ftGroupTable[WL_FTGROUP_TABLE_SIZE];
 												/* FTGroup table. */
-	RsslQueue		ftGroupTimerQueue;			/* FTGroup list. Should be ordered
-												 * by each group's expireTime. */
 	RsslQueue		gapStreamQueue;				/* Streams that have detected a gap. */
 	RsslInt64		gapExpireTime;				/* Time at which streams begin any recovery from
 												 * gaps. */
@@ -250,6 +251,11 @@ struct WlItems
 												 * fanning out. */
 	WlItemGroup		*pCurrentFanoutGroup;
 	WlFTGroup		*pCurrentFanoutFTGroup;
+	RsslBool		enableFanoutList;			/* Deliver updates once per stream, with a list of the
+												 * requests' user-specified pointers. */
+	RsslBool		fanoutListInUse;			/* The fanout list is currently held by a callback. */
+	void			**fanoutList;				/* User-specified pointers for the current update. */
+	RsslUInt32		fanoutListSize;				/* Capacity of fanoutList. */
 };
 
 /* Options for wlItemsInit. */
@@ -257,12 +263,14 @@ typedef struct
 {
 	RsslUInt32 maxOutstandingPosts;	/* Acknowledgement pool limit. */
 	RsslUInt32 postAckTimeout;		/* Timeout for acks of onstream posts. */
+	RsslBool enableFanoutList;		/* Deliver updates to several requests as one event. */
 } WlItemsInitOptions;
 
 RTR_C_INLINE void wlClearItemsInitOptions(WlItemsInitOptions *pOpts)
 {
 	pOpts->maxOutstandingPosts = 100000;
 	pOpts->postAckTimeout = 15000;
+	pOpts->enableFanoutList = RSSL_FALSE;
 }
 
 /* Initializes the WlItems structure. */
@@ -288,6 +296,7 @@ typedef struct
 	void*			viewElemList;
 	RsslUInt32		viewElemCount;
 	void			*pUserSpec;
+	RsslUInt8		requestRank;
 	RsslUInt		slDataStreamFlags;
 	RsslUInt32		majorVersion;
 	RsslUInt32		minorVersion;
@@ -330,6 +339,14 @@ void wlItemStreamRemoveRequest(WlItemStream *pItemStream, WlItemRequest *pItemRe
 RsslRet wlItemStreamClose(WlBase *pBase, WlItems *pItems, WlItemStream *pItemStream,
 		RsslErrorInfo *pErrorInfo);
 
+/* Indicates whether messages sent to this request need the request's message key added. */
+RTR_C_INLINE RsslBool wlItemRequestNeedsMsgKey(WlItemRequest *pItemRequest)
+{
+	return (pItemRequest->requestMsgFlags & RSSL_RQMF_MSG_KEY_IN_UPDATES
+			|| (pItemRequest->flags & WL_IRQF_PROV_DRIVEN &&
+				!(pItemRequest->flags & WL_IRQF_HAS_PROV_KEY))) ? RSSL_TRUE : RSSL_FALSE;
+}
+
 /* Sends a message to an item request. */
 RsslRet wlItemRequestSendMsgEvent(WlBase *pBase,
 		RsslWatchlistMsgEvent *pEvent, WlItemRequest *pItemRequest, RsslErrorInfo *pErrorInfo);
@@ -344,6 +361,9 @@ void wlItemStreamSetMsgPending(WlBase *pBase, WlItemStream *pItemStream, RsslBoo
 /* Removes an item stream from the message pending queue. */
 void wlItemStreamUnsetMsgPending(WlBase *pBase, WlItemStream *pItemStream);
 
+/* Sends refresh requests for streams waiting in the request pacer, as far as its tokens allow. */
+void wlItemStreamReleasePaced(WlBase *pBase);
+
 /* Checks if requests can be made due to room in a service's OpenWindow. */
 void wlItemStreamCheckOpenWindow(WlBase *pBase, WlService *pWlService);
 
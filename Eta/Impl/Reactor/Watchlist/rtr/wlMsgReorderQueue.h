@@ -23,7 +23,9 @@ extern "C" {
 typedef enum
 {
 	WL_BFMSG_NONE				= 0x00,	/* None. */
-	WL_BFMSG_HAS_FT_GROUP_ID	= 0x01	/* FTGroupID is present. */
+	WL_BFMSG_HAS_FT_GROUP_ID	= 0x01,	/* FTGroupID is present. */
+	WL_BFMSG_ALLOCATED			= 0x02	/* Message was too large for the buffered message pool and 
+										 * was allocated individually. */
 } WlBufferedMsgFlags;
 
 /* Queue for buffering messages.
@@ -35,6 +37,7 @@ typedef struct
 	RsslUInt8		ftGroupId;	/* FTGroupID associated with the message (under normal circumstances 
 								 * this shouldn't change within a stream). */
 	RsslUInt32		seqNum;		/* Sequence number that was received with this message. */
+	RsslMemoryPool	*pPool;		/* Pool the message was taken from. */
 } WlBufferedMsg;
 
 typedef struct
@@ -49,7 +52,8 @@ void wlMsgReorderQueueInit(WlMsgReorderQueue *pQueue);
 /* Cleans up a WlMsgReorderQueue. */
 void wlMsgReorderQueueCleanup(WlMsgReorderQueue *pQueue);
 
-/* Adds a message to the queue. */
+/* Adds a message to the queue. The message is copied into a block from the watchlist's buffered 
+ * message pool if it fits. */
 RsslRet wlMsgReorderQueuePush(WlMsgReorderQueue *pQueue, RsslMsg *pRsslMsg,
 		RsslUInt32 seqNum, RsslUInt8 *pFTGroupId, WlBase *pBase, RsslErrorInfo *pErrorInfo);
 
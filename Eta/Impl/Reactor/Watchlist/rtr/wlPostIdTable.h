@@ -27,7 +27,7 @@ typedef struct
 {
 	RsslQueueLink	qlUser;			/* Link for either the pool or the stream's list of
 									 * open records. */
-	RsslQueueLink	qlTimeout;
+	WlTimeout		ackTimer;		/* Expires when this post is assumed to have been lost. */
 	void			*pUserSpec;		/* General pointer (intended to point to a WlItemRequest) */
 
 	RsslHashLink	hlTable;
@@ -38,7 +38,6 @@ typedef struct
 	RsslUInt32		seqNum;			/* Sequence number. */
 	RsslBool		fromAckMsg;		/* Indicates whether the record is being used to match
 									 * an AckMsg, rather than checking PostMsg duplicate. */
-	RsslInt64		expireTime;		/* Time at which this post is assumed to have been lost.  */
 } WlPostRecord;
 
 typedef struct
@@ -46,7 +45,6 @@ typedef struct
 	RsslQueue 		pool;				/* Pool of WlPostRecord structures. */
 	RsslHashTable	records;			/* Table of active post records. */
 	RsslUInt32		postAckTimeout;		/* Timeout for acknowledgement of posts. */
-	RsslQueue		timeoutQueue;		/* Queue of outstanding posts, by their expire time. */
 } WlPostTable;
 
 /* Initializes a Post ID table. */
@@ -61,7 +59,7 @@ RTR_C_INLINE WlPostRecord *wlPostTableAddRecord(WlBase *pBase, WlPostTable *pTab
 		RsslPostMsg *pPostMsg, RsslErrorInfo *pErrorInfo);
 
 /* Removes a record from the Post ID table. */
-RTR_C_INLINE void wlPostTableRemoveRecord(WlPostTable *pTable, WlPostRecord *pRecord);
+RTR_C_INLINE void wlPostTableRemoveRecord(WlBase *pBase, WlPostTable *pTable, WlPostRecord *pRecord);
 
 /* Matches an RsslAckMsg to a post in the table. */
 RTR_C_INLINE WlPostRecord *wlPostTableFindRecord(WlPostTable *pTable, RsslAckMsg *pAckMsg);
@@ -125,13 +123,12 @@ RTR_C_INLINE RsslRet wlPostTableInit(WlPostTable *pTable, RsslUInt32 maxPoolSize
 
 	memset(pTable, 0, sizeof(WlPostTable));
 
-	if ((ret = rsslHashTableInit(&pTable->records, maxPoolSize, wlPostRecordSum, wlPostRecordCompare, 
+	if ((ret = rsslHashTableInitOpenAddressing(&pTable->records, maxPoolSize, wlPostRecordSum, wlPostRecordCompare, 
 			RSSL_FALSE, pErrorInfo)) != RSSL_RET_SUCCESS)
 		return ret;
 
 	pTable->postAckTimeout = postAckTimeout;
 	rsslInitQueue(&pTable->pool);
-	rsslInitQueue(&pTable->timeoutQueue);
 
 	for (ui = 0; ui < maxPoolSize; ++ui)
 	{
@@ -282,18 +279,18 @@ RTR_C_INLINE WlPostRecord *wlPostTableAddRecord(WlBase *pBase, WlPostTable *pTab
 
 	/* Add timer. */
 	/* Time is currently only set when dispatching, so we must get an up-to-date time. */
-	pRecord->expireTime = getCurrentTimeMs(pBase->ticksPerMsec) + pTable->postAckTimeout;
-	rsslQueueAddLinkToBack(&pTable->timeoutQueue, &pRecord->qlTimeout);
+	wlTimeoutQueueAdd(&pBase->postAckTimeouts, &pRecord->ackTimer, 
+			getCurrentTimeMs(pBase->ticksPerMsec) + pTable->postAckTimeout);
 	pBase->watchlist.state |= RSSLWL_STF_NEED_TIMER;
 
 	return pRecord;
 }
 
-RTR_C_INLINE void wlPostTableRemoveRecord(WlPostTable *pTable, WlPostRecord *pRecord)
+RTR_C_INLINE void wlPostTableRemoveRecord(WlBase *pBase, WlPostTable *pTable, WlPostRecord *pRecord)
 {
 	rsslHashTableRemoveLink(&pTable->records, &pRecord->hlTable);
 	rsslQueueAddLinkToBack(&pTable->pool, &pRecord->qlUser);
-	rsslQueueRemoveLink(&pTable->timeoutQueue, &pRecord->qlTimeout);
+	wlTimeoutQueueRemove(&pBase->postAckTimeouts, &pRecord->ackTimer);
 }
 
 
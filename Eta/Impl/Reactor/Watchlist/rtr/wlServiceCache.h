@@ -37,6 +37,8 @@ typedef struct
 	RsslUInt32			stateUpdateFlags;
 	RsslUInt32			loadUpdateFlags;
 	void				*pUserSpec;
+	RsslBool			preloaded;				/* Service was preloaded from a watchlist snapshot 
+												 * and the provider has not yet confirmed it. */
 	RsslQueueLink		_fullListLink;			/* Link for WlServiceCache full list. */
 	RsslHashLink		_nameLink;				/* Link for WlServiceCache _servicesByName. */
 	RsslHashLink		_idLink;				/* Link for WlServiceCache _servicesById. */
@@ -86,6 +88,9 @@ struct WlServiceCache
 	WlServiceCacheUpdateCallback	*_serviceUpdateCallback;	/* User-specified service update 
 																   event callback. */
 	RsslBuffer						tempMemBuffer;
+	RsslBool						_hasPreloadedServices;		/* Cache contains preloaded services 
+																   that the next directory refresh 
+																   must reconcile. */
 };
 
 typedef struct
@@ -110,6 +115,13 @@ void wlServiceCacheDestroy(WlServiceCache *pServiceCache);
 RsslRet wlServiceCacheProcessDirectoryMsg(WlServiceCache *pServiceCache, 
 		RsslChannel *pChannel, RsslRDMDirectoryMsg *pDirectoryMsg, RsslErrorInfo *pErrorInfo);
 
+/* Adds the services of a saved directory refresh to the cache, so that restored requests can
+ * be matched to their services before the provider's directory arrives. The first directory 
+ * refresh received afterwards updates the services it contains instead of clearing the cache,
+ * and deletes any preloaded service it does not contain. */
+RsslRet wlServiceCachePreload(WlServiceCache *pServiceCache, 
+		RsslRDMDirectoryRefresh *pDirectoryRefresh, RsslErrorInfo *pErrorInfo);
+
 RsslRet wlServiceCacheProcessInactiveChannel(WlServiceCache *pServiceCache, 
 		RsslChannel *pChannel, RsslErrorInfo *pErrorInfo);
 
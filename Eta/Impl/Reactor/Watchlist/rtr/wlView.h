@@ -71,14 +71,19 @@ WlView *wlViewCreate(void *elemList, RsslUInt32 elemCount, RsslUInt viewType,
 
 void wlViewDestroy(WlView *pView);
 
-/* If the viewType is RDM_VIEW_TYPE_FIELD_ID_LIST, the aggregate viewElemList will consist of 
- * these.*/
+/* If the viewType is RDM_VIEW_TYPE_FIELD_ID_LIST, the aggregate view tracks fields in pages, each
+ * covering a contiguous range of field IDs. Pages are only allocated for ranges that have been used,
+ * and the bitmaps let the view be compared and encoded a word at a time. */
+#define WL_VIEW_FIELD_PAGE_SIZE		256
+#define WL_VIEW_FIELD_PAGE_WORDS	(WL_VIEW_FIELD_PAGE_SIZE / 64)
+#define WL_VIEW_FIELD_PAGE_COUNT	(65536 / WL_VIEW_FIELD_PAGE_SIZE)
+
 typedef struct
 {
-	RsslFieldId	fieldId;
-	RsslBool	committed;
-	RsslUInt32	count;
-} WlViewField;
+	RsslUInt64	present[WL_VIEW_FIELD_PAGE_WORDS];		/* Fields requested by at least one view. */
+	RsslUInt64	committed[WL_VIEW_FIELD_PAGE_WORDS];	/* Fields in the last view that was sent. */
+	RsslUInt32	count[WL_VIEW_FIELD_PAGE_SIZE];			/* Number of merged views requesting each field. */
+} WlViewFieldPage;
 
 /* If the viewType is RDM_VIEW_TYPE_ELEMENT_NAME_LIST, the aggregate viewElemList will consist of 
  * these.*/
@@ -99,8 +104,10 @@ typedef struct
 	RsslQueue	committedViews;		/* Views that have been added to the overall view,
 									 * and won't need not be undone. */
 	RsslUInt32	elemCapacity;		/* Max capacity of viewElemList. */
-	RsslUInt32	elemCount;			/* Number of actual fields in viewElemList. */
-	void		*elemList;			/* List of aggregated elements. */
+	RsslUInt32	elemCount;			/* Number of actual fields in viewElemList(for field ID views,
+									 * the number of fields requested by at least one view). */
+	void		*elemList;			/* List of aggregated elements(element name views only). */
+	WlViewFieldPage	**fieldPages;	/* Pages of aggregated fields, indexed by field ID(field ID views only). */
 } WlAggregateView;
 
 /* Initializes an aggregate view structure. */
@@ -0,0 +1,39 @@
+/*
+ * This source code is provided under the Apache 2.0 license and is provided
+ * AS IS with no warranty or guarantee of fit for purpose.  See the project's 
+ * LICENSE.md for details. 
+ * Copyright Thomson Reuters 2015. All rights reserved.
+*/
+
+#ifndef WL_WATCHLIST_H
+#define WL_WATCHLIST_H
+
+#include "rtr/wlService.h"
+#include "rtr/wlStream.h"
+
+#include "rtr/rsslWatchlist.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Watchlist structure. Included by watchlist source files that need its members, without 
+ * the internal function declarations in rsslWatchlistImpl.h. */
+
+typedef struct RsslWatchlistImpl RsslWatchlistImpl;
+
+/* The watchlist structure. */
+struct RsslWatchlistImpl
+{
+	WlBase						base;
+	WlItems						items;
+	WlLogin						login;
+	WlDirectory					directory;
+	RsslQueue					services;
+};
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
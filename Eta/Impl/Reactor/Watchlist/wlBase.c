@@ -9,6 +9,8 @@
 
 RsslUInt32 wlStreamAttributesHashSum(void *pKey)
 {
+	/* This sum must be rsslMsgKeyHash(), as it is also registered with the transport as the stream's 
+	 * multicast hash ID(see RSSL_REGISTER_HASH_ID). */
 	return rsslMsgKeyHash(&((WlStreamAttributes*)pKey)->msgKey);
 }
 
@@ -71,6 +73,42 @@ RsslRDMMsg *wlCreateRdmMsgCopy(RsslRDMMsg *pRdmMsg, RsslBuffer *pMemoryBuffer,
 	}
 }
 
+/* Number of blocks the request and stream pools grow by. */
+#define WL_POOL_CHUNK_BLOCK_COUNT 1024
+
+/* Pools whose initial blocks take at least this much memory are backed by huge pages, so that walking 
+ * a large number of streams or requests does not miss the TLB as often. */
+#define WL_POOL_HUGE_PAGE_THRESHOLD (2 * 1024 * 1024)
+
+static RsslUInt32 wlBasePoolFlags(int blockSize, int blockCount)
+{
+	return ((RsslUInt64)blockSize * (RsslUInt64)(blockCount > 0 ? blockCount : 0) >= WL_POOL_HUGE_PAGE_THRESHOLD) ?
+		RSSL_MPLF_HUGE_PAGES : RSSL_MPLF_NONE;
+}
+
+/* Pools keep the blocks they were created with, plus one chunk so that opening and closing a few streams does not
+ * repeatedly allocate and release a chunk. */
+static void wlBaseInitPoolTrim(WlPoolTrim *pPoolTrim, int blockCount)
+{
+	pPoolTrim->watermark = (RsslUInt32)(blockCount > 0 ? blockCount : 0) + WL_POOL_CHUNK_BLOCK_COUNT;
+	pPoolTrim->trimThreshold = pPoolTrim->watermark;
+}
+
+void wlBaseTrimPool(RsslMemoryPool *pPool, WlPoolTrim *pPoolTrim)
+{
+	RsslUInt32 freeBlocks;
+
+	if (rsslQueueGetElementCount(&pPool->blocks) <= pPoolTrim->trimThreshold)
+		return;
+
+	rsslMemoryPoolTrim(pPool, pPoolTrim->watermark);
+
+	/* Chunks that still have blocks in use could not be released. Don't search them again until twice as many
+	 * blocks are free. */
+	freeBlocks = rsslQueueGetElementCount(&pPool->blocks);
+	pPoolTrim->trimThreshold = (freeBlocks > pPoolTrim->watermark) ? freeBlocks * 2 : pPoolTrim->watermark;
+}
+
 RsslRet wlBaseInit(WlBase *pBase, WlBaseInitOptions *pOpts, RsslErrorInfo *pErrorInfo)
 {
 	WlServiceCacheCreateOptions		serviceCacheOpts;
@@ -108,6 +146,28 @@ RsslRet wlBaseInit(WlBase *pBase, WlBaseInitOptions *pOpts, RsslErrorInfo *pErro
 	pBase->config.msgCallback = pOpts->msgCallback;
 	pBase->config.obeyOpenWindow = pOpts->obeyOpenWindow;
 	pBase->config.requestTimeout = pOpts->requestTimeout;
+
+	if (pOpts->requestRate)
+	{
+		RsslUInt32 i;
+
+		if (!(pBase->requestPacer.waitingStreams = (RsslQueue*)malloc(WL_RP_LEVEL_COUNT * sizeof(RsslQueue))))
+		{
+			rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, 
+					"Memory allocation failure.");
+			wlBaseCleanup(pBase);
+			return RSSL_RET_FAILURE;
+		}
+
+		for (i = 0; i < WL_RP_LEVEL_COUNT; ++i)
+			rsslInitQueue(&pBase->requestPacer.waitingStreams[i]);
+
+		pBase->requestPacer.requestRate = pOpts->requestRate;
+		pBase->requestPacer.requestBurst = pOpts->requestBurst ? pOpts->requestBurst : 1;
+		pBase->requestPacer.order = pOpts->requestPacingOrder;
+		pBase->requestPacer.tokens = (RsslInt64)pBase->requestPacer.requestBurst * 1000;
+	}
+
 	pBase->watchlist.state = 0;
 	pBase->channelState = WL_CHS_START;
 	pBase->pRsslChannel = NULL;
@@ -118,21 +178,21 @@ RsslRet wlBaseInit(WlBase *pBase, WlBaseInitOptions *pOpts, RsslErrorInfo *pErro
 	pBase->nextProviderStreamId = MIN_STREAM_ID;
 	pBase->ticksPerMsec = pOpts->ticksPerMsec;
 
-	if ((ret = rsslHashTableInit(&pBase->requestsByStreamId, 10007, rsslHashU32Sum, 
+	if ((ret = rsslHashTableInitOpenAddressing(&pBase->requestsByStreamId, 10007, rsslHashU32Sum, 
 			rsslHashU32Compare, RSSL_TRUE, pErrorInfo)) != RSSL_RET_SUCCESS)
 	{
 		wlBaseCleanup(pBase);
 		return ret;
 	}
 
-	if ((ret = rsslHashTableInit(&pBase->openStreamsByAttrib, 100003, wlStreamAttributesHashSum, 
+	if ((ret = rsslHashTableInitOpenAddressing(&pBase->openStreamsByAttrib, 100003, wlStreamAttributesHashSum, 
 			wlStreamAttributesHashCompare, RSSL_TRUE, pErrorInfo)) != RSSL_RET_SUCCESS)
 	{
 		wlBaseCleanup(pBase);
 		return ret;
 	}
 
-	if ((ret = rsslHashTableInit(&pBase->streamsById, 100003, rsslHashU32Sum, 
+	if ((ret = rsslHashTableInitOpenAddressing(&pBase->streamsById, 100003, rsslHashU32Sum, 
 			rsslHashU32Compare, RSSL_TRUE, pErrorInfo)) != RSSL_RET_SUCCESS)
 	{
 		wlBaseCleanup(pBase);
@@ -157,18 +217,35 @@ RsslRet wlBaseInit(WlBase *pBase, WlBaseInitOptions *pOpts, RsslErrorInfo *pErro
 	rsslInitQueue(&pBase->requestedServices);
 	rsslInitQueue(&pBase->streamsPendingRequest);
 
-	rsslInitQueue(&pBase->streamsPendingResponse);
+	wlTimeoutQueueInit(&pBase->streamsPendingResponse);
+	wlTimeoutQueueInit(&pBase->ftGroupTimeouts);
+	wlTimeoutQueueInit(&pBase->postAckTimeouts);
 	rsslInitQueue(&pBase->openStreams);
 
-	if ((ret = rsslMemoryPoolInit(&pBase->streamPool, pOpts->streamPoolBlockSize, 
-					pOpts->streamPoolCount, pErrorInfo)) != RSSL_RET_SUCCESS)
+	if ((ret = rsslMemoryPoolInitSlab(&pBase->streamPool, pOpts->streamPoolBlockSize, 
+					pOpts->streamPoolCount, WL_POOL_CHUNK_BLOCK_COUNT, 
+					wlBasePoolFlags(pOpts->streamPoolBlockSize, pOpts->streamPoolCount), 
+					pErrorInfo)) != RSSL_RET_SUCCESS)
+	{
+		wlBaseCleanup(pBase);
+		return ret;
+	}
+	wlBaseInitPoolTrim(&pBase->streamPoolTrim, pOpts->streamPoolCount);
+
+	if ((ret = rsslMemoryPoolInitSlab(&pBase->requestPool, pOpts->requestPoolBlockSize, 
+					pOpts->requestPoolCount, WL_POOL_CHUNK_BLOCK_COUNT, 
+					wlBasePoolFlags(pOpts->requestPoolBlockSize, pOpts->requestPoolCount), 
+					pErrorInfo)) != RSSL_RET_SUCCESS)
 	{
 		wlBaseCleanup(pBase);
 		return ret;
 	}
+	wlBaseInitPoolTrim(&pBase->requestPoolTrim, pOpts->requestPoolCount);
 
-	if ((ret = rsslMemoryPoolInit(&pBase->requestPool, pOpts->requestPoolBlockSize, 
-					pOpts->requestPoolCount, pErrorInfo)) != RSSL_RET_SUCCESS)
+	/* No blocks are allocated until a message is first buffered; the pool then grows by enough
+	 * blocks for one stream's worth of messages at a time. */
+	if ((ret = rsslMemoryPoolInitSlab(&pBase->bufferedMsgPool, WL_BUFFERED_MSG_BLOCK_SIZE,
+					0, (int)pBase->maxBufferedBroadcastMsgs, RSSL_MPLF_NONE, pErrorInfo)) != RSSL_RET_SUCCESS)
 	{
 		wlBaseCleanup(pBase);
 		return ret;
@@ -182,6 +259,8 @@ void wlBaseCleanup(WlBase *pBase)
 	wlServiceCacheDestroy(pBase->pServiceCache);
 	rsslHeapBufferCleanup(&pBase->tempDecodeBuffer);
 	rsslHeapBufferCleanup(&pBase->tempEncodeBuffer);
+	if (pBase->requestPacer.waitingStreams)
+		free(pBase->requestPacer.waitingStreams);
 	rsslHashTableCleanup(&pBase->requestsByStreamId);
 	rsslHashTableCleanup(&pBase->openStreamsByAttrib);
 	rsslHashTableCleanup(&pBase->streamsById);
@@ -189,6 +268,7 @@ void wlBaseCleanup(WlBase *pBase)
 	rsslHashTableCleanup(&pBase->requestedSvcById);
 	rsslMemoryPoolCleanup(&pBase->requestPool);
 	rsslMemoryPoolCleanup(&pBase->streamPool);
+	rsslMemoryPoolCleanup(&pBase->bufferedMsgPool);
 }
 
 void wlAddRequest(WlBase *pBase, WlRequestBase *pRequestBase)
@@ -219,11 +299,10 @@ void wlSetStreamPendingResponse(WlBase *pBase, WlStreamBase *pStreamBase)
 {
 	if (!(pStreamBase->requestState & WL_STRS_PENDING_RESPONSE))
 	{
-		rsslQueueAddLinkToBack(&pBase->streamsPendingResponse,
-				&pStreamBase->qlStreamsPendingResponse);
+		wlTimeoutQueueAdd(&pBase->streamsPendingResponse, &pStreamBase->responseTimer,
+				pBase->currentTime + pBase->config.requestTimeout);
 		pStreamBase->requestState |= WL_STRS_PENDING_RESPONSE;
 
-		pStreamBase->requestExpireTime = pBase->currentTime + pBase->config.requestTimeout;
 		pBase->watchlist.state |= RSSLWL_STF_NEED_TIMER;
 	}
 }
@@ -241,8 +320,7 @@ void wlUnsetStreamPendingResponse(WlBase *pBase, WlStreamBase *pStreamBase)
 {
 	if (pStreamBase->requestState & WL_STRS_PENDING_RESPONSE)
 	{
-		rsslQueueRemoveLink(&pBase->streamsPendingResponse,
-				&pStreamBase->qlStreamsPendingResponse);
+		wlTimeoutQueueRemove(&pBase->streamsPendingResponse, &pStreamBase->responseTimer);
 		pStreamBase->requestState &= ~WL_STRS_PENDING_RESPONSE;
 	}
 }
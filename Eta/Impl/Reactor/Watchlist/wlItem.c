@@ -18,9 +18,11 @@
 static RsslRet _wlItemRequestSaveExtraInfo(WlItemRequest *pItemRequest, RsslRequestMsg *pRequestMsg,
 		RsslErrorInfo *pErrorInfo);
 
+/* Removes a stream from the request pacer's waiting streams. */
+static void wlItemStreamRemoveFromPacer(WlBase *pBase, WlItemStream *pItemStream);
+
 RsslUInt32 wlProviderRequestHashSum(void *pKey)
 {
-	RsslUInt32 i;
 	RsslUInt32 hashSum = 0;
 	WlItemRequest *pItemRequest = (WlItemRequest*)pKey;
 	RsslMsgKey *pMsgKey = &pItemRequest->msgKey;
@@ -29,22 +31,10 @@ RsslUInt32 wlProviderRequestHashSum(void *pKey)
 		hashSum += pMsgKey->serviceId;
 
 	if (pMsgKey->flags & RSSL_MKF_HAS_NAME)
-	{
-		for(i = 0; i < pMsgKey->name.length; ++i)
-		{
-			hashSum = (hashSum << 4) + (RsslUInt32)pMsgKey->name.data[i];
-			hashSum ^= (hashSum >> 12);
-		}
-	}
+		hashSum = rsslHashBytes(pMsgKey->name.data, pMsgKey->name.length, hashSum);
 
 	if (pMsgKey->flags & RSSL_MKF_HAS_ATTRIB)
-	{
-		for(i = 0; i < pMsgKey->encAttrib.length; ++i)
-		{
-			hashSum = (hashSum << 4) + (RsslUInt32)pMsgKey->encAttrib.data[i];
-			hashSum ^= (hashSum >> 12);
-		}
-	}
+		hashSum = rsslHashBytes(pMsgKey->encAttrib.data, pMsgKey->encAttrib.length, hashSum);
 
 	return hashSum;
 }
@@ -99,11 +89,15 @@ RsslRet wlItemsInit(WlItems *pItems, WlItemsInitOptions *pOpts, RsslErrorInfo *p
 	memset(pItems->ftGroupTable, 0, sizeof(pItems->ftGroupTable));
 
 	
-	rsslInitQueue(&pItems->ftGroupTimerQueue);
 	rsslInitQueue(&pItems->gapStreamQueue);
 
 	pItems->gapExpireTime = WL_TIME_UNSET;
 
+	pItems->enableFanoutList = pOpts->enableFanoutList;
+	pItems->fanoutListInUse = RSSL_FALSE;
+	pItems->fanoutList = NULL;
+	pItems->fanoutListSize = 0;
+
 	return RSSL_RET_SUCCESS;
 }
 
@@ -111,6 +105,12 @@ void wlItemsCleanup(WlItems *pItems)
 {
 	rsslHashTableCleanup(&pItems->providerRequestsByAttrib);
 	wlPostTableCleanup(&pItems->postTable);
+
+	if (pItems->fanoutList)
+	{
+		free(pItems->fanoutList);
+		pItems->fanoutList = NULL;
+	}
 }
 
 RsslRet wlItemCopyKey(RsslMsgKey *pNewMsgKey, RsslMsgKey *pOldMsgKey, char **pMemoryBuffer,
@@ -189,6 +189,8 @@ RsslRet wlItemRequestInit(WlItemRequest *pItemRequest, WlBase *pBase, WlItems *p
 		pItemRequest->priorityCount = 1;
 	}
 
+	pItemRequest->requestRank = pOpts->requestRank;
+
 	wlRequestBaseInit(&pItemRequest->base, 
 			pRequestMsg->msgBase.streamId, 
 			pRequestMsg->msgBase.domainType,
@@ -270,6 +272,7 @@ void wlItemRequestDestroy(WlBase *pBase, WlItemRequest *pItemRequest)
 {
 	wlItemRequestCleanup(pItemRequest);
 	rsslMemoryPoolPut(&pBase->requestPool, pItemRequest);
+	wlBaseTrimPool(&pBase->requestPool, &pBase->requestPoolTrim);
 }
 
 void wlItemRequestEstablishQos(WlItemRequest *pItemRequest, RsslQos *pQos)
@@ -368,18 +371,20 @@ RsslRet wlItemStreamInit(WlItemStream *pItemStream, WlStreamAttributes *pStreamA
 	return RSSL_RET_SUCCESS;
 }
 
-void wlItemStreamResetState(WlItemStream *pItemStream)
+void wlItemStreamResetState(WlBase *pBase, WlItemStream *pItemStream)
 {
 	if (pItemStream->refreshState != WL_ISRS_NONE)
 	{
 		if (pItemStream->refreshState == WL_ISRS_PENDING_OPEN_WINDOW)
 			rsslQueueRemoveLink(&pItemStream->pWlService->streamsPendingWindow,
 					&pItemStream->qlOpenWindow);
+		else if (pItemStream->refreshState == WL_ISRS_PENDING_PACER)
+			wlItemStreamRemoveFromPacer(pBase, pItemStream);
 		else
 			rsslQueueRemoveLink(&pItemStream->pWlService->streamsPendingRefresh,
 					&pItemStream->qlOpenWindow);
 
-		pItemStream->flags = WL_ISRS_NONE;
+		pItemStream->refreshState = WL_ISRS_NONE;
 	}
 
 	/* Reset flags(set view change flag so that view gets re-checked). */
@@ -418,6 +423,7 @@ void wlItemStreamDestroy(WlBase *pBase, WlItemStream *pItemStream)
 	wlMsgReorderQueueCleanup(&pItemStream->bufferedMsgQueue);
 
 	rsslMemoryPoolPut(&pBase->streamPool, pItemStream);
+	wlBaseTrimPool(&pBase->streamPool, &pBase->streamPoolTrim);
 }
 
 static void wlItemStreamMergePriorityFromRequest(WlItemRequest *pItemRequest,
@@ -653,8 +659,8 @@ RsslRet wlFTGroupAddStream(WlBase *pBase, WlItems *pItems, RsslUInt8 ftGroupId,
 
 		pGroup->ftGroupId = ftGroupId;
 		pItems->ftGroupTable[ftGroupId] = pGroup;
-		rsslQueueAddLinkToBack(&pItems->ftGroupTimerQueue, &pGroup->qlGroups);
-		pGroup->expireTime = pBase->currentTime + pBase->pRsslChannel->pingTimeout * 1000;
+		wlTimeoutQueueAdd(&pBase->ftGroupTimeouts, &pGroup->pingTimer, 
+				pBase->currentTime + pBase->pRsslChannel->pingTimeout * 1000);
 		pBase->watchlist.state |= RSSLWL_STF_NEED_TIMER;
 		rsslInitQueue(&pGroup->openStreamList);
 		
@@ -666,7 +672,7 @@ RsslRet wlFTGroupAddStream(WlBase *pBase, WlItems *pItems, RsslUInt8 ftGroupId,
 	return RSSL_RET_SUCCESS;
 }
 
-void wlFTGroupRemoveStream(WlItems *pItems, WlItemStream *pItemStream)
+void wlFTGroupRemoveStream(WlBase *pBase, WlItems *pItems, WlItemStream *pItemStream)
 {
 	WlFTGroup *pGroup;
 
@@ -675,13 +681,13 @@ void wlFTGroupRemoveStream(WlItems *pItems, WlItemStream *pItemStream)
 	rsslQueueRemoveLink(&pGroup->openStreamList, &pItemStream->qlFTGroup);
 	if (pItems->pCurrentFanoutFTGroup != pGroup
 			&& !rsslQueueGetElementCount(&pGroup->openStreamList))
-		wlFTGroupRemove(pItems, pGroup); /* Group is now empty, so remove it. */
+		wlFTGroupRemove(pBase, pItems, pGroup); /* Group is now empty, so remove it. */
 }
 
-void wlFTGroupRemove(WlItems *pItems, WlFTGroup *pGroup)
+void wlFTGroupRemove(WlBase *pBase, WlItems *pItems, WlFTGroup *pGroup)
 {
 	pItems->ftGroupTable[pGroup->ftGroupId] = NULL;
-	rsslQueueRemoveLink(&pItems->ftGroupTimerQueue, &pGroup->qlGroups);
+	wlTimeoutQueueRemove(&pBase->ftGroupTimeouts, &pGroup->pingTimer);
 	free(pGroup);
 }
 
@@ -889,6 +895,8 @@ RsslRet wlItemRequestReissue(WlBase *pBase, WlItems *pItems, WlItemRequest *pIte
 			pItemStream->flags |= WL_IOSF_PENDING_PRIORITY_CHANGE;
 	}
 
+	pItemRequest->requestRank = pOpts->requestRank;
+
 	if ((ret = _wlItemRequestSaveExtraInfo(pItemRequest, pRequestMsg, pErrorInfo))
 			   	< RSSL_RET_SUCCESS)
 		return ret;
@@ -981,7 +989,7 @@ void wlItemRequestClose(WlBase *pBase, WlItems *pItems, WlItemRequest *pItemRequ
 	while (pLink = rsslQueueRemoveFirstLink(&pItemRequest->openPosts))
 	{
 		WlPostRecord *pPostRecord = RSSL_QUEUE_LINK_TO_OBJECT(WlPostRecord, qlUser, pLink);
-		wlPostTableRemoveRecord(&pItems->postTable, pPostRecord);
+		wlPostTableRemoveRecord(pBase, &pItems->postTable, pPostRecord);
 	}
 
 
@@ -1556,9 +1564,7 @@ RsslRet wlItemRequestSendMsgEvent(WlBase *pBase,
 	if (pItemRequest->pRequestedService->flags & WL_RSVC_HAS_NAME)
 		streamInfo.pServiceName = &pItemRequest->pRequestedService->serviceName;
 
-	if (!(pItemRequest->requestMsgFlags & RSSL_RQMF_MSG_KEY_IN_UPDATES)
-			&& (!(pItemRequest->flags & WL_IRQF_PROV_DRIVEN) || 
-				pItemRequest->flags & WL_IRQF_HAS_PROV_KEY))
+	if (!wlItemRequestNeedsMsgKey(pItemRequest))
 	{
 		if ((ret = (*pBase->config.msgCallback) (&pBase->watchlist, pEvent, pErrorInfo)) 
 				!= RSSL_RET_SUCCESS)
@@ -1711,7 +1717,7 @@ RsslRet wlItemStreamClose(WlBase *pBase, WlItems *pItems, WlItemStream *pItemStr
 		wlItemGroupRemoveStream(pItems, pItemStream->pItemGroup, pItemStream);
 
 	if (pItemStream->pFTGroup)
-		wlFTGroupRemoveStream(pItems, pItemStream);
+		wlFTGroupRemoveStream(pBase, pItems, pItemStream);
 
 	if (!(pItemStream->flags & WL_IOSF_PRIVATE))
 		rsslHashTableRemoveLink(&pBase->openStreamsByAttrib, &pItemStream->hlStreamsByAttrib);
@@ -1727,6 +1733,8 @@ RsslRet wlItemStreamClose(WlBase *pBase, WlItems *pItems, WlItemStream *pItemStr
 		if (pItemStream->refreshState == WL_ISRS_PENDING_OPEN_WINDOW)
 			rsslQueueRemoveLink(&pItemStream->pWlService->streamsPendingWindow,
 					&pItemStream->qlOpenWindow);
+		else if (pItemStream->refreshState == WL_ISRS_PENDING_PACER)
+			wlItemStreamRemoveFromPacer(pBase, pItemStream);
 		else
 			rsslQueueRemoveLink(&pItemStream->pWlService->streamsPendingRefresh,
 					&pItemStream->qlOpenWindow);
@@ -1752,40 +1760,176 @@ RsslRet wlItemStreamClose(WlBase *pBase, WlItems *pItems, WlItemStream *pItemStr
 	return RSSL_RET_SUCCESS;
 }
 
+/* Requests a refresh for a stream, unless the service's OpenWindow is full. */
+static void wlItemStreamRequestRefresh(WlBase *pBase, WlItemStream *pItemStream)
+{
+	/* Check service open window before requesting. */
+	WlService *pWlService = pItemStream->pWlService;
+
+	if ( pBase->config.obeyOpenWindow && pWlService->pService->rdm.flags & RDM_SVCF_HAS_LOAD
+			&& pWlService->pService->rdm.load.flags & RDM_SVC_LDF_HAS_OPEN_WINDOW
+			&& (pWlService->streamsPendingRefresh.count 
+				>= pWlService->pService->rdm.load.openWindow))
+	{
+		pItemStream->refreshState = WL_ISRS_PENDING_OPEN_WINDOW;
+		rsslQueueAddLinkToBack(&pWlService->streamsPendingWindow,
+				&pItemStream->qlOpenWindow);
+
+	}
+	else
+	{
+		wlSetStreamMsgPending(pBase, &pItemStream->base);
+		pItemStream->refreshState = WL_ISRS_REQUEST_REFRESH;
+		rsslQueueAddLinkToBack(&pWlService->streamsPendingRefresh,
+				&pItemStream->qlOpenWindow);
+	}
+}
+
+/* Returns the highest rank among the streaming requests in a queue, or the given rank if higher. */
+static RsslUInt8 wlItemStreamMergeRank(RsslQueue *pRequestQueue, RsslUInt8 rank)
+{
+	RsslQueueLink *pLink;
+
+	RSSL_QUEUE_FOR_EACH_LINK(pRequestQueue, pLink)
+	{
+		WlItemRequest *pItemRequest = RSSL_QUEUE_LINK_TO_OBJECT(WlItemRequest, base.qlStateQueue, pLink);
+		if (pItemRequest->requestMsgFlags & RSSL_RQMF_STREAMING && pItemRequest->requestRank > rank)
+			rank = pItemRequest->requestRank;
+	}
+
+	return rank;
+}
+
+/* Returns the level at which a stream waits in the request pacer. */
+static RsslUInt8 wlItemStreamGetPacerLevel(WlBase *pBase, WlItemStream *pItemStream)
+{
+	RsslUInt8 rank;
+	RsslUInt8 priorityClass;
+	RsslUInt16 priorityCount;
+
+	switch(pBase->requestPacer.order)
+	{
+		case RSSLWL_RPO_PRIORITY_CLASS:
+			if (pItemStream->requestsStreamingCount == 0)
+				return 0;
+			wlItemStreamMergePriority(pItemStream, &priorityClass, &priorityCount);
+			return priorityClass;
+
+		case RSSLWL_RPO_RANK:
+			rank = wlItemStreamMergeRank(&pItemStream->requestsRecovering, 0);
+			rank = wlItemStreamMergeRank(&pItemStream->requestsPendingRefresh, rank);
+			return wlItemStreamMergeRank(&pItemStream->requestsOpen, rank);
+
+		default:
+			return 0;
+	}
+}
+
+/* Adds a stream to the request pacer, at the level its requests give it. */
+static void wlItemStreamAddToPacer(WlBase *pBase, WlItemStream *pItemStream)
+{
+	WlRequestPacer *pPacer = &pBase->requestPacer;
+
+	pItemStream->refreshState = WL_ISRS_PENDING_PACER;
+	pItemStream->pacerLevel = wlItemStreamGetPacerLevel(pBase, pItemStream);
+	rsslQueueAddLinkToBack(&pPacer->waitingStreams[pItemStream->pacerLevel],
+			&pItemStream->qlOpenWindow);
+
+	if (pItemStream->pacerLevel > pPacer->highestLevel)
+		pPacer->highestLevel = pItemStream->pacerLevel;
+
+	++pPacer->waitingCount;
+
+	/* Wake up when the pacer will have a token. */
+	pBase->watchlist.state |= RSSLWL_STF_NEED_TIMER;
+}
+
+static void wlItemStreamRemoveFromPacer(WlBase *pBase, WlItemStream *pItemStream)
+{
+	WlRequestPacer *pPacer = &pBase->requestPacer;
+
+	assert(pPacer->waitingCount);
+	rsslQueueRemoveLink(&pPacer->waitingStreams[pItemStream->pacerLevel],
+			&pItemStream->qlOpenWindow);
+
+	if (--pPacer->waitingCount == 0)
+		pPacer->highestLevel = 0;
+}
+
 void wlItemStreamSetMsgPending(WlBase *pBase, WlItemStream *pItemStream, RsslBool requestRefresh)
 {
 	if (requestRefresh)
 	{
 		if (pItemStream->refreshState == WL_ISRS_NONE)
 		{
-			/* Check service open window before requesting. */
-			WlService *pWlService = pItemStream->pWlService;
+			WlRequestPacer *pPacer = &pBase->requestPacer;
 
-			if ( pBase->config.obeyOpenWindow && pWlService->pService->rdm.flags & RDM_SVCF_HAS_LOAD
-					&& pWlService->pService->rdm.load.flags & RDM_SVC_LDF_HAS_OPEN_WINDOW
-					&& (pWlService->streamsPendingRefresh.count 
-						>= pWlService->pService->rdm.load.openWindow))
+			if (pPacer->requestRate)
 			{
-				pItemStream->refreshState = WL_ISRS_PENDING_OPEN_WINDOW;
-				rsslQueueAddLinkToBack(&pWlService->streamsPendingWindow,
-						&pItemStream->qlOpenWindow);
-
+				/* Request at once if a token is available and no other stream is waiting for one.
+				 * Otherwise wait in the pacer. */
+				wlRequestPacerRefill(pPacer, pBase->currentTime);
+				if (!pPacer->waitingCount && pPacer->tokens >= 1000)
+				{
+					pPacer->tokens -= 1000;
+					wlItemStreamRequestRefresh(pBase, pItemStream);
+				}
+				else
+					wlItemStreamAddToPacer(pBase, pItemStream);
 			}
 			else
+				wlItemStreamRequestRefresh(pBase, pItemStream);
+		}
+		else if (pItemStream->refreshState == WL_ISRS_PENDING_PACER)
+		{
+			/* A new request may have raised the stream's level. */
+			if (wlItemStreamGetPacerLevel(pBase, pItemStream) != pItemStream->pacerLevel)
 			{
-				wlSetStreamMsgPending(pBase, &pItemStream->base);
-				pItemStream->refreshState = WL_ISRS_REQUEST_REFRESH;
-				rsslQueueAddLinkToBack(&pWlService->streamsPendingRefresh,
-						&pItemStream->qlOpenWindow);
+				wlItemStreamRemoveFromPacer(pBase, pItemStream);
+				wlItemStreamAddToPacer(pBase, pItemStream);
 			}
 		}
 		else if (pItemStream->refreshState != WL_ISRS_PENDING_OPEN_WINDOW)
 			wlSetStreamMsgPending(pBase, &pItemStream->base);
 	}
-	else if (pItemStream->refreshState != WL_ISRS_PENDING_OPEN_WINDOW)
+	else if (pItemStream->refreshState != WL_ISRS_PENDING_OPEN_WINDOW
+			&& pItemStream->refreshState != WL_ISRS_PENDING_PACER)
 		wlSetStreamMsgPending(pBase, &pItemStream->base);
 }
 
+void wlItemStreamReleasePaced(WlBase *pBase)
+{
+	WlRequestPacer *pPacer = &pBase->requestPacer;
+
+	if (!pPacer->waitingCount)
+		return;
+
+	wlRequestPacerRefill(pPacer, pBase->currentTime);
+
+	/* Release streams from the highest level down, oldest first within a level. */
+	while (pPacer->waitingCount && pPacer->tokens >= 1000)
+	{
+		RsslQueueLink *pLink;
+		WlItemStream *pWaitingStream;
+
+		while (!rsslQueueGetElementCount(&pPacer->waitingStreams[pPacer->highestLevel]))
+			--pPacer->highestLevel;
+
+		pLink = rsslQueuePeekFront(&pPacer->waitingStreams[pPacer->highestLevel]);
+		pWaitingStream = RSSL_QUEUE_LINK_TO_OBJECT(WlItemStream, qlOpenWindow, pLink);
+
+		assert(pWaitingStream->refreshState == WL_ISRS_PENDING_PACER);
+
+		wlItemStreamRemoveFromPacer(pBase, pWaitingStream);
+		pWaitingStream->refreshState = WL_ISRS_NONE;
+		pPacer->tokens -= 1000;
+		wlItemStreamRequestRefresh(pBase, pWaitingStream);
+	}
+
+	if (pPacer->waitingCount)
+		pBase->watchlist.state |= RSSLWL_STF_NEED_TIMER;
+}
+
 void wlItemStreamUnsetMsgPending(WlBase *pBase, WlItemStream *pItemStream)
 {
 	assert(pItemStream->pWlService);
@@ -1827,8 +1971,9 @@ void wlItemStreamCheckOpenWindow(WlBase *pBase, WlService *pWlService)
 
 			assert(pWaitingStream->refreshState == WL_ISRS_PENDING_OPEN_WINDOW);
 			
+			/* The stream already passed the request pacer, if any. */
 			pWaitingStream->refreshState = WL_ISRS_NONE;
-			wlItemStreamSetMsgPending(pBase, pWaitingStream, RSSL_TRUE);
+			wlItemStreamRequestRefresh(pBase, pWaitingStream);
 		}
 	}
 }
@@ -244,6 +244,11 @@ RsslRet wlLoginProcessProviderMsg(WlLogin *pLogin, WlBase *pBase,
 					else
 						pLoginRefresh->singleOpen = 1;
 
+					/* Keep the provider's batch support for the watchlist's own use before replacing it 
+					 * (the watchlist always supports batch requests from the application). */
+					pBase->config.providerSupportBatch = (pLoginRefresh->flags & RDM_LG_RFF_HAS_SUPPORT_BATCH) ?
+						pLoginRefresh->supportBatchRequests : RDM_LOGIN_BATCH_NONE;
+
 					pLoginRefresh->flags |= RDM_LG_RFF_HAS_SUPPORT_BATCH;
 					pLoginRefresh->supportBatchRequests = 1;
 
@@ -260,6 +265,8 @@ RsslRet wlLoginProcessProviderMsg(WlLogin *pLogin, WlBase *pBase,
 					pBase->gapRecovery = pLoginRefresh->sequenceNumberRecovery;
 					pBase->gapTimeout = pLoginRefresh->sequenceRetryInterval * 1000;
 					pBase->maxBufferedBroadcastMsgs = pLoginRefresh->updateBufferLimit;
+					if (pBase->maxBufferedBroadcastMsgs > 0)
+						pBase->bufferedMsgPool.chunkBlockCount = (int)pBase->maxBufferedBroadcastMsgs;
 
 					pLoginRequest->pLoginReqMsg->flags |= RDM_LG_RQF_NO_REFRESH;
 
@@ -23,21 +23,48 @@ RsslRet wlMsgReorderQueuePush(WlMsgReorderQueue *pQueue, RsslMsg *pRsslMsg,
 	RsslUInt32 msgSize;
 	RsslBuffer msgBuffer;
 
-	/* Allocate space for header and RsslMsg. */
+	/* Broadcast & unicast messages should not appear simultaneously in the queue. */
+	assert(pRsslMsg->msgBase.streamId != 0 || pQueue->hasUnicastMsgs == RSSL_FALSE);
+	assert(pRsslMsg->msgBase.streamId == 0 || pQueue->hasUnicastMsgs == RSSL_TRUE
+			|| rsslQueueGetElementCount(&pQueue->msgQueue) == 0);
+
+	/* Get space for header and RsslMsg. */
 	msgSize = rsslSizeOfMsg(pRsslMsg, RSSL_CMF_ALL_FLAGS & ~RSSL_CMF_MSG_BUFFER);
-	pBufferedMsg = (WlBufferedMsg*)malloc(sizeof(WlBufferedMsg) + msgSize);
-	verify_malloc(pBufferedMsg, pErrorInfo, RSSL_RET_FAILURE);
+	if (sizeof(WlBufferedMsg) + msgSize <= WL_BUFFERED_MSG_BLOCK_SIZE)
+	{
+		if (!(pBufferedMsg = (WlBufferedMsg*)rsslMemoryPoolGet(&pBase->bufferedMsgPool, pErrorInfo)))
+			return RSSL_RET_FAILURE;
+
+		pBufferedMsg->flags = WL_BFMSG_NONE;
+		pBufferedMsg->pPool = &pBase->bufferedMsgPool;
+	}
+	else
+	{
+		pBufferedMsg = (WlBufferedMsg*)malloc(sizeof(WlBufferedMsg) + msgSize);
+		verify_malloc(pBufferedMsg, pErrorInfo, RSSL_RET_FAILURE);
+
+		pBufferedMsg->flags = WL_BFMSG_ALLOCATED;
+		pBufferedMsg->pPool = NULL;
+	}
 
 	msgBuffer.data = (char*)pBufferedMsg + sizeof(WlBufferedMsg);
 	msgBuffer.length = msgSize;
 	if (!rsslCopyMsg(pRsslMsg, RSSL_CMF_ALL_FLAGS & ~RSSL_CMF_MSG_BUFFER, 0, &msgBuffer))
 	{
+		wlBufferedMsgDestroy(pBufferedMsg);
 		rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, 
 				"Failed to copy message for buffering.");
 		return RSSL_RET_FAILURE;
 	}
 
-	pBufferedMsg->flags = WL_BFMSG_NONE;
+	/* Eject an old message if the queue is full. Done only once the new message is copied, so a failure loses nothing. */
+	if (rsslQueueGetElementCount(&pQueue->msgQueue) >= pBase->maxBufferedBroadcastMsgs
+			&& rsslQueueGetElementCount(&pQueue->msgQueue) > 0)
+	{
+		WlBufferedMsg *pOldMsg = wlMsgReorderQueuePop(pQueue);
+		wlBufferedMsgDestroy(pOldMsg);
+	}
+
 	pBufferedMsg->seqNum = seqNum;
 
 	if (pFTGroupId)
@@ -46,21 +73,9 @@ RsslRet wlMsgReorderQueuePush(WlMsgReorderQueue *pQueue, RsslMsg *pRsslMsg,
 		pBufferedMsg->flags |= WL_BFMSG_HAS_FT_GROUP_ID;
 	}
 
-	/* Broadcast & unicast messages should not appear simultaneously in the queue. */
-	assert(pRsslMsg->msgBase.streamId != 0 || pQueue->hasUnicastMsgs == RSSL_FALSE);
-	assert(pRsslMsg->msgBase.streamId == 0 || pQueue->hasUnicastMsgs == RSSL_TRUE
-			|| rsslQueueGetElementCount(&pQueue->msgQueue) == 0);
-
 	if (pRsslMsg->msgBase.streamId != 0)
 		pQueue->hasUnicastMsgs = RSSL_TRUE;
 
-	/* Eject an old message if the queue is full. */
-	if (rsslQueueGetElementCount(&pQueue->msgQueue) >= pBase->maxBufferedBroadcastMsgs)
-	{
-		WlBufferedMsg *pOldMsg = wlMsgReorderQueuePop(pQueue);
-		wlBufferedMsgDestroy(pOldMsg);
-	}
-
 	rsslQueueAddLinkToBack(&pQueue->msgQueue, &pBufferedMsg->qlMsg);
 
 	return RSSL_RET_SUCCESS;
@@ -109,7 +124,10 @@ WlBufferedMsg *wlMsgReorderQueuePopUntil(WlMsgReorderQueue *pQueue, RsslUInt32 s
 
 void wlBufferedMsgDestroy(WlBufferedMsg *pBufferedMsg)
 {
-	free(pBufferedMsg);
+	if (pBufferedMsg->flags & WL_BFMSG_ALLOCATED)
+		free(pBufferedMsg);
+	else
+		rsslMemoryPoolPut(pBufferedMsg->pPool, pBufferedMsg);
 }
 
 void wlMsgReorderQueueCleanup(WlMsgReorderQueue *pQueue)
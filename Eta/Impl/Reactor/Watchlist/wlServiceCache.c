@@ -26,6 +26,11 @@ RsslRet rscUpdateLink(RDMCachedService *pCachedService, RsslRDMServiceLink *pUpd
 
 void rscRemoveLink(RDMCachedService *pService, RDMCachedLink *pCachedLink);
 
+/* Deletes preloaded services that the provider's directory refresh did not contain. */
+static RsslRet wlscRemovePreloadedServices(WlServiceCache *pServiceCache, 
+		RsslErrorInfo *pErrorInfo);
+
+
 WlServiceCache* wlServiceCacheCreate(WlServiceCacheCreateOptions *pOptions, 
 		RsslErrorInfo *pErrorInfo)
 {
@@ -127,6 +132,7 @@ RsslRet wlServiceCacheProcessDirectoryMsg(WlServiceCache *pServiceCache,
 	RsslQueue deletedServiceList;
 	RsslRet ret;
 	RsslBool clearCache = RSSL_FALSE;
+	RsslBool reconcilePreloaded = RSSL_FALSE;
 
 	rscClearUpdateEvent(&updateEvent);
 
@@ -170,6 +176,15 @@ RsslRet wlServiceCacheProcessDirectoryMsg(WlServiceCache *pServiceCache,
 		return RSSL_RET_SUCCESS;
 	}
 
+	/* The first refresh after a preload is compared against the preloaded services rather than
+	 * replacing them, so items already matched to services that still exist are not recovered. */
+	if (pServiceCache->_hasPreloadedServices 
+			&& pDirectoryMsg->rdmMsgBase.rdmMsgType == RDM_DR_MT_REFRESH)
+	{
+		clearCache = RSSL_FALSE;
+		reconcilePreloaded = RSSL_TRUE;
+	}
+
 	if (clearCache)
 		if ((ret = wlServiceCacheClear(pServiceCache, RSSL_TRUE, pErrorInfo)) != RSSL_RET_SUCCESS)
 			return ret;
@@ -188,6 +203,7 @@ RsslRet wlServiceCacheProcessDirectoryMsg(WlServiceCache *pServiceCache,
 		if (pHashLink)
 		{
 			pCachedService = RSSL_HASH_LINK_TO_OBJECT(RDMCachedService, _idLink, pHashLink);
+			pCachedService->preloaded = RSSL_FALSE;
 
 			if (pServiceEntry->action == RSSL_MPEA_ADD_ENTRY)
 				pServiceEntry->action = RSSL_MPEA_UPDATE_ENTRY;
@@ -232,9 +248,75 @@ RsslRet wlServiceCacheProcessDirectoryMsg(WlServiceCache *pServiceCache,
 
 	wlscSendUpdatedServiceList(pServiceCache, &updateEvent, pErrorInfo);
 
+	if (reconcilePreloaded)
+		return wlscRemovePreloadedServices(pServiceCache, pErrorInfo);
+
+	return RSSL_RET_SUCCESS;
+}
+
+RsslRet wlServiceCachePreload(WlServiceCache *pServiceCache, 
+		RsslRDMDirectoryRefresh *pDirectoryRefresh, RsslErrorInfo *pErrorInfo)
+{
+	RsslRDMDirectoryMsg directoryMsg;
+	RsslQueueLink *pLink;
+	RsslRet ret;
+
+	directoryMsg.refresh = *pDirectoryRefresh;
+	directoryMsg.refresh.flags &= ~RDM_DR_RFF_CLEAR_CACHE;
+	directoryMsg.refresh.state.streamState = RSSL_STREAM_OPEN;
+
+	if ((ret = wlServiceCacheProcessDirectoryMsg(pServiceCache, NULL, &directoryMsg, pErrorInfo))
+			!= RSSL_RET_SUCCESS)
+		return ret;
+
+	RSSL_QUEUE_FOR_EACH_LINK(&pServiceCache->_serviceList, pLink)
+	{
+		RDMCachedService *pService = RSSL_QUEUE_LINK_TO_OBJECT(RDMCachedService, _fullListLink,
+				pLink);
+		pService->preloaded = RSSL_TRUE;
+	}
+
+	pServiceCache->_hasPreloadedServices = (pServiceCache->_serviceList.count > 0);
 	return RSSL_RET_SUCCESS;
 }
 
+/* Deletes preloaded services that the provider's directory refresh did not contain. */
+static RsslRet wlscRemovePreloadedServices(WlServiceCache *pServiceCache, 
+		RsslErrorInfo *pErrorInfo)
+{
+	RsslQueueLink *pLink;
+	WlServiceCacheUpdateEvent updateEvent;
+
+	rscClearUpdateEvent(&updateEvent);
+	pServiceCache->_hasPreloadedServices = RSSL_FALSE;
+
+	pLink = rsslQueuePeekFront(&pServiceCache->_serviceList);
+	while (pLink)
+	{
+		RDMCachedService *pService = RSSL_QUEUE_LINK_TO_OBJECT(RDMCachedService, _fullListLink, 
+				pLink);
+
+		pLink = rsslQueuePeekNext(&pServiceCache->_serviceList, pLink);
+
+		if (!pService->preloaded)
+			continue;
+
+		if (pService->pUserSpec)
+		{
+			pService->rdm.action = RSSL_MPEA_DELETE_ENTRY;
+			rsslQueueAddLinkToBack(&updateEvent.updatedServiceList, &pService->_updatedServiceLink);
+		}
+		else
+		{
+			/* The watchlist has not seen this service. */
+			rscRemoveService(pServiceCache, pService);
+			rscDestroyService(pService);
+		}
+	}
+
+	return wlscSendUpdatedServiceList(pServiceCache, &updateEvent, pErrorInfo);
+}
+
 RDMCachedService *rscCreateService(RsslErrorInfo *pErrorInfo)
 {
 	RDMCachedService *pCachedService = (RDMCachedService*)malloc(sizeof(RDMCachedService));
@@ -247,6 +329,7 @@ RDMCachedService *rscCreateService(RsslErrorInfo *pErrorInfo)
 	pCachedService->stateUpdateFlags = RDM_SVC_STF_NONE;
 	pCachedService->hasServiceName = RSSL_FALSE;
 	pCachedService->pUserSpec = NULL;
+	pCachedService->preloaded = RSSL_FALSE;
 
 	rsslInitQueueLink(&pCachedService->_fullListLink);
 	rsslHashLinkInit(&pCachedService->_nameLink);
@@ -1019,6 +1102,7 @@ RsslRet wlServiceCacheClear(WlServiceCache *pServiceCache, RsslBool callback,
 	}
 
 	rsslInitQueue(&pServiceCache->_serviceList);
+	pServiceCache->_hasPreloadedServices = RSSL_FALSE;
 
 	return RSSL_RET_SUCCESS;
 }
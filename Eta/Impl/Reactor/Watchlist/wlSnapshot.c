@@ -0,0 +1,630 @@
+/*
+ * This source code is provided under the Apache 2.0 license and is provided
+ * AS IS with no warranty or guarantee of fit for purpose.  See the project's
+ * LICENSE.md for details.
+ * Copyright Thomson Reuters 2015. All rights reserved.
+*/
+
+#include "rtr/wlWatchlist.h"
+#include "rtr/wlSymbolList.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <errno.h>
+
+/* Snapshot file layout. Integers are in network byte order.
+ *   Header:	magic "WLSN"(4), file version(1), RWF major version(1), RWF minor version(1), request count(4)
+ *   Directory:	encoded RsslRDMDirectoryRefresh length(4), encoded RsslRDMDirectoryRefresh
+ *   Request:	request rank(1), service name length(2), service name,
+ *   			encoded RsslRequestMsg length(4), encoded RsslRequestMsg
+ * Requests by service ID have no service name; the ID is in the message key. The directory
+ * length is 0 if no services were cached. Request user-specified pointers are not saved. */
+#define WL_SNAPSHOT_VERSION			2
+#define WL_SNAPSHOT_HEADER_LENGTH	11
+#define WL_SNAPSHOT_COUNT_POSITION	7
+
+static const char wlSnapshotMagic[4] = { 'W', 'L', 'S', 'N' };
+
+/* Buffer into which the snapshot is written before it is saved to the file. */
+typedef struct
+{
+	char		*data;
+	RsslUInt32	length;		/* Length written so far. */
+	RsslUInt32	maxLength;	/* Allocated length. */
+} WlSnapshotBuffer;
+
+/* Ensures that at least length more bytes can be written to the buffer. */
+static RsslRet wlSnapshotReserve(WlSnapshotBuffer *pBuffer, RsslUInt32 length, RsslErrorInfo *pErrorInfo)
+{
+	RsslUInt32 maxLength = pBuffer->maxLength ? pBuffer->maxLength : 16384;
+	char *data;
+
+	if (pBuffer->length + length <= pBuffer->maxLength)
+		return RSSL_RET_SUCCESS;
+
+	while (maxLength < pBuffer->length + length)
+		maxLength *= 2;
+
+	data = (char*)realloc(pBuffer->data, maxLength);
+	verify_malloc(data, pErrorInfo, RSSL_RET_FAILURE);
+
+	pBuffer->data = data;
+	pBuffer->maxLength = maxLength;
+	return RSSL_RET_SUCCESS;
+}
+
+/* Writes an integer of the given size at the given position. Space must already be reserved. */
+static void wlSnapshotPutUInt(char *pPosition, RsslUInt64 value, int size)
+{
+	while (size-- > 0)
+	{
+		pPosition[size] = (char)(value & 0xff);
+		value >>= 8;
+	}
+}
+
+/* Reads an integer of the given size from the given position. */
+static RsslUInt64 wlSnapshotGetUInt(const char *pPosition, int size)
+{
+	RsslUInt64 value = 0;
+	int i;
+
+	for (i = 0; i < size; ++i)
+		value = (value << 8) | (unsigned char)pPosition[i];
+
+	return value;
+}
+
+/* Encodes the view and symbol list behaviors of a request, if any, as the element list payload of its request message. */
+static RsslRet wlSnapshotEncodePayload(RsslEncodeIterator *pIter, WlItemRequest *pItemRequest, RsslBool hasBehaviors)
+{
+	RsslElementList elementList;
+	RsslElementEntry elementEntry;
+	RsslRet ret;
+
+	rsslClearElementList(&elementList);
+	elementList.flags = RSSL_ELF_HAS_STANDARD_DATA;
+	if ((ret = rsslEncodeElementListInit(pIter, &elementList, NULL, 0)) != RSSL_RET_SUCCESS)
+		return ret;
+
+	if (pItemRequest->pView)
+	{
+		WlView *pView = pItemRequest->pView;
+		RsslUInt viewType = pView->elemList ? pView->viewType : RDM_VIEW_TYPE_FIELD_ID_LIST;
+		RsslArray viewArray;
+		RsslUInt32 i;
+
+		rsslClearElementEntry(&elementEntry);
+		elementEntry.name = RSSL_ENAME_VIEW_TYPE;
+		elementEntry.dataType = RSSL_DT_UINT;
+		if ((ret = rsslEncodeElementEntry(pIter, &elementEntry, &viewType)) != RSSL_RET_SUCCESS)
+			return ret;
+
+		rsslClearElementEntry(&elementEntry);
+		elementEntry.name = RSSL_ENAME_VIEW_DATA;
+		elementEntry.dataType = RSSL_DT_ARRAY;
+		if ((ret = rsslEncodeElementEntryInit(pIter, &elementEntry, 0)) != RSSL_RET_SUCCESS)
+			return ret;
+
+		rsslClearArray(&viewArray);
+		if (viewType == RDM_VIEW_TYPE_FIELD_ID_LIST)
+		{
+			viewArray.primitiveType = RSSL_DT_INT;
+			viewArray.itemLength = 2;
+		}
+		else
+			viewArray.primitiveType = RSSL_DT_ASCII_STRING;
+
+		if ((ret = rsslEncodeArrayInit(pIter, &viewArray)) != RSSL_RET_SUCCESS)
+			return ret;
+
+		for (i = 0; i < pView->elemCount; ++i)
+		{
+			if (viewType == RDM_VIEW_TYPE_FIELD_ID_LIST)
+			{
+				RsslInt fieldId = ((RsslFieldId*)pView->elemList)[i];
+				ret = rsslEncodeArrayEntry(pIter, NULL, &fieldId);
+			}
+			else
+				ret = rsslEncodeArrayEntry(pIter, NULL, &((RsslBuffer*)pView->elemList)[i]);
+
+			if (ret != RSSL_RET_SUCCESS)
+				return ret;
+		}
+
+		if ((ret = rsslEncodeArrayComplete(pIter, RSSL_TRUE)) != RSSL_RET_SUCCESS
+				|| (ret = rsslEncodeElementEntryComplete(pIter, RSSL_TRUE)) != RSSL_RET_SUCCESS)
+			return ret;
+	}
+
+	if (hasBehaviors)
+	{
+		RsslElementList behaviorsList;
+		RsslUInt dataStreams = ((WlSymbolListRequest*)pItemRequest)->flags;
+
+		rsslClearElementEntry(&elementEntry);
+		elementEntry.name = RSSL_ENAME_SYMBOL_LIST_BEHAVIORS;
+		elementEntry.dataType = RSSL_DT_ELEMENT_LIST;
+		if ((ret = rsslEncodeElementEntryInit(pIter, &elementEntry, 0)) != RSSL_RET_SUCCESS)
+			return ret;
+
+		rsslClearElementList(&behaviorsList);
+		behaviorsList.flags = RSSL_ELF_HAS_STANDARD_DATA;
+		if ((ret = rsslEncodeElementListInit(pIter, &behaviorsList, NULL, 0)) != RSSL_RET_SUCCESS)
+			return ret;
+
+		rsslClearElementEntry(&elementEntry);
+		elementEntry.name = RSSL_ENAME_DATA_STREAMS;
+		elementEntry.dataType = RSSL_DT_UINT;
+		if ((ret = rsslEncodeElementEntry(pIter, &elementEntry, &dataStreams)) != RSSL_RET_SUCCESS)
+			return ret;
+
+		if ((ret = rsslEncodeElementListComplete(pIter, RSSL_TRUE)) != RSSL_RET_SUCCESS
+				|| (ret = rsslEncodeElementEntryComplete(pIter, RSSL_TRUE)) != RSSL_RET_SUCCESS)
+			return ret;
+	}
+
+	return rsslEncodeElementListComplete(pIter, RSSL_TRUE);
+}
+
+/* Encodes a request message that reopens the given request. */
+static RsslRet wlSnapshotEncodeRequestMsg(RsslEncodeIterator *pIter, WlItemRequest *pItemRequest, RsslUInt32 maxLength)
+{
+	RsslRequestMsg requestMsg;
+	RsslBool hasBehaviors;
+	RsslRet ret;
+
+	rsslClearRequestMsg(&requestMsg);
+	requestMsg.msgBase.streamId = pItemRequest->base.streamId;
+	requestMsg.msgBase.domainType = pItemRequest->base.domainType;
+	requestMsg.msgBase.msgKey = pItemRequest->msgKey;
+	requestMsg.flags = pItemRequest->requestMsgFlags
+		& ~(RSSL_RQMF_HAS_BATCH | RSSL_RQMF_HAS_VIEW | RSSL_RQMF_NO_REFRESH | RSSL_RQMF_HAS_EXTENDED_HEADER);
+	requestMsg.qos = pItemRequest->qos;
+	requestMsg.worstQos = pItemRequest->worstQos;
+	requestMsg.priorityClass = pItemRequest->priorityClass;
+	requestMsg.priorityCount = pItemRequest->priorityCount;
+
+	/* Requests by name are resolved to the service again when restored. */
+	if (pItemRequest->pRequestedService->flags & WL_RSVC_HAS_NAME)
+		requestMsg.msgBase.msgKey.flags &= ~RSSL_MKF_HAS_SERVICE_ID;
+
+	if (pItemRequest->extendedHeader.length)
+	{
+		requestMsg.flags |= RSSL_RQMF_HAS_EXTENDED_HEADER;
+		requestMsg.extendedHeader = pItemRequest->extendedHeader;
+	}
+
+	hasBehaviors = (pItemRequest->base.domainType == RSSL_DMT_SYMBOL_LIST
+			&& ((WlSymbolListRequest*)pItemRequest)->hasBehaviors);
+
+	if (!pItemRequest->pView && !hasBehaviors)
+	{
+		if (pItemRequest->encDataBody.length)
+		{
+			requestMsg.msgBase.containerType = pItemRequest->containerType;
+			requestMsg.msgBase.encDataBody = pItemRequest->encDataBody;
+		}
+		else
+			requestMsg.msgBase.containerType = RSSL_DT_NO_DATA;
+
+		return rsslEncodeMsg(pIter, (RsslMsg*)&requestMsg);
+	}
+
+	if (pItemRequest->pView)
+		requestMsg.flags |= RSSL_RQMF_HAS_VIEW;
+
+	requestMsg.msgBase.containerType = RSSL_DT_ELEMENT_LIST;
+	if ((ret = rsslEncodeMsgInit(pIter, (RsslMsg*)&requestMsg, maxLength)) != RSSL_RET_ENCODE_CONTAINER)
+		return ret;
+
+	if ((ret = wlSnapshotEncodePayload(pIter, pItemRequest, hasBehaviors)) != RSSL_RET_SUCCESS)
+		return ret;
+
+	return rsslEncodeMsgComplete(pIter, RSSL_TRUE);
+}
+
+/* Adds a request's record to the snapshot. */
+static RsslRet wlSnapshotPutItemRequest(WlSnapshotBuffer *pBuffer, WlItemRequest *pItemRequest, RsslErrorInfo *pErrorInfo)
+{
+	RsslBuffer *pServiceName = (pItemRequest->pRequestedService->flags & WL_RSVC_HAS_NAME) ?
+		&pItemRequest->pRequestedService->serviceName : NULL;
+	RsslUInt32 serviceNameLength = pServiceName ? pServiceName->length : 0;
+	RsslUInt32 msgLength = 256 + pItemRequest->msgKey.name.length + pItemRequest->msgKey.encAttrib.length
+		+ pItemRequest->encDataBody.length + pItemRequest->extendedHeader.length;
+	RsslUInt32 recordLength = 1 + 2 + serviceNameLength + 4;
+	RsslRet ret;
+
+	if (pItemRequest->pView)
+		msgLength += pItemRequest->pView->elemCount * 16;
+
+	while (1)
+	{
+		RsslEncodeIterator encodeIter;
+		RsslBuffer msgBuffer;
+		char *pRecord;
+
+		if ((ret = wlSnapshotReserve(pBuffer, recordLength + msgLength, pErrorInfo)) != RSSL_RET_SUCCESS)
+			return ret;
+
+		pRecord = pBuffer->data + pBuffer->length;
+		msgBuffer.data = pRecord + recordLength;
+		msgBuffer.length = msgLength;
+
+		rsslClearEncodeIterator(&encodeIter);
+		rsslSetEncodeIteratorRWFVersion(&encodeIter, RSSL_RWF_MAJOR_VERSION, RSSL_RWF_MINOR_VERSION);
+		rsslSetEncodeIteratorBuffer(&encodeIter, &msgBuffer);
+
+		switch (ret = wlSnapshotEncodeRequestMsg(&encodeIter, pItemRequest, msgLength))
+		{
+			case RSSL_RET_SUCCESS:
+				wlSnapshotPutUInt(pRecord, pItemRequest->requestRank, 1);
+				wlSnapshotPutUInt(pRecord + 1, serviceNameLength, 2);
+				if (serviceNameLength)
+					memcpy(pRecord + 3, pServiceName->data, serviceNameLength);
+				wlSnapshotPutUInt(pRecord + 3 + serviceNameLength, rsslGetEncodedBufferLength(&encodeIter), 4);
+				pBuffer->length += recordLength + rsslGetEncodedBufferLength(&encodeIter);
+				return RSSL_RET_SUCCESS;
+
+			case RSSL_RET_BUFFER_TOO_SMALL:
+				msgLength *= 2;
+				break;
+
+			default:
+				rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, ret, __FILE__, __LINE__,
+						"Failed to encode request on stream %d for watchlist snapshot -- %d.", pItemRequest->base.streamId, ret);
+				return ret;
+		}
+	}
+}
+
+/* Adds the cached directory to the snapshot, as a refresh of all cached services. */
+static RsslRet wlSnapshotPutDirectory(WlSnapshotBuffer *pBuffer, WlServiceCache *pServiceCache, RsslErrorInfo *pErrorInfo)
+{
+	WlServiceList serviceList;
+	RsslRDMDirectoryRefresh directoryRefresh;
+	RsslUInt32 msgLength;
+	RsslRet ret;
+
+	if ((ret = wlServiceCacheGetServiceList(pServiceCache, &serviceList, NULL, NULL, RSSL_FALSE, pErrorInfo))
+			!= RSSL_RET_SUCCESS)
+		return ret;
+
+	if (!serviceList.serviceCount)
+	{
+		if ((ret = wlSnapshotReserve(pBuffer, 4, pErrorInfo)) != RSSL_RET_SUCCESS)
+			return ret;
+
+		wlSnapshotPutUInt(pBuffer->data + pBuffer->length, 0, 4);
+		pBuffer->length += 4;
+		return RSSL_RET_SUCCESS;
+	}
+
+	rsslClearRDMDirectoryRefresh(&directoryRefresh);
+	directoryRefresh.rdmMsgBase.streamId = 1;
+	directoryRefresh.filter = RDM_DIRECTORY_SERVICE_INFO_FILTER | RDM_DIRECTORY_SERVICE_STATE_FILTER
+		| RDM_DIRECTORY_SERVICE_GROUP_FILTER | RDM_DIRECTORY_SERVICE_LOAD_FILTER
+		| RDM_DIRECTORY_SERVICE_DATA_FILTER | RDM_DIRECTORY_SERVICE_LINK_FILTER;
+	directoryRefresh.serviceList = serviceList.serviceList;
+	directoryRefresh.serviceCount = serviceList.serviceCount;
+
+	msgLength = 1024 * serviceList.serviceCount;
+
+	while (1)
+	{
+		RsslEncodeIterator encodeIter;
+		RsslBuffer msgBuffer;
+		RsslUInt32 bytesWritten;
+
+		if ((ret = wlSnapshotReserve(pBuffer, 4 + msgLength, pErrorInfo)) != RSSL_RET_SUCCESS)
+			return ret;
+
+		msgBuffer.data = pBuffer->data + pBuffer->length + 4;
+		msgBuffer.length = msgLength;
+
+		rsslClearEncodeIterator(&encodeIter);
+		rsslSetEncodeIteratorRWFVersion(&encodeIter, RSSL_RWF_MAJOR_VERSION, RSSL_RWF_MINOR_VERSION);
+		rsslSetEncodeIteratorBuffer(&encodeIter, &msgBuffer);
+
+		switch (ret = rsslEncodeRDMDirectoryMsg(&encodeIter, (RsslRDMDirectoryMsg*)&directoryRefresh, 
+					&bytesWritten, pErrorInfo))
+		{
+			case RSSL_RET_SUCCESS:
+				wlSnapshotPutUInt(pBuffer->data + pBuffer->length, bytesWritten, 4);
+				pBuffer->length += 4 + bytesWritten;
+				return RSSL_RET_SUCCESS;
+
+			case RSSL_RET_BUFFER_TOO_SMALL:
+				msgLength *= 2;
+				break;
+
+			default:
+				return ret;
+		}
+	}
+}
+
+RsslRet rsslWatchlistSaveSnapshot(RsslWatchlist *pWatchlist, const char *fileName, RsslErrorInfo *pErrorInfo)
+{
+	RsslWatchlistImpl *pWatchlistImpl = (RsslWatchlistImpl*)pWatchlist;
+	WlSnapshotBuffer buffer;
+	RsslQueueLink *pServiceLink, *pLink;
+	RsslUInt32 requestCount = 0;
+	FILE *pFile;
+	RsslRet ret = RSSL_RET_SUCCESS;
+
+	memset(&buffer, 0, sizeof(WlSnapshotBuffer));
+
+	if ((ret = wlSnapshotReserve(&buffer, WL_SNAPSHOT_HEADER_LENGTH, pErrorInfo)) != RSSL_RET_SUCCESS)
+		return ret;
+
+	memcpy(buffer.data, wlSnapshotMagic, sizeof(wlSnapshotMagic));
+	wlSnapshotPutUInt(buffer.data + 4, WL_SNAPSHOT_VERSION, 1);
+	wlSnapshotPutUInt(buffer.data + 5, RSSL_RWF_MAJOR_VERSION, 1);
+	wlSnapshotPutUInt(buffer.data + 6, RSSL_RWF_MINOR_VERSION, 1);
+	buffer.length = WL_SNAPSHOT_HEADER_LENGTH;
+
+	if ((ret = wlSnapshotPutDirectory(&buffer, pWatchlistImpl->base.pServiceCache, pErrorInfo)) != RSSL_RET_SUCCESS)
+	{
+		free(buffer.data);
+		return ret;
+	}
+
+	RSSL_QUEUE_FOR_EACH_LINK(&pWatchlistImpl->base.requestedServices, pServiceLink)
+	{
+		WlRequestedService *pRequestedService = RSSL_QUEUE_LINK_TO_OBJECT(WlRequestedService,
+				qlServiceRequests, pServiceLink);
+
+		RSSL_QUEUE_FOR_EACH_LINK(&pRequestedService->itemRequests, pLink)
+		{
+			WlItemRequest *pItemRequest = RSSL_QUEUE_LINK_TO_OBJECT(WlItemRequest,
+					qlRequestedService, pLink);
+
+			/* Snapshot requests end on their own, and requests with negative stream IDs
+			 * are symbol list data streams that the restored symbol list will open again. */
+			if (!(pItemRequest->requestMsgFlags & RSSL_RQMF_STREAMING) || pItemRequest->base.streamId < 0)
+				continue;
+
+			if ((ret = wlSnapshotPutItemRequest(&buffer, pItemRequest, pErrorInfo)) != RSSL_RET_SUCCESS)
+			{
+				free(buffer.data);
+				return ret;
+			}
+
+			++requestCount;
+		}
+	}
+
+	wlSnapshotPutUInt(buffer.data + WL_SNAPSHOT_COUNT_POSITION, requestCount, 4);
+
+	if (!(pFile = fopen(fileName, "wb")))
+	{
+		rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__,
+				"Failed to open watchlist snapshot file %s -- errno %d.", fileName, errno);
+		free(buffer.data);
+		return RSSL_RET_FAILURE;
+	}
+
+	if (fwrite(buffer.data, 1, buffer.length, pFile) != buffer.length)
+	{
+		rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__,
+				"Failed to write watchlist snapshot file %s -- errno %d.", fileName, errno);
+		ret = RSSL_RET_FAILURE;
+	}
+
+	if (fclose(pFile) != 0 && ret == RSSL_RET_SUCCESS)
+	{
+		rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__,
+				"Failed to write watchlist snapshot file %s -- errno %d.", fileName, errno);
+		ret = RSSL_RET_FAILURE;
+	}
+
+	free(buffer.data);
+	return ret;
+}
+
+/* Reads a whole file into a newly-allocated buffer. */
+static RsslRet wlSnapshotReadFile(const char *fileName, RsslBuffer *pFileBuffer, RsslErrorInfo *pErrorInfo)
+{
+	FILE *pFile;
+	long fileLength;
+
+	if (!(pFile = fopen(fileName, "rb")))
+	{
+		/* No snapshot was saved yet. */
+		if (errno == ENOENT)
+			return RSSL_RET_READ_WOULD_BLOCK;
+
+		rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__,
+				"Failed to open watchlist snapshot file %s -- errno %d.", fileName, errno);
+		return RSSL_RET_FAILURE;
+	}
+
+	if (fseek(pFile, 0, SEEK_END) != 0 || (fileLength = ftell(pFile)) < 0 || fseek(pFile, 0, SEEK_SET) != 0)
+	{
+		rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__,
+				"Failed to read watchlist snapshot file %s -- errno %d.", fileName, errno);
+		fclose(pFile);
+		return RSSL_RET_FAILURE;
+	}
+
+	if (!(pFileBuffer->data = (char*)malloc(fileLength ? fileLength : 1)))
+	{
+		rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, 
+				"Memory allocation failed.");
+		fclose(pFile);
+		return RSSL_RET_FAILURE;
+	}
+
+	pFileBuffer->length = (RsslUInt32)fileLength;
+	if (fread(pFileBuffer->data, 1, pFileBuffer->length, pFile) != pFileBuffer->length)
+	{
+		rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__,
+				"Failed to read watchlist snapshot file %s -- errno %d.", fileName, errno);
+		free(pFileBuffer->data);
+		fclose(pFile);
+		return RSSL_RET_FAILURE;
+	}
+
+	fclose(pFile);
+	return RSSL_RET_SUCCESS;
+}
+
+/* Preloads the service cache from the snapshot's directory refresh. */
+static RsslRet wlSnapshotPreloadDirectory(RsslWatchlistImpl *pWatchlistImpl, RsslBuffer *pMsgBuffer,
+		RsslUInt32 majorVersion, RsslUInt32 minorVersion, RsslErrorInfo *pErrorInfo)
+{
+	RsslDecodeIterator decodeIter;
+	RsslMsg rsslMsg;
+	RsslRDMDirectoryMsg directoryMsg;
+	RsslBuffer memoryBuffer;
+	RsslUInt32 memoryLength = 4 * pMsgBuffer->length + 4096;
+	RsslRet ret;
+
+	while (1)
+	{
+		if (!(memoryBuffer.data = (char*)malloc(memoryLength)))
+		{
+			rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, 
+					"Memory allocation failed.");
+			return RSSL_RET_FAILURE;
+		}
+		memoryBuffer.length = memoryLength;
+
+		rsslClearDecodeIterator(&decodeIter);
+		rsslSetDecodeIteratorRWFVersion(&decodeIter, majorVersion, minorVersion);
+		rsslSetDecodeIteratorBuffer(&decodeIter, pMsgBuffer);
+
+		if ((ret = rsslDecodeMsg(&decodeIter, &rsslMsg)) == RSSL_RET_SUCCESS)
+			ret = rsslDecodeRDMDirectoryMsg(&decodeIter, &rsslMsg, &directoryMsg, &memoryBuffer, pErrorInfo);
+
+		if (ret != RSSL_RET_BUFFER_TOO_SMALL)
+			break;
+
+		free(memoryBuffer.data);
+		memoryLength *= 2;
+	}
+
+	if (ret == RSSL_RET_SUCCESS && directoryMsg.rdmMsgBase.rdmMsgType == RDM_DR_MT_REFRESH)
+		ret = wlServiceCachePreload(pWatchlistImpl->base.pServiceCache, &directoryMsg.refresh, pErrorInfo);
+	else if (ret == RSSL_RET_SUCCESS)
+		ret = RSSL_RET_INVALID_DATA;
+
+	free(memoryBuffer.data);
+	return ret;
+}
+
+RsslRet rsslWatchlistLoadSnapshot(RsslWatchlist *pWatchlist, const char *fileName, RsslErrorInfo *pErrorInfo)
+{
+	RsslWatchlistImpl *pWatchlistImpl = (RsslWatchlistImpl*)pWatchlist;
+	RsslBuffer fileBuffer, directoryBuffer;
+	RsslUInt32 position, requestCount, i, majorVersion, minorVersion;
+	RsslRet ret;
+
+	switch (ret = wlSnapshotReadFile(fileName, &fileBuffer, pErrorInfo))
+	{
+		case RSSL_RET_SUCCESS: break;
+		case RSSL_RET_READ_WOULD_BLOCK: return RSSL_RET_SUCCESS;
+		default: return ret;
+	}
+
+	if (fileBuffer.length < WL_SNAPSHOT_HEADER_LENGTH
+			|| memcmp(fileBuffer.data, wlSnapshotMagic, sizeof(wlSnapshotMagic)) != 0
+			|| wlSnapshotGetUInt(fileBuffer.data + 4, 1) != WL_SNAPSHOT_VERSION)
+	{
+		rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_INVALID_DATA, __FILE__, __LINE__,
+				"File %s is not a watchlist snapshot.", fileName);
+		free(fileBuffer.data);
+		return RSSL_RET_INVALID_DATA;
+	}
+
+	majorVersion = (RsslUInt32)wlSnapshotGetUInt(fileBuffer.data + 5, 1);
+	minorVersion = (RsslUInt32)wlSnapshotGetUInt(fileBuffer.data + 6, 1);
+	requestCount = (RsslUInt32)wlSnapshotGetUInt(fileBuffer.data + WL_SNAPSHOT_COUNT_POSITION, 4);
+	position = WL_SNAPSHOT_HEADER_LENGTH;
+
+	/* Preload the directory first, so restored requests are matched to their services
+	 * without waiting for the provider's directory. */
+	if (fileBuffer.length - position < 4
+			|| (directoryBuffer.length = (RsslUInt32)wlSnapshotGetUInt(fileBuffer.data + position, 4))
+				> fileBuffer.length - position - 4)
+	{
+		rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_INVALID_DATA, __FILE__, __LINE__,
+				"Watchlist snapshot file %s is truncated or corrupt at the directory.", fileName);
+		free(fileBuffer.data);
+		return RSSL_RET_INVALID_DATA;
+	}
+
+	directoryBuffer.data = fileBuffer.data + position + 4;
+	position += 4 + directoryBuffer.length;
+
+	if (directoryBuffer.length 
+			&& (ret = wlSnapshotPreloadDirectory(pWatchlistImpl, &directoryBuffer, majorVersion, minorVersion,
+					pErrorInfo)) != RSSL_RET_SUCCESS)
+	{
+		if (ret == RSSL_RET_INVALID_DATA)
+			rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_INVALID_DATA, __FILE__, __LINE__,
+					"Watchlist snapshot file %s has an invalid directory.", fileName);
+		free(fileBuffer.data);
+		return ret;
+	}
+
+	for (i = 0; i < requestCount; ++i)
+	{
+		RsslWatchlistProcessMsgOptions processOpts;
+		RsslDecodeIterator decodeIter;
+		RsslBuffer serviceName, msgBuffer;
+		RsslMsg rsslMsg;
+		RsslUInt8 requestRank;
+
+		if (fileBuffer.length - position < 3)
+			break;
+
+		requestRank = (RsslUInt8)wlSnapshotGetUInt(fileBuffer.data + position, 1);
+		serviceName.length = (RsslUInt32)wlSnapshotGetUInt(fileBuffer.data + position + 1, 2);
+		serviceName.data = fileBuffer.data + position + 3;
+		position += 3 + serviceName.length;
+
+		if (position > fileBuffer.length || fileBuffer.length - position < 4)
+			break;
+
+		msgBuffer.length = (RsslUInt32)wlSnapshotGetUInt(fileBuffer.data + position, 4);
+		msgBuffer.data = fileBuffer.data + position + 4;
+		position += 4;
+
+		if (fileBuffer.length - position < msgBuffer.length)
+			break;
+
+		position += msgBuffer.length;
+
+		rsslClearDecodeIterator(&decodeIter);
+		rsslSetDecodeIteratorRWFVersion(&decodeIter, majorVersion, minorVersion);
+		rsslSetDecodeIteratorBuffer(&decodeIter, &msgBuffer);
+		if ((ret = rsslDecodeMsg(&decodeIter, &rsslMsg)) != RSSL_RET_SUCCESS
+				|| rsslMsg.msgBase.msgClass != RSSL_MC_REQUEST)
+			break;
+
+		rsslWatchlistClearProcessMsgOptions(&processOpts);
+		processOpts.pRsslMsg = &rsslMsg;
+		processOpts.pServiceName = serviceName.length ? &serviceName : NULL;
+		processOpts.requestRank = requestRank;
+		processOpts.majorVersion = majorVersion;
+		processOpts.minorVersion = minorVersion;
+
+		if ((ret = rsslWatchlistSubmitMsg(pWatchlist, &processOpts, pErrorInfo)) < RSSL_RET_SUCCESS)
+		{
+			free(fileBuffer.data);
+			return ret;
+		}
+	}
+
+	free(fileBuffer.data);
+
+	if (i < requestCount)
+	{
+		rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_INVALID_DATA, __FILE__, __LINE__,
+				"Watchlist snapshot file %s is truncated or corrupt at request %u.", fileName, i);
+		return RSSL_RET_INVALID_DATA;
+	}
+
+	return RSSL_RET_SUCCESS;
+}
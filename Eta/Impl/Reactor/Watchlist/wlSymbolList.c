@@ -321,6 +321,7 @@ RsslRet wlProcessSymbolListMsg(WlBase *pBase, WlItems *pItems, RsslMsg *pRsslMsg
 						opts.pRequestMsg = &requestMsg;
 						opts.pUserSpec = NULL;
 						opts.slDataStreamFlags = pRequest->flags;
+						opts.requestRank = pRequest->itemBase.requestRank;
 						opts.majorVersion = pBase->pRsslChannel->majorVersion;
 						opts.minorVersion = pBase->pRsslChannel->minorVersion;
 						opts.pServiceName = &pCachedService->rdm.info.serviceName;
@@ -25,26 +25,35 @@ static int wlaCompareFieldId(const void *p1, const void *p2)
 	else return 1;
 }
 
-/* Field ID compare function; used to sort fields in an aggregate view. */
-static int wlaCompareViewField(const void *p1, const void *p2)
+/* Field ID views: Position of a field in the aggregate view's pages. Field IDs are signed, so they
+ * are offset to keep the pages in field ID order. */
+#define WLA_FIELD_INDEX(__fieldId) ((RsslUInt32)((RsslInt32)(__fieldId) + 32768))
+#define WLA_FIELD_BIT(__index) ((RsslUInt64)1 << ((__index) % 64))
+
+/* Counts the bits set in a word. */
+static RsslUInt32 wlaPopCount64(RsslUInt64 word)
 {
-	const WlViewField *pViewFid1 = (const WlViewField*)p1;
-	const WlViewField *pViewFid2 = (const WlViewField*)p2;
-	
-	if (pViewFid1->fieldId < pViewFid2->fieldId) return -1;
-	else if (pViewFid1->fieldId == pViewFid2->fieldId) return 0;
-	else return 1;
+	word = word - ((word >> 1) & 0x5555555555555555ULL);
+	word = (word & 0x3333333333333333ULL) + ((word >> 2) & 0x3333333333333333ULL);
+	word = (word + (word >> 4)) & 0x0f0f0f0f0f0f0f0fULL;
+	return (RsslUInt32)((word * 0x0101010101010101ULL) >> 56);
 }
 
-/* Field ID compare function; used to find fields in an aggregate view by their ID. */
-static int wlaCompareViewFieldWithId(const void *p1, const void *p2)
+/* Frees all field pages of a field ID view. */
+static void wlaFreeFieldPages(WlAggregateView *pAggView)
 {
-	const RsslFieldId fieldId = *(const RsslFieldId*)p1;
-	const WlViewField *pViewFid = (const WlViewField*)p2;
-	
-	if (fieldId < pViewFid->fieldId) return -1;
-	else if (fieldId == pViewFid->fieldId) return 0;
-	else return 1;
+	RsslUInt32 ui;
+
+	if (!pAggView->fieldPages)
+		return;
+
+	for(ui = 0; ui < WL_VIEW_FIELD_PAGE_COUNT; ++ui)
+		if (pAggView->fieldPages[ui])
+			free(pAggView->fieldPages[ui]);
+
+	free(pAggView->fieldPages);
+	pAggView->fieldPages = NULL;
+	pAggView->elemCount = 0;
 }
 
 /* Compare RsslBuffers as strings(view element names are required to be ASCII strings). */
@@ -116,64 +125,37 @@ static RsslRet wlaMergeView(WlAggregateView *pAggView, WlView *pView, RsslBool *
 
 	case RDM_VIEW_TYPE_FIELD_ID_LIST:
 	{
-		WlViewField *aggViewFieldList = (WlViewField*)pAggView->elemList;
-		RsslUInt32 aggViewFieldCapacity;
-		RsslUInt32 aggViewFieldCount;
-		RsslFieldId *viewFieldList;
+		RsslFieldId *viewFieldList = (RsslFieldId*)pView->elemList;
 
-		if (!aggViewFieldList)
+		if (!pAggView->fieldPages)
 		{
-			aggViewFieldList = (WlViewField*)malloc(pView->elemCount 
-					* sizeof(WlViewField));
-			verify_malloc(aggViewFieldList, pErrorInfo, RSSL_RET_FAILURE);
-			pAggView->elemCapacity = pView->elemCount;
+			pAggView->fieldPages = (WlViewFieldPage**)calloc(WL_VIEW_FIELD_PAGE_COUNT, 
+					sizeof(WlViewFieldPage*));
+			verify_malloc(pAggView->fieldPages, pErrorInfo, RSSL_RET_FAILURE);
 			pAggView->elemCount = 0;
-			pAggView->elemList = (void*)aggViewFieldList;
 		}
 
-		aggViewFieldCapacity = pAggView->elemCapacity;
-		aggViewFieldCount = pAggView->elemCount;
-		viewFieldList = (RsslFieldId*)pView->elemList;
-
 		for(ui = 0; ui < pView->elemCount; ++ui)
 		{
-			WlViewField *pViewField = (WlViewField*)bsearch(&viewFieldList[ui],
-					aggViewFieldList, pAggView->elemCount, sizeof(WlViewField),
-					wlaCompareViewFieldWithId);
+			RsslUInt32 index = WLA_FIELD_INDEX(viewFieldList[ui]);
+			WlViewFieldPage *pPage = pAggView->fieldPages[index / WL_VIEW_FIELD_PAGE_SIZE];
 
-			if (pViewField)
+			if (!pPage)
 			{
-				/* Field exists in list already; just update count. */
-				++pViewField->count;
+				pPage = (WlViewFieldPage*)calloc(1, sizeof(WlViewFieldPage));
+				verify_malloc(pPage, pErrorInfo, RSSL_RET_FAILURE);
+				pAggView->fieldPages[index / WL_VIEW_FIELD_PAGE_SIZE] = pPage;
 			}
-			else
-			{
-				/* Need to add this field to the view. */
-				if (aggViewFieldCount == aggViewFieldCapacity)
-				{
-					/* Out of space -- grow the list. */
-					aggViewFieldCapacity *= 2;
-					aggViewFieldList = (WlViewField*)realloc(aggViewFieldList,
-							aggViewFieldCapacity * sizeof(WlViewField));
-					verify_malloc(aggViewFieldList, pErrorInfo, RSSL_RET_FAILURE);
-					pAggView->elemList = (void*)aggViewFieldList;
-				}
 
-				/* Add the new field to the end (we'll sort it in later -- we only need to
-				 * bsearch for fields that were in the aggregate list to begin with; the
-				 * component views already have any duplicates removed). */
-				aggViewFieldList[aggViewFieldCount].fieldId = viewFieldList[ui];
-				aggViewFieldList[aggViewFieldCount].count = 1;
-				aggViewFieldList[aggViewFieldCount].committed = RSSL_FALSE;
-				++aggViewFieldCount;
+			index %= WL_VIEW_FIELD_PAGE_SIZE;
+			if (pPage->count[index]++ == 0)
+			{
+				/* Field is newly requested. */
+				pPage->present[index / 64] |= WLA_FIELD_BIT(index);
+				++pAggView->elemCount;
 			}
 		}
 
-		pAggView->elemCapacity = aggViewFieldCapacity;
-		pAggView->elemCount = aggViewFieldCount;
-
-		qsort(aggViewFieldList, pAggView->elemCount, sizeof(WlViewField), 
-				wlaCompareViewField);
 		break;
 	}
 
@@ -275,34 +257,23 @@ RsslBool wlAggregateViewContains(WlAggregateView *pAggView, WlView *pView)
 
 	case RDM_VIEW_TYPE_FIELD_ID_LIST:
 	{
-		WlViewField *aggViewFieldList = (WlViewField*)pAggView->elemList;
-
-		switch(mergedCount)
-		{
-			case 0:
-				return RSSL_FALSE;
-			default:
-			{
-				/* Check against aggregate view. */
-				RsslFieldId *viewFieldList = (RsslFieldId*)pView->elemList;
-				WlViewField *aggViewFieldList = (WlViewField*)pAggView->elemList;
-
-				if (pView->elemCount > pAggView->elemCount)
-					return RSSL_FALSE;
+		RsslFieldId *viewFieldList = (RsslFieldId*)pView->elemList;
 
-				for(ui = 0; ui < pView->elemCount; ++ui)
-				{
-					WlViewField *pViewField = (WlViewField*)bsearch(&viewFieldList[ui], aggViewFieldList, 
-							pAggView->elemCount, sizeof(WlViewField), wlaCompareViewFieldWithId);
+		if (mergedCount == 0 || !pAggView->fieldPages)
+			return RSSL_FALSE;
 
-					if (!pViewField || !pViewField->committed)
-						return RSSL_FALSE;
-				}
+		/* Check against the committed fields. */
+		for(ui = 0; ui < pView->elemCount; ++ui)
+		{
+			RsslUInt32 index = WLA_FIELD_INDEX(viewFieldList[ui]);
+			WlViewFieldPage *pPage = pAggView->fieldPages[index / WL_VIEW_FIELD_PAGE_SIZE];
 
-				return RSSL_TRUE;
-			}
+			index %= WL_VIEW_FIELD_PAGE_SIZE;
+			if (!pPage || !(pPage->committed[index / 64] & WLA_FIELD_BIT(index)))
+				return RSSL_FALSE;
 		}
-		break;
+
+		return RSSL_TRUE;
 	}
 
 	case RDM_VIEW_TYPE_ELEMENT_NAME_LIST:
@@ -368,43 +339,28 @@ static RsslBool wlaUnmergeView(WlAggregateView *pAggView, WlView *pView, RsslBoo
 
 	case RDM_VIEW_TYPE_FIELD_ID_LIST:
 	{
-		WlViewField *aggViewFieldList = (WlViewField*)pAggView->elemList;
 		RsslBool viewUpdated = RSSL_FALSE;
 		RsslFieldId *viewFieldList = (RsslFieldId*)pView->elemList;
 
-		assert(aggViewFieldList);
+		assert(pAggView->fieldPages);
 
-		/* Decrement field counts. */
+		/* Decrement field counts. Fields no longer requested leave the view immediately; the
+		 * committed bits still record whether they were sent, so either way a change is detected. */
 		for(ui = 0; ui < pView->elemCount; ++ui)
 		{
-			WlViewField *pViewField = (WlViewField*)bsearch(&viewFieldList[ui],
-					aggViewFieldList, pAggView->elemCount, sizeof(WlViewField),
-					wlaCompareViewFieldWithId);
+			RsslUInt32 index = WLA_FIELD_INDEX(viewFieldList[ui]);
+			WlViewFieldPage *pPage = pAggView->fieldPages[index / WL_VIEW_FIELD_PAGE_SIZE];
 
-			assert(pViewField && pViewField->count > 0);
+			index %= WL_VIEW_FIELD_PAGE_SIZE;
+			assert(pPage && pPage->count[index] > 0);
 
-			--pViewField->count;
-		}
-
-		/* Now remove fields that have been zeroed(can't remove them in the first pass
-		 * since we would likely break the sorted ordering needed for binary search). */
-		if (removeZeroFields)
-			for(ui = 0; ui < pView->elemCount; ++ui)
+			if (--pPage->count[index] == 0)
 			{
-				if (aggViewFieldList[ui].count == 0 && !aggViewFieldList[ui].committed)
-				{
-					viewUpdated = RSSL_TRUE;
-					aggViewFieldList[ui] = 
-						aggViewFieldList[pAggView->elemCount - 1];
-					--pAggView->elemCount;
-				}
-
+				pPage->present[index / 64] &= ~WLA_FIELD_BIT(index);
+				--pAggView->elemCount;
+				viewUpdated = RSSL_TRUE;
 			}
-
-		/* Resort list if anything changed. */
-		if (viewUpdated)
-			qsort(aggViewFieldList, pAggView->elemCount, sizeof(WlViewField), 
-					wlaCompareViewField);
+		}
 
 		return viewUpdated;
 	}
@@ -651,6 +607,8 @@ WlAggregateView *wlAggregateViewCreate(RsslErrorInfo *pErrorInfo)
 
 void wlAggregateViewDestroy(WlAggregateView *pView)
 {
+	wlaFreeFieldPages(pView);
+
 	if (pView->elemList)
 	{
 		if (pView->viewType == RDM_VIEW_TYPE_ELEMENT_NAME_LIST)
@@ -720,7 +678,7 @@ RsslRet wlAggregateViewMerge(WlAggregateView *pAggView, RsslBool *pUpdated,
 	if (*pUpdated == RSSL_TRUE)
 		return RSSL_RET_SUCCESS;
 
-	if (pAggView->elemList)
+	if (pAggView->elemList || pAggView->fieldPages)
 	{
 		RsslUInt32 ui;
 
@@ -731,15 +689,21 @@ RsslRet wlAggregateViewMerge(WlAggregateView *pAggView, RsslBool *pUpdated,
 		{
 			case RDM_VIEW_TYPE_FIELD_ID_LIST:
 			{
-				WlViewField* viewFieldList = (WlViewField*)pAggView->elemList;
-
-				for(ui = 0; ui < pAggView->elemCount; ++ui)
+				for(ui = 0; ui < WL_VIEW_FIELD_PAGE_COUNT && !*pUpdated; ++ui)
 				{
-					if (viewFieldList[ui].count == 0 && viewFieldList[ui].committed
-							|| viewFieldList[ui].count && !viewFieldList[ui].committed)
+					WlViewFieldPage *pPage = pAggView->fieldPages[ui];
+					RsslUInt32 word;
+
+					if (!pPage)
+						continue;
+
+					for(word = 0; word < WL_VIEW_FIELD_PAGE_WORDS; ++word)
 					{
-						*pUpdated = RSSL_TRUE;
-						break;
+						if (pPage->present[word] != pPage->committed[word])
+						{
+							*pUpdated = RSSL_TRUE;
+							break;
+						}
 					}
 				}
 
@@ -789,24 +753,13 @@ void wlAggregateViewUnmerge(WlAggregateView *pAggView)
 RsslUInt32 wlAggregateViewEstimateEncodedLength(WlAggregateView *pAggView)
 {
 	assert(pAggView->newViews.count == 0);
-	assert(pAggView->elemList);
+	assert(pAggView->elemList || pAggView->fieldPages);
 
 	switch(pAggView->viewType)
 	{
 
 		case RDM_VIEW_TYPE_FIELD_ID_LIST:
-			{
-				WlViewField *aggViewFieldList = (WlViewField*)pAggView->elemList;
-				RsslUInt32 encodedLength = 0;
-				RsslUInt32 ui;
-
-				for(ui = 0; ui < pAggView->elemCount; ++ui)
-				{
-					if (aggViewFieldList[ui].count != 0)
-						encodedLength += 3;
-				}
-				return encodedLength;
-			}
+			return pAggView->elemCount * 3;
 
 		case RDM_VIEW_TYPE_ELEMENT_NAME_LIST:
 			{
@@ -856,24 +809,38 @@ RsslRet wlAggregateViewEncodeArray(RsslEncodeIterator *pIter, WlAggregateView *p
 		return ret;
 	}
 
-	assert(pAggView->elemList);
+	assert(pAggView->elemList || pAggView->fieldPages);
 
 	switch(pAggView->viewType)
 	{
 
 		case RDM_VIEW_TYPE_FIELD_ID_LIST:
 			{
-				WlViewField *aggViewFieldList = (WlViewField*)pAggView->elemList;
-
-				/* Encode aggregate view. */
-				for(ui = 0; ui < pAggView->elemCount; ++ui)
+				/* Encode aggregate view. Walking the set bits of each page in order yields the 
+				 * fields in ascending order. */
+				for(ui = 0; ui < WL_VIEW_FIELD_PAGE_COUNT; ++ui)
 				{
-					RsslInt fieldId;
-					if (aggViewFieldList[ui].count == 0)
+					WlViewFieldPage *pPage = pAggView->fieldPages[ui];
+					RsslUInt32 word;
+
+					if (!pPage)
 						continue;
-					fieldId = aggViewFieldList[ui].fieldId;
-					if ((ret = rsslEncodeArrayEntry(pIter, NULL, &fieldId)) != RSSL_RET_SUCCESS)
-						return ret;
+
+					for(word = 0; word < WL_VIEW_FIELD_PAGE_WORDS; ++word)
+					{
+						RsslUInt64 bits = pPage->present[word];
+
+						while (bits)
+						{
+							RsslUInt32 bit = wlaPopCount64((bits & (~bits + 1)) - 1);
+							RsslInt fieldId = (RsslInt)(ui * WL_VIEW_FIELD_PAGE_SIZE + word * 64 + bit) - 32768;
+
+							if ((ret = rsslEncodeArrayEntry(pIter, NULL, &fieldId)) != RSSL_RET_SUCCESS)
+								return ret;
+
+							bits &= bits - 1;
+						}
+					}
 				}
 				break;
 			}
@@ -927,34 +894,38 @@ void wlAggregateViewCommitViews(WlAggregateView *pAggView)
 	{
 		case RDM_VIEW_TYPE_FIELD_ID_LIST:
 		{
-			WlViewField *aggViewFieldList = (WlViewField*)pAggView->elemList;
+			if (!pAggView->fieldPages)
+				break;
 
-			if (pAggView->elemList && pAggView->committedViews.count == 0)
+			if (pAggView->committedViews.count == 0)
 			{
-				/* We can free the overall list. */
-				free(pAggView->elemList);
-				pAggView->elemList = NULL;
+				/* We can free the overall view. */
+				wlaFreeFieldPages(pAggView);
 				break;
 			}
 
-			for(ui = 0; ui < pAggView->elemCount;)
+			/* The sent view is now the committed one. Pages with no fields left are freed. */
+			for(ui = 0; ui < WL_VIEW_FIELD_PAGE_COUNT; ++ui)
 			{
-				if (aggViewFieldList[ui].count == 0)
+				WlViewFieldPage *pPage = pAggView->fieldPages[ui];
+				RsslUInt64 pageBits = 0;
+				RsslUInt32 word;
+
+				if (!pPage)
+					continue;
+
+				for(word = 0; word < WL_VIEW_FIELD_PAGE_WORDS; ++word)
 				{
-					fieldsRemoved = RSSL_TRUE;
-					aggViewFieldList[ui] = aggViewFieldList[pAggView->elemCount - 1];
-					--pAggView->elemCount;
+					pPage->committed[word] = pPage->present[word];
+					pageBits |= pPage->present[word];
 				}
-				else
+
+				if (!pageBits)
 				{
-					aggViewFieldList[ui].committed = RSSL_TRUE;
-					++ui;
+					free(pPage);
+					pAggView->fieldPages[ui] = NULL;
 				}
 			}
-
-			if (fieldsRemoved)
-				qsort(aggViewFieldList, pAggView->elemCount, sizeof(WlViewField), 
-						wlaCompareViewField);
 			break;
 		}
 
@@ -34,8 +34,14 @@ static RsslRet _reactorDispatchFromChannel(RsslReactorImpl *pReactorImpl, RsslRe
 /* Reads and handles an event from the given queue. */
 static RsslRet _reactorDispatchEventFromQueue(RsslReactorImpl *pReactorImpl, RsslReactorEventQueue *pQueue, RsslErrorInfo *pError);
 
+/* Adds the channel's statistics for the current interval to pStatistics, and starts a new interval if requested. */
+static void _reactorAddChannelStatistics(RsslReactorChannelImpl *pReactorChannel, RsslReactorChannelStatistics *pStatistics, RsslBool reset);
+
+/* Copies a watchlist pool's statistics for rsslReactorGetChannelInfo(). */
+static void _reactorSetWatchlistPoolInfo(RsslReactorWatchlistPoolInfo *pPoolInfo, RsslMemoryPoolStats *pPoolStats);
+
 /* Sets whether we are in a callback call */
-static void _reactorSetInCallback(RsslReactorImpl *pReactorImpl, RsslBool inCallback);
+static void _reactorSetInCallback(RsslReactorImpl *pReactorImpl, RsslReactorChannelImpl *pReactorChannel, RsslBool inCallback);
 
 /* Encodes and sends RDM messages. */
 static RsslRet _reactorSendRDMMessage(RsslReactorImpl *pReactorImpl, RsslReactorChannelImpl *pReactorChannel, RsslRDMMsg *pRDMMsg, RsslErrorInfo *pError);
@@ -61,6 +67,47 @@ static RsslRet _reactorSendConnReadyEvent(RsslReactorImpl *pReactorImpl, RsslRea
 /* Stops all channels in the reactor. */
 static void _reactorShutdown(RsslReactorImpl *pReactorImpl, RsslErrorInfo *pError);
 
+/* Adds a channel to the back of the reactor's list of channels that have data to read. */
+static void _reactorAddReadyChannel(RsslReactorImpl *pReactorImpl, RsslReactorChannelImpl *pReactorChannel);
+
+/* Removes a channel from the reactor's list of channels that have data to read. */
+static void _reactorRemoveReadyChannel(RsslReactorImpl *pReactorImpl, RsslReactorChannelImpl *pReactorChannel);
+
+/* Checks active channels that are not ready to read for ping timeouts. */
+static RsslRet _reactorCheckPingTimeouts(RsslReactorImpl *pReactorImpl, RsslErrorInfo *pError);
+
+/* Starts busy-polling a channel that has received data, if it was connected with a busyPollIdleTimeout. */
+static void _reactorStartBusyPoll(RsslReactorImpl *pReactorImpl, RsslReactorChannelImpl *pReactorChannel);
+
+/* Stops busy-polling a channel, so it is read again only when its descriptor is ready. */
+static void _reactorStopBusyPoll(RsslReactorImpl *pReactorImpl, RsslReactorChannelImpl *pReactorChannel);
+
+/* Indicates whether a busy-polling channel should stay on the ready list after a read that found nothing more.
+ * Stops busy-polling the channel if it has been idle for its busyPollIdleTimeout. */
+static RsslBool _reactorContinueBusyPoll(RsslReactorImpl *pReactorImpl, RsslReactorChannelImpl *pReactorChannel);
+
+/* Counts an event or message against the limits of a call to rsslReactorDispatch(). Sets *pMaxMsgs to 0 once the maximum
+ * number of messages or the deadline(if nonzero) is reached. */
+static void _reactorChargeDispatch(RsslReactorImpl *pReactorImpl, RsslUInt32 *pMaxMsgs, RsslUInt32 weight, RsslInt64 deadlineUsec);
+
+/* How often rsslReactorDispatch() checks channels that have not been ready for ping timeouts. */
+static const RsslInt64 pingTimeoutCheckIntervalMs = 100;
+
+/* Writes a buffer to the channel and requests flushing if needed. */
+static RsslRet _reactorWrite(RsslReactorImpl *pReactorImpl, RsslReactorChannelImpl *pReactorChannel, RsslBuffer *pBuffer, RsslReactorSubmitOptions *pSubmitOptions, RsslErrorInfo *pError);
+
+/* Encodes a message into the channel's packed buffer. Returns RSSL_RET_BUFFER_TOO_SMALL if the message is too large to be packed. */
+static RsslRet _reactorPackMsg(RsslReactorImpl *pReactorImpl, RsslReactorChannelImpl *pReactorChannel, RsslMsg *pMsg, RsslErrorInfo *pError);
+
+/* Returns RSSL_TRUE if messages can be packed on the channel's connection type. */
+static RsslBool _reactorChannelSupportsPacking(RsslChannel *pChannel);
+
+/* Submits a message on behalf of rsslReactorSubmitMsg or rsslReactorSubmitMsgBatch. */
+static RsslRet _reactorSubmitMsg(RsslReactorImpl *pReactorImpl, RsslReactorChannelImpl *pReactorChannel, RsslReactorSubmitMsgOptions *pOptions, RsslBool packMsg, RsslErrorInfo *pError);
+
+/* Writes the channel's packed buffer, if it has one. */
+static RsslRet _reactorWritePackedBuffer(RsslReactorImpl *pReactorImpl, RsslReactorChannelImpl *pReactorChannel, RsslErrorInfo *pError);
+
 /* Options for _reactorProcessMsg. */
 typedef struct
 {
@@ -76,6 +123,19 @@ typedef struct
 
 static RsslRet _reactorProcessMsg(RsslReactorImpl *pReactorImpl, RsslReactorChannelImpl *pReactorChannel, ReactorProcessMsgOptions *pOpts);
 
+/* Replaces the reactor's memory buffer for decoding RDM structures with one twice the size. */
+static RsslRet _reactorGrowDecodeMemory(RsslReactorImpl *pReactorImpl, RsslErrorInfo *pError);
+
+/* Decodes the payload of a login, directory or dictionary message to its RDM structure, growing the reactor's memory buffer as needed. */
+static RsslRet _reactorDecodeRDMMsg(RsslReactorImpl *pReactorImpl, RsslReactorChannelImpl *pReactorChannel, RsslMsg *pMsg, RsslRDMMsg *pRdmMsg, RsslErrorInfo *pError);
+
+/* Decodes a message for a domain-specific callback. If the reactor uses lazyRDMDecoding, the message is instead left for the callback
+ * to decode, and *ppRdmMsg is set to NULL. */
+static RsslRet _reactorDecodeRDMMsgForCallback(RsslReactorImpl *pReactorImpl, RsslReactorChannelImpl *pReactorChannel, RsslMsg *pMsg, RsslRDMMsg **ppRdmMsg, RsslErrorInfo *pError);
+
+/* Decodes the message left for the current callback by lazyRDMDecoding. */
+static RsslRDMMsg *_reactorDecodeLazyRDMMsg(RsslReactorChannelImpl *pReactorChannel, RsslUInt8 domainType, RsslErrorInfo *pError);
+
 static RsslRet _reactorSubmitWatchlistMsg(RsslReactorImpl *pReactorImpl, RsslReactorChannelImpl *pReactorChannel, 
 		RsslWatchlistProcessMsgOptions *pOptions, RsslErrorInfo *pError);
 
@@ -141,8 +201,27 @@ static RsslRet _reactorSubmit(RsslReactorImpl *pReactorImpl, RsslReactorChannelI
 
 static void _reactorMoveChannel(RsslQueue *pNewList, RsslReactorChannelImpl *pReactorChannel)
 { 
+	RsslReactorImpl *pReactorImpl = pReactorChannel->pParentReactor;
+
 	if (pReactorChannel->reactorParentQueue)
 	{
+		if (pReactorChannel->reactorParentQueue == &pReactorImpl->activeChannels)
+		{
+			/* Channel is no longer active, so stop watching its descriptor. */
+			rsslNotifierRemoveEvent(&pReactorImpl->notifier, &pReactorChannel->notifierEvent);
+			_reactorRemoveReadyChannel(pReactorImpl, pReactorChannel);
+			_reactorStopBusyPoll(pReactorImpl, pReactorChannel);
+
+			if (pReactorChannel->pPackedBuffer)
+			{
+				/* Drop any messages waiting to be packed. */
+				RsslError rsslError;
+				rsslReleaseBuffer(pReactorChannel->pPackedBuffer, &rsslError);
+				pReactorChannel->pPackedBuffer = NULL;
+				pReactorChannel->packedBufferMsgCount = 0;
+			}
+		}
+
 		rsslQueueRemoveLink(pReactorChannel->reactorParentQueue, &pReactorChannel->reactorQueueLink);
 		rsslInitQueueLink(&pReactorChannel->reactorQueueLink);
 	}
@@ -153,6 +232,55 @@ static void _reactorMoveChannel(RsslQueue *pNewList, RsslReactorChannelImpl *pRe
 		rsslQueueAddLinkToBack(pNewList, &pReactorChannel->reactorQueueLink);
 }
 
+static void _reactorAddReadyChannel(RsslReactorImpl *pReactorImpl, RsslReactorChannelImpl *pReactorChannel)
+{
+	if (pReactorChannel->inReadyChannels)
+		return;
+
+	rsslQueueAddLinkToBack(&pReactorImpl->readyChannels, &pReactorChannel->readyChannelLink);
+	pReactorChannel->inReadyChannels = RSSL_TRUE;
+}
+
+static void _reactorRemoveReadyChannel(RsslReactorImpl *pReactorImpl, RsslReactorChannelImpl *pReactorChannel)
+{
+	if (!pReactorChannel->inReadyChannels)
+		return;
+
+	rsslQueueRemoveLink(&pReactorImpl->readyChannels, &pReactorChannel->readyChannelLink);
+	pReactorChannel->inReadyChannels = RSSL_FALSE;
+}
+
+static void _reactorStartBusyPoll(RsslReactorImpl *pReactorImpl, RsslReactorChannelImpl *pReactorChannel)
+{
+	if (!pReactorChannel->busyPollIdleTimeout || pReactorChannel->busyPolling)
+		return;
+
+	pReactorChannel->busyPolling = RSSL_TRUE;
+	++pReactorImpl->busyPollChannelCount;
+}
+
+static void _reactorStopBusyPoll(RsslReactorImpl *pReactorImpl, RsslReactorChannelImpl *pReactorChannel)
+{
+	if (!pReactorChannel->busyPolling)
+		return;
+
+	pReactorChannel->busyPolling = RSSL_FALSE;
+	--pReactorImpl->busyPollChannelCount;
+}
+
+static RsslBool _reactorContinueBusyPoll(RsslReactorImpl *pReactorImpl, RsslReactorChannelImpl *pReactorChannel)
+{
+	if (!pReactorChannel->busyPolling)
+		return RSSL_FALSE;
+
+	if (pReactorImpl->lastRecordedTimeMs - pReactorChannel->lastDataReadMs < (RsslInt64)pReactorChannel->busyPollIdleTimeout)
+		return RSSL_TRUE;
+
+	/* Idle for too long; go back to waiting for the descriptor. */
+	_reactorStopBusyPoll(pReactorImpl, pReactorChannel);
+	return RSSL_FALSE;
+}
+
 static RsslReactorChannelImpl* _reactorTakeChannel(RsslReactorImpl *pReactorImpl, RsslQueue *pList)
 {
 	RsslQueueLink *pLink = rsslQueueRemoveFirstLink(pList);
@@ -167,6 +295,7 @@ static RsslReactorChannelImpl* _reactorTakeChannel(RsslReactorImpl *pReactorImpl
 
 		rsslClearReactorChannelImpl(pReactorImpl, pReactorChannel);
 		rsslInitQueueLink(&pReactorChannel->reactorQueueLink);
+		/* Not a ring queue; see the channel pool in _reactorCreate(). */
 		rsslInitReactorEventQueue(&pReactorChannel->eventQueue, 5, &pReactorImpl->activeEventQueueGroup);
 	}
 	else
@@ -190,6 +319,8 @@ static RsslRet _reactorSendFlushRequest(RsslReactorImpl *pReactorImpl, RsslReact
 			pReactorChannel->pWatchlist->state &= ~RSSLWL_STF_NEED_FLUSH;
 
 		pReactorChannel->requestedFlush = RSSL_TRUE;
+		if (pReactorImpl->statisticsEnabled)
+			++pReactorChannel->statistics.flushRequestCount;
 		pReactorChannel->writeRet = 0; /* Set writeRet to 0. If it gets set again later we know we've called rsslWrite since the last flush request. */
 
 		rsslInitFlushEvent(&pEvent->flushEvent);
@@ -249,6 +380,11 @@ static RsslRet _reactorSendShutdownEvent(RsslReactorImpl *pReactorImpl, RsslErro
 }
 
 RSSL_VA_API RsslReactor *rsslCreateReactor(RsslCreateReactorOptions *pReactorOpts, RsslErrorInfo *pError)
+{
+	return _reactorCreate(pReactorOpts, NULL, pError);
+}
+
+RsslReactor *_reactorCreate(RsslCreateReactorOptions *pReactorOpts, RsslReactorWorkerThread *pSharedWorkerThread, RsslErrorInfo *pError)
 {
 	RsslReactorImpl *pReactorImpl;
 	RsslInt32 i;
@@ -256,9 +392,6 @@ RSSL_VA_API RsslReactor *rsslCreateReactor(RsslCreateReactorOptions *pReactorOpt
 
 #ifdef WIN32
 	LARGE_INTEGER	perfFrequency;
-#else
-	struct rlimit rlimit;
-	long fdSetSizeRemainder;
 #endif
 
 	
@@ -281,12 +414,15 @@ RSSL_VA_API RsslReactor *rsslCreateReactor(RsslCreateReactorOptions *pReactorOpt
 	/* Copy options */
 	pReactorImpl->dispatchDecodeMemoryBufferSize = pReactorOpts->dispatchDecodeMemoryBufferSize;
 	pReactorImpl->reactor.userSpecPtr = pReactorOpts->userSpecPtr;
+	pReactorImpl->notifierType = (RsslNotifierType)pReactorOpts->notifierType;
+	pReactorImpl->statisticsEnabled = pReactorOpts->enableChannelStatistics;
+	pReactorImpl->lazyRDMDecoding = pReactorOpts->lazyRDMDecoding;
 
 	pReactorImpl->state = RSSL_REACTOR_ST_ACTIVE;
 
 
 	/* Setup reactor */
-	if (rsslInitReactorEventQueue(&pReactorImpl->reactorEventQueue, 10, &pReactorImpl->activeEventQueueGroup) != RSSL_RET_SUCCESS)
+	if (rsslInitReactorEventRingQueue(&pReactorImpl->reactorEventQueue, 128, &pReactorImpl->activeEventQueueGroup) != RSSL_RET_SUCCESS)
 	{
 		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to initialize event queue.");
 		return NULL;
@@ -313,6 +449,7 @@ RSSL_VA_API RsslReactor *rsslCreateReactor(RsslCreateReactorOptions *pReactorOpt
 	rsslInitQueue(&pReactorImpl->inactiveChannels);
 	rsslInitQueue(&pReactorImpl->closingChannels);
 	rsslInitQueue(&pReactorImpl->reconnectingChannels);
+	rsslInitQueue(&pReactorImpl->readyChannels);
 
 
 	RSSL_MUTEX_INIT(&pReactorImpl->interfaceLock);
@@ -331,65 +468,27 @@ RSSL_VA_API RsslReactor *rsslCreateReactor(RsslCreateReactorOptions *pReactorOpt
 		}
 		rsslClearReactorChannelImpl(pReactorImpl, pNewChannel);
 		rsslInitQueueLink(&pNewChannel->reactorQueueLink);
+		/* A channel's event queue cannot be a ring queue, since it has two producers: the worker thread(flush, timer and
+		 * channel events), and the reactor thread itself(channel ready, watchlist and tunnel stream dispatch events). */
 		rsslInitReactorEventQueue(&pNewChannel->eventQueue, 5, &pReactorImpl->activeEventQueueGroup);
 		_reactorMoveChannel(&pReactorImpl->channelPool, pNewChannel);
 	}
 
-	/* Initialize fd sets and sizes. */
-#ifdef WIN32
-	pReactorImpl->fdSetSize = FD_SETSIZE;
-	pReactorImpl->fdSetSizeInBytes = sizeof(fd_set);
-#else
-	getrlimit(RLIMIT_NOFILE, &rlimit);
-	pReactorImpl->fdSetSize = (size_t)rlimit.rlim_cur;
-
-	/* do not allow fdSetSize to be smaller than FD_SETSIZE */
-	if (pReactorImpl->fdSetSize < FD_SETSIZE)
-		pReactorImpl->fdSetSize = FD_SETSIZE;
-
-	/* fdSetSize needs to be a multiple of 8 */
-	fdSetSizeRemainder = pReactorImpl->fdSetSize % 8;
-	if (fdSetSizeRemainder > 0)
-		pReactorImpl->fdSetSize += (8 - fdSetSizeRemainder);
-
-	pReactorImpl->fdSetSizeInBytes = pReactorImpl->fdSetSize / 8;
-#endif
-
-	if ((pReactorImpl->readFds = (fd_set*)malloc(pReactorImpl->fdSetSizeInBytes)) == NULL)
-	{
-		_reactorWorkerCleanupReactor(pReactorImpl);
-		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to allocate memory.");
-		return NULL;
-	}
-
-	if ((pReactorImpl->exceptFds = (fd_set*)malloc(pReactorImpl->fdSetSizeInBytes)) == NULL)
-	{
-		_reactorWorkerCleanupReactor(pReactorImpl);
-		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to allocate memory.");
-		return NULL;
-	}
-
-	if ((pReactorImpl->useReadFds = (fd_set*)malloc(pReactorImpl->fdSetSizeInBytes)) == NULL)
+	/* Initialize notifier and add the reactor's event queue descriptor. */
+	rsslClearNotifierEvent(&pReactorImpl->queueNotifierEvent);
+	if (rsslNotifierInit(&pReactorImpl->notifier, pReactorImpl->notifierType, pError) != RSSL_RET_SUCCESS)
 	{
 		_reactorWorkerCleanupReactor(pReactorImpl);
-		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to allocate memory.");
 		return NULL;
 	}
 
-	if ((pReactorImpl->useExceptFds = (fd_set*)malloc(pReactorImpl->fdSetSizeInBytes)) == NULL)
+	pReactorImpl->reactor.eventFd = rsslGetEventQueueGroupSignalFD(&pReactorImpl->activeEventQueueGroup);
+	if (rsslNotifierAddEvent(&pReactorImpl->notifier, &pReactorImpl->queueNotifierEvent, pReactorImpl->reactor.eventFd, NULL,
+				RSSL_NOTIFIER_READ | RSSL_NOTIFIER_EXCEPT, pError) != RSSL_RET_SUCCESS)
 	{
 		_reactorWorkerCleanupReactor(pReactorImpl);
-		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to allocate memory.");
 		return NULL;
 	}
-	memset(pReactorImpl->readFds, 0, pReactorImpl->fdSetSizeInBytes);
-	memset(pReactorImpl->exceptFds, 0, pReactorImpl->fdSetSizeInBytes);
-	memset(pReactorImpl->useReadFds, 0, pReactorImpl->fdSetSizeInBytes);
-	memset(pReactorImpl->useExceptFds, 0, pReactorImpl->fdSetSizeInBytes);
-
-	pReactorImpl->reactor.eventFd = rsslGetEventQueueGroupSignalFD(&pReactorImpl->activeEventQueueGroup);
-	FD_SET(pReactorImpl->reactor.eventFd, pReactorImpl->readFds);
-	FD_SET(pReactorImpl->reactor.eventFd, pReactorImpl->exceptFds);
 
 	/* Initialize memory block for decoding RDM structures */
 	memBuf = (char*)malloc(pReactorImpl->dispatchDecodeMemoryBufferSize);
@@ -402,7 +501,7 @@ RSSL_VA_API RsslReactor *rsslCreateReactor(RsslCreateReactorOptions *pReactorOpt
 	pReactorImpl->memoryBuffer.data = memBuf;
 	pReactorImpl->memoryBuffer.length = pReactorImpl->dispatchDecodeMemoryBufferSize;
 
-	if (_reactorWorkerStart(pReactorImpl, pReactorOpts, pError) != RSSL_RET_SUCCESS)
+	if (_reactorWorkerStart(pReactorImpl, pReactorOpts, pSharedWorkerThread, pError) != RSSL_RET_SUCCESS)
 	{
 		_reactorWorkerCleanupReactor(pReactorImpl);
 		return NULL;
@@ -444,6 +543,8 @@ static void _reactorShutdown(RsslReactorImpl *pReactorImpl, RsslErrorInfo *pErro
 static RsslRet _reactorCleanupReactor(RsslReactorImpl *pReactorImpl)
 {
 	RsslReactorStateEvent *pEvent;
+	RsslBool ownsWorkerThread = !pReactorImpl->reactorWorker.pWorkerThread->isShared;
+	RsslThreadId workerThread = pReactorImpl->workerThread.thread;
 
 	/* Tell worker thread to cleanup all memory. */
 
@@ -451,7 +552,10 @@ static RsslRet _reactorCleanupReactor(RsslReactorImpl *pReactorImpl)
 	rsslClearReactorEvent(pEvent);
 	pEvent->reactorEventType = RSSL_RCIMPL_STET_DESTROY;
 	rsslReactorEventQueuePut(&pReactorImpl->reactorWorker.workerQueue, (RsslReactorEventImpl*)pEvent);
-	RSSL_THREAD_JOIN(pReactorImpl->reactorWorker.thread);
+
+	/* The reactor may already be freed. A shared worker thread keeps running for the rest of the reactor group, which joins it. */
+	if (ownsWorkerThread)
+		RSSL_THREAD_JOIN(workerThread);
 	return RSSL_RET_SUCCESS;
 }
 
@@ -628,7 +732,7 @@ RSSL_VA_API RsslRet rsslReactorConnect(RsslReactor *pReactor, RsslReactorConnect
 	if ((ret = _validateRole(pRole, pError)) != RSSL_RET_SUCCESS)
 		goto reactorConnectFail;
 
-	if (pReactorImpl->channelCount == FD_SETSIZE - 1)
+	if (pReactorImpl->notifier.type == RSSL_NOTIFIER_SELECT && pReactorImpl->channelCount == FD_SETSIZE - 1)
 	{
 		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Cannot add channel -- file descriptor limit reached.");
 		goto reactorConnectFail;
@@ -669,6 +773,10 @@ RSSL_VA_API RsslRet rsslReactorConnect(RsslReactor *pReactor, RsslReactorConnect
 		watchlistCreateOpts.postAckTimeout = pRole->ommConsumerRole.watchlistOptions.postAckTimeout;
 		watchlistCreateOpts.requestTimeout = pRole->ommConsumerRole.watchlistOptions.requestTimeout;
 		watchlistCreateOpts.ticksPerMsec = pReactorImpl->ticksPerMsec;
+		watchlistCreateOpts.enableFanoutList = pRole->ommConsumerRole.watchlistOptions.enableFanoutList;
+		watchlistCreateOpts.requestRate = pRole->ommConsumerRole.watchlistOptions.requestRate;
+		watchlistCreateOpts.requestBurst = pRole->ommConsumerRole.watchlistOptions.requestBurst;
+		watchlistCreateOpts.requestPacingOrder = (RsslUInt8)pRole->ommConsumerRole.watchlistOptions.requestPacingOrder;
 		pWatchlist = rsslWatchlistCreate(&watchlistCreateOpts, pError);
 		if (!pWatchlist) goto reactorConnectFail;
 	}
@@ -684,6 +792,9 @@ RSSL_VA_API RsslRet rsslReactorConnect(RsslReactor *pReactor, RsslReactorConnect
 	pReactorChannel->channelRole = *pRole;
 	pReactorChannel->initializationTimeout = pOpts->initializationTimeout;
 	pReactorChannel->pWatchlist = pWatchlist;
+	pReactorChannel->packingBufferSize = pOpts->packingBufferSize;
+	pReactorChannel->packingMaxLatency = pOpts->packingMaxLatency;
+	pReactorChannel->busyPollIdleTimeout = pOpts->busyPollIdleTimeout;
 	pReactorChannel->readRet = 0;
 
 	/* Set reconnection info here, this should be zeroed out provider bound connections */
@@ -749,12 +860,18 @@ RSSL_VA_API RsslRet rsslReactorConnect(RsslReactor *pReactor, RsslReactorConnect
 		}
 
 
-		_reactorSetInCallback(pReactorImpl, RSSL_TRUE);
+		/* Restore item requests saved by a previous watchlist. */
+		if (pReactorChannel->channelRole.ommConsumerRole.watchlistOptions.snapshotFile
+				&& rsslWatchlistLoadSnapshot(pWatchlist, pReactorChannel->channelRole.ommConsumerRole.watchlistOptions.snapshotFile, 
+					pError) != RSSL_RET_SUCCESS)
+			goto reactorConnectFail;
+
+		_reactorSetInCallback(pReactorImpl, pReactorChannel, RSSL_TRUE);
 		if (pReactorChannel->channelRole.ommConsumerRole.watchlistOptions.channelOpenCallback)
 			cret = (*pReactorChannel->channelRole.ommConsumerRole.watchlistOptions.channelOpenCallback)((RsslReactor*)pReactorImpl, (RsslReactorChannel*)pReactorChannel, &rsslEvent.channelEventImpl.channelEvent);
 		else
 			cret = RSSL_RC_CRET_SUCCESS;
-		_reactorSetInCallback(pReactorImpl, RSSL_FALSE);
+		_reactorSetInCallback(pReactorImpl, pReactorChannel, RSSL_FALSE);
 
 		if (cret < RSSL_RC_CRET_SUCCESS || pReactorChannel->reactorParentQueue == &pReactorImpl->closingChannels)
 			goto reactorConnectFail;
@@ -841,7 +958,7 @@ RSSL_VA_API RsslRet rsslReactorAccept(RsslReactor *pReactor, RsslServer *pServer
 	if (_validateRole(pRole, pError) != RSSL_RET_SUCCESS)
 		return (reactorUnlockInterface((RsslReactorImpl*)pReactor), RSSL_RET_INVALID_ARGUMENT);
 
-	if (pReactorImpl->channelCount == FD_SETSIZE - 1)
+	if (pReactorImpl->notifier.type == RSSL_NOTIFIER_SELECT && pReactorImpl->channelCount == FD_SETSIZE - 1)
 	{
 		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Cannot add channel -- file descriptor limit reached.");
 		return (reactorUnlockInterface(pReactorImpl), RSSL_RET_FAILURE);
@@ -869,6 +986,9 @@ RSSL_VA_API RsslRet rsslReactorAccept(RsslReactor *pReactor, RsslServer *pServer
 	pReactorChannel->channelRole = *pRole;
 	pReactorChannel->reactorChannel.userSpecPtr = pOpts->rsslAcceptOptions.userSpecPtr;
 	pReactorChannel->initializationTimeout = pOpts->initializationTimeout;
+	pReactorChannel->packingBufferSize = pOpts->packingBufferSize;
+	pReactorChannel->packingMaxLatency = pOpts->packingMaxLatency;
+	pReactorChannel->busyPollIdleTimeout = pOpts->busyPollIdleTimeout;
 
 	if ((pReactorChannel->pTunnelManager = tunnelManagerOpen(pReactor, (RsslReactorChannel*)pReactorChannel, pError)) == NULL)
 		return (reactorUnlockInterface(pReactorImpl), RSSL_RET_FAILURE);
@@ -888,47 +1008,79 @@ RSSL_VA_API RsslRet rsslReactorAccept(RsslReactor *pReactor, RsslServer *pServer
 RSSL_VA_API RsslRet rsslReactorDispatch(RsslReactor *pReactor, RsslReactorDispatchOptions *pDispatchOpts, RsslErrorInfo *pError)
 {
 	RsslReactorImpl *pReactorImpl = (RsslReactorImpl*)pReactor;
-	struct timeval selectTime = {0, 0};
 	RsslRet ret;
-	RsslUInt32  channelsToCheck, channelsWithData;
+	RsslUInt32 i;
+	RsslBool eventQueueReady = RSSL_FALSE;
 	RsslUInt32 maxMsgs = pDispatchOpts->maxMessages;
+	RsslUInt32 eventWeight = pDispatchOpts->eventWeight ? pDispatchOpts->eventWeight : 1;
+	RsslUInt32 readWeight = pDispatchOpts->readWeight ? pDispatchOpts->readWeight : 1;
+	RsslInt64 currentTimeUsec, deadlineUsec = 0;
+	RsslUInt32 idleReads;
 
 	if ((ret = reactorLockInterface(pReactorImpl, RSSL_FALSE, pError)) != RSSL_RET_SUCCESS)
 		return ret;
 
-	/* Record current time. */
-	pReactorImpl->lastRecordedTimeMs = getCurrentTimeMs(pReactorImpl->ticksPerMsec);
+	/* Record current time. Timeouts checked during this call use this value rather than reading the clock again. */
+	currentTimeUsec = getCurrentTimeUsec(pReactorImpl->ticksPerMsec);
+	pReactorImpl->lastRecordedTimeMs = currentTimeUsec / 1000;
+	++pReactorImpl->dispatchSeq;
+
+	if (pDispatchOpts->maxDispatchTimeUsec)
+		deadlineUsec = currentTimeUsec + pDispatchOpts->maxDispatchTimeUsec;
 
-	/* Call select to see which if any channels have something to read. */
-	memcpy(pReactorImpl->useReadFds, pReactorImpl->readFds, pReactorImpl->fdSetSizeInBytes);
-	memcpy(pReactorImpl->useExceptFds, pReactorImpl->exceptFds, pReactorImpl->fdSetSizeInBytes);
-	if ((ret = select(pReactorImpl->fdSetSize, pReactorImpl->useReadFds, NULL, pReactorImpl->useExceptFds, &selectTime)) < 0)
+	if (pReactorImpl->busyPollChannelCount > 0 && pReactorImpl->busyPollChannelCount == rsslQueueGetElementCount(&pReactorImpl->activeChannels))
+	{
+		/* Every active channel is being busy-polled and is already on the ready list, so skip waiting on the notifier.
+		 * Events are found by checking the event queue group directly. */
+		eventQueueReady = (rsslQueueGetElementCount(&pReactorImpl->activeEventQueueGroup.readyEventQueueGroup) > 0);
+	}
+	else
 	{
+		/* Check which if any channels have something to read. */
+		if (rsslNotifierWait(&pReactorImpl->notifier, 0) < 0)
+		{
 #ifdef WIN32
-		int selectErrno = WSAGetLastError();
-		if (selectErrno == WSAEINTR)
-			return (reactorUnlockInterface(pReactorImpl), RSSL_RET_SUCCESS);
+			int selectErrno = WSAGetLastError();
+			if (selectErrno == WSAEINTR)
+				return (reactorUnlockInterface(pReactorImpl), RSSL_RET_SUCCESS);
 #else
-		int selectErrno = errno;
-		if (selectErrno == EINTR)
-			return (reactorUnlockInterface(pReactorImpl), RSSL_RET_SUCCESS);
+			int selectErrno = errno;
+			if (selectErrno == EINTR)
+				return (reactorUnlockInterface(pReactorImpl), RSSL_RET_SUCCESS);
 #endif
-		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "select() failed: %d", selectErrno);
-		_reactorShutdown(pReactorImpl, pError);
-		_reactorSendShutdownEvent(pReactorImpl, pError);
-		return (reactorUnlockInterface(pReactorImpl), RSSL_RET_FAILURE);
+			rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "rsslNotifierWait() failed: %d", selectErrno);
+			_reactorShutdown(pReactorImpl, pError);
+			_reactorSendShutdownEvent(pReactorImpl, pError);
+			return (reactorUnlockInterface(pReactorImpl), RSSL_RET_FAILURE);
+		}
+
+		/* Only channels whose descriptors were triggered are added to the ready list(channels whose last rsslRead() returned
+		 * a positive value are already on it). */
+		for (i = 0; i < pReactorImpl->notifier.notifiedEventCount; ++i)
+		{
+			RsslNotifierEvent *pEvent = pReactorImpl->notifier.notifiedEvents[i];
+
+			if (!pEvent)
+				continue;
+
+			if (pEvent == &pReactorImpl->queueNotifierEvent)
+				eventQueueReady = RSSL_TRUE;
+			else
+				_reactorAddReadyChannel(pReactorImpl, (RsslReactorChannelImpl*)pEvent->object);
+		}
 	}
 
 	if (pReactorImpl->state == RSSL_REACTOR_ST_ACTIVE)
 	{
-		/* No particular channel was specified. Loop in round-robin fashion on all channels until either:
+		/* No particular channel was specified. Loop in round-robin fashion on the ready channels until either:
 		 * - The desired number of messages has been dispatched
 		 * - There is nothing more to read */
 		if (!pDispatchOpts->pReactorChannel)
 		{
 			RsslReactorChannelImpl *pReactorChannel;
+			RsslQueueLink *pLink;
 
-			if ((FD_ISSET(pReactorImpl->reactor.eventFd, pReactorImpl->useReadFds) || FD_ISSET(pReactorImpl->reactor.eventFd, pReactorImpl->useExceptFds) ))
+			if (eventQueueReady)
 			{
 				RsslReactorEventQueue *pQueue;
 
@@ -941,106 +1093,66 @@ RSSL_VA_API RsslRet rsslReactorDispatch(RsslReactor *pReactor, RsslReactorDispat
 						_reactorSendShutdownEvent(pReactorImpl, pError);
 						return (reactorUnlockInterface(pReactorImpl), ret);
 					}
-					if (maxMsgs > 0) --maxMsgs;
+					_reactorChargeDispatch(pReactorImpl, &maxMsgs, eventWeight, deadlineUsec);
 				}
 			}
 
-			channelsWithData = channelsToCheck = rsslQueueGetElementCount(&pReactorImpl->activeChannels);
-
-			while(maxMsgs > 0 && channelsWithData > 0)
+			/* Stop once every channel left on the ready list is a busy-polled channel that was just read without finding anything. */
+			idleReads = 0;
+			while(maxMsgs > 0 && idleReads < rsslQueueGetElementCount(&pReactorImpl->readyChannels)
+					&& (pLink = rsslQueueRemoveFirstLink(&pReactorImpl->readyChannels)))
 			{
-				RsslQueueLink *pLink;
-				RsslBool isFdSet;
-
-				pLink = rsslQueueRemoveFirstLink(&pReactorImpl->activeChannels);
-				rsslQueueAddLinkToBack(&pReactorImpl->activeChannels, pLink);
-
-				pReactorChannel = RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorChannelImpl, reactorQueueLink, pLink);
+				pReactorChannel = RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorChannelImpl, readyChannelLink, pLink);
+				pReactorChannel->inReadyChannels = RSSL_FALSE;
 
-				isFdSet = FD_ISSET(pReactorChannel->reactorChannel.socketId, pReactorImpl->useReadFds) || FD_ISSET(pReactorChannel->reactorChannel.socketId, pReactorImpl->useExceptFds);
+				if ((ret = _reactorDispatchFromChannel(pReactorImpl, pReactorChannel, pError)) < RSSL_RET_SUCCESS)
+				{
+					/* _reactorDispatchFromChannel from channel will disconnect the channel if it needs to. If if fails,
+					 * then it had a problem doing that and there's nothing more we can do to handle it. */
+					_reactorShutdown(pReactorImpl, pError);
+					_reactorSendShutdownEvent(pReactorImpl, pError);
+					return (reactorUnlockInterface(pReactorImpl), ret);
+				}
 
-				/* A channel has something to read if either:
-				 * - The last return from rsslRead() was greater than zero, indicating there were still bytes in RSSL's queue
-				 * - The file descriptor is set because there is data from the socket */
-				if (pReactorChannel->readRet > 0 || isFdSet)
+				/* A channel still has something to read if the last return from rsslRead() was greater than zero,
+				 * indicating there were still bytes in RSSL's queue. Put it behind the other ready channels. */
+				if (pReactorChannel->reactorParentQueue == &pReactorImpl->activeChannels)
 				{
-					if ((ret = _reactorDispatchFromChannel(pReactorImpl, pReactorChannel, pError)) < RSSL_RET_SUCCESS)
-					{
-						/* _reactorDispatchFromChannel from channel will disconnect the channel if it needs to. If if fails,
-						 * then it had a problem doing that and there's nothing more we can do to handle it. */
-						_reactorShutdown(pReactorImpl, pError);
-						_reactorSendShutdownEvent(pReactorImpl, pError);
-						return (reactorUnlockInterface(pReactorImpl), ret);
-					}
-					else if (pReactorChannel->reactorParentQueue != &pReactorImpl->activeChannels)
-					{
-						/* Channel is no longer active */
-						--channelsWithData;
-					}
-					else if (pReactorChannel->readRet <= RSSL_RET_SUCCESS)
+					if (pReactorChannel->readRet > 0)
 					{
-						--channelsWithData;
-						if (isFdSet)
-						{
-							FD_CLR(pReactorChannel->reactorChannel.socketId, pReactorImpl->useReadFds);
-							FD_CLR(pReactorChannel->reactorChannel.socketId, pReactorImpl->useExceptFds);
-						}
+						_reactorAddReadyChannel(pReactorImpl, pReactorChannel);
+						idleReads = 0;
 					}
-					if (channelsToCheck > 0) --channelsToCheck;
-					if (maxMsgs > 0) --maxMsgs;
-				}
-				/* If not triggered to read, check if this channel has passed its ping timeout without sending either a ping or some data. */
-				else 
-				{
-					if ((pReactorImpl->lastRecordedTimeMs - pReactorChannel->lastPingReadMs) > pReactorChannel->reactorChannel.pRsslChannel->pingTimeout * 1000)
+					else if (_reactorContinueBusyPoll(pReactorImpl, pReactorChannel))
 					{
-						rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Channel ping timeout expired.");
-						if (_reactorHandleChannelDown(pReactorImpl, pReactorChannel, pError) != RSSL_RET_SUCCESS)
-						{
-							_reactorShutdown(pReactorImpl, pError);
-							_reactorSendShutdownEvent(pReactorImpl, pError);
-							return (reactorUnlockInterface(pReactorImpl), RSSL_RET_FAILURE);
-						}
+						/* Busy-polled channels stay on the ready list so they are read on the next call without waiting for the notifier. */
+						_reactorAddReadyChannel(pReactorImpl, pReactorChannel);
+						if (pReactorChannel->readWouldBlock)
+							++idleReads;
+						else
+							idleReads = 0;
 					}
-					if (channelsToCheck > 0) --channelsToCheck;
-					--channelsWithData;
 				}
+
+				_reactorChargeDispatch(pReactorImpl, &maxMsgs, readWeight, deadlineUsec);
 			}
 
-			if (channelsToCheck < channelsWithData)
+			if (_reactorCheckPingTimeouts(pReactorImpl, pError) != RSSL_RET_SUCCESS)
 			{
-				/* Some channels had more data to read, so return positive value. */
-				return (reactorUnlockInterface(pReactorImpl), 1);
+				_reactorShutdown(pReactorImpl, pError);
+				_reactorSendShutdownEvent(pReactorImpl, pError);
+				return (reactorUnlockInterface(pReactorImpl), RSSL_RET_FAILURE);
 			}
-			else
-			{
-				/* We may have exhausted maxMessages before all channels were
-				 * checked for data. If any of them still have data
-				 * to read make sure we return a positive value. */
-				while (channelsToCheck > 0)
-				{
-					RsslQueueLink *pLink;
-					pLink = rsslQueueRemoveFirstLink(&pReactorImpl->activeChannels);
-					rsslQueueAddLinkToBack(&pReactorImpl->activeChannels, pLink);
-
-					pReactorChannel = RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorChannelImpl, reactorQueueLink, pLink);
 
-					/* A channel has something to read if either:
-					 * - The last return from rsslRead() was greater than zero, indicating there were still bytes in RSSL's queue
-					 * - The file descriptor is set because there is data from the socket */
-					if (pReactorChannel->readRet > 0 || FD_ISSET(pReactorChannel->reactorChannel.socketId, pReactorImpl->useReadFds) || FD_ISSET(pReactorChannel->reactorChannel.socketId, pReactorImpl->useExceptFds))
-						return (reactorUnlockInterface(pReactorImpl), 1);
-
-					--channelsToCheck;
-				}
-				return (reactorUnlockInterface(pReactorImpl), 0);
-			}
+			/* If any channels still have data to read, return a positive value. */
+			return (reactorUnlockInterface(pReactorImpl), (rsslQueueGetElementCount(&pReactorImpl->readyChannels) > 0) ? 1 : 0);
 		}
 		else
 		{
 			/* Specific channel specified. Dispatch only from that channel. */
 
 			RsslReactorChannelImpl *pReactorChannel = (RsslReactorChannelImpl*)pDispatchOpts->pReactorChannel;
+			RsslUInt32 channelsToCheck;
 
 			/* Since the application passed in this channel, make sure it is valid for this reactor and that it is active. */
 			if (!rsslReactorChannelIsValid(pReactorImpl, pReactorChannel, pError) || pReactorChannel->reactorParentQueue != &pReactorImpl->activeChannels)
@@ -1049,7 +1161,7 @@ RSSL_VA_API RsslRet rsslReactorDispatch(RsslReactor *pReactor, RsslReactorDispat
 				return (reactorUnlockInterface(pReactorImpl), RSSL_RET_INVALID_ARGUMENT);
 			}
 
-			if ((FD_ISSET(pReactorImpl->reactor.eventFd, pReactorImpl->useReadFds) || FD_ISSET(pReactorImpl->reactor.eventFd, pReactorImpl->useExceptFds)))
+			if (eventQueueReady)
 			{
 
 				/* Dispatch from reactor queue */
@@ -1069,7 +1181,7 @@ RSSL_VA_API RsslRet rsslReactorDispatch(RsslReactor *pReactor, RsslReactorDispat
 					else
 					{
 						/* Message was successfully processed. */
-						--maxMsgs;
+						_reactorChargeDispatch(pReactorImpl, &maxMsgs, eventWeight, deadlineUsec);
 						if (ret == RSSL_RET_SUCCESS)
 							break;
 					}
@@ -1092,7 +1204,7 @@ RSSL_VA_API RsslRet rsslReactorDispatch(RsslReactor *pReactor, RsslReactorDispat
 					else
 					{
 						/* Message was successfully processed. */
-						--maxMsgs;
+						_reactorChargeDispatch(pReactorImpl, &maxMsgs, eventWeight, deadlineUsec);
 						if (ret == RSSL_RET_SUCCESS)
 							break;
 					}
@@ -1101,10 +1213,10 @@ RSSL_VA_API RsslRet rsslReactorDispatch(RsslReactor *pReactor, RsslReactorDispat
 			}
 
 			channelsToCheck = 1;
-			/* A channel has something to read if either:
+			/* A channel has something to read if it is on the ready list, either because:
 			 * - The last return from rsslRead() was greater than zero, indicating there were still bytes in RSSL's queue
 			 * - The file descriptor is set because there is data from the socket */
-			if (pReactorChannel->readRet > 0 || FD_ISSET(pDispatchOpts->pReactorChannel->socketId, pReactorImpl->useReadFds) || FD_ISSET(pDispatchOpts->pReactorChannel->socketId, pReactorImpl->useExceptFds))
+			if (pReactorChannel->inReadyChannels)
 			{
 				while (maxMsgs > 0 && channelsToCheck > 0)
 				{
@@ -1118,10 +1230,15 @@ RSSL_VA_API RsslRet rsslReactorDispatch(RsslReactor *pReactor, RsslReactorDispat
 					}
 					else if (pReactorChannel->readRet <= 0)
 					{
+						if (pReactorChannel->reactorParentQueue == &pReactorImpl->activeChannels
+								&& _reactorContinueBusyPoll(pReactorImpl, pReactorChannel))
+							break; /* Leave the channel on the ready list so it is read on the next call. */
+
 						channelsToCheck = 0;
+						_reactorRemoveReadyChannel(pReactorImpl, pReactorChannel);
 						break;
 					}
-					if (maxMsgs > 0) --maxMsgs;
+					_reactorChargeDispatch(pReactorImpl, &maxMsgs, readWeight, deadlineUsec);
 				}
 			}
 			/* If not triggered to read, check if this channel has passed its ping timeout without sending either a ping or some data. */
@@ -1149,12 +1266,48 @@ RSSL_VA_API RsslRet rsslReactorDispatch(RsslReactor *pReactor, RsslReactorDispat
 	}
 }
 
+static void _reactorChargeDispatch(RsslReactorImpl *pReactorImpl, RsslUInt32 *pMaxMsgs, RsslUInt32 weight, RsslInt64 deadlineUsec)
+{
+	*pMaxMsgs = (*pMaxMsgs > weight) ? *pMaxMsgs - weight : 0;
+
+	if (deadlineUsec && *pMaxMsgs > 0 && getCurrentTimeUsec(pReactorImpl->ticksPerMsec) >= deadlineUsec)
+		*pMaxMsgs = 0;
+}
+
+static RsslRet _reactorCheckPingTimeouts(RsslReactorImpl *pReactorImpl, RsslErrorInfo *pError)
+{
+	RsslQueueLink *pLink;
+
+	/* This walks every active channel, so only do it periodically rather than on every dispatch. */
+	if (pReactorImpl->lastRecordedTimeMs < pReactorImpl->nextPingTimeoutCheckMs)
+		return RSSL_RET_SUCCESS;
+
+	pReactorImpl->nextPingTimeoutCheckMs = pReactorImpl->lastRecordedTimeMs + pingTimeoutCheckIntervalMs;
+
+	RSSL_QUEUE_FOR_EACH_LINK(&pReactorImpl->activeChannels, pLink)
+	{
+		RsslReactorChannelImpl *pReactorChannel = RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorChannelImpl, reactorQueueLink, pLink);
+
+		/* Channels with data waiting to be read are not timed out(busy-polled channels are always on the ready list, so they are still checked). */
+		if (pReactorChannel->inReadyChannels && !pReactorChannel->busyPolling)
+			continue;
+
+		if ((pReactorImpl->lastRecordedTimeMs - pReactorChannel->lastPingReadMs) > pReactorChannel->reactorChannel.pRsslChannel->pingTimeout * 1000)
+		{
+			rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Channel ping timeout expired.");
+			if (_reactorHandleChannelDown(pReactorImpl, pReactorChannel, pError) != RSSL_RET_SUCCESS)
+				return RSSL_RET_FAILURE;
+		}
+	}
+
+	return RSSL_RET_SUCCESS;
+}
+
 RSSL_VA_API RsslRet rsslReactorSubmit(RsslReactor *pReactor, RsslReactorChannel *pChannel, RsslBuffer *buffer, RsslReactorSubmitOptions *pSubmitOptions, RsslErrorInfo *pError)
 {
 	RsslRet ret;
 	RsslReactorImpl *pReactorImpl = (RsslReactorImpl*)pReactor;
 	RsslReactorChannelImpl *pReactorChannel = (RsslReactorChannelImpl*)pChannel;
-	RsslUInt32 dummyBytesWritten, dummyUncompBytesWritten;
 
 	if ((ret = reactorLockInterface(pReactorImpl, RSSL_TRUE, pError)) != RSSL_RET_SUCCESS)
 		return ret;
@@ -1172,10 +1325,24 @@ RSSL_VA_API RsslRet rsslReactorSubmit(RsslReactor *pReactor, RsslReactorChannel
 		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, "rsslReactorSubmit may not be used when watchlist is enabled.");
 		return (reactorUnlockInterface((RsslReactorImpl*)pReactor), RSSL_RET_INVALID_ARGUMENT);
 	}
-	
+
+	/* Messages waiting in a packed buffer were submitted first, so write them first. */
+	if (pReactorChannel->pPackedBuffer && (ret = _reactorWritePackedBuffer(pReactorImpl, pReactorChannel, pError)) < RSSL_RET_SUCCESS)
+		return (reactorUnlockInterface(pReactorImpl), ret);
+
+	ret = _reactorWrite(pReactorImpl, pReactorChannel, buffer, pSubmitOptions, pError);
+	return (reactorUnlockInterface((RsslReactorImpl*)pReactor), ret);
+
+}
+
+static RsslRet _reactorWrite(RsslReactorImpl *pReactorImpl, RsslReactorChannelImpl *pReactorChannel, RsslBuffer *pBuffer, RsslReactorSubmitOptions *pSubmitOptions, RsslErrorInfo *pError)
+{
+	RsslRet ret;
+	RsslUInt32 dummyBytesWritten, dummyUncompBytesWritten;
+
 	/* Write message */
 	ret = rsslWrite(pReactorChannel->reactorChannel.pRsslChannel, 
-			buffer, 
+			pBuffer, 
 			pSubmitOptions->priority,
 			pSubmitOptions->writeFlags, 
 			pSubmitOptions->pBytesWritten ? pSubmitOptions->pBytesWritten : &dummyBytesWritten,
@@ -1196,11 +1363,13 @@ RSSL_VA_API RsslRet rsslReactorSubmit(RsslReactor *pReactor, RsslReactorChannel
 				 * We will request flushing to make the buffers available.
 				 * RSSL_RET_WRITE_CALL_AGAIN will still be returned to the application.  It should attempt to call rsslReactorSubmit() again later. */
 				pReactorChannel->writeRet = 1;
+				if (pReactorImpl->statisticsEnabled)
+					++pReactorChannel->statistics.writeCallAgainCount;
 				break;
 			default:
 				/* Failure */
 				rsslSetErrorInfoLocation(pError, __FILE__, __LINE__);
-				return (reactorUnlockInterface(pReactorImpl), ret);
+				return ret;
 		}
 	}
 	else if (ret > 0)
@@ -1210,143 +1379,529 @@ RSSL_VA_API RsslRet rsslReactorSubmit(RsslReactor *pReactor, RsslReactorChannel
 		ret = RSSL_RET_SUCCESS;
 	}
 
-	if (pReactorChannel->writeRet > 0)
+	if (pReactorChannel->writeRet > 0)
+		return _reactorSendFlushRequest(pReactorImpl, pReactorChannel, pError);
+
+	return ret;
+}
+
+static RsslRet _reactorWritePackedBuffer(RsslReactorImpl *pReactorImpl, RsslReactorChannelImpl *pReactorChannel, RsslErrorInfo *pError)
+{
+	RsslBuffer *pBuffer = pReactorChannel->pPackedBuffer;
+	RsslReactorSubmitOptions submitOpts;
+	RsslRet ret;
+
+	if (!pBuffer)
+		return RSSL_RET_SUCCESS;
+
+	pReactorChannel->pPackedBuffer = NULL;
+
+	/* Every message in the buffer has already been packed, so nothing follows the last one. */
+	pBuffer->length = 0;
+
+	/* Packed buffers are no larger than the channel's maxFragmentSize, so they are not fragmented and will not return RSSL_RET_WRITE_CALL_AGAIN. */
+	rsslClearReactorSubmitOptions(&submitOpts);
+	if ((ret = _reactorWrite(pReactorImpl, pReactorChannel, pBuffer, &submitOpts, pError)) < RSSL_RET_SUCCESS)
+	{
+		RsslError rsslError;
+		rsslReleaseBuffer(pBuffer, &rsslError);
+		pReactorChannel->packedBufferMsgCount = 0;
+		return ret;
+	}
+
+	pReactorChannel->packedMsgCount += pReactorChannel->packedBufferMsgCount;
+	++pReactorChannel->packedBufferCount;
+	pReactorChannel->packedBufferMsgCount = 0;
+
+	return RSSL_RET_SUCCESS;
+}
+
+static RsslRet _reactorPackMsg(RsslReactorImpl *pReactorImpl, RsslReactorChannelImpl *pReactorChannel, RsslMsg *pMsg, RsslErrorInfo *pError)
+{
+	RsslChannel *pChannel = pReactorChannel->reactorChannel.pRsslChannel;
+	RsslEncodeIterator encodeIter;
+	RsslRet ret;
+
+	if (!pReactorChannel->packedBufferMaxSize)
+	{
+		/* Packed buffers cannot be fragmented, so limit them to the channel's maxFragmentSize. */
+		RsslChannelInfo channelInfo;
+
+		if ((ret = rsslGetChannelInfo(pChannel, &channelInfo, &pError->rsslError)) != RSSL_RET_SUCCESS)
+		{
+			rsslSetErrorInfoLocation(pError, __FILE__, __LINE__);
+			return ret;
+		}
+
+		pReactorChannel->packedBufferMaxSize = (pReactorChannel->packingBufferSize && pReactorChannel->packingBufferSize < channelInfo.maxFragmentSize) ?
+			pReactorChannel->packingBufferSize : channelInfo.maxFragmentSize;
+	}
+
+	while (1)
+	{
+		if (!pReactorChannel->pPackedBuffer)
+		{
+			RsslInt64 expireTime;
+
+			if (!(pReactorChannel->pPackedBuffer = rsslGetBuffer(pChannel, pReactorChannel->packedBufferMaxSize, RSSL_TRUE, &pError->rsslError)))
+			{
+				rsslSetErrorInfoLocation(pError, __FILE__, __LINE__);
+				return pError->rsslError.rsslErrorId;
+			}
+
+			/* Make sure the buffer is written if no more messages are submitted. If packing is not enabled on the channel,
+			 * this is a batch submission and the buffer is written when the batch completes. */
+			if (pReactorChannel->packingBufferSize)
+			{
+				expireTime = getCurrentTimeMs(pReactorImpl->ticksPerMsec) + pReactorChannel->packingMaxLatency;
+				pReactorChannel->packedBufferExpireTime = expireTime;
+				if ((ret = _reactorSetTimer(pReactorImpl, pReactorChannel, expireTime, pError)) != RSSL_RET_SUCCESS)
+					return ret;
+			}
+		}
+
+		rsslClearEncodeIterator(&encodeIter);
+		rsslSetEncodeIteratorRWFVersion(&encodeIter, pChannel->majorVersion, pChannel->minorVersion);
+		rsslSetEncodeIteratorBuffer(&encodeIter, pReactorChannel->pPackedBuffer);
+
+		if ((ret = rsslEncodeMsg(&encodeIter, pMsg)) == RSSL_RET_SUCCESS)
+			break;
+
+		if (ret != RSSL_RET_BUFFER_TOO_SMALL)
+		{
+			rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, ret, __FILE__, __LINE__, "Message encoding failure.");
+			return ret;
+		}
+
+		if (pReactorChannel->packedBufferMsgCount == 0)
+		{
+			/* Message does not fit even in an empty buffer. */
+			RsslError rsslError;
+			rsslReleaseBuffer(pReactorChannel->pPackedBuffer, &rsslError);
+			pReactorChannel->pPackedBuffer = NULL;
+			return RSSL_RET_BUFFER_TOO_SMALL;
+		}
+
+		/* Not enough room left in this buffer; write it and try again with a new one. */
+		if ((ret = _reactorWritePackedBuffer(pReactorImpl, pReactorChannel, pError)) < RSSL_RET_SUCCESS)
+			return ret;
+	}
+
+	pReactorChannel->pPackedBuffer->length = rsslGetEncodedBufferLength(&encodeIter);
+
+	if (!(pReactorChannel->pPackedBuffer = rsslPackBuffer(pChannel, pReactorChannel->pPackedBuffer, &pError->rsslError)))
+	{
+		rsslSetErrorInfoLocation(pError, __FILE__, __LINE__);
+		pReactorChannel->packedBufferMsgCount = 0;
+		return pError->rsslError.rsslErrorId;
+	}
+
+	++pReactorChannel->packedBufferMsgCount;
+
+	if (pReactorChannel->pPackedBuffer->length == 0)
+		return _reactorWritePackedBuffer(pReactorImpl, pReactorChannel, pError);
+
+	return RSSL_RET_SUCCESS;
+}
+
+static RsslBool _reactorChannelSupportsPacking(RsslChannel *pChannel)
+{
+	if (!pChannel)
+		return RSSL_FALSE;
+
+	switch(pChannel->connectionType)
+	{
+		case RSSL_CONN_TYPE_SOCKET:
+		case RSSL_CONN_TYPE_ENCRYPTED:
+		case RSSL_CONN_TYPE_HTTP:
+			return RSSL_TRUE;
+		default:
+			return RSSL_FALSE;
+	}
+}
+
+static RsslUInt32 _reactorMsgEncodedSize(RsslMsg *pMsg)
+{
+	RsslUInt32 msgSize = 128;
+	const RsslMsgKey *pKey;
+
+	msgSize += pMsg->msgBase.encDataBody.length;
+
+	if ((pKey = rsslGetMsgKey(pMsg)))
+	{
+		if (pKey->flags & RSSL_MKF_HAS_NAME)
+			msgSize += pKey->name.length;
+
+		if (pKey->flags & RSSL_MKF_HAS_ATTRIB)
+			msgSize += pKey->encAttrib.length;
+	}
+	
+	return msgSize;
+}
+
+/* Submits a message on a channel whose validity has already been checked. If packMsg is set, messages are packed
+ * even if packing is not enabled on the channel; the caller is then responsible for writing the packed buffer. */
+static RsslRet _reactorSubmitMsg(RsslReactorImpl *pReactorImpl, RsslReactorChannelImpl *pReactorChannel, RsslReactorSubmitMsgOptions *pOptions, RsslBool packMsg, RsslErrorInfo *pError)
+{
+	RsslRet ret;
+
+	if (pReactorChannel->pWatchlist)
+	{
+		RsslWatchlistProcessMsgOptions processOpts;
+
+		rsslWatchlistClearProcessMsgOptions(&processOpts);
+		processOpts.pChannel = pReactorChannel->reactorChannel.pRsslChannel;
+		processOpts.pRsslMsg = pOptions->pRsslMsg;
+		processOpts.pRdmMsg = pOptions->pRDMMsg;
+		processOpts.pServiceName = pOptions->pServiceName;
+		processOpts.pUserSpec = pOptions->requestMsgOptions.pUserSpec;
+		processOpts.requestRank = pOptions->requestMsgOptions.requestRank;
+		processOpts.majorVersion = pOptions->majorVersion;
+		processOpts.minorVersion = pOptions->minorVersion;
+
+		ret = _reactorSubmitWatchlistMsg(pReactorImpl, pReactorChannel, &processOpts, pError);
+		return ret;
+
+	}
+	else
+	{
+		/* Watchlist is off. Encode the message for the application. */
+
+		RsslUInt32 msgSize;
+
+		if (pReactorChannel->pWriteCallAgainBuffer)
+		{
+			rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_BUFFER_NO_BUFFERS, __FILE__, __LINE__, "Writing of fragmented buffer still in progress.");
+			return RSSL_RET_BUFFER_NO_BUFFERS;
+		}
+
+		if (pOptions->pRsslMsg)
+		{
+			/* User-provided message structure. Encode the message. */
+			RsslBuffer *pWriteBuffer;
+			RsslEncodeIterator encodeIter;
+
+			/* Packing is ignored on connection types that do not support it. */
+			if (packMsg || (pReactorChannel->packingBufferSize && _reactorChannelSupportsPacking(pReactorChannel->reactorChannel.pRsslChannel)))
+			{
+				if ((ret = _reactorPackMsg(pReactorImpl, pReactorChannel, pOptions->pRsslMsg, pError)) != RSSL_RET_BUFFER_TOO_SMALL)
+					return ret;
+
+				/* Message is too large to be packed; write it on its own. */
+			}
+
+			msgSize = _reactorMsgEncodedSize(pOptions->pRsslMsg);
+
+			do
+			{
+
+				if (!(pWriteBuffer = rsslGetBuffer(pReactorChannel->reactorChannel.pRsslChannel, msgSize, RSSL_FALSE, 
+								&pError->rsslError)))
+				{
+					rsslSetErrorInfoLocation(pError, __FILE__, __LINE__);
+					return pError->rsslError.rsslErrorId;
+				}
+
+				rsslClearEncodeIterator(&encodeIter);
+				rsslSetEncodeIteratorRWFVersion(&encodeIter, pReactorChannel->reactorChannel.pRsslChannel->majorVersion,
+						pReactorChannel->reactorChannel.pRsslChannel->minorVersion);
+
+				rsslSetEncodeIteratorBuffer(&encodeIter, pWriteBuffer);
+
+				if ((ret = rsslEncodeMsg(&encodeIter, pOptions->pRsslMsg)) == RSSL_RET_SUCCESS)
+					break;
+
+				rsslReleaseBuffer(pWriteBuffer, &pError->rsslError);
+				switch (ret)
+				{
+					case RSSL_RET_BUFFER_TOO_SMALL:
+						/* Double buffer size and try again. */
+						msgSize *= 2;
+						break;
+					default:
+					{
+						rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, ret, __FILE__, __LINE__, "Message encoding failure.");
+						return ret;
+					}
+				}
+
+			} while (ret != RSSL_RET_SUCCESS);
+
+			pWriteBuffer->length = rsslGetEncodedBufferLength(&encodeIter);
+
+			ret = _reactorSubmit(pReactorImpl, pReactorChannel, 
+					pWriteBuffer, pError);
+			return ret;
+
+		}
+		else if (pOptions->pRDMMsg)
+		{
+			ret = _reactorSendRDMMessage(pReactorImpl, pReactorChannel, pOptions->pRDMMsg, pError);
+			return ret;
+		}
+		else
+		{
+			rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, "No message or buffer provided.");
+			return RSSL_RET_INVALID_ARGUMENT;
+		}
+	}
+}
+
+RSSL_VA_API RsslRet rsslReactorSubmitMsg(RsslReactor *pReactor, RsslReactorChannel *pChannel, RsslReactorSubmitMsgOptions *pOptions, RsslErrorInfo *pError)
+{
+	RsslReactorImpl *pReactorImpl = (RsslReactorImpl*)pReactor;
+	RsslReactorChannelImpl *pReactorChannel = (RsslReactorChannelImpl*)pChannel;
+	RsslRet ret;
+
+
+	if ((ret = reactorLockInterface(pReactorImpl, RSSL_TRUE, pError)) != RSSL_RET_SUCCESS)
+		return ret;
+
+	/* Since the application passed in this channel, make sure it is valid for this reactor and that it is active. */
+	if (!pReactorChannel || !rsslReactorChannelIsValid(pReactorImpl, pReactorChannel, pError))
+		return (reactorUnlockInterface(pReactorImpl), RSSL_RET_INVALID_ARGUMENT);
+
+	if (pReactorImpl->state != RSSL_REACTOR_ST_ACTIVE)
+		return (reactorUnlockInterface((RsslReactorImpl*)pReactor), RSSL_RET_FAILURE);
+
+	ret = _reactorSubmitMsg(pReactorImpl, pReactorChannel, pOptions, RSSL_FALSE, pError);
+	return (reactorUnlockInterface((RsslReactorImpl*)pReactor), ret);
+}
+
+RSSL_VA_API RsslRet rsslReactorSaveWatchlistSnapshot(RsslReactor *pReactor, RsslReactorChannel *pChannel, const char *fileName, RsslErrorInfo *pError)
+{
+	RsslReactorImpl *pReactorImpl = (RsslReactorImpl*)pReactor;
+	RsslReactorChannelImpl *pReactorChannel = (RsslReactorChannelImpl*)pChannel;
+	RsslRet ret;
+
+	if ((ret = reactorLockInterface(pReactorImpl, RSSL_TRUE, pError)) != RSSL_RET_SUCCESS)
+		return ret;
+
+	if (!pReactorChannel || !rsslReactorChannelIsValid(pReactorImpl, pReactorChannel, pError))
+		return (reactorUnlockInterface(pReactorImpl), RSSL_RET_INVALID_ARGUMENT);
+
+	if (!pReactorChannel->pWatchlist)
 	{
-		ret =  _reactorSendFlushRequest(pReactorImpl, pReactorChannel, pError);
-		return (reactorUnlockInterface(pReactorImpl), ret);
+		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, "Channel does not have a watchlist enabled.");
+		return (reactorUnlockInterface(pReactorImpl), RSSL_RET_INVALID_ARGUMENT);
 	}
 
-	return (reactorUnlockInterface((RsslReactorImpl*)pReactor), ret);
-
+	ret = rsslWatchlistSaveSnapshot(pReactorChannel->pWatchlist, fileName, pError);
+	return (reactorUnlockInterface(pReactorImpl), ret);
 }
 
-static RsslUInt32 _reactorMsgEncodedSize(RsslMsg *pMsg)
+RSSL_VA_API RsslRet rsslReactorSubmitMsgBatch(RsslReactor *pReactor, RsslReactorChannel *pChannel, RsslReactorSubmitMsgOptions *pOptionsArray, RsslUInt32 msgCount,
+		RsslRet *pMsgRets, RsslErrorInfo *pError)
 {
-	RsslUInt32 msgSize = 128;
-	const RsslMsgKey *pKey;
+	RsslReactorImpl *pReactorImpl = (RsslReactorImpl*)pReactor;
+	RsslReactorChannelImpl *pReactorChannel = (RsslReactorChannelImpl*)pChannel;
+	RsslRet ret = RSSL_RET_SUCCESS, flushRet;
+	RsslQueue *pEntryQueue;
+	RsslBool packMsg;
+	RsslUInt32 i;
 
-	msgSize += pMsg->msgBase.encDataBody.length;
+	if ((ret = reactorLockInterface(pReactorImpl, RSSL_TRUE, pError)) != RSSL_RET_SUCCESS)
+		return ret;
 
-	if ((pKey = rsslGetMsgKey(pMsg)))
+	/* Since the application passed in this channel, make sure it is valid for this reactor and that it is active. */
+	if (!pReactorChannel || !rsslReactorChannelIsValid(pReactorImpl, pReactorChannel, pError))
+		return (reactorUnlockInterface(pReactorImpl), RSSL_RET_INVALID_ARGUMENT);
+
+	if (pReactorImpl->state != RSSL_REACTOR_ST_ACTIVE)
+		return (reactorUnlockInterface(pReactorImpl), RSSL_RET_FAILURE);
+
+	/* Channels that are not yet(or no longer) active accept messages as they do from rsslReactorSubmitMsg(), e.g. those
+	 * with a watchlist that is initializing or reconnecting. */
+	pEntryQueue = pReactorChannel->reactorParentQueue;
+
+	/* When the watchlist is off, messages are packed back-to-back so that the batch uses as few buffers as possible.
+	 * Other connection types cannot pack, so each message is written in its own buffer. */
+	packMsg = _reactorChannelSupportsPacking(pReactorChannel->reactorChannel.pRsslChannel);
+
+	if (!pOptionsArray && msgCount)
 	{
-		if (pKey->flags & RSSL_MKF_HAS_NAME)
-			msgSize += pKey->name.length;
+		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, "No message options provided.");
+		return (reactorUnlockInterface(pReactorImpl), RSSL_RET_INVALID_ARGUMENT);
+	}
 
-		if (pKey->flags & RSSL_MKF_HAS_ATTRIB)
-			msgSize += pKey->encAttrib.length;
+	for (i = 0; i < msgCount; ++i)
+	{
+		/* Submitting a previous message may have found the channel down. */
+		if (pReactorImpl->state != RSSL_REACTOR_ST_ACTIVE || pReactorChannel->reactorParentQueue != pEntryQueue)
+		{
+			rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Channel went down while submitting the batch.");
+			ret = RSSL_RET_FAILURE;
+			break;
+		}
+
+		ret = _reactorSubmitMsg(pReactorImpl, pReactorChannel, &pOptionsArray[i], packMsg, pError);
+
+		if (pMsgRets)
+			pMsgRets[i] = ret;
+
+		if (ret < RSSL_RET_SUCCESS)
+		{
+			++i;
+			break;
+		}
 	}
-	
-	return msgSize;
+
+	/* Messages after a failure are not submitted, so that messages are never reordered. */
+	if (pMsgRets)
+		for (; i < msgCount; ++i)
+			pMsgRets[i] = RSSL_RET_FAILURE;
+
+	/* If packing is not enabled on the channel, nothing writes the packed buffer later, so write it now. */
+	if (!pReactorChannel->packingBufferSize && pReactorChannel->pPackedBuffer
+			&& (flushRet = _reactorWritePackedBuffer(pReactorImpl, pReactorChannel, pError)) < RSSL_RET_SUCCESS && ret >= RSSL_RET_SUCCESS)
+		ret = flushRet;
+
+	return (reactorUnlockInterface(pReactorImpl), ret < RSSL_RET_SUCCESS ? ret : RSSL_RET_SUCCESS);
 }
 
-RSSL_VA_API RsslRet rsslReactorSubmitMsg(RsslReactor *pReactor, RsslReactorChannel *pChannel, RsslReactorSubmitMsgOptions *pOptions, RsslErrorInfo *pError)
+RSSL_VA_API RsslRet rsslReactorFlushPackedBuffer(RsslReactor *pReactor, RsslReactorChannel *pChannel, RsslErrorInfo *pError)
 {
 	RsslReactorImpl *pReactorImpl = (RsslReactorImpl*)pReactor;
 	RsslReactorChannelImpl *pReactorChannel = (RsslReactorChannelImpl*)pChannel;
 	RsslRet ret;
 
-
 	if ((ret = reactorLockInterface(pReactorImpl, RSSL_TRUE, pError)) != RSSL_RET_SUCCESS)
 		return ret;
 
-	/* Since the application passed in this channel, make sure it is valid for this reactor and that it is active. */
+	/* Since the application passed in this channel, make sure it is valid for this reactor. */
 	if (!pReactorChannel || !rsslReactorChannelIsValid(pReactorImpl, pReactorChannel, pError))
 		return (reactorUnlockInterface(pReactorImpl), RSSL_RET_INVALID_ARGUMENT);
 
 	if (pReactorImpl->state != RSSL_REACTOR_ST_ACTIVE)
-		return (reactorUnlockInterface((RsslReactorImpl*)pReactor), RSSL_RET_FAILURE);
+		return (reactorUnlockInterface(pReactorImpl), RSSL_RET_FAILURE);
 
-	if (pReactorChannel->pWatchlist)
+	ret = _reactorWritePackedBuffer(pReactorImpl, pReactorChannel, pError);
+	return (reactorUnlockInterface(pReactorImpl), ret);
+}
+
+static void _reactorSetWatchlistPoolInfo(RsslReactorWatchlistPoolInfo *pPoolInfo, RsslMemoryPoolStats *pPoolStats)
+{
+	pPoolInfo->blocksInUse = pPoolStats->blocksInUse;
+	pPoolInfo->freeBlocks = pPoolStats->freeBlocks;
+	pPoolInfo->chunkCount = pPoolStats->chunkCount;
+	pPoolInfo->missCount = pPoolStats->missCount;
+}
+
+RSSL_VA_API RsslRet rsslReactorGetChannelInfo(RsslReactorChannel *pReactorChannel, RsslReactorChannelInfo *pInfo, RsslErrorInfo *pError)
+{
+	RsslReactorChannelImpl *pReactorChannelImpl = (RsslReactorChannelImpl*)pReactorChannel;
+	RsslRet ret;
+
+	if ((ret = rsslGetChannelInfo(pReactorChannel->pRsslChannel, &pInfo->rsslChannelInfo, &pError->rsslError)) != RSSL_RET_SUCCESS)
 	{
-		RsslWatchlistProcessMsgOptions processOpts;
+		rsslSetErrorInfoLocation(pError, __FILE__, __LINE__);
+		return ret;
+	}
 
-		rsslWatchlistClearProcessMsgOptions(&processOpts);
-		processOpts.pChannel = pChannel->pRsslChannel;
-		processOpts.pRsslMsg = pOptions->pRsslMsg;
-		processOpts.pRdmMsg = pOptions->pRDMMsg;
-		processOpts.pServiceName = pOptions->pServiceName;
-		processOpts.pUserSpec = pOptions->requestMsgOptions.pUserSpec;
-		processOpts.majorVersion = pOptions->majorVersion;
-		processOpts.minorVersion = pOptions->minorVersion;
+	pInfo->packedMsgCount = pReactorChannelImpl->packedMsgCount;
+	pInfo->packedBufferCount = pReactorChannelImpl->packedBufferCount;
 
-		ret = _reactorSubmitWatchlistMsg(pReactorImpl, pReactorChannel, &processOpts, pError);
-		return (reactorUnlockInterface((RsslReactorImpl*)pReactor), ret);
+	if (pReactorChannelImpl->pWatchlist)
+	{
+		RsslMemoryPoolStats requestPoolStats, streamPoolStats;
 
+		rsslWatchlistGetPoolStats(pReactorChannelImpl->pWatchlist, &requestPoolStats, &streamPoolStats);
+		_reactorSetWatchlistPoolInfo(&pInfo->watchlistRequestPool, &requestPoolStats);
+		_reactorSetWatchlistPoolInfo(&pInfo->watchlistStreamPool, &streamPoolStats);
 	}
 	else
 	{
-		/* Watchlist is off. Encode the message for the application. */
+		memset(&pInfo->watchlistRequestPool, 0, sizeof(RsslReactorWatchlistPoolInfo));
+		memset(&pInfo->watchlistStreamPool, 0, sizeof(RsslReactorWatchlistPoolInfo));
+	}
 
-		RsslUInt32 msgSize;
+	return RSSL_RET_SUCCESS;
+}
 
-		if (pReactorChannel->pWriteCallAgainBuffer)
-		{
-			rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_BUFFER_NO_BUFFERS, __FILE__, __LINE__, "Writing of fragmented buffer still in progress.");
-			return (reactorUnlockInterface((RsslReactorImpl*)pReactor), RSSL_RET_BUFFER_NO_BUFFERS);
-		}
+static void _reactorAddHistogram(RsslReactorLatencyHistogram *pTotal, RsslReactorLatencyHistogram *pCurrent, RsslReactorLatencyHistogram *pBaseline)
+{
+	RsslUInt32 i;
 
-		if (pOptions->pRsslMsg)
-		{
-			/* User-provided message structure. Encode the message. */
-			RsslBuffer *pWriteBuffer;
-			RsslEncodeIterator encodeIter;
+	pTotal->count += pCurrent->count - pBaseline->count;
+	pTotal->totalUsec += pCurrent->totalUsec - pBaseline->totalUsec;
+	for (i = 0; i < RSSL_RC_LATENCY_HISTOGRAM_BUCKETS; ++i)
+		pTotal->buckets[i] += pCurrent->buckets[i] - pBaseline->buckets[i];
+}
 
-			msgSize = _reactorMsgEncodedSize(pOptions->pRsslMsg);
+static void _reactorAddChannelStatistics(RsslReactorChannelImpl *pReactorChannel, RsslReactorChannelStatistics *pStatistics, RsslBool reset)
+{
+	/* Copy the running totals first, since the worker thread may update the flush statistics at any time. */
+	RsslReactorChannelStatistics current = pReactorChannel->statistics;
+	RsslReactorChannelStatistics *pBaseline = &pReactorChannel->statisticsBaseline;
+
+	pStatistics->dispatchCount += current.dispatchCount - pBaseline->dispatchCount;
+	pStatistics->readCount += current.readCount - pBaseline->readCount;
+	pStatistics->msgsRead += current.msgsRead - pBaseline->msgsRead;
+	pStatistics->bytesRead += current.bytesRead - pBaseline->bytesRead;
+	pStatistics->uncompressedBytesRead += current.uncompressedBytesRead - pBaseline->uncompressedBytesRead;
+	pStatistics->eventCount += current.eventCount - pBaseline->eventCount;
+	pStatistics->flushRequestCount += current.flushRequestCount - pBaseline->flushRequestCount;
+	pStatistics->flushCount += current.flushCount - pBaseline->flushCount;
+	pStatistics->writeCallAgainCount += current.writeCallAgainCount - pBaseline->writeCallAgainCount;
+	_reactorAddHistogram(&pStatistics->callbackTime, &current.callbackTime, &pBaseline->callbackTime);
+	_reactorAddHistogram(&pStatistics->flushTime, &current.flushTime, &pBaseline->flushTime);
+
+	if (reset)
+		*pBaseline = current;
+}
 
-			do
-			{
+RSSL_VA_API RsslRet rsslReactorGetChannelStatistics(RsslReactorChannel *pReactorChannel, RsslReactorChannelStatistics *pStatistics, RsslBool reset, RsslErrorInfo *pError)
+{
+	RsslReactorChannelImpl *pReactorChannelImpl = (RsslReactorChannelImpl*)pReactorChannel;
+	RsslReactorImpl *pReactorImpl = pReactorChannelImpl->pParentReactor;
+	RsslRet ret;
 
-				if (!(pWriteBuffer = rsslGetBuffer(pChannel->pRsslChannel, msgSize, RSSL_FALSE, 
-								&pError->rsslError)))
-				{
-					rsslSetErrorInfoLocation(pError, __FILE__, __LINE__);
-					return (reactorUnlockInterface((RsslReactorImpl*)pReactor), pError->rsslError.rsslErrorId);
-				}
+	if ((ret = reactorLockInterface(pReactorImpl, RSSL_TRUE, pError)) != RSSL_RET_SUCCESS)
+		return ret;
 
-				rsslClearEncodeIterator(&encodeIter);
-				rsslSetEncodeIteratorRWFVersion(&encodeIter, pChannel->pRsslChannel->majorVersion,
-						pChannel->pRsslChannel->minorVersion);
+	if (!pReactorImpl->statisticsEnabled)
+	{
+		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, "Reactor was not created with enableChannelStatistics.");
+		return (reactorUnlockInterface(pReactorImpl), RSSL_RET_INVALID_ARGUMENT);
+	}
 
-				rsslSetEncodeIteratorBuffer(&encodeIter, pWriteBuffer);
+	rsslClearReactorChannelStatistics(pStatistics);
+	_reactorAddChannelStatistics(pReactorChannelImpl, pStatistics, reset);
 
-				if ((ret = rsslEncodeMsg(&encodeIter, pOptions->pRsslMsg)) == RSSL_RET_SUCCESS)
-					break;
+	return (reactorUnlockInterface(pReactorImpl), RSSL_RET_SUCCESS);
+}
 
-				rsslReleaseBuffer(pWriteBuffer, &pError->rsslError);
-				switch (ret)
-				{
-					case RSSL_RET_BUFFER_TOO_SMALL:
-						/* Double buffer size and try again. */
-						msgSize *= 2;
-						break;
-					default:
-					{
-						rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, ret, __FILE__, __LINE__, "Message encoding failure.");
-						return (reactorUnlockInterface((RsslReactorImpl*)pReactor), ret);
-					}
-				}
+RSSL_VA_API RsslRet rsslReactorGetStatistics(RsslReactor *pReactor, RsslReactorChannelStatistics *pStatistics, RsslBool reset, RsslErrorInfo *pError)
+{
+	RsslReactorImpl *pReactorImpl = (RsslReactorImpl*)pReactor;
+	RsslQueue *channelQueues[5];
+	RsslQueueLink *pLink;
+	RsslUInt32 i;
+	RsslRet ret;
 
-			} while (ret != RSSL_RET_SUCCESS);
+	if ((ret = reactorLockInterface(pReactorImpl, RSSL_TRUE, pError)) != RSSL_RET_SUCCESS)
+		return ret;
 
-			pWriteBuffer->length = rsslGetEncodedBufferLength(&encodeIter);
+	if (!pReactorImpl->statisticsEnabled)
+	{
+		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, "Reactor was not created with enableChannelStatistics.");
+		return (reactorUnlockInterface(pReactorImpl), RSSL_RET_INVALID_ARGUMENT);
+	}
 
-			ret = _reactorSubmit((RsslReactorImpl*)pReactor, pReactorChannel, 
-					pWriteBuffer, pError);
-			return (reactorUnlockInterface((RsslReactorImpl*)pReactor), ret);
+	channelQueues[0] = &pReactorImpl->initializingChannels;
+	channelQueues[1] = &pReactorImpl->activeChannels;
+	channelQueues[2] = &pReactorImpl->inactiveChannels;
+	channelQueues[3] = &pReactorImpl->closingChannels;
+	channelQueues[4] = &pReactorImpl->reconnectingChannels;
 
-		}
-		else if (pOptions->pRDMMsg)
-		{
-			ret = _reactorSendRDMMessage(pReactorImpl, pReactorChannel, pOptions->pRDMMsg, pError);
-			return (reactorUnlockInterface((RsslReactorImpl*)pReactor), ret);
-		}
-		else
-		{
-			rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, "No message or buffer provided.");
-			return (reactorUnlockInterface((RsslReactorImpl*)pReactor), RSSL_RET_INVALID_ARGUMENT);
-		}
+	rsslClearReactorChannelStatistics(pStatistics);
+	for (i = 0; i < 5; ++i)
+	{
+		RSSL_QUEUE_FOR_EACH_LINK(channelQueues[i], pLink)
+			_reactorAddChannelStatistics(RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorChannelImpl, reactorQueueLink, pLink), pStatistics, reset);
 	}
 
+	return (reactorUnlockInterface(pReactorImpl), RSSL_RET_SUCCESS);
 }
 
 static RsslRet _reactorSendRDMMessage(RsslReactorImpl *pReactorImpl, RsslReactorChannelImpl *pReactorChannel, RsslRDMMsg *pRDMMsg, RsslErrorInfo *pError)
@@ -1444,7 +1999,6 @@ static RsslRet _reactorSendRDMMessage(RsslReactorImpl *pReactorImpl, RsslReactor
 static RsslRet _reactorHandleChannelDown(RsslReactorImpl *pReactorImpl, RsslReactorChannelImpl *pReactorChannel, RsslErrorInfo *pError)
 {
 	RsslReactorChannelEventImpl *pEvent;
-	RsslChannel *pChannel = pReactorChannel->reactorChannel.pRsslChannel;
 	RsslReactorCallbackRet cret;
 
 	if (pReactorChannel->reactorParentQueue == &pReactorImpl->inactiveChannels)
@@ -1452,12 +2006,6 @@ static RsslRet _reactorHandleChannelDown(RsslReactorImpl *pReactorImpl, RsslReac
 
 	pEvent = (RsslReactorChannelEventImpl*)rsslReactorEventQueueGetFromPool(&pReactorImpl->reactorWorker.workerQueue);
 
-	if(pChannel && pChannel->socketId != REACTOR_INVALID_SOCKET)
-	{
-		FD_CLR(pChannel->socketId, pReactorImpl->readFds);
-		FD_CLR(pChannel->socketId, pReactorImpl->exceptFds);
-	}
-
 	if(pReactorChannel->reconnectAttemptLimit != 0 && pReactorChannel->reconnectAttemptCount != pReactorChannel->reconnectAttemptLimit)
 	{
 
@@ -1492,9 +2040,9 @@ static RsslRet _reactorHandleChannelDown(RsslReactorImpl *pReactorImpl, RsslReac
 				return ret;
 	}
 
-	_reactorSetInCallback(pReactorImpl, RSSL_TRUE);
+	_reactorSetInCallback(pReactorImpl, pReactorChannel, RSSL_TRUE);
 	cret = (*pReactorChannel->channelRole.base.channelEventCallback)((RsslReactor*)pReactorImpl, (RsslReactorChannel*)pReactorChannel, &pEvent->channelEvent);
-	_reactorSetInCallback(pReactorImpl, RSSL_FALSE);
+	_reactorSetInCallback(pReactorImpl, pReactorChannel, RSSL_FALSE);
 
 	if (pReactorChannel->pWatchlist)
 	{
@@ -1657,12 +2205,6 @@ RSSL_VA_API RsslRet rsslReactorCloseChannel(RsslReactor *pReactor, RsslReactorCh
 		/* Channel is not currently trying to close.  Start the process of shutting it down. */
 		RsslReactorChannelEventImpl *pEvent = (RsslReactorChannelEventImpl*)rsslReactorEventQueueGetFromPool(&pReactorImpl->reactorWorker.workerQueue);
 
-		if(pChannel && pChannel->socketId != REACTOR_INVALID_SOCKET)
-		{
-			FD_CLR(pChannel->socketId, pReactorImpl->readFds);
-			FD_CLR(pChannel->socketId, pReactorImpl->exceptFds);
-		}
-
 		_reactorMoveChannel(&pReactorImpl->closingChannels, pReactorChannel);
 
 		/* Send request to worker to close this channel */
@@ -1760,6 +2302,9 @@ static RsslRet _reactorDispatchEventFromQueue(RsslReactorImpl *pReactorImpl, Rss
 				RsslReactorFlushEvent *pFlushEvent = (RsslReactorFlushEvent*)pEvent;
 				pReactorChannel = (RsslReactorChannelImpl*)pFlushEvent->pReactorChannel;
 
+				if (pReactorImpl->statisticsEnabled)
+					++pReactorChannel->statistics.eventCount;
+
 				if (pReactorChannel->reactorParentQueue == &pReactorImpl->activeChannels)
 				{
 					switch(pFlushEvent->flushEventType)
@@ -1821,6 +2366,9 @@ static RsslRet _reactorDispatchEventFromQueue(RsslReactorImpl *pReactorImpl, Rss
 				RsslReactorChannelEventImpl *pConnEvent = (RsslReactorChannelEventImpl*)pEvent;
 				pReactorChannel = (RsslReactorChannelImpl*)pConnEvent->channelEvent.pReactorChannel;
 
+				if (pReactorImpl->statisticsEnabled)
+					++pReactorChannel->statistics.eventCount;
+
 				if (pReactorChannel->reactorParentQueue != &pReactorImpl->closingChannels)
 				{
 
@@ -1828,16 +2376,18 @@ static RsslRet _reactorDispatchEventFromQueue(RsslReactorImpl *pReactorImpl, Rss
 					{
 						case RSSL_RC_CET_CHANNEL_UP:
 							/* Channel has been initialized by worker thread and is ready for reading & writing. */
-							FD_SET(pReactorChannel->reactorChannel.pRsslChannel->socketId, pReactorImpl->readFds);
-							FD_SET(pReactorChannel->reactorChannel.pRsslChannel->socketId, pReactorImpl->exceptFds);
-
 							_reactorMoveChannel(&pReactorImpl->activeChannels, pReactorChannel);
+
+							if (rsslNotifierAddEvent(&pReactorImpl->notifier, &pReactorChannel->notifierEvent, pReactorChannel->reactorChannel.pRsslChannel->socketId,
+										pReactorChannel, RSSL_NOTIFIER_READ | RSSL_NOTIFIER_EXCEPT, pError) != RSSL_RET_SUCCESS)
+								return RSSL_RET_FAILURE;
+
 							pReactorChannel->lastPingReadMs = pReactorImpl->lastRecordedTimeMs;
 
 							/* Notify application */
-							_reactorSetInCallback(pReactorImpl, RSSL_TRUE);
+							_reactorSetInCallback(pReactorImpl, pReactorChannel, RSSL_TRUE);
 							cret = (*pReactorChannel->channelRole.base.channelEventCallback)((RsslReactor*)pReactorImpl, (RsslReactorChannel*)pReactorChannel, &pConnEvent->channelEvent);
-							_reactorSetInCallback(pReactorImpl, RSSL_FALSE);
+							_reactorSetInCallback(pReactorImpl, pReactorChannel, RSSL_FALSE);
 
 							if (cret == RSSL_RC_CRET_SUCCESS && pReactorChannel->reactorParentQueue != &pReactorImpl->closingChannels)
 							{
@@ -1898,9 +2448,9 @@ static RsslRet _reactorDispatchEventFromQueue(RsslReactorImpl *pReactorImpl, Rss
 
 							break;
 						case RSSL_RC_CET_CHANNEL_READY:
-							_reactorSetInCallback(pReactorImpl, RSSL_TRUE);
+							_reactorSetInCallback(pReactorImpl, pReactorChannel, RSSL_TRUE);
 							cret = (*pReactorChannel->channelRole.base.channelEventCallback)((RsslReactor*)pReactorImpl, (RsslReactorChannel*)pReactorChannel, &pConnEvent->channelEvent);
-							_reactorSetInCallback(pReactorImpl, RSSL_FALSE);
+							_reactorSetInCallback(pReactorImpl, pReactorChannel, RSSL_FALSE);
 							break;
 
 						case RSSL_RC_CET_CHANNEL_DOWN:
@@ -1985,6 +2535,9 @@ static RsslRet _reactorDispatchEventFromQueue(RsslReactorImpl *pReactorImpl, Rss
 				pReactorChannel = (RsslReactorChannelImpl*)pEvent->timerEvent.pReactorChannel;
 				pReactorChannel->lastRequestedExpireTime = RCIMPL_TIMER_UNSET;
 
+				if (pReactorImpl->statisticsEnabled)
+					++pReactorChannel->statistics.eventCount;
+
 				if (pReactorChannel->pWatchlist)
 				{
 					if ((ret = rsslWatchlistProcessTimer(pReactorChannel->pWatchlist, pEvent->timerEvent.expireTime, pError))
@@ -1998,6 +2551,18 @@ static RsslRet _reactorDispatchEventFromQueue(RsslReactorImpl *pReactorImpl, Rss
 					if (_reactorHandleTunnelManagerRet(pReactorImpl, pReactorChannel, ret, pError) != RSSL_RET_SUCCESS)
 						return ret;
 				}
+
+				if (pReactorChannel->pPackedBuffer)
+				{
+					/* Write the packed buffer if it has been held long enough. Otherwise the timer may have been for something else, so reset it. */
+					if (pReactorChannel->packedBufferExpireTime <= getCurrentTimeMs(pReactorImpl->ticksPerMsec))
+					{
+						if (_reactorWritePackedBuffer(pReactorImpl, pReactorChannel, pError) < RSSL_RET_SUCCESS)
+							return (_reactorHandleChannelDown(pReactorImpl, pReactorChannel, pError));
+					}
+					else if (_reactorSetTimer(pReactorImpl, pReactorChannel, pReactorChannel->packedBufferExpireTime, pError) != RSSL_RET_SUCCESS)
+						return RSSL_RET_FAILURE;
+				}
 				break;
 			}
 			default:
@@ -2076,6 +2641,123 @@ static RsslRet _reactorEncodeRDMAsRsslMsg(RsslReactorImpl *pReactorImpl, RsslRea
 	return RSSL_RET_SUCCESS;
 }
 
+static RsslRet _reactorGrowDecodeMemory(RsslReactorImpl *pReactorImpl, RsslErrorInfo *pError)
+{
+	RsslUInt32 newLength = pReactorImpl->memoryBuffer.length * 2;
+	char *newData;
+
+	if (newLength > RSSL_REACTOR_MAX_DECODE_MEMORY_SIZE || !(newData = (char*)malloc(newLength)))
+	{
+		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_BUFFER_TOO_SMALL, __FILE__, __LINE__, "Failed to expand reactor memory buffer for decoding to %u bytes.", newLength);
+		return RSSL_RET_BUFFER_TOO_SMALL;
+	}
+
+	/* The buffer only holds the structures decoded for the current callback, so its contents need not be kept. */
+	free(pReactorImpl->memoryBuffer.data);
+	pReactorImpl->memoryBuffer.data = newData;
+	pReactorImpl->memoryBuffer.length = newLength;
+	return RSSL_RET_SUCCESS;
+}
+
+static RsslRet _reactorDecodeRDMMsg(RsslReactorImpl *pReactorImpl, RsslReactorChannelImpl *pReactorChannel, RsslMsg *pMsg, RsslRDMMsg *pRdmMsg, RsslErrorInfo *pError)
+{
+	RsslDecodeIterator dIter;
+	RsslBuffer memoryBuffer;
+	RsslRet ret;
+
+	do
+	{
+		memoryBuffer = pReactorImpl->memoryBuffer;
+		rsslClearDecodeIterator(&dIter);
+		rsslSetDecodeIteratorRWFVersion(&dIter, pReactorChannel->reactorChannel.majorVersion, pReactorChannel->reactorChannel.minorVersion);
+		rsslSetDecodeIteratorBuffer(&dIter, &pMsg->msgBase.encDataBody);
+
+		switch(pMsg->msgBase.domainType)
+		{
+			case RSSL_DMT_LOGIN:
+				rsslClearRDMLoginMsg(&pRdmMsg->loginMsg);
+				ret = rsslDecodeRDMLoginMsg(&dIter, pMsg, &pRdmMsg->loginMsg, &memoryBuffer, pError);
+				break;
+			case RSSL_DMT_SOURCE:
+				rsslClearRDMDirectoryMsg(&pRdmMsg->directoryMsg);
+				ret = rsslDecodeRDMDirectoryMsg(&dIter, pMsg, &pRdmMsg->directoryMsg, &memoryBuffer, pError);
+				break;
+			case RSSL_DMT_DICTIONARY:
+				rsslClearRDMDictionaryMsg(&pRdmMsg->dictionaryMsg);
+				ret = rsslDecodeRDMDictionaryMsg(&dIter, pMsg, &pRdmMsg->dictionaryMsg, &memoryBuffer, pError);
+				break;
+			default:
+				rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, "Unexpected domain type %u for RDM decoding.", pMsg->msgBase.domainType);
+				return RSSL_RET_INVALID_ARGUMENT;
+		}
+
+		/* Large directories and dictionaries may not fit. Retry with a larger buffer, which is then kept for later messages. */
+	} while (ret == RSSL_RET_BUFFER_TOO_SMALL && _reactorGrowDecodeMemory(pReactorImpl, pError) == RSSL_RET_SUCCESS);
+
+	return ret;
+}
+
+static RsslRet _reactorDecodeRDMMsgForCallback(RsslReactorImpl *pReactorImpl, RsslReactorChannelImpl *pReactorChannel, RsslMsg *pMsg, RsslRDMMsg **ppRdmMsg, RsslErrorInfo *pError)
+{
+	RsslRet ret;
+
+	if (pReactorImpl->lazyRDMDecoding)
+	{
+		/* Cleared when the callback returns. */
+		pReactorChannel->pLazyRDMMsg = pMsg;
+		*ppRdmMsg = NULL;
+		return RSSL_RET_SUCCESS;
+	}
+
+	ret = _reactorDecodeRDMMsg(pReactorImpl, pReactorChannel, pMsg, &pReactorChannel->rdmMsg, pError);
+	*ppRdmMsg = (ret == RSSL_RET_SUCCESS) ? &pReactorChannel->rdmMsg : NULL;
+	return ret;
+}
+
+static RsslRDMMsg *_reactorDecodeLazyRDMMsg(RsslReactorChannelImpl *pReactorChannel, RsslUInt8 domainType, RsslErrorInfo *pError)
+{
+	RsslReactorImpl *pReactorImpl = pReactorChannel->pParentReactor;
+	RsslRDMMsg *pRdmMsg = NULL;
+
+	if (reactorLockInterface(pReactorImpl, RSSL_TRUE, pError) != RSSL_RET_SUCCESS)
+		return NULL;
+
+	if (!pReactorChannel->pLazyRDMMsg || pReactorChannel->pLazyRDMMsg->msgBase.domainType != domainType)
+		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, "No message of this domain is waiting to be decoded. Messages can only be decoded from the callback that received them.");
+	else if (_reactorDecodeRDMMsg(pReactorImpl, pReactorChannel, pReactorChannel->pLazyRDMMsg, &pReactorChannel->rdmMsg, pError) == RSSL_RET_SUCCESS)
+	{
+		pRdmMsg = &pReactorChannel->rdmMsg;
+		pReactorChannel->pLazyRDMMsg = NULL;
+	}
+
+	reactorUnlockInterface(pReactorImpl);
+	return pRdmMsg;
+}
+
+RSSL_VA_API RsslRDMLoginMsg *rsslReactorGetRDMLoginMsg(RsslReactorChannel *pReactorChannel, RsslRDMLoginMsgEvent *pEvent, RsslErrorInfo *pError)
+{
+	if (!pEvent->pRDMLoginMsg)
+		pEvent->pRDMLoginMsg = (RsslRDMLoginMsg*)_reactorDecodeLazyRDMMsg((RsslReactorChannelImpl*)pReactorChannel, RSSL_DMT_LOGIN, pError);
+
+	return pEvent->pRDMLoginMsg;
+}
+
+RSSL_VA_API RsslRDMDirectoryMsg *rsslReactorGetRDMDirectoryMsg(RsslReactorChannel *pReactorChannel, RsslRDMDirectoryMsgEvent *pEvent, RsslErrorInfo *pError)
+{
+	if (!pEvent->pRDMDirectoryMsg)
+		pEvent->pRDMDirectoryMsg = (RsslRDMDirectoryMsg*)_reactorDecodeLazyRDMMsg((RsslReactorChannelImpl*)pReactorChannel, RSSL_DMT_SOURCE, pError);
+
+	return pEvent->pRDMDirectoryMsg;
+}
+
+RSSL_VA_API RsslRDMDictionaryMsg *rsslReactorGetRDMDictionaryMsg(RsslReactorChannel *pReactorChannel, RsslRDMDictionaryMsgEvent *pEvent, RsslErrorInfo *pError)
+{
+	if (!pEvent->pRDMDictionaryMsg)
+		pEvent->pRDMDictionaryMsg = (RsslRDMDictionaryMsg*)_reactorDecodeLazyRDMMsg((RsslReactorChannelImpl*)pReactorChannel, RSSL_DMT_DICTIONARY, pError);
+
+	return pEvent->pRDMDictionaryMsg;
+}
+
 /* Calls the defaultMsgCallback. */
 static void _reactorCallDefaultCallback(RsslReactorImpl *pReactorImpl, RsslReactorChannelImpl *pReactorChannel, ReactorProcessMsgOptions *pOpts)
 {
@@ -2087,9 +2769,9 @@ static void _reactorCallDefaultCallback(RsslReactorImpl *pReactorImpl, RsslReact
 	msgEvent.pFTGroupId = pOpts->pFTGroupId;
 	msgEvent.pSeqNum = pOpts->pSeqNum;
 
-	_reactorSetInCallback(pReactorImpl, RSSL_TRUE);
+	_reactorSetInCallback(pReactorImpl, pReactorChannel, RSSL_TRUE);
 	*pOpts->pCret = (*pReactorChannel->channelRole.base.defaultMsgCallback)((RsslReactor*)pReactorImpl, (RsslReactorChannel*)pReactorChannel, &msgEvent);
-	_reactorSetInCallback(pReactorImpl, RSSL_FALSE);
+	_reactorSetInCallback(pReactorImpl, pReactorChannel, RSSL_FALSE);
 }
 
 /* Raises an RDM message from a domain-specific callback to a defaultMsgCallback.
@@ -2132,7 +2814,7 @@ static RsslRet _reactorProcessMsg(RsslReactorImpl *pReactorImpl, RsslReactorChan
 	RsslErrorInfo			*pError = pOpts->pError;
 	RsslStreamInfo			*pStreamInfo = pOpts->pStreamInfo;
 	RsslReactorCallbackRet	*pCret = pOpts->pCret;
-	RsslDecodeIterator		dIter;
+	RsslRDMMsg				*pDecodedMsg;
 
 	/* check for RsslTunnelStream message */
 	if (pReactorChannel->pTunnelManager && pMsg)
@@ -2164,20 +2846,15 @@ static RsslRet _reactorProcessMsg(RsslReactorImpl *pReactorImpl, RsslReactorChan
 
 					if (pConsumerRole->loginMsgCallback)
 					{
-						RsslBuffer memoryBuffer = pReactorImpl->memoryBuffer;
-						RsslRDMLoginMsg loginResponse, *pLoginResponse;
+						RsslRDMLoginMsg *pLoginResponse;
 						RsslRDMLoginMsgEvent loginEvent;
 
 						if (!pRdmMsg)
 						{
-							rsslClearRDMLoginMsg(&loginResponse);
 							rsslClearRDMLoginMsgEvent(&loginEvent);
 
-							rsslClearDecodeIterator(&dIter);
-							rsslSetDecodeIteratorRWFVersion(&dIter, pReactorChannel->reactorChannel.majorVersion, pReactorChannel->reactorChannel.minorVersion);
-							rsslSetDecodeIteratorBuffer(&dIter, &pMsg->msgBase.encDataBody);
-							ret = rsslDecodeRDMLoginMsg(&dIter, pMsg, &loginResponse, &memoryBuffer, pError);
-							pLoginResponse = &loginResponse;
+							ret = _reactorDecodeRDMMsgForCallback(pReactorImpl, pReactorChannel, pMsg, &pDecodedMsg, pError);
+							pLoginResponse = (RsslRDMLoginMsg*)pDecodedMsg;
 						}
 						else
 						{
@@ -2194,9 +2871,9 @@ static RsslRet _reactorProcessMsg(RsslReactorImpl *pReactorImpl, RsslReactorChan
 						if (ret == RSSL_RET_SUCCESS) loginEvent.pRDMLoginMsg = pLoginResponse;
 						else loginEvent.baseMsgEvent.pErrorInfo = pError;
 
-						_reactorSetInCallback(pReactorImpl, RSSL_TRUE);
+						_reactorSetInCallback(pReactorImpl, pReactorChannel, RSSL_TRUE);
 						*pCret = (*pConsumerRole->loginMsgCallback)((RsslReactor*)pReactorImpl, (RsslReactorChannel*)pReactorChannel, &loginEvent);
-						_reactorSetInCallback(pReactorImpl, RSSL_FALSE);
+						_reactorSetInCallback(pReactorImpl, pReactorChannel, RSSL_FALSE);
 					} 
 					else
 					{
@@ -2284,20 +2961,23 @@ static RsslRet _reactorProcessMsg(RsslReactorImpl *pReactorImpl, RsslReactorChan
 				case RSSL_DMT_SOURCE:
 				{
 					RsslReactorOMMConsumerRole *pConsumerRole = &pReactorChannel->channelRole.ommConsumerRole;
-					RsslRDMDirectoryMsg directoryResponse, *pDirectoryResponse;
+					RsslRDMDirectoryMsg *pDirectoryResponse = NULL;
 
 					if (pConsumerRole->directoryMsgCallback || pReactorChannel->channelSetupState == RSSL_RC_CHST_LOGGED_IN && pConsumerRole->dictionaryDownloadMode == RSSL_RC_DICTIONARY_DOWNLOAD_FIRST_AVAILABLE)
 					{
 						if (!pRdmMsg)
 						{
-							RsslBuffer memoryBuffer = pReactorImpl->memoryBuffer;
-							rsslClearRDMDirectoryMsg(&directoryResponse);
-
-							rsslClearDecodeIterator(&dIter);
-							rsslSetDecodeIteratorRWFVersion(&dIter, pReactorChannel->reactorChannel.majorVersion, pReactorChannel->reactorChannel.minorVersion);
-							rsslSetDecodeIteratorBuffer(&dIter, &pMsg->msgBase.encDataBody);
-							ret = rsslDecodeRDMDirectoryMsg(&dIter, pMsg, &directoryResponse, &memoryBuffer, pError);
-							pDirectoryResponse = &directoryResponse;
+							if (pReactorChannel->channelSetupState == RSSL_RC_CHST_LOGGED_IN && pConsumerRole->dictionaryDownloadMode == RSSL_RC_DICTIONARY_DOWNLOAD_FIRST_AVAILABLE)
+							{
+								/* The reactor needs the service list to request dictionaries, so always decode it. */
+								ret = _reactorDecodeRDMMsg(pReactorImpl, pReactorChannel, pMsg, &pReactorChannel->rdmMsg, pError);
+								pDirectoryResponse = &pReactorChannel->rdmMsg.directoryMsg;
+							}
+							else
+							{
+								ret = _reactorDecodeRDMMsgForCallback(pReactorImpl, pReactorChannel, pMsg, &pDecodedMsg, pError);
+								pDirectoryResponse = (RsslRDMDirectoryMsg*)pDecodedMsg;
+							}
 						}
 						else
 						{
@@ -2321,9 +3001,9 @@ static RsslRet _reactorProcessMsg(RsslReactorImpl *pReactorImpl, RsslReactorChan
 						if (ret == RSSL_RET_SUCCESS) directoryEvent.pRDMDirectoryMsg = pDirectoryResponse;
 						else directoryEvent.baseMsgEvent.pErrorInfo = pError;
 
-						_reactorSetInCallback(pReactorImpl, RSSL_TRUE);
+						_reactorSetInCallback(pReactorImpl, pReactorChannel, RSSL_TRUE);
 						*pCret = (*pConsumerRole->directoryMsgCallback)((RsslReactor*)pReactorImpl, (RsslReactorChannel*)pReactorChannel, &directoryEvent);
-						_reactorSetInCallback(pReactorImpl, RSSL_FALSE);
+						_reactorSetInCallback(pReactorImpl, pReactorChannel, RSSL_FALSE);
 					}
 					else
 					{
@@ -2352,21 +3032,21 @@ static RsslRet _reactorProcessMsg(RsslReactorImpl *pReactorImpl, RsslReactorChan
 							RsslUInt32 serviceCount;
 							RsslRDMDirectoryRequest *pRequest = pReactorChannel->channelRole.ommConsumerRole.pDirectoryRequest;
 
-							switch(directoryResponse.rdmMsgBase.rdmMsgType)
+							switch(pDirectoryResponse->rdmMsgBase.rdmMsgType)
 							{
 								case RDM_DR_MT_REFRESH:
-									pServiceList = directoryResponse.refresh.serviceList; 
-									serviceCount = directoryResponse.refresh.serviceCount; 
-									pState = &directoryResponse.refresh.state;
+									pServiceList = pDirectoryResponse->refresh.serviceList; 
+									serviceCount = pDirectoryResponse->refresh.serviceCount; 
+									pState = &pDirectoryResponse->refresh.state;
 									break;
 								case RDM_DR_MT_UPDATE: 
-									pServiceList = directoryResponse.update.serviceList; 
-									serviceCount = directoryResponse.update.serviceCount; 
+									pServiceList = pDirectoryResponse->update.serviceList; 
+									serviceCount = pDirectoryResponse->update.serviceCount; 
 									pState = NULL; 
 									break;
 								case RDM_DR_MT_STATUS: 
 									pServiceList = NULL; 
-									pState = (directoryResponse.status.flags & RDM_DR_STF_HAS_STATE) ? &directoryResponse.status.state : NULL;
+									pState = (pDirectoryResponse->status.flags & RDM_DR_STF_HAS_STATE) ? &pDirectoryResponse->status.state : NULL;
 									break;
 								default: 
 									pServiceList = NULL;
@@ -2378,7 +3058,7 @@ static RsslRet _reactorProcessMsg(RsslReactorImpl *pReactorImpl, RsslReactorChan
 							}
 
 							if (ret == RSSL_RC_CRET_SUCCESS
-									&& pRequest && directoryResponse.rdmMsgBase.streamId == pRequest->rdmMsgBase.streamId /* Matches request */
+									&& pRequest && pDirectoryResponse->rdmMsgBase.streamId == pRequest->rdmMsgBase.streamId /* Matches request */
 									&& pServiceList /* Has serviceList */) 
 							{
 								RsslUInt32 i;
@@ -2484,16 +3164,10 @@ static RsslRet _reactorProcessMsg(RsslReactorImpl *pReactorImpl, RsslReactorChan
 
 					if (pConsumerRole->dictionaryMsgCallback)
 					{
-						RsslBuffer memoryBuffer = pReactorImpl->memoryBuffer;
-						RsslRDMDictionaryMsg dictionaryResponse;
 						RsslRDMDictionaryMsgEvent dictionaryEvent;
-						rsslClearRDMDictionaryMsg(&dictionaryResponse);
 						rsslClearRDMDictionaryMsgEvent(&dictionaryEvent);
 
-						rsslClearDecodeIterator(&dIter);
-						rsslSetDecodeIteratorRWFVersion(&dIter, pReactorChannel->reactorChannel.majorVersion, pReactorChannel->reactorChannel.minorVersion);
-						rsslSetDecodeIteratorBuffer(&dIter, &pMsg->msgBase.encDataBody);
-						ret = rsslDecodeRDMDictionaryMsg(&dIter, pMsg, &dictionaryResponse, &memoryBuffer, pError);
+						ret = _reactorDecodeRDMMsgForCallback(pReactorImpl, pReactorChannel, pMsg, &pDecodedMsg, pError);
 
 						/* Avoid passing these when the watchlist is enabled; the message may be modified from what was sent by the provider. */
 						if (!pConsumerRole->watchlistOptions.enableWatchlist)
@@ -2505,12 +3179,12 @@ static RsslRet _reactorProcessMsg(RsslReactorImpl *pReactorImpl, RsslReactorChan
 						dictionaryEvent.baseMsgEvent.pStreamInfo = (RsslStreamInfo*)pStreamInfo;
 						dictionaryEvent.baseMsgEvent.pFTGroupId = pOpts->pFTGroupId;
 						dictionaryEvent.baseMsgEvent.pSeqNum = pOpts->pSeqNum;
-						if (ret == RSSL_RET_SUCCESS) dictionaryEvent.pRDMDictionaryMsg = &dictionaryResponse;
+						if (ret == RSSL_RET_SUCCESS) dictionaryEvent.pRDMDictionaryMsg = (RsslRDMDictionaryMsg*)pDecodedMsg;
 						else dictionaryEvent.baseMsgEvent.pErrorInfo = pError;
 
-						_reactorSetInCallback(pReactorImpl, RSSL_TRUE);
+						_reactorSetInCallback(pReactorImpl, pReactorChannel, RSSL_TRUE);
 						*pCret = (*pConsumerRole->dictionaryMsgCallback)((RsslReactor*)pReactorImpl, (RsslReactorChannel*)pReactorChannel, &dictionaryEvent);
-						_reactorSetInCallback(pReactorImpl, RSSL_FALSE);
+						_reactorSetInCallback(pReactorImpl, pReactorChannel, RSSL_FALSE);
 					}
 					else
 					{
@@ -2594,26 +3268,20 @@ static RsslRet _reactorProcessMsg(RsslReactorImpl *pReactorImpl, RsslReactorChan
 
 					if (pNIProviderRole->loginMsgCallback)
 					{
-						RsslBuffer memoryBuffer = pReactorImpl->memoryBuffer;
-						RsslRDMLoginMsg loginResponse;
 						RsslRDMLoginMsgEvent loginEvent;
 
-						rsslClearRDMLoginMsg(&loginResponse);
 						rsslClearRDMLoginMsgEvent(&loginEvent);
 
-						rsslClearDecodeIterator(&dIter);
-						rsslSetDecodeIteratorRWFVersion(&dIter, pReactorChannel->reactorChannel.majorVersion, pReactorChannel->reactorChannel.minorVersion);
-						rsslSetDecodeIteratorBuffer(&dIter, &pMsg->msgBase.encDataBody);
-						ret = rsslDecodeRDMLoginMsg(&dIter, pMsg, &loginResponse, &memoryBuffer, pError);
+						ret = _reactorDecodeRDMMsgForCallback(pReactorImpl, pReactorChannel, pMsg, &pDecodedMsg, pError);
 
 						loginEvent.baseMsgEvent.pRsslMsgBuffer = pMsgBuf;
 						loginEvent.baseMsgEvent.pRsslMsg = pMsg;
-						if (ret == RSSL_RET_SUCCESS) loginEvent.pRDMLoginMsg = &loginResponse;
+						if (ret == RSSL_RET_SUCCESS) loginEvent.pRDMLoginMsg = (RsslRDMLoginMsg*)pDecodedMsg;
 						else loginEvent.baseMsgEvent.pErrorInfo = pError;
 
-						_reactorSetInCallback(pReactorImpl, RSSL_TRUE);
+						_reactorSetInCallback(pReactorImpl, pReactorChannel, RSSL_TRUE);
 						*pCret = (*pNIProviderRole->loginMsgCallback)((RsslReactor*)pReactorImpl, (RsslReactorChannel*)pReactorChannel, &loginEvent);
-						_reactorSetInCallback(pReactorImpl, RSSL_FALSE);
+						_reactorSetInCallback(pReactorImpl, pReactorChannel, RSSL_FALSE);
 					}
 					else
 					{
@@ -2715,26 +3383,20 @@ static RsslRet _reactorProcessMsg(RsslReactorImpl *pReactorImpl, RsslReactorChan
 
 					if (pProviderRole->loginMsgCallback)
 					{
-						RsslBuffer memoryBuffer = pReactorImpl->memoryBuffer;
-						RsslRDMLoginMsg loginResponse;
 						RsslRDMLoginMsgEvent loginEvent;
 
-						rsslClearRDMLoginMsg(&loginResponse);
 						rsslClearRDMLoginMsgEvent(&loginEvent);
 
-						rsslClearDecodeIterator(&dIter);
-						rsslSetDecodeIteratorRWFVersion(&dIter, pReactorChannel->reactorChannel.majorVersion, pReactorChannel->reactorChannel.minorVersion);
-						rsslSetDecodeIteratorBuffer(&dIter, &pMsg->msgBase.encDataBody);
-						ret = rsslDecodeRDMLoginMsg(&dIter, pMsg, &loginResponse, &memoryBuffer, pError);
+						ret = _reactorDecodeRDMMsgForCallback(pReactorImpl, pReactorChannel, pMsg, &pDecodedMsg, pError);
 
 						loginEvent.baseMsgEvent.pRsslMsgBuffer = pMsgBuf;
 						loginEvent.baseMsgEvent.pRsslMsg = pMsg;
-						if (ret == RSSL_RET_SUCCESS) loginEvent.pRDMLoginMsg = &loginResponse;
+						if (ret == RSSL_RET_SUCCESS) loginEvent.pRDMLoginMsg = (RsslRDMLoginMsg*)pDecodedMsg;
 						else loginEvent.baseMsgEvent.pErrorInfo = pError;
 
-						_reactorSetInCallback(pReactorImpl, RSSL_TRUE);
+						_reactorSetInCallback(pReactorImpl, pReactorChannel, RSSL_TRUE);
 						*pCret = (*pProviderRole->loginMsgCallback)((RsslReactor*)pReactorImpl, (RsslReactorChannel*)pReactorChannel, &loginEvent);
-						_reactorSetInCallback(pReactorImpl, RSSL_FALSE);
+						_reactorSetInCallback(pReactorImpl, pReactorChannel, RSSL_FALSE);
 					}
 					else
 					{
@@ -2752,26 +3414,20 @@ static RsslRet _reactorProcessMsg(RsslReactorImpl *pReactorImpl, RsslReactorChan
 				{
 					if (pProviderRole->directoryMsgCallback)
 					{
-						RsslBuffer memoryBuffer = pReactorImpl->memoryBuffer;
-						RsslRDMDirectoryMsg directoryResponse;
 						RsslRDMDirectoryMsgEvent directoryEvent;
 
-						rsslClearRDMDirectoryMsg(&directoryResponse);
 						rsslClearRDMDirectoryMsgEvent(&directoryEvent);
 
-						rsslClearDecodeIterator(&dIter);
-						rsslSetDecodeIteratorRWFVersion(&dIter, pReactorChannel->reactorChannel.majorVersion, pReactorChannel->reactorChannel.minorVersion);
-						rsslSetDecodeIteratorBuffer(&dIter, &pMsg->msgBase.encDataBody);
-						ret = rsslDecodeRDMDirectoryMsg(&dIter, pMsg, &directoryResponse, &memoryBuffer, pError);
+						ret = _reactorDecodeRDMMsgForCallback(pReactorImpl, pReactorChannel, pMsg, &pDecodedMsg, pError);
 
 						directoryEvent.baseMsgEvent.pRsslMsgBuffer = pMsgBuf;
 						directoryEvent.baseMsgEvent.pRsslMsg = pMsg;
-						if (ret == RSSL_RET_SUCCESS) directoryEvent.pRDMDirectoryMsg = &directoryResponse;
+						if (ret == RSSL_RET_SUCCESS) directoryEvent.pRDMDirectoryMsg = (RsslRDMDirectoryMsg*)pDecodedMsg;
 						else directoryEvent.baseMsgEvent.pErrorInfo = pError;
 
-						_reactorSetInCallback(pReactorImpl, RSSL_TRUE);
+						_reactorSetInCallback(pReactorImpl, pReactorChannel, RSSL_TRUE);
 						*pCret = (*pProviderRole->directoryMsgCallback)((RsslReactor*)pReactorImpl, (RsslReactorChannel*)pReactorChannel, &directoryEvent);
-						_reactorSetInCallback(pReactorImpl, RSSL_FALSE);
+						_reactorSetInCallback(pReactorImpl, pReactorChannel, RSSL_FALSE);
 					}
 					else
 					{
@@ -2789,26 +3445,20 @@ static RsslRet _reactorProcessMsg(RsslReactorImpl *pReactorImpl, RsslReactorChan
 				{
 					if (pProviderRole->dictionaryMsgCallback)
 					{
-						RsslBuffer memoryBuffer = pReactorImpl->memoryBuffer;
-						RsslRDMDictionaryMsg dictionaryResponse;
 						RsslRDMDictionaryMsgEvent dictionaryEvent;
 
-						rsslClearRDMDictionaryMsg(&dictionaryResponse);
 						rsslClearRDMDictionaryMsgEvent(&dictionaryEvent);
 
-						rsslClearDecodeIterator(&dIter);
-						rsslSetDecodeIteratorRWFVersion(&dIter, pReactorChannel->reactorChannel.majorVersion, pReactorChannel->reactorChannel.minorVersion);
-						rsslSetDecodeIteratorBuffer(&dIter, &pMsg->msgBase.encDataBody);
-						ret = rsslDecodeRDMDictionaryMsg(&dIter, pMsg, &dictionaryResponse, &memoryBuffer, pError);
+						ret = _reactorDecodeRDMMsgForCallback(pReactorImpl, pReactorChannel, pMsg, &pDecodedMsg, pError);
 
 						dictionaryEvent.baseMsgEvent.pRsslMsgBuffer = pMsgBuf;
 						dictionaryEvent.baseMsgEvent.pRsslMsg = pMsg;
-						if (ret == RSSL_RET_SUCCESS) dictionaryEvent.pRDMDictionaryMsg = &dictionaryResponse;
+						if (ret == RSSL_RET_SUCCESS) dictionaryEvent.pRDMDictionaryMsg = (RsslRDMDictionaryMsg*)pDecodedMsg;
 						else dictionaryEvent.baseMsgEvent.pErrorInfo = pError;
 
-						_reactorSetInCallback(pReactorImpl, RSSL_TRUE);
+						_reactorSetInCallback(pReactorImpl, pReactorChannel, RSSL_TRUE);
 						*pCret = (*pProviderRole->dictionaryMsgCallback)((RsslReactor*)pReactorImpl, (RsslReactorChannel*)pReactorChannel, &dictionaryEvent);
-						_reactorSetInCallback(pReactorImpl, RSSL_FALSE);
+						_reactorSetInCallback(pReactorImpl, pReactorChannel, RSSL_FALSE);
 					}
 					else
 					{
@@ -2881,6 +3531,24 @@ static RsslRet _reactorDispatchFromChannel(RsslReactorImpl *pReactorImpl, RsslRe
 	rsslClearReadOutArgs(&readOutArgs);
 	pMsgBuf = rsslReadEx(pChannel, &readInArgs, &readOutArgs, &ret, &pError->rsslError);
 	pReactorChannel->readRet = ret;
+	pReactorChannel->readWouldBlock = (!pMsgBuf && ret == RSSL_RET_READ_WOULD_BLOCK);
+
+	if (pReactorImpl->statisticsEnabled)
+	{
+		RsslReactorChannelStatistics *pStatistics = &pReactorChannel->statistics;
+
+		if (pReactorChannel->lastDispatchSeq != pReactorImpl->dispatchSeq)
+		{
+			pReactorChannel->lastDispatchSeq = pReactorImpl->dispatchSeq;
+			++pStatistics->dispatchCount;
+		}
+
+		++pStatistics->readCount;
+		pStatistics->bytesRead += readOutArgs.bytesRead;
+		pStatistics->uncompressedBytesRead += readOutArgs.uncompressedBytesRead;
+		if (pMsgBuf)
+			++pStatistics->msgsRead;
+	}
 
 	if (pMsgBuf)
 	{
@@ -2888,14 +3556,8 @@ static RsslRet _reactorDispatchFromChannel(RsslReactorImpl *pReactorImpl, RsslRe
 		RsslMsg msg;
 
 		/* Update ping time & notication logic */
-		pReactorChannel->lastPingReadMs = pReactorImpl->lastRecordedTimeMs;
-
-		if (ret == RSSL_RET_SUCCESS)
-		{
-			/* Clear notification */
-			FD_CLR(pChannel->socketId, pReactorImpl->useReadFds);
-			FD_CLR(pChannel->socketId, pReactorImpl->useExceptFds);
-		}
+		pReactorChannel->lastPingReadMs = pReactorChannel->lastDataReadMs = pReactorImpl->lastRecordedTimeMs;
+		_reactorStartBusyPoll(pReactorImpl, pReactorChannel);
 
 		/* Decode the message header. Call the appropriate callback function based on the domainType. */
 		rsslClearMsg(&msg);
@@ -2999,9 +3661,7 @@ static RsslRet _reactorDispatchFromChannel(RsslReactorImpl *pReactorImpl, RsslRe
 
 				return RSSL_RET_SUCCESS;
 			case RSSL_RET_READ_WOULD_BLOCK:
-				/* Clear descriptor so that we will ignore this channel until the next notification call */
-				FD_CLR(pChannel->socketId, pReactorImpl->useReadFds);
-				FD_CLR(pChannel->socketId, pReactorImpl->useExceptFds);
+				/* Channel will be ignored until the next notification call */
 				pReactorChannel->readRet = 0;
 				return RSSL_RET_SUCCESS;
 			case RSSL_RET_READ_FD_CHANGE:
@@ -3009,15 +3669,8 @@ static RsslRet _reactorDispatchFromChannel(RsslReactorImpl *pReactorImpl, RsslRe
 					RsslReactorEventImpl rsslEvent;
 
 					/* Change descriptors */
-					FD_CLR(pChannel->oldSocketId, pReactorImpl->useReadFds);
-					FD_CLR(pChannel->oldSocketId, pReactorImpl->useExceptFds);
-					FD_SET(pChannel->socketId, pReactorImpl->useReadFds);
-					FD_SET(pChannel->socketId, pReactorImpl->useExceptFds);
-
-					FD_CLR(pChannel->oldSocketId, pReactorImpl->readFds);
-					FD_CLR(pChannel->oldSocketId, pReactorImpl->exceptFds);
-					FD_SET(pChannel->socketId, pReactorImpl->readFds);
-					FD_SET(pChannel->socketId, pReactorImpl->exceptFds);
+					if (rsslNotifierUpdateEventFd(&pReactorImpl->notifier, &pReactorChannel->notifierEvent, pChannel->socketId, pError) != RSSL_RET_SUCCESS)
+						return _reactorHandleChannelDown(pReactorImpl, pReactorChannel, pError);
 
 					/* Copy changed sockets to reactor channel */
 					pReactorChannel->reactorChannel.socketId = pChannel->socketId;
@@ -3028,9 +3681,9 @@ static RsslRet _reactorDispatchFromChannel(RsslReactorImpl *pReactorImpl, RsslRe
 					rsslEvent.channelEventImpl.channelEvent.channelEventType = RSSL_RC_CET_FD_CHANGE;
 					rsslEvent.channelEventImpl.channelEvent.pReactorChannel = (RsslReactorChannel*)pReactorChannel;
 					
-					_reactorSetInCallback(pReactorImpl, RSSL_TRUE);
+					_reactorSetInCallback(pReactorImpl, pReactorChannel, RSSL_TRUE);
 					(*pReactorChannel->channelRole.base.channelEventCallback)((RsslReactor*)pReactorImpl, (RsslReactorChannel*)pReactorChannel, &rsslEvent.channelEventImpl.channelEvent);
-					_reactorSetInCallback(pReactorImpl, RSSL_FALSE);
+					_reactorSetInCallback(pReactorImpl, pReactorChannel, RSSL_FALSE);
 
 
 					pReactorChannel->readRet = 0;
@@ -3065,9 +3718,9 @@ static RsslRet _reactorDispatchFromChannel(RsslReactorImpl *pReactorImpl, RsslRe
 					rsslEvent.channelEventImpl.channelEvent.pError = pError;
 					rsslSetErrorInfoLocation(pError, __FILE__, __LINE__);
 					
-					_reactorSetInCallback(pReactorImpl, RSSL_TRUE);
+					_reactorSetInCallback(pReactorImpl, pReactorChannel, RSSL_TRUE);
 					(*pReactorChannel->channelRole.base.channelEventCallback)((RsslReactor*)pReactorImpl, (RsslReactorChannel*)pReactorChannel, &rsslEvent.channelEventImpl.channelEvent);
-					_reactorSetInCallback(pReactorImpl, RSSL_FALSE);
+					_reactorSetInCallback(pReactorImpl, pReactorChannel, RSSL_FALSE);
 
 
 					pReactorChannel->readRet = 0;
@@ -3093,7 +3746,7 @@ static RsslRet _reactorDispatchFromChannel(RsslReactorImpl *pReactorImpl, RsslRe
 	}
 	else
 	{
-		pReactorChannel->lastPingReadMs = pReactorImpl->lastRecordedTimeMs;
+		pReactorChannel->lastPingReadMs = pReactorChannel->lastDataReadMs = pReactorImpl->lastRecordedTimeMs;
 		return ret; /* Got positive return from read, but no message -- means a partial message was received by Rssl and we have to wait for the rest of the data. */
 	}
 }
@@ -3356,8 +4009,21 @@ RsslRet reactorUnlockInterface(RsslReactorImpl *pReactorImpl)
 	return RSSL_RET_SUCCESS;
 }
 
-static void _reactorSetInCallback(RsslReactorImpl *pReactorImpl, RsslBool inCallback)
+static void _reactorSetInCallback(RsslReactorImpl *pReactorImpl, RsslReactorChannelImpl *pReactorChannel, RsslBool inCallback)
 {
 	pReactorImpl->inReactorFunction = inCallback;
+
+	/* A message left for the callback to decode can no longer be decoded once it returns. */
+	if (!inCallback && pReactorChannel)
+		pReactorChannel->pLazyRDMMsg = NULL;
+
+	/* Measure time spent in the callback. */
+	if (pReactorImpl->statisticsEnabled)
+	{
+		if (inCallback)
+			pReactorImpl->callbackStartUsec = getCurrentTimeUsec(pReactorImpl->ticksPerMsec);
+		else if (pReactorChannel)
+			_reactorAddLatency(&pReactorChannel->statistics.callbackTime, getCurrentTimeUsec(pReactorImpl->ticksPerMsec) - pReactorImpl->callbackStartUsec);
+	}
 }
 
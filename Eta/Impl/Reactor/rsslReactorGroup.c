@@ -0,0 +1,296 @@
+/*
+ * This source code is provided under the Apache 2.0 license and is provided
+ * AS IS with no warranty or guarantee of fit for purpose.  See the project's
+ * LICENSE.md for details.
+ * Copyright Thomson Reuters 2015. All rights reserved.
+*/
+
+#include "rtr/rsslReactorGroupImpl.h"
+
+#ifdef WIN32
+#include <windows.h>
+#elif defined(Linux)
+#include <sched.h>
+#include <poll.h>
+#else
+#include <sys/types.h>
+#include <sys/processor.h>
+#include <sys/procset.h>
+#include <poll.h>
+#endif
+
+RSSL_VA_API RsslReactorGroup *rsslCreateReactorGroup(RsslCreateReactorGroupOptions *pOpts, RsslErrorInfo *pError)
+{
+	RsslReactorGroupImpl *pReactorGroupImpl;
+	RsslCreateReactorOptions reactorOpts;
+	RsslErrorInfo cleanupError;
+	RsslUInt32 i;
+
+	if (pOpts->threadCount == 0)
+	{
+		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, "Reactor group threadCount must be nonzero.");
+		return NULL;
+	}
+
+	if (!(pReactorGroupImpl = (RsslReactorGroupImpl*)malloc(sizeof(RsslReactorGroupImpl))))
+	{
+		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to create reactor group object.");
+		return NULL;
+	}
+
+	memset(pReactorGroupImpl, 0, sizeof(RsslReactorGroupImpl));
+	pReactorGroupImpl->reactorGroup.userSpecPtr = pOpts->userSpecPtr;
+	pReactorGroupImpl->maxMessages = pOpts->maxMessages;
+	pReactorGroupImpl->dispatchWaitTimeout = pOpts->dispatchWaitTimeout;
+	pReactorGroupImpl->threadFailureCallback = pOpts->threadFailureCallback;
+	RSSL_MUTEX_INIT(&pReactorGroupImpl->assignLock);
+
+	pReactorGroupImpl->threads = (RsslReactorGroupThread*)malloc(pOpts->threadCount * sizeof(RsslReactorGroupThread));
+	pReactorGroupImpl->reactorGroup.reactors = (RsslReactor**)malloc(pOpts->threadCount * sizeof(RsslReactor*));
+	if (!pReactorGroupImpl->threads || !pReactorGroupImpl->reactorGroup.reactors)
+	{
+		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to create reactor group threads.");
+		_reactorGroupCleanup(pReactorGroupImpl, &cleanupError);
+		return NULL;
+	}
+	memset(pReactorGroupImpl->threads, 0, pOpts->threadCount * sizeof(RsslReactorGroupThread));
+
+	/* Each thread waits on its reactor's notifier, which can only be done from outside the reactor when it uses epoll. */
+	reactorOpts = pOpts->reactorOptions;
+	reactorOpts.notifierType = RSSL_RC_NT_EPOLL;
+
+	/* Rather than each starting its own worker thread, the reactors share this one. */
+	if (_reactorWorkerThreadStartShared(&pReactorGroupImpl->workerThread, (RsslNotifierType)reactorOpts.notifierType, pError) != RSSL_RET_SUCCESS)
+	{
+		_reactorGroupCleanup(pReactorGroupImpl, &cleanupError);
+		return NULL;
+	}
+	pReactorGroupImpl->workerThreadStarted = RSSL_TRUE;
+
+	for (i = 0; i < pOpts->threadCount; ++i)
+	{
+		RsslReactorGroupThread *pThread = &pReactorGroupImpl->threads[i];
+		RsslReactor *pReactor;
+
+		if (!(pReactor = _reactorCreate(&reactorOpts, &pReactorGroupImpl->workerThread, pError)))
+		{
+			_reactorGroupCleanup(pReactorGroupImpl, &cleanupError);
+			return NULL;
+		}
+
+		pThread->pReactorGroupImpl = pReactorGroupImpl;
+		pThread->pReactorImpl = (RsslReactorImpl*)pReactor;
+		pReactorGroupImpl->reactorGroup.reactors[i] = pReactor;
+		++pReactorGroupImpl->threadCount;
+		pReactorGroupImpl->reactorGroup.reactorCount = pReactorGroupImpl->threadCount;
+
+		if (RSSL_THREAD_START(&pThread->thread, runReactorGroupThread, pThread) < 0)
+		{
+			rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to start reactor group thread.");
+			_reactorGroupCleanup(pReactorGroupImpl, &cleanupError);
+			return NULL;
+		}
+		pThread->threadStarted = RSSL_TRUE;
+
+		if (pOpts->cpuIds && i < pOpts->cpuIdCount && pOpts->cpuIds[i] >= 0
+				&& _reactorGroupBindThread(pThread, pOpts->cpuIds[i], pError) != RSSL_RET_SUCCESS)
+		{
+			_reactorGroupCleanup(pReactorGroupImpl, &cleanupError);
+			return NULL;
+		}
+	}
+
+	return &pReactorGroupImpl->reactorGroup;
+}
+
+RSSL_VA_API RsslRet rsslDestroyReactorGroup(RsslReactorGroup *pReactorGroup, RsslErrorInfo *pError)
+{
+	return _reactorGroupCleanup((RsslReactorGroupImpl*)pReactorGroup, pError);
+}
+
+RSSL_VA_API RsslRet rsslReactorGroupConnect(RsslReactorGroup *pReactorGroup, RsslInt32 threadHint, RsslReactorConnectOptions *pOpts, RsslReactorChannelRole *pRole, RsslErrorInfo *pError)
+{
+	RsslReactor *pReactor;
+
+	if (!(pReactor = _reactorGroupSelectReactor((RsslReactorGroupImpl*)pReactorGroup, threadHint, pError)))
+		return RSSL_RET_FAILURE;
+
+	return rsslReactorConnect(pReactor, pOpts, pRole, pError);
+}
+
+RSSL_VA_API RsslRet rsslReactorGroupAccept(RsslReactorGroup *pReactorGroup, RsslInt32 threadHint, RsslServer *pServer, RsslReactorAcceptOptions *pOpts, RsslReactorChannelRole *pRole, RsslErrorInfo *pError)
+{
+	RsslReactor *pReactor;
+
+	if (!(pReactor = _reactorGroupSelectReactor((RsslReactorGroupImpl*)pReactorGroup, threadHint, pError)))
+		return RSSL_RET_FAILURE;
+
+	return rsslReactorAccept(pReactor, pServer, pOpts, pRole, pError);
+}
+
+RSSL_VA_API RsslReactor *rsslReactorGroupGetChannelReactor(RsslReactorGroup *pReactorGroup, RsslReactorChannel *pChannel)
+{
+	return (RsslReactor*)((RsslReactorChannelImpl*)pChannel)->pParentReactor;
+}
+
+static RsslReactor *_reactorGroupSelectReactor(RsslReactorGroupImpl *pReactorGroupImpl, RsslInt32 threadHint, RsslErrorInfo *pError)
+{
+	RsslUInt32 index, i;
+
+	if (threadHint >= 0)
+		index = (RsslUInt32)threadHint % pReactorGroupImpl->threadCount;
+	else
+	{
+		RSSL_MUTEX_LOCK(&pReactorGroupImpl->assignLock);
+		index = pReactorGroupImpl->nextThread;
+		pReactorGroupImpl->nextThread = (index + 1) % pReactorGroupImpl->threadCount;
+		RSSL_MUTEX_UNLOCK(&pReactorGroupImpl->assignLock);
+	}
+
+	/* If the chosen thread has stopped, its reactor has shut down; use the next one still running. */
+	for (i = 0; i < pReactorGroupImpl->threadCount; ++i)
+	{
+		RsslUInt32 threadIndex = (index + i) % pReactorGroupImpl->threadCount;
+
+		if (!pReactorGroupImpl->threads[threadIndex].stopped)
+			return pReactorGroupImpl->reactorGroup.reactors[threadIndex];
+	}
+
+	rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "All reactors of the reactor group have stopped.");
+	return NULL;
+}
+
+static RsslRet _reactorGroupBindThread(RsslReactorGroupThread *pThread, RsslInt32 cpuId, RsslErrorInfo *pError)
+{
+#if defined(WIN32)
+	if (SetThreadAffinityMask(pThread->thread.handle, (DWORD_PTR)1 << cpuId) != 0)
+		return RSSL_RET_SUCCESS;
+#elif defined(Linux)
+	cpu_set_t cpuSet;
+	CPU_ZERO(&cpuSet);
+	CPU_SET(cpuId, &cpuSet);
+
+	if (pthread_setaffinity_np(pThread->thread, sizeof(cpu_set_t), &cpuSet) == 0)
+		return RSSL_RET_SUCCESS;
+#else /* Solaris */
+	if (processor_bind(P_LWPID, (id_t)pThread->thread, cpuId, NULL) == 0)
+		return RSSL_RET_SUCCESS;
+#endif
+
+	rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to bind reactor group thread to CPU %d.", cpuId);
+	return RSSL_RET_FAILURE;
+}
+
+static void _reactorGroupThreadWait(RsslReactorGroupThread *pThread)
+{
+	RsslReactorImpl *pReactorImpl = pThread->pReactorImpl;
+	RsslUInt32 waitTimeout = pThread->pReactorGroupImpl->dispatchWaitTimeout;
+
+#ifdef WIN32
+	fd_set readFds, exceptFds;
+	struct timeval selectTime;
+
+	/* No epoll, so wait on a copy of the descriptors registered with the reactor's notifier(its event queue and its active
+	 * channels). The copy is taken under the interface lock, since channels may be closed from other threads. */
+	RSSL_MUTEX_LOCK(&pReactorImpl->interfaceLock);
+	readFds = *pReactorImpl->notifier.readFds;
+	exceptFds = *pReactorImpl->notifier.exceptFds;
+	RSSL_MUTEX_UNLOCK(&pReactorImpl->interfaceLock);
+
+	selectTime.tv_sec = waitTimeout / 1000000;
+	selectTime.tv_usec = waitTimeout % 1000000;
+	select(0, &readFds, NULL, &exceptFds, &selectTime);
+#else
+	struct pollfd pollFd;
+
+	/* The epoll descriptor is readable while any descriptor registered with the reactor's notifier(its event queue and
+	 * its active channels) is ready, and epoll_ctl() is safe to call while another thread waits on it. */
+	pollFd.fd = (pReactorImpl->notifier.type == RSSL_NOTIFIER_EPOLL) ? pReactorImpl->notifier.epollFd : pReactorImpl->reactor.eventFd;
+	pollFd.events = POLLIN;
+	pollFd.revents = 0;
+	poll(&pollFd, 1, (int)((waitTimeout + 999) / 1000));
+#endif
+}
+
+RSSL_THREAD_DECLARE(runReactorGroupThread, pArg)
+{
+	RsslReactorGroupThread *pThread = (RsslReactorGroupThread*)pArg;
+	RsslReactorGroupImpl *pReactorGroupImpl = pThread->pReactorGroupImpl;
+	RsslReactorDispatchOptions dispatchOpts;
+	RsslRet ret;
+
+	rsslClearReactorDispatchOptions(&dispatchOpts);
+	dispatchOpts.maxMessages = pReactorGroupImpl->maxMessages;
+
+	while (!pReactorGroupImpl->stopping)
+	{
+		_reactorGroupThreadWait(pThread);
+
+		/* Dispatch until the reactor reports nothing more to read. */
+		do
+		{
+			ret = rsslReactorDispatch(&pThread->pReactorImpl->reactor, &dispatchOpts, &pThread->errorInfo);
+		} while (ret > RSSL_RET_SUCCESS && !pReactorGroupImpl->stopping);
+
+		if (ret < RSSL_RET_SUCCESS)
+		{
+			/* The reactor has shut down, and its channels have been reported down. */
+			pThread->dispatchRet = ret;
+			RSSL_MEMORY_BARRIER();
+			pThread->stopped = RSSL_TRUE;
+
+			if (pReactorGroupImpl->threadFailureCallback)
+				(*pReactorGroupImpl->threadFailureCallback)(&pReactorGroupImpl->reactorGroup, &pThread->pReactorImpl->reactor, &pThread->errorInfo);
+			break;
+		}
+	}
+
+	return RSSL_THREAD_RETURN();
+}
+
+static RsslRet _reactorGroupCleanup(RsslReactorGroupImpl *pReactorGroupImpl, RsslErrorInfo *pError)
+{
+	RsslRet ret = RSSL_RET_SUCCESS;
+	RsslReactorGroupThread *pFailedThread = NULL;
+	RsslUInt32 i;
+
+	pReactorGroupImpl->stopping = RSSL_TRUE;
+	RSSL_MEMORY_BARRIER();
+
+	for (i = 0; i < pReactorGroupImpl->threadCount; ++i)
+	{
+		RsslReactorGroupThread *pThread = &pReactorGroupImpl->threads[i];
+
+		if (pThread->threadStarted)
+		{
+			RSSL_THREAD_JOIN(pThread->thread);
+#ifdef WIN32
+			RSSL_THREAD_DETACH(&pThread->thread);
+#endif
+		}
+
+		if (pThread->stopped && !pFailedThread)
+			pFailedThread = pThread;
+
+		if (rsslDestroyReactor(&pThread->pReactorImpl->reactor, pError) != RSSL_RET_SUCCESS)
+			ret = RSSL_RET_FAILURE;
+	}
+
+	/* The worker thread frees each destroyed reactor, and stops once it has freed them all. */
+	if (pReactorGroupImpl->workerThreadStarted)
+		_reactorWorkerThreadStopShared(&pReactorGroupImpl->workerThread);
+
+	/* Report why a dispatch thread stopped early. */
+	if (pFailedThread)
+	{
+		*pError = pFailedThread->errorInfo;
+		pError->rsslError.channel = NULL; /* Destroyed with the reactor. */
+		ret = pFailedThread->dispatchRet;
+	}
+
+	RSSL_MUTEX_DESTROY(&pReactorGroupImpl->assignLock);
+	free(pReactorGroupImpl->threads);
+	free(pReactorGroupImpl->reactorGroup.reactors);
+	free(pReactorGroupImpl);
+	return ret;
+}
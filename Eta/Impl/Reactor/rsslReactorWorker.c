@@ -47,87 +47,156 @@ static void _reactorWorkerCalculateNextTimeout(RsslReactorImpl *pReactorImpl, Rs
 
 static void _reactorWorkerMoveChannel(RsslQueue *pNewList, RsslReactorChannelImpl *pReactorChannel);
 
-/* Shutdown the worker due to some error. Sends a request to the reactor and waits for response, then shuts down. */
-void _reactorWorkerShutdown(RsslReactorImpl *pReactorImpl, RsslErrorInfo *pErrorInfo);
+/* Registers the channel's descriptor with the worker's notifier for the given conditions(or updates the registration). */
+static RsslRet _reactorWorkerRegisterChannel(RsslReactorImpl *pReactorImpl, RsslReactorChannelImpl *pReactorChannel, RsslUInt8 notifyFlags);
+
+/* Stops notification on the channel's descriptor. */
+static void _reactorWorkerUnregisterChannel(RsslReactorImpl *pReactorImpl, RsslReactorChannelImpl *pReactorChannel);
+
+/* Shutdown the worker due to some error. Stops work on the reactor's channels and sends a shutdown request to the reactor.
+ * The reactor's reply is handled as any other event, so the thread keeps serving the other reactors sharing it. */
+static void _reactorWorkerShutdown(RsslReactorImpl *pReactorImpl);
 
 /* Shuts down in response to a request from the reactor */
 void _reactorWorkerHandleShutdownRequest(RsslReactorImpl *pReactorImpl, RsslErrorInfo *pErrorInfo);
 
-/* Setup and start the worker thread (Should be called from rsslCreateReactor) */
-RsslRet _reactorWorkerStart(RsslReactorImpl *pReactorImpl, RsslCreateReactorOptions *pReactorOptions, RsslErrorInfo *pError);
+/* Initializes a worker thread's notifier and event queue group. */
+static RsslRet _reactorWorkerThreadInit(RsslReactorWorkerThread *pWorkerThread, RsslNotifierType notifierType, RsslErrorInfo *pError);
+
+/* Cleans up a worker thread's notifier and event queue group. */
+static void _reactorWorkerThreadCleanup(RsslReactorWorkerThread *pWorkerThread);
+
+/* Handles a channel whose descriptor was triggered: continues its initialization, or flushes it. */
+static RsslRet _reactorWorkerProcessNotifiedChannel(RsslReactorImpl *pReactorImpl, RsslReactorChannelImpl *pReactorChannel, RsslNotifierEvent *pNotifierEvent);
+
+/* Handles an event from the reactor(other than attaching or destroying it, which the thread handles). */
+static RsslRet _reactorWorkerProcessEvent(RsslReactorImpl *pReactorImpl, RsslReactorEventImpl *pEvent);
+
+/* Registers the descriptors of the worker's channels again, after the notifier found a bad descriptor. */
+static RsslRet _reactorWorkerReregisterChannels(RsslReactorImpl *pReactorImpl);
 
-RsslRet _reactorWorkerStart(RsslReactorImpl *pReactorImpl, RsslCreateReactorOptions *pReactorOptions, RsslErrorInfo *pError)
+/* Checks the worker's channels for initialization timeouts, pings, timers and reconnection. */
+static RsslRet _reactorWorkerProcessTimeouts(RsslReactorImpl *pReactorImpl);
+
+/* Removes a destroyed reactor's worker from a shared worker thread. */
+static void _reactorWorkerDetach(RsslReactorImpl *pReactorImpl);
+
+/* Checks whether a stopping shared thread has destroyed all of its workers. */
+static RsslBool _reactorWorkerThreadIsDone(RsslReactorWorkerThread *pWorkerThread);
+
+static RsslRet _reactorWorkerThreadInit(RsslReactorWorkerThread *pWorkerThread, RsslNotifierType notifierType, RsslErrorInfo *pError)
 {
-	RsslReactorWorker *pReactorWorker = &pReactorImpl->reactorWorker;
 	int eventQueueFd;
+#ifdef WIN32
+	LARGE_INTEGER	perfFrequency;
+
+	QueryPerformanceFrequency(&perfFrequency);
+	pWorkerThread->ticksPerMsec = perfFrequency.QuadPart/1000;
+#else
+	pWorkerThread->ticksPerMsec = 1000000; /* Not used. */
+#endif
+
+	pWorkerThread->lastRecordedTimeMs = getCurrentTimeMs(pWorkerThread->ticksPerMsec);
+	pWorkerThread->sleepTimeMs = 3000;
+	rsslInitQueue(&pWorkerThread->workers);
 
-	if (rsslInitReactorEventQueueGroup(&pReactorImpl->reactorWorker.activeEventQueueGroup) != RSSL_RET_SUCCESS)
+	if (rsslInitReactorEventQueueGroup(&pWorkerThread->activeEventQueueGroup) != RSSL_RET_SUCCESS)
 	{
 		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to initialize worker activeEventQueueGroup.");
 		return RSSL_RET_FAILURE;
 	}
 
-	if (rsslInitReactorEventQueue(&pReactorImpl->reactorWorker.workerQueue, 10, &pReactorImpl->reactorWorker.activeEventQueueGroup) != RSSL_RET_SUCCESS)
-	{
-		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to init worker event queue.");
+	rsslClearNotifierEvent(&pWorkerThread->queueNotifierEvent);
+	if (rsslNotifierInit(&pWorkerThread->notifier, notifierType, pError) != RSSL_RET_SUCCESS)
 		return RSSL_RET_FAILURE;
-	}
-
-	/* Prepare worker's channel lists */
-	rsslInitQueue(&pReactorImpl->reactorWorker.initializingChannels);
-	rsslInitQueue(&pReactorImpl->reactorWorker.activeChannels);
-	rsslInitQueue(&pReactorImpl->reactorWorker.inactiveChannels);
-	rsslInitQueue(&pReactorImpl->reactorWorker.reconnectingChannels);
 
-	if ((pReactorWorker->readFds = (fd_set*)malloc(pReactorImpl->fdSetSizeInBytes)) == NULL)
-	{
-		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to allocate memory.");
+	eventQueueFd = rsslGetEventQueueGroupSignalFD(&pWorkerThread->activeEventQueueGroup);
+	if (rsslNotifierAddEvent(&pWorkerThread->notifier, &pWorkerThread->queueNotifierEvent, eventQueueFd, NULL,
+				RSSL_NOTIFIER_READ | RSSL_NOTIFIER_EXCEPT, pError) != RSSL_RET_SUCCESS)
 		return RSSL_RET_FAILURE;
-	}
 
-	if ((pReactorWorker->writeFds = (fd_set*)malloc(pReactorImpl->fdSetSizeInBytes)) == NULL)
-	{
-		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to allocate memory.");
-		return RSSL_RET_FAILURE;
-	}
+	return RSSL_RET_SUCCESS;
+}
 
-	if ((pReactorWorker->exceptFds = (fd_set*)malloc(pReactorImpl->fdSetSizeInBytes)) == NULL)
-	{
-		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to allocate memory.");
-		return RSSL_RET_FAILURE;
-	}
+static void _reactorWorkerThreadCleanup(RsslReactorWorkerThread *pWorkerThread)
+{
+	rsslCleanupReactorEventQueueGroup(&pWorkerThread->activeEventQueueGroup);
+	rsslNotifierCleanup(&pWorkerThread->notifier);
+}
 
-	if ((pReactorWorker->useReadFds = (fd_set*)malloc(pReactorImpl->fdSetSizeInBytes)) == NULL)
+RsslRet _reactorWorkerThreadStartShared(RsslReactorWorkerThread *pWorkerThread, RsslNotifierType notifierType, RsslErrorInfo *pError)
+{
+	if (_reactorWorkerThreadInit(pWorkerThread, notifierType, pError) != RSSL_RET_SUCCESS)
+		return (_reactorWorkerThreadCleanup(pWorkerThread), RSSL_RET_FAILURE);
+
+	pWorkerThread->isShared = RSSL_TRUE;
+
+	if (RSSL_THREAD_START(&pWorkerThread->thread, runReactorWorker, pWorkerThread) < 0)
 	{
-		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to allocate memory.");
-		return RSSL_RET_FAILURE;
+		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to start reactorWorker.");
+		return (_reactorWorkerThreadCleanup(pWorkerThread), RSSL_RET_FAILURE);
 	}
 
-	if ((pReactorWorker->useWriteFds = (fd_set*)malloc(pReactorImpl->fdSetSizeInBytes)) == NULL)
+	return RSSL_RET_SUCCESS;
+}
+
+void _reactorWorkerThreadStopShared(RsslReactorWorkerThread *pWorkerThread)
+{
+	/* The reactors have already sent their destroy events. Wake the thread so that it sees it is stopping once it has handled them. */
+	pWorkerThread->stopping = RSSL_TRUE;
+	RSSL_MEMORY_BARRIER();
+
+	RSSL_MUTEX_LOCK(&pWorkerThread->activeEventQueueGroup.lock);
+	rsslSetEventSignal(&pWorkerThread->activeEventQueueGroup.eventSignal);
+	RSSL_MUTEX_UNLOCK(&pWorkerThread->activeEventQueueGroup.lock);
+
+	RSSL_THREAD_JOIN(pWorkerThread->thread);
+#ifdef WIN32
+	RSSL_THREAD_DETACH(&pWorkerThread->thread);
+#endif
+
+	_reactorWorkerThreadCleanup(pWorkerThread);
+}
+
+RsslRet _reactorWorkerStart(RsslReactorImpl *pReactorImpl, RsslCreateReactorOptions *pReactorOptions, RsslReactorWorkerThread *pSharedWorkerThread, RsslErrorInfo *pError)
+{
+	RsslReactorWorker *pReactorWorker = &pReactorImpl->reactorWorker;
+	RsslReactorStateEvent *pEvent;
+
+	if (pSharedWorkerThread)
+		pReactorWorker->pWorkerThread = pSharedWorkerThread;
+	else
 	{
-		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to allocate memory.");
-		return RSSL_RET_FAILURE;
+		pReactorWorker->pWorkerThread = &pReactorImpl->workerThread;
+		if (_reactorWorkerThreadInit(&pReactorImpl->workerThread, pReactorImpl->notifierType, pError) != RSSL_RET_SUCCESS)
+			return RSSL_RET_FAILURE;
 	}
 
-	if ((pReactorWorker->useExceptFds = (fd_set*)malloc(pReactorImpl->fdSetSizeInBytes)) == NULL)
+	if (rsslInitReactorEventRingQueue(&pReactorWorker->workerQueue, 128, &pReactorWorker->pWorkerThread->activeEventQueueGroup) != RSSL_RET_SUCCESS)
 	{
-		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to allocate memory.");
+		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to init worker event queue.");
 		return RSSL_RET_FAILURE;
 	}
 
-	memset(pReactorWorker->readFds, 0, pReactorImpl->fdSetSizeInBytes);
-	memset(pReactorWorker->writeFds, 0, pReactorImpl->fdSetSizeInBytes);
-	memset(pReactorWorker->exceptFds, 0, pReactorImpl->fdSetSizeInBytes);
-	memset(pReactorWorker->useReadFds, 0, pReactorImpl->fdSetSizeInBytes);
-	memset(pReactorWorker->useWriteFds, 0, pReactorImpl->fdSetSizeInBytes);
-	memset(pReactorWorker->useExceptFds, 0, pReactorImpl->fdSetSizeInBytes);
+	/* Prepare worker's channel lists */
+	rsslInitQueue(&pReactorImpl->reactorWorker.initializingChannels);
+	rsslInitQueue(&pReactorImpl->reactorWorker.activeChannels);
+	rsslInitQueue(&pReactorImpl->reactorWorker.inactiveChannels);
+	rsslInitQueue(&pReactorImpl->reactorWorker.reconnectingChannels);
+	rsslInitQueueLink(&pReactorWorker->workerThreadLink);
+
+	/* The thread adds the worker when it gets this event, ahead of any other from the reactor. */
+	pEvent = (RsslReactorStateEvent*)rsslReactorEventQueueGetFromPool(&pReactorWorker->workerQueue);
+	rsslClearReactorEvent(pEvent);
+	pEvent->reactorEventType = RSSL_RCIMPL_STET_ATTACH;
+	if (!RSSL_ERROR_INFO_CHECK(rsslReactorEventQueuePut(&pReactorWorker->workerQueue, (RsslReactorEventImpl*)pEvent) == RSSL_RET_SUCCESS, RSSL_RET_FAILURE, pError))
+		return RSSL_RET_FAILURE;
 
-	eventQueueFd = rsslGetEventQueueGroupSignalFD(&pReactorImpl->reactorWorker.activeEventQueueGroup);
-	FD_SET(eventQueueFd, pReactorImpl->reactorWorker.readFds);
-	FD_SET(eventQueueFd, pReactorImpl->reactorWorker.exceptFds);
+	if (pSharedWorkerThread)
+		return RSSL_RET_SUCCESS;
 
 	/* Start write reactor thread */
-	if (RSSL_THREAD_START(&pReactorImpl->reactorWorker.thread, runReactorWorker, pReactorImpl) < 0)
+	if (RSSL_THREAD_START(&pReactorImpl->workerThread.thread, runReactorWorker, &pReactorImpl->workerThread) < 0)
 	{
 		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to start reactorWorker.");
 		return RSSL_RET_FAILURE;
@@ -139,12 +208,17 @@ RsslRet _reactorWorkerStart(RsslReactorImpl *pReactorImpl, RsslCreateReactorOpti
 void _reactorWorkerCleanupReactor(RsslReactorImpl *pReactorImpl)
 {
 	RsslQueueLink *pLink;
-	RsslReactorWorker *pReactorWorker = &pReactorImpl->reactorWorker;
+	RsslReactorWorkerThread *pWorkerThread = pReactorImpl->reactorWorker.pWorkerThread;
 
 	rsslCleanupReactorEventQueue(&pReactorImpl->reactorEventQueue);
 	rsslCleanupReactorEventQueue(&pReactorImpl->reactorWorker.workerQueue);
-	rsslCleanupReactorEventQueueGroup(&pReactorImpl->reactorWorker.activeEventQueueGroup);
 	rsslCleanupReactorEventQueueGroup(&pReactorImpl->activeEventQueueGroup);
+	rsslNotifierCleanup(&pReactorImpl->notifier);
+
+	/* A shared worker thread belongs to the reactor group, which cleans it up. */
+	if (!pWorkerThread || !pWorkerThread->isShared)
+		_reactorWorkerThreadCleanup(&pReactorImpl->workerThread);
+
 	while (pLink = rsslQueueRemoveFirstLink(&pReactorImpl->channelPool))
 	{
 		RsslReactorChannelImpl *pReactorChannel = RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorChannelImpl, reactorQueueLink, pLink);
@@ -198,39 +272,9 @@ void _reactorWorkerCleanupReactor(RsslReactorImpl *pReactorImpl)
 		free(pReactorChannel);
 	}
 
-	if (pReactorImpl->readFds)
-		free(pReactorImpl->readFds);
-
-	if (pReactorImpl->exceptFds)
-		free(pReactorImpl->exceptFds);
-
-	if (pReactorImpl->useReadFds)
-		free(pReactorImpl->useReadFds);
-
-	if (pReactorImpl->useExceptFds)
-		free(pReactorImpl->useExceptFds);
-
 	if (pReactorImpl->memoryBuffer.data)
 		free(pReactorImpl->memoryBuffer.data);
 
-	if (pReactorWorker->readFds)
-		free(pReactorWorker->readFds);
-
-	if (pReactorWorker->writeFds)
-		free(pReactorWorker->writeFds);
-
-	if (pReactorWorker->exceptFds)
-		free(pReactorWorker->exceptFds);
-
-	if (pReactorWorker->useReadFds)
-		free(pReactorWorker->useReadFds);
-
-	if (pReactorWorker->useWriteFds)
-		free(pReactorWorker->useWriteFds);
-
-	if (pReactorWorker->useExceptFds)
-		free(pReactorWorker->useExceptFds);
-
 	RSSL_MUTEX_DESTROY(&pReactorImpl->interfaceLock);
 	free(pReactorImpl);
 
@@ -247,14 +291,12 @@ RsslRet _reactorWorkerProcessChannelUp(RsslReactorImpl *pReactorImpl, RsslReacto
 
 	/* Initialization succeeded. Send channel up event. */
 
-	/* Remove read fd -- from now on the worker thread should mainly handle flushing */
-	FD_CLR(pReactorChannel->reactorChannel.pRsslChannel->socketId, pReactorWorker->readFds);
-	FD_CLR(pReactorChannel->reactorChannel.pRsslChannel->socketId, pReactorWorker->writeFds);
-	FD_CLR(pReactorChannel->reactorChannel.pRsslChannel->socketId, pReactorWorker->exceptFds);
+	/* Remove descriptor -- from now on the worker thread should mainly handle flushing */
+	_reactorWorkerUnregisterChannel(pReactorImpl, pReactorChannel);
 
 	_reactorWorkerMoveChannel(&pReactorWorker->activeChannels, pReactorChannel);
 	_reactorWorkerCalculateNextTimeout(pReactorImpl, (RsslUInt32)(pReactorChannel->reactorChannel.pRsslChannel->pingTimeout * 1000 * pingIntervalFactor));
-	pReactorChannel->lastPingSentMs = pReactorWorker->lastRecordedTimeMs;
+	pReactorChannel->lastPingSentMs = pReactorWorker->pWorkerThread->lastRecordedTimeMs;
 
 	/* Copy RsslChannel parameters */
 	pReactorChannel->reactorChannel.socketId = pReactorChannel->reactorChannel.pRsslChannel->socketId;
@@ -281,12 +323,7 @@ RsslRet _reactorWorkerHandleChannelFailure(RsslReactorImpl *pReactorImpl, RsslRe
 	RsslReactorWorker *pReactorWorker = &pReactorImpl->reactorWorker;
 
 
-	if(pReactorChannel->reactorChannel.pRsslChannel != 0)
-	{
-		FD_CLR(pReactorChannel->reactorChannel.pRsslChannel->socketId, pReactorWorker->readFds);
-		FD_CLR(pReactorChannel->reactorChannel.pRsslChannel->socketId, pReactorWorker->exceptFds);
-		FD_CLR(pReactorChannel->reactorChannel.pRsslChannel->socketId, pReactorWorker->writeFds);
-	}
+	_reactorWorkerUnregisterChannel(pReactorImpl, pReactorChannel);
 
 	_reactorWorkerMoveChannel(&pReactorImpl->reactorWorker.inactiveChannels, pReactorChannel);
 
@@ -334,10 +371,10 @@ RsslRet _reactorWorkerSendTimerExpired(RsslReactorImpl *pReactorImpl, RsslReacto
 
 static void _reactorWorkerCalculateNextTimeout(RsslReactorImpl *pReactorImpl, RsslUInt32 newTimeoutMicroSeconds)
 {
-	RsslReactorWorker *pReactorWorker = &pReactorImpl->reactorWorker;
+	RsslReactorWorkerThread *pWorkerThread = pReactorImpl->reactorWorker.pWorkerThread;
 
-	if (newTimeoutMicroSeconds < pReactorWorker->sleepTimeMs)
-		pReactorWorker->sleepTimeMs = newTimeoutMicroSeconds;
+	if (newTimeoutMicroSeconds < pWorkerThread->sleepTimeMs)
+		pWorkerThread->sleepTimeMs = newTimeoutMicroSeconds;
 	}
 
 void _reactorWorkerMoveChannel(RsslQueue *pNewList, RsslReactorChannelImpl *pReactorChannel)
@@ -354,301 +391,512 @@ void _reactorWorkerMoveChannel(RsslQueue *pNewList, RsslReactorChannelImpl *pRea
 		rsslQueueAddLinkToBack(pNewList, &pReactorChannel->workerLink);
 }
 
-RSSL_THREAD_DECLARE(runReactorWorker, pArg)
+static RsslRet _reactorWorkerRegisterChannel(RsslReactorImpl *pReactorImpl, RsslReactorChannelImpl *pReactorChannel, RsslUInt8 notifyFlags)
 {
-	RsslReactorImpl *pReactorImpl = (RsslReactorImpl*)pArg;
 	RsslReactorWorker *pReactorWorker = &pReactorImpl->reactorWorker;
-	RsslReactorEventQueue *pEventQueue = &pReactorWorker->workerQueue;
-	int eventQueueFd = rsslGetEventQueueGroupSignalFD(&pReactorWorker->activeEventQueueGroup);
+	RsslNotifierEvent *pEvent = &pReactorChannel->workerNotifierEvent;
+	RsslSocket socketId = pReactorChannel->reactorChannel.pRsslChannel->socketId;
 
-	RsslInt32 activeChannelSize = 0;
+	if (!rsslNotifierEventIsRegistered(pEvent))
+		return rsslNotifierAddEvent(&pReactorWorker->pWorkerThread->notifier, pEvent, socketId, pReactorChannel, notifyFlags, &pReactorChannel->channelWorkerCerr);
 
-	pReactorWorker->sleepTimeMs = 3000;
+	/* The descriptor may have changed since it was registered(e.g. rsslRead() on the reactor thread received an FD_CHANGE). */
+	if (pEvent->fd != socketId
+			&& rsslNotifierUpdateEventFd(&pReactorWorker->pWorkerThread->notifier, pEvent, socketId, &pReactorChannel->channelWorkerCerr) != RSSL_RET_SUCCESS)
+		return RSSL_RET_FAILURE;
 
+	return rsslNotifierUpdateEventFlags(&pReactorWorker->pWorkerThread->notifier, pEvent, notifyFlags, &pReactorChannel->channelWorkerCerr);
+}
 
-	while (1)
+static void _reactorWorkerUnregisterChannel(RsslReactorImpl *pReactorImpl, RsslReactorChannelImpl *pReactorChannel)
+{
+	rsslNotifierRemoveEvent(&pReactorImpl->reactorWorker.pWorkerThread->notifier, &pReactorChannel->workerNotifierEvent);
+}
+
+static RsslRet _reactorWorkerProcessNotifiedChannel(RsslReactorImpl *pReactorImpl, RsslReactorChannelImpl *pReactorChannel, RsslNotifierEvent *pNotifierEvent)
+{
+	RsslReactorWorker *pReactorWorker = &pReactorImpl->reactorWorker;
+	RsslRet ret;
+
+	if (pReactorChannel->workerParentList == &pReactorWorker->initializingChannels)
 	{
-		RsslRet ret;
-		RsslReactorChannelImpl *pReactorChannel;
-		RsslQueueLink *pLink;
+		RsslInProgInfo inProg = RSSL_INIT_IN_PROG_INFO;
 
-		struct timeval selectTime;
-		memcpy(pReactorWorker->useReadFds, pReactorWorker->readFds, pReactorImpl->fdSetSizeInBytes);
-		memcpy(pReactorWorker->useWriteFds, pReactorWorker->writeFds, pReactorImpl->fdSetSizeInBytes);
-		memcpy(pReactorWorker->useExceptFds, pReactorWorker->exceptFds, pReactorImpl->fdSetSizeInBytes);
+		/* Write descriptor is set initially in case this end starts the message hanshakes that rsslInitChannel() performs.
+		 * Once rsslInitChannel() is called for the first time the channel can wait on the read descriptor for more messages.
+		 * We will set the write descriptor again if an FD_CHANGE event occurs. */
+		if (_reactorWorkerRegisterChannel(pReactorImpl, pReactorChannel, RSSL_NOTIFIER_READ | RSSL_NOTIFIER_EXCEPT) != RSSL_RET_SUCCESS)
+			return _reactorWorkerHandleChannelFailure(pReactorImpl, pReactorChannel, &pReactorChannel->channelWorkerCerr);
+
+		ret = rsslInitChannel(pReactorChannel->reactorChannel.pRsslChannel, &inProg, &pReactorChannel->channelWorkerCerr.rsslError);
 
-		selectTime.tv_sec = pReactorWorker->sleepTimeMs / 1000;
-		selectTime.tv_usec = (pReactorWorker->sleepTimeMs - (selectTime.tv_sec * 1000)) * 1000;
 
-		ret = select(pReactorImpl->fdSetSize, pReactorWorker->useReadFds, pReactorWorker->useWriteFds, pReactorWorker->useExceptFds, &selectTime);
+		switch(ret)
+		{
+			case RSSL_RET_CHAN_INIT_IN_PROGRESS:
+				{
+					if (inProg.flags & RSSL_IP_FD_CHANGE)
+					{
+						/* File descriptor changed. Update notifier.
+						 * No need to send an event back -- the application will only get the descriptors when we're done initializing. */
+						if (_reactorWorkerRegisterChannel(pReactorImpl, pReactorChannel, RSSL_NOTIFIER_READ | RSSL_NOTIFIER_WRITE | RSSL_NOTIFIER_EXCEPT) != RSSL_RET_SUCCESS)
+							return _reactorWorkerHandleChannelFailure(pReactorImpl, pReactorChannel, &pReactorChannel->channelWorkerCerr);
+					}
 
-		pReactorWorker->lastRecordedTimeMs = getCurrentTimeMs(pReactorImpl->ticksPerMsec);
+					return RSSL_RET_SUCCESS;
+				}
 
+			case RSSL_RET_SUCCESS:
+				{
+					/* Channel is now active. Its descriptor is removed from the notifier so we don't think we need to flush right away */
+					return _reactorWorkerProcessChannelUp(pReactorImpl, pReactorChannel);
+				}
 
-		if (ret > 0)
+			default:
+				{
+					/* Error */
+					rsslSetErrorInfoLocation(&pReactorChannel->channelWorkerCerr, __FILE__, __LINE__);
+					return _reactorWorkerHandleChannelFailure(pReactorImpl, pReactorChannel, &pReactorChannel->channelWorkerCerr);
+				}
+		}
+	}
+	else if (pReactorChannel->workerParentList == &pReactorWorker->activeChannels
+			&& (pNotifierEvent->revents & RSSL_NOTIFIER_WRITE))
+	{
+		/* Flush */
+		if (pReactorImpl->statisticsEnabled)
+		{
+			RsslInt64 flushStartUsec = getCurrentTimeUsec(pReactorImpl->ticksPerMsec);
+
+			ret = rsslFlush(pReactorChannel->reactorChannel.pRsslChannel, &pReactorChannel->channelWorkerCerr.rsslError);
+			++pReactorChannel->statistics.flushCount;
+			_reactorAddLatency(&pReactorChannel->statistics.flushTime, getCurrentTimeUsec(pReactorImpl->ticksPerMsec) - flushStartUsec);
+		}
+		else
+			ret = rsslFlush(pReactorChannel->reactorChannel.pRsslChannel, &pReactorChannel->channelWorkerCerr.rsslError);
+		pReactorChannel->lastPingSentMs = pReactorWorker->pWorkerThread->lastRecordedTimeMs;
+
+		if (ret < 0)
+		{
+			rsslSetErrorInfoLocation(&pReactorChannel->channelWorkerCerr, __FILE__, __LINE__);
+			return _reactorWorkerHandleChannelFailure(pReactorImpl, pReactorChannel, &pReactorChannel->channelWorkerCerr);
+		}
+		else if (ret == 0)
 		{
-			RSSL_QUEUE_FOR_EACH_LINK(&pReactorWorker->initializingChannels, pLink)
+			/* Can stop flushing now */
+			_reactorWorkerUnregisterChannel(pReactorImpl, pReactorChannel);
+			_reactorWorkerSendFlushComplete(pReactorImpl, pReactorChannel);
+		}
+	}
+
+	return RSSL_RET_SUCCESS;
+}
+
+static RsslRet _reactorWorkerProcessEvent(RsslReactorImpl *pReactorImpl, RsslReactorEventImpl *pEvent)
+{
+	RsslReactorWorker *pReactorWorker = &pReactorImpl->reactorWorker;
+	RsslReactorChannelImpl *pReactorChannel;
+	RsslRet ret;
+
+	switch(pEvent->base.eventType)
+	{
+		case RSSL_RCIMPL_ET_CHANNEL:
+		{
+			RsslReactorChannelEventImpl *pConnEvent = &pEvent->channelEventImpl;
+			pReactorChannel = (RsslReactorChannelImpl*)pConnEvent->channelEvent.pReactorChannel;
+
+			switch(pConnEvent->channelEvent.channelEventType)
 			{
-				pReactorChannel = RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorChannelImpl, workerLink, pLink);
+				case RSSL_RCIMPL_CET_NEW_CHANNEL:
+				{
+					if (!RSSL_ERROR_INFO_CHECK((ret = _reactorWorkerProcessNewChannel(pReactorImpl, pReactorChannel)) == RSSL_RET_SUCCESS, ret, &pReactorWorker->workerCerr))
+						return RSSL_RET_FAILURE;
+					break;
+				}
+				case RSSL_RC_CET_CHANNEL_DOWN:
+				{
+					/* Make sure descriptor is removed */
+					_reactorWorkerUnregisterChannel(pReactorImpl, pReactorChannel);
 
-				if (FD_ISSET(pReactorChannel->reactorChannel.pRsslChannel->socketId, pReactorWorker->useReadFds) ||
-					FD_ISSET(pReactorChannel->reactorChannel.pRsslChannel->socketId, pReactorWorker->useWriteFds) ||
-					FD_ISSET(pReactorChannel->reactorChannel.pRsslChannel->socketId, pReactorWorker->useExceptFds))
+					/* Remove channel from worker's list */
+					_reactorWorkerMoveChannel(&pReactorWorker->inactiveChannels, pReactorChannel);
+
+					break;
+				}
+				case RSSL_RC_CET_CHANNEL_DOWN_RECONNECTING:
 				{
-					RsslInProgInfo inProg = RSSL_INIT_IN_PROG_INFO;
+					_reactorWorkerMoveChannel(&pReactorImpl->reactorWorker.reconnectingChannels, pReactorChannel);
 
-					/* Write descriptor is set initially in case this end starts the message hanshakes that rsslInitChannel() performs. 
-					 * Once rsslInitChannel() is called for the first time the channel can wait on the read descriptor for more messages.  
-					 * We will set the write descriptor again if an FD_CHANGE event occurs. */
-					FD_CLR(pReactorChannel->reactorChannel.pRsslChannel->socketId, pReactorWorker->writeFds);
-					ret = rsslInitChannel(pReactorChannel->reactorChannel.pRsslChannel, &inProg, &pReactorChannel->channelWorkerCerr.rsslError);
+					/* Make sure descriptor is removed */
+					_reactorWorkerUnregisterChannel(pReactorImpl, pReactorChannel);
 
+					if(pReactorChannel->reactorChannel.pRsslChannel != 0)
+					{
+						pReactorChannel->reactorChannel.socketId = REACTOR_INVALID_SOCKET;
 
-					switch(ret)
+						/* Close the channel */
+						/* TODO: Error check? */
+						rsslCloseChannel(pReactorChannel->reactorChannel.pRsslChannel, &(pReactorChannel->channelWorkerCerr.rsslError));
+						pReactorChannel->reactorChannel.pRsslChannel = 0;
+					}
+
+					if(pReactorChannel->reconnectAttemptCount == 0)
 					{
-						case RSSL_RET_CHAN_INIT_IN_PROGRESS:
-							{
-								if (inProg.flags & RSSL_IP_FD_CHANGE)
-								{
-									/* File descriptor changed. Update descriptor set.
-									 * No need to send an event back -- the application will only get the descriptors when we're done initializing. */
-									FD_CLR(inProg.oldSocket, pReactorWorker->exceptFds);
-									FD_CLR(inProg.oldSocket, pReactorWorker->readFds);
-
-									FD_SET(inProg.newSocket, pReactorWorker->readFds);
-									FD_SET(inProg.newSocket, pReactorWorker->exceptFds);
-									FD_SET(inProg.newSocket, pReactorWorker->writeFds);
-								}
-
-								break;
-							}
-
-						case RSSL_RET_SUCCESS:
-							{
-								if (_reactorWorkerProcessChannelUp(pReactorImpl, pReactorChannel) != RSSL_RET_SUCCESS)
-									return (_reactorWorkerShutdown(pReactorImpl, &pReactorWorker->workerCerr), RSSL_THREAD_RETURN());
-								/* Channel is now active. Clear descriptor so we don't think we need to flush right away */
-								FD_CLR(pReactorChannel->reactorChannel.pRsslChannel->socketId, pReactorWorker->useWriteFds);
-								break;
-							}
-
-						default:
-							{
-								/* Error */
-								rsslSetErrorInfoLocation(&pReactorChannel->channelWorkerCerr, __FILE__, __LINE__);
-								if (_reactorWorkerHandleChannelFailure(pReactorImpl, pReactorChannel, &pReactorChannel->channelWorkerCerr) != RSSL_RET_SUCCESS)
-									return (_reactorWorkerShutdown(pReactorImpl, &pReactorWorker->workerCerr), RSSL_THREAD_RETURN());
-								break;
-							}
+						pReactorChannel->reconnectDelay = pReactorChannel->reconnectMinDelay;
+
 					}
-				}
+					else
+					{
+						pReactorChannel->reconnectDelay = 2 * pReactorChannel->reconnectDelay;
 
-			}
+						if(pReactorChannel->reconnectDelay > pReactorChannel->reconnectMaxDelay)
+							pReactorChannel->reconnectDelay = pReactorChannel->reconnectMaxDelay;
+					}
 
-			RSSL_QUEUE_FOR_EACH_LINK(&pReactorWorker->activeChannels, pLink)
-			{
-				pReactorChannel = RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorChannelImpl, workerLink, pLink);
-				if (FD_ISSET(pReactorChannel->reactorChannel.pRsslChannel->socketId, pReactorWorker->useWriteFds))
+					pReactorChannel->reconnectAttemptCount++;
+
+					pReactorChannel->lastReconnectAttemptMs = pReactorWorker->pWorkerThread->lastRecordedTimeMs;
+
+					_reactorWorkerCalculateNextTimeout(pReactorImpl, pReactorChannel->reconnectDelay);
+
+					break;
+
+				}
+				case RSSL_RCIMPL_CET_CLOSE_CHANNEL:
 				{
-					/* Flush */
-					ret = rsslFlush(pReactorChannel->reactorChannel.pRsslChannel, &pReactorChannel->channelWorkerCerr.rsslError);
-					pReactorChannel->lastPingSentMs = pReactorWorker->lastRecordedTimeMs;
+					RsslReactorChannelEventImpl *pEvent = (RsslReactorChannelEventImpl*)rsslReactorEventQueueGetFromPool(&pReactorChannel->eventQueue);
+
+					/* Make sure descriptor is removed */
+					_reactorWorkerUnregisterChannel(pReactorImpl, pReactorChannel);
 
-					if (ret < 0)
+					/* Close RSSL channel */
+					if (!RSSL_ERROR_INFO_CHECK((ret = rsslCloseChannel(pReactorChannel->reactorChannel.pRsslChannel, &pReactorWorker->workerCerr.rsslError)) >= RSSL_RET_SUCCESS, RSSL_RET_FAILURE, &pReactorWorker->workerCerr))
 					{
 						rsslSetErrorInfoLocation(&pReactorChannel->channelWorkerCerr, __FILE__, __LINE__);
-						if (_reactorWorkerHandleChannelFailure(pReactorImpl, pReactorChannel, &pReactorChannel->channelWorkerCerr) != RSSL_RET_SUCCESS)
-						{
-							return (_reactorWorkerShutdown(pReactorImpl, &pReactorWorker->workerCerr), RSSL_THREAD_RETURN());
-						}
+						return RSSL_RET_FAILURE;
 					}
-					else if (ret == 0)
+
+					/* Free connection list */
+					if(pReactorChannel->connectionOptList)
 					{
-						/* Can stop flushing now */
-						FD_CLR(pReactorChannel->reactorChannel.pRsslChannel->socketId, pReactorWorker->writeFds);
-						_reactorWorkerSendFlushComplete(pReactorImpl, pReactorChannel);
+						_rsslChannelFreeConnectionList(pReactorChannel);
 					}
+
+					_reactorWorkerMoveChannel(NULL, pReactorChannel);
+
+					/* Acknowledge that this channel has been closed. */
+					rsslClearReactorChannelEventImpl((RsslReactorChannelEventImpl*)pEvent);
+					pEvent->channelEvent.channelEventType = (RsslReactorChannelEventType)RSSL_RCIMPL_CET_CLOSE_CHANNEL_ACK;
+					pEvent->channelEvent.pReactorChannel = (RsslReactorChannel*)pReactorChannel;
+					pEvent->channelEvent.pError = pConnEvent->channelEvent.pError;
+					if (!RSSL_ERROR_INFO_CHECK(rsslReactorEventQueuePut(&pReactorChannel->eventQueue, (RsslReactorEventImpl*)pEvent) == RSSL_RET_SUCCESS, RSSL_RET_FAILURE, &pReactorWorker->workerCerr))
+						return RSSL_RET_FAILURE;
 				}
+				break;
+				default:
+					rsslSetErrorInfo(&pReactorWorker->workerCerr, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__,
+							"Unknown channel event type %d", pConnEvent->channelEvent.channelEventType);
+					return RSSL_RET_FAILURE;
 			}
 
-			if (FD_ISSET(eventQueueFd, pReactorWorker->useReadFds))
+			return RSSL_RET_SUCCESS;
+		}
+
+		case RSSL_RCIMPL_ET_FLUSH:
+		{
+			RsslReactorFlushEvent *pFlushEvent = &pEvent->flushEvent;
+
+			switch(pFlushEvent->flushEventType)
 			{
-				RsslReactorEventImpl *pEvent;
-				/* Message in event queue */
-				if ((pEvent = rsslReactorEventQueueGet(pEventQueue, &ret)))
+				case RSSL_RCIMPL_FET_START_FLUSH:
+					pReactorChannel = (RsslReactorChannelImpl*)pFlushEvent->pReactorChannel;
+					if (pReactorChannel->workerParentList == &pReactorWorker->activeChannels
+							&& _reactorWorkerRegisterChannel(pReactorImpl, pReactorChannel, RSSL_NOTIFIER_WRITE) != RSSL_RET_SUCCESS)
+						return _reactorWorkerHandleChannelFailure(pReactorImpl, pReactorChannel, &pReactorChannel->channelWorkerCerr);
+					return RSSL_RET_SUCCESS;
+				default:
+					rsslSetErrorInfo(&pReactorWorker->workerCerr, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__,
+							"Unknown flush event type %d", pFlushEvent->flushEventType);
+					return RSSL_RET_FAILURE;
+			}
+		}
+
+		case RSSL_RCIMPL_ET_TIMER:
+		{
+			RsslReactorTimerEvent *pTimerEvent = &pEvent->timerEvent;
+			((RsslReactorChannelImpl*)pTimerEvent->pReactorChannel)->nextExpireTime = pTimerEvent->expireTime;
+			return RSSL_RET_SUCCESS;
+		}
+
+		case RSSL_RCIMPL_ET_REACTOR:
+		{
+			RsslReactorStateEvent *pReactorEvent = &pEvent->reactorEvent;
+
+			switch(pReactorEvent->reactorEventType)
+			{
+				case RSSL_RCIMPL_STET_SHUTDOWN:
+					_reactorWorkerHandleShutdownRequest(pReactorImpl, pReactorEvent->pErrorInfo);
+					return RSSL_RET_SUCCESS;
+				default:
+					rsslSetErrorInfo(&pReactorWorker->workerCerr, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__,
+							"Unknown reactor event type %d", pReactorEvent->reactorEventType);
+					return RSSL_RET_FAILURE;
+			}
+		}
+
+		default:
+		{
+			rsslSetErrorInfo(&pReactorWorker->workerCerr, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Unknown event type %d", pEvent->base.eventType);
+			return RSSL_RET_FAILURE;
+		}
+	}
+}
+
+static RsslRet _reactorWorkerReregisterChannels(RsslReactorImpl *pReactorImpl)
+{
+	RsslReactorWorker *pReactorWorker = &pReactorImpl->reactorWorker;
+	RsslReactorChannelImpl *pReactorChannel;
+	RsslQueueLink *pLink;
+
+	RSSL_QUEUE_FOR_EACH_LINK(&pReactorWorker->activeChannels, pLink)
+	{
+		pReactorChannel = RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorChannelImpl, workerLink, pLink);
+		if (_reactorWorkerRegisterChannel(pReactorImpl, pReactorChannel, RSSL_NOTIFIER_WRITE) != RSSL_RET_SUCCESS
+				&& _reactorWorkerHandleChannelFailure(pReactorImpl, pReactorChannel, &pReactorChannel->channelWorkerCerr) != RSSL_RET_SUCCESS)
+			return RSSL_RET_FAILURE;
+	}
+	RSSL_QUEUE_FOR_EACH_LINK(&pReactorWorker->initializingChannels, pLink)
+	{
+		pReactorChannel = RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorChannelImpl, workerLink, pLink);
+		if (_reactorWorkerRegisterChannel(pReactorImpl, pReactorChannel, RSSL_NOTIFIER_READ | RSSL_NOTIFIER_WRITE | RSSL_NOTIFIER_EXCEPT) != RSSL_RET_SUCCESS
+				&& _reactorWorkerHandleChannelFailure(pReactorImpl, pReactorChannel, &pReactorChannel->channelWorkerCerr) != RSSL_RET_SUCCESS)
+			return RSSL_RET_FAILURE;
+	}
+
+	return RSSL_RET_SUCCESS;
+}
+
+static RsslRet _reactorWorkerProcessTimeouts(RsslReactorImpl *pReactorImpl)
+{
+	RsslReactorWorker *pReactorWorker = &pReactorImpl->reactorWorker;
+	RsslInt64 lastRecordedTimeMs = pReactorWorker->pWorkerThread->lastRecordedTimeMs;
+	RsslReactorChannelImpl *pReactorChannel;
+	RsslQueueLink *pLink;
+	RsslRet ret;
+
+	/* Check whether the initialization time period has passed. */
+	RSSL_QUEUE_FOR_EACH_LINK(&pReactorWorker->initializingChannels, pLink)
+	{
+		pReactorChannel = RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorChannelImpl, workerLink, pLink);
+		if ((lastRecordedTimeMs - pReactorChannel->initializationStartTimeMs) > pReactorChannel->initializationTimeout * 1000)
+		{
+			rsslSetErrorInfo(&pReactorChannel->channelWorkerCerr, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Initialization timed out.");
+			if (_reactorWorkerHandleChannelFailure(pReactorImpl, pReactorChannel, &pReactorChannel->channelWorkerCerr) != RSSL_RET_SUCCESS)
+				return RSSL_RET_FAILURE;
+		}
+		else
+		{
+			_reactorWorkerCalculateNextTimeout(pReactorImpl, (RsslUInt32)(pReactorChannel->initializationStartTimeMs + (pReactorChannel->initializationTimeout * 1000) - lastRecordedTimeMs));
+		}
+	}
+
+	RSSL_QUEUE_FOR_EACH_LINK(&pReactorWorker->activeChannels, pLink)
+	{
+		pReactorChannel = RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorChannelImpl, workerLink, pLink);
+
+		/* If the channel is flushing, make sure the notifier has its current descriptor. Some notifiers(e.g. epoll) silently drop
+		 * descriptors that are closed, such as when rsslRead() on the reactor thread receives an FD_CHANGE. */
+		if (rsslNotifierEventIsRegistered(&pReactorChannel->workerNotifierEvent)
+				&& pReactorChannel->workerNotifierEvent.fd != pReactorChannel->reactorChannel.pRsslChannel->socketId
+				&& _reactorWorkerRegisterChannel(pReactorImpl, pReactorChannel, RSSL_NOTIFIER_WRITE) != RSSL_RET_SUCCESS)
+		{
+			if (_reactorWorkerHandleChannelFailure(pReactorImpl, pReactorChannel, &pReactorChannel->channelWorkerCerr) != RSSL_RET_SUCCESS)
+				return RSSL_RET_FAILURE;
+			continue;
+		}
+
+		if ((lastRecordedTimeMs - pReactorChannel->lastPingSentMs) > pReactorChannel->reactorChannel.pRsslChannel->pingTimeout * 1000 * pingIntervalFactor )
+		{
+			ret = rsslPing(pReactorChannel->reactorChannel.pRsslChannel, &pReactorChannel->channelWorkerCerr.rsslError);
+			if (ret < 0)
+			{
+				rsslSetErrorInfoLocation(&pReactorChannel->channelWorkerCerr, __FILE__, __LINE__);
+				if (!RSSL_ERROR_INFO_CHECK(_reactorWorkerHandleChannelFailure(pReactorImpl, pReactorChannel, &pReactorChannel->channelWorkerCerr) == RSSL_RET_SUCCESS, RSSL_RET_FAILURE, &pReactorWorker->workerCerr))
+					return RSSL_RET_FAILURE;
+			}
+			else
+				pReactorChannel->lastPingSentMs = lastRecordedTimeMs;
+		}
+		else
+		{
+			_reactorWorkerCalculateNextTimeout(pReactorImpl, (RsslUInt32)(pReactorChannel->lastPingSentMs + (RsslInt64)(pReactorChannel->reactorChannel.pRsslChannel->pingTimeout * 1000 * pingIntervalFactor) - lastRecordedTimeMs));
+		}
+
+		/* Process any channels that are waiting for a timeout. */
+		if (pReactorChannel->nextExpireTime != RCIMPL_TIMER_UNSET)
+		{
+			if (pReactorChannel->nextExpireTime < lastRecordedTimeMs)
+			{
+				/* Timer expired for this channel, send event back. */
+				_reactorWorkerSendTimerExpired(pReactorImpl, pReactorChannel, lastRecordedTimeMs);
+			}
+			else
+				_reactorWorkerCalculateNextTimeout(pReactorImpl, (RsslUInt32)(pReactorChannel->nextExpireTime - lastRecordedTimeMs));
+		}
+	}
+
+	RSSL_QUEUE_FOR_EACH_LINK(&pReactorWorker->reconnectingChannels, pLink)
+	{
+		pReactorChannel = RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorChannelImpl, workerLink, pLink);
+
+		if((lastRecordedTimeMs - pReactorChannel->lastReconnectAttemptMs) >= pReactorChannel->reconnectDelay)
+			/* Attempt to reconnect here */
+		{
+
+			pReactorChannel->connectionListIter++;
+
+			if(pReactorChannel->connectionListIter >= pReactorChannel->connectionListCount)
+			{
+				pReactorChannel->connectionListIter = 0;
+			}
+
+			pReactorChannel->reactorChannel.userSpecPtr = pReactorChannel->connectionOptList[pReactorChannel->connectionListIter].rsslConnectOptions.userSpecPtr;
+
+			if (!(pReactorChannel->reactorChannel.pRsslChannel = rsslConnect(&(pReactorChannel->connectionOptList[pReactorChannel->connectionListIter].rsslConnectOptions), &pReactorChannel->channelWorkerCerr.rsslError)))
+			{
+				if (!RSSL_ERROR_INFO_CHECK(_reactorWorkerHandleChannelFailure(pReactorImpl, pReactorChannel, &pReactorChannel->channelWorkerCerr) == RSSL_RET_SUCCESS, RSSL_RET_FAILURE, &pReactorWorker->workerCerr))
+					return RSSL_RET_FAILURE;
+			}
+			else
+			{
+				pReactorChannel->channelSetupState = RSSL_RC_CHST_INIT;
+				pReactorChannel->initializationTimeout = pReactorChannel->connectionOptList[pReactorChannel->connectionListIter].initializationTimeout;
+				if (!RSSL_ERROR_INFO_CHECK((ret = _reactorWorkerProcessNewChannel(pReactorImpl, pReactorChannel)) == RSSL_RET_SUCCESS, ret, &pReactorWorker->workerCerr))
+					return RSSL_RET_FAILURE;
+			}
+	}
+		else
+		{
+			_reactorWorkerCalculateNextTimeout(pReactorImpl, (RsslUInt32)(pReactorChannel->lastReconnectAttemptMs + pReactorChannel->reconnectDelay - lastRecordedTimeMs));
+		}
+	}
+
+	return RSSL_RET_SUCCESS;
+}
+
+static void _reactorWorkerDetach(RsslReactorImpl *pReactorImpl)
+{
+	RsslReactorWorker *pReactorWorker = &pReactorImpl->reactorWorker;
+	RsslQueue *channelLists[4];
+	RsslQueueLink *pLink;
+	int i;
+
+	channelLists[0] = &pReactorWorker->initializingChannels;
+	channelLists[1] = &pReactorWorker->activeChannels;
+	channelLists[2] = &pReactorWorker->inactiveChannels;
+	channelLists[3] = &pReactorWorker->reconnectingChannels;
+
+	/* The channels are about to be freed, so their descriptors must not stay in the shared notifier. */
+	for (i = 0; i < 4; ++i)
+	{
+		RSSL_QUEUE_FOR_EACH_LINK(channelLists[i], pLink)
+			_reactorWorkerUnregisterChannel(pReactorImpl, RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorChannelImpl, workerLink, pLink));
+	}
+
+	rsslReactorEventQueueSetInactive(&pReactorWorker->workerQueue);
+	rsslQueueRemoveLink(&pReactorWorker->pWorkerThread->workers, &pReactorWorker->workerThreadLink);
+}
+
+static RsslBool _reactorWorkerThreadIsDone(RsslReactorWorkerThread *pWorkerThread)
+{
+	RsslBool isDone;
+
+	RSSL_MUTEX_LOCK(&pWorkerThread->activeEventQueueGroup.lock);
+	isDone = rsslQueueGetElementCount(&pWorkerThread->workers) == 0
+		&& rsslQueueGetElementCount(&pWorkerThread->activeEventQueueGroup.readyEventQueueGroup) == 0;
+	RSSL_MUTEX_UNLOCK(&pWorkerThread->activeEventQueueGroup.lock);
+
+	return isDone;
+}
+
+RSSL_THREAD_DECLARE(runReactorWorker, pArg)
+{
+	RsslReactorWorkerThread *pWorkerThread = (RsslReactorWorkerThread*)pArg;
+
+	while (1)
+	{
+		RsslRet ret;
+		RsslReactorImpl *pReactorImpl;
+		RsslQueueLink *pLink;
+		RsslUInt32 i;
+		RsslBool eventQueueReady = RSSL_FALSE;
+
+		ret = rsslNotifierWait(&pWorkerThread->notifier, (RsslInt64)pWorkerThread->sleepTimeMs * 1000);
+
+		pWorkerThread->lastRecordedTimeMs = getCurrentTimeMs(pWorkerThread->ticksPerMsec);
+
+
+		if (ret > 0)
+		{
+			/* Only channels whose descriptors were triggered are visited. */
+			for (i = 0; i < pWorkerThread->notifier.notifiedEventCount; ++i)
+			{
+				RsslNotifierEvent *pNotifierEvent = pWorkerThread->notifier.notifiedEvents[i];
+				RsslReactorChannelImpl *pReactorChannel;
+
+				if (!pNotifierEvent)
+					continue; /* Channel was removed while handling a previous event. */
+
+				if (pNotifierEvent == &pWorkerThread->queueNotifierEvent)
 				{
-					switch(pEvent->base.eventType)
-					{
-						case RSSL_RCIMPL_ET_CHANNEL:
-						{
-							RsslReactorChannelEventImpl *pConnEvent = &pEvent->channelEventImpl;
-							pReactorChannel = (RsslReactorChannelImpl*)pConnEvent->channelEvent.pReactorChannel;
-
-							switch(pConnEvent->channelEvent.channelEventType)
-							{
-								case RSSL_RCIMPL_CET_NEW_CHANNEL:
-								{
-									if (!RSSL_ERROR_INFO_CHECK(_reactorWorkerProcessNewChannel(pReactorImpl, pReactorChannel) == RSSL_RET_SUCCESS, ret, &pReactorWorker->workerCerr))
-										return (_reactorWorkerShutdown(pReactorImpl, &pReactorWorker->workerCerr), RSSL_THREAD_RETURN());
-									break;
-								}
-								case RSSL_RC_CET_CHANNEL_DOWN:
-								{
-									/* Make sure descriptors are cleared */
-									FD_CLR(pReactorChannel->reactorChannel.pRsslChannel->socketId, pReactorWorker->readFds);
-									FD_CLR(pReactorChannel->reactorChannel.pRsslChannel->socketId, pReactorWorker->exceptFds);
-									FD_CLR(pReactorChannel->reactorChannel.pRsslChannel->socketId, pReactorWorker->writeFds);
-
-									/* Remove channel from worker's list */
-									_reactorWorkerMoveChannel(&pReactorWorker->inactiveChannels, pReactorChannel);
-
-									break;
-								}
-								case RSSL_RC_CET_CHANNEL_DOWN_RECONNECTING:
-								{
-									_reactorWorkerMoveChannel(&pReactorImpl->reactorWorker.reconnectingChannels, pReactorChannel);
-
-									if(pReactorChannel->reactorChannel.pRsslChannel != 0)
-									{
-										/* Make sure descriptors are cleared */
-										FD_CLR(pReactorChannel->reactorChannel.pRsslChannel->socketId, pReactorWorker->readFds);
-										FD_CLR(pReactorChannel->reactorChannel.pRsslChannel->socketId, pReactorWorker->exceptFds);
-										FD_CLR(pReactorChannel->reactorChannel.pRsslChannel->socketId, pReactorWorker->writeFds);
-
-										pReactorChannel->reactorChannel.socketId = REACTOR_INVALID_SOCKET;
-
-										/* Close the channel */
-										/* TODO: Error check? */
-										rsslCloseChannel(pReactorChannel->reactorChannel.pRsslChannel, &(pReactorChannel->channelWorkerCerr.rsslError));
-										pReactorChannel->reactorChannel.pRsslChannel = 0;
-									}
-
-									if(pReactorChannel->reconnectAttemptCount == 0)
-									{
-										pReactorChannel->reconnectDelay = pReactorChannel->reconnectMinDelay;
-
-									}
-									else
-									{
-										pReactorChannel->reconnectDelay = 2 * pReactorChannel->reconnectDelay;
-
-										if(pReactorChannel->reconnectDelay > pReactorChannel->reconnectMaxDelay)
-											pReactorChannel->reconnectDelay = pReactorChannel->reconnectMaxDelay;
-									}
-
-									pReactorChannel->reconnectAttemptCount++;
-
-									pReactorChannel->lastReconnectAttemptMs = pReactorImpl->reactorWorker.lastRecordedTimeMs;
-
-									_reactorWorkerCalculateNextTimeout(pReactorImpl, pReactorChannel->reconnectDelay);
-
-									break;
-
-								}
-								case RSSL_RCIMPL_CET_CLOSE_CHANNEL:
-								{
-									RsslReactorChannelEventImpl *pEvent = (RsslReactorChannelEventImpl*)rsslReactorEventQueueGetFromPool(&pReactorChannel->eventQueue);
-									RsslRet ret;
-
-									if ((pReactorChannel->workerParentList != &pReactorWorker->inactiveChannels) && (pReactorChannel->reactorChannel.pRsslChannel != NULL))
-									{
-										/* Make sure descriptors are cleared */
-										FD_CLR(pReactorChannel->reactorChannel.pRsslChannel->socketId, pReactorWorker->readFds);
-										FD_CLR(pReactorChannel->reactorChannel.pRsslChannel->socketId, pReactorWorker->exceptFds);
-										FD_CLR(pReactorChannel->reactorChannel.pRsslChannel->socketId, pReactorWorker->writeFds);
-									}
-
-									/* Close RSSL channel */
-									if (!RSSL_ERROR_INFO_CHECK((ret = rsslCloseChannel(pReactorChannel->reactorChannel.pRsslChannel, &pReactorWorker->workerCerr.rsslError)) >= RSSL_RET_SUCCESS, RSSL_RET_FAILURE, &pReactorWorker->workerCerr))
-									{
-										rsslSetErrorInfoLocation(&pReactorChannel->channelWorkerCerr, __FILE__, __LINE__);
-										return (_reactorWorkerShutdown(pReactorImpl, &pReactorWorker->workerCerr), RSSL_THREAD_RETURN());
-									}
-
-									/* Free connection list */
-									if(pReactorChannel->connectionOptList)
-									{
-										_rsslChannelFreeConnectionList(pReactorChannel);
-									}
-
-									_reactorWorkerMoveChannel(NULL, pReactorChannel);
-
-									/* Acknowledge that this channel has been closed. */
-									rsslClearReactorChannelEventImpl((RsslReactorChannelEventImpl*)pEvent);
-									pEvent->channelEvent.channelEventType = (RsslReactorChannelEventType)RSSL_RCIMPL_CET_CLOSE_CHANNEL_ACK;
-									pEvent->channelEvent.pReactorChannel = (RsslReactorChannel*)pReactorChannel;
-									pEvent->channelEvent.pError = pConnEvent->channelEvent.pError;
-									if (!RSSL_ERROR_INFO_CHECK(rsslReactorEventQueuePut(&pReactorChannel->eventQueue, (RsslReactorEventImpl*)pEvent) == RSSL_RET_SUCCESS, RSSL_RET_FAILURE, &pReactorWorker->workerCerr))
-										return (_reactorWorkerShutdown(pReactorImpl, &pReactorWorker->workerCerr), RSSL_THREAD_RETURN());
-								}
-								break;
-								default:
-									rsslSetErrorInfo(&pReactorWorker->workerCerr, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, 
-											"Unknown channel event type %d", pConnEvent->channelEvent.channelEventType);
-									return (_reactorWorkerShutdown(pReactorImpl, &pReactorWorker->workerCerr), RSSL_THREAD_RETURN());
-							}
-
-							break;
-						}
+					eventQueueReady = RSSL_TRUE;
+					continue;
+				}
 
-						case RSSL_RCIMPL_ET_FLUSH:
-						{
-							RsslReactorFlushEvent *pFlushEvent = &pEvent->flushEvent;
-							
-							switch(pFlushEvent->flushEventType)
-							{
-								case RSSL_RCIMPL_FET_START_FLUSH:
-									pReactorChannel = (RsslReactorChannelImpl*)pFlushEvent->pReactorChannel;
-									FD_SET(pReactorChannel->reactorChannel.pRsslChannel->socketId, pReactorWorker->writeFds);
-									break;
-								default:
-									rsslSetErrorInfo(&pReactorWorker->workerCerr, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, 
-											"Unknown flush event type %d", pFlushEvent->flushEventType);
-									return (_reactorWorkerShutdown(pReactorImpl, &pReactorWorker->workerCerr), RSSL_THREAD_RETURN());
-							}
-							break;
-						}
+				pReactorChannel = (RsslReactorChannelImpl*)pNotifierEvent->object;
+				pReactorImpl = pReactorChannel->pParentReactor;
 
-						case RSSL_RCIMPL_ET_TIMER:
-						{
-							RsslReactorTimerEvent *pTimerEvent = &pEvent->timerEvent;
-							((RsslReactorChannelImpl*)pTimerEvent->pReactorChannel)->nextExpireTime = pTimerEvent->expireTime;
-							break;
-						}
+				if (pReactorImpl->reactorWorker.shutdownRequested)
+					continue;
 
-						case RSSL_RCIMPL_ET_REACTOR:
-						{
-							RsslReactorStateEvent *pReactorEvent = &pEvent->reactorEvent;
-
-							switch(pReactorEvent->reactorEventType)
-							{
-								case RSSL_RCIMPL_STET_SHUTDOWN:
-									_reactorWorkerHandleShutdownRequest(pReactorImpl, pReactorEvent->pErrorInfo);
-									break;
-								case RSSL_RCIMPL_STET_DESTROY:
-									return (_reactorWorkerCleanupReactor(pReactorImpl), RSSL_THREAD_RETURN());
-								default:
-									rsslSetErrorInfo(&pReactorWorker->workerCerr, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, 
-											"Unknown reactor event type %d", pReactorEvent->reactorEventType);
-									return (_reactorWorkerShutdown(pReactorImpl, &pReactorWorker->workerCerr), RSSL_THREAD_RETURN());
-							}
-							break;
-						}
+				if (_reactorWorkerProcessNotifiedChannel(pReactorImpl, pReactorChannel, pNotifierEvent) != RSSL_RET_SUCCESS)
+					_reactorWorkerShutdown(pReactorImpl);
+			}
 
-						default:
+			if (eventQueueReady)
+			{
+				RsslReactorEventQueue *pEventQueue;
+				RsslReactorEventImpl *pEvent;
+
+				/* Message in event queue. The queues of the thread's workers take turns. */
+				if ((pEventQueue = rsslReactorEventQueueGroupShift(&pWorkerThread->activeEventQueueGroup)))
+				{
+					pReactorImpl = (RsslReactorImpl*)((char*)pEventQueue - offsetof(RsslReactorImpl, reactorWorker.workerQueue));
+
+					if ((pEvent = rsslReactorEventQueueGet(pEventQueue, &ret)))
+					{
+						if (pEvent->base.eventType == RSSL_RCIMPL_ET_REACTOR && pEvent->reactorEvent.reactorEventType == RSSL_RCIMPL_STET_ATTACH)
+							rsslQueueAddLinkToBack(&pWorkerThread->workers, &pReactorImpl->reactorWorker.workerThreadLink);
+						else if (pEvent->base.eventType == RSSL_RCIMPL_ET_REACTOR && pEvent->reactorEvent.reactorEventType == RSSL_RCIMPL_STET_DESTROY)
 						{
-							rsslSetErrorInfo(&pReactorWorker->workerCerr, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Unknown event type %d", pEvent->base.eventType);
-							return (_reactorWorkerShutdown(pReactorImpl, &pReactorWorker->workerCerr), RSSL_THREAD_RETURN());
+							if (!pWorkerThread->isShared)
+								return (_reactorWorkerCleanupReactor(pReactorImpl), RSSL_THREAD_RETURN());
+
+							_reactorWorkerDetach(pReactorImpl);
+							_reactorWorkerCleanupReactor(pReactorImpl);
 						}
+						else if (pReactorImpl->reactorWorker.shutdownRequested && pEvent->base.eventType != RSSL_RCIMPL_ET_REACTOR)
+							; /* The reactor is shutting down; its channels are no longer serviced. */
+						else if (_reactorWorkerProcessEvent(pReactorImpl, pEvent) != RSSL_RET_SUCCESS)
+							_reactorWorkerShutdown(pReactorImpl);
 					}
+					else if (!RSSL_ERROR_INFO_CHECK(ret >= RSSL_RET_SUCCESS, ret, &pReactorImpl->reactorWorker.workerCerr))
+						_reactorWorkerShutdown(pReactorImpl);
 				}
-				else if (!RSSL_ERROR_INFO_CHECK(ret >= RSSL_RET_SUCCESS, ret, &pReactorWorker->workerCerr))
-					return (_reactorWorkerShutdown(pReactorImpl, &pReactorWorker->workerCerr), RSSL_THREAD_RETURN());
 			}
 		}
 		else if (ret < 0)
 		{
-			RsslQueueLink *pLink;
 #ifdef WIN32
 			switch(WSAGetLastError())
 #else
@@ -660,27 +908,14 @@ RSSL_THREAD_DECLARE(runReactorWorker, pArg)
 #else
 				case EBADF:
 #endif
-					/* When a bad file descriptor is encountered in the reactorWorker, it is likely because rsslRead() 
-					 * received an FD_CHANGE event. Reset all descriptors and try again. */
-					memset(pReactorWorker->readFds, 0, pReactorImpl->fdSetSizeInBytes);
-					memset(pReactorWorker->writeFds, 0, pReactorImpl->fdSetSizeInBytes);
-					memset(pReactorWorker->exceptFds, 0, pReactorImpl->fdSetSizeInBytes);
-
-					FD_SET(eventQueueFd, pReactorWorker->readFds);
-					FD_SET(eventQueueFd, pReactorWorker->exceptFds);
-
-					/* Set all channel descriptors again, including write descriptors(this may result in extra "flush done" events being sent back). */
-					RSSL_QUEUE_FOR_EACH_LINK(&pReactorWorker->activeChannels, pLink)
-					{
-						pReactorChannel = RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorChannelImpl, workerLink, pLink);
-						FD_SET(pReactorChannel->reactorChannel.pRsslChannel->socketId, pReactorWorker->writeFds);
-					}
-					RSSL_QUEUE_FOR_EACH_LINK(&pReactorWorker->initializingChannels, pLink)
+					/* When a bad file descriptor is encountered in the reactorWorker, it is likely because rsslRead()
+					 * received an FD_CHANGE event. Register all channel descriptors again, including write descriptors
+					 * (this may result in extra "flush done" events being sent back). */
+					RSSL_QUEUE_FOR_EACH_LINK(&pWorkerThread->workers, pLink)
 					{
-						pReactorChannel = RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorChannelImpl, workerLink, pLink);
-						FD_SET(pReactorChannel->reactorChannel.pRsslChannel->socketId, pReactorWorker->writeFds);
-						FD_SET(pReactorChannel->reactorChannel.pRsslChannel->socketId, pReactorWorker->readFds);
-						FD_SET(pReactorChannel->reactorChannel.pRsslChannel->socketId, pReactorWorker->exceptFds);
+						pReactorImpl = RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorImpl, reactorWorker.workerThreadLink, pLink);
+						if (!pReactorImpl->reactorWorker.shutdownRequested && _reactorWorkerReregisterChannels(pReactorImpl) != RSSL_RET_SUCCESS)
+							_reactorWorkerShutdown(pReactorImpl);
 					}
 
 					continue;
@@ -693,137 +928,63 @@ RSSL_THREAD_DECLARE(runReactorWorker, pArg)
 					continue;
 
 				default:
-					rsslSetErrorInfo(&pReactorWorker->workerCerr, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, 
+				{
 #ifdef WIN32
-							"select() failed: %d", WSAGetLastError()
+					int waitError = WSAGetLastError();
 #else
-							"select() failed: %d", errno
+					int waitError = errno;
 #endif
-							);
-					return (_reactorWorkerShutdown(pReactorImpl, &pReactorWorker->workerCerr), RSSL_THREAD_RETURN());
-			}
-		}
-
-		/* Ping/initialization/recovery timeout check */
 
-		pReactorWorker->sleepTimeMs = defaultSelectTimeoutMs;
-
-		/* Check whether the initialization time period has passed. */
-		RSSL_QUEUE_FOR_EACH_LINK(&pReactorWorker->initializingChannels, pLink)
-		{
-			pReactorChannel = RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorChannelImpl, workerLink, pLink);
-			if ((pReactorWorker->lastRecordedTimeMs - pReactorChannel->initializationStartTimeMs) > pReactorChannel->initializationTimeout * 1000)
-			{
-				rsslSetErrorInfo(&pReactorChannel->channelWorkerCerr, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Initialization timed out.");
-				if (_reactorWorkerHandleChannelFailure(pReactorImpl, pReactorChannel, &pReactorChannel->channelWorkerCerr) != RSSL_RET_SUCCESS)
-					return (_reactorWorkerShutdown(pReactorImpl, &pReactorWorker->workerCerr), RSSL_THREAD_RETURN());
-			}
-			else
-			{
-				_reactorWorkerCalculateNextTimeout(pReactorImpl, (RsslUInt32)(pReactorChannel->initializationStartTimeMs + (pReactorChannel->initializationTimeout * 1000) - pReactorWorker->lastRecordedTimeMs));
-			}
-		}
-
-		RSSL_QUEUE_FOR_EACH_LINK(&pReactorWorker->activeChannels, pLink)
-		{
-			pReactorChannel = RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorChannelImpl, workerLink, pLink);
-			if ((pReactorWorker->lastRecordedTimeMs - pReactorChannel->lastPingSentMs) > pReactorChannel->reactorChannel.pRsslChannel->pingTimeout * 1000 * pingIntervalFactor )
-			{
-				ret = rsslPing(pReactorChannel->reactorChannel.pRsslChannel, &pReactorChannel->channelWorkerCerr.rsslError);
-				if (ret < 0)
-				{
-					rsslSetErrorInfoLocation(&pReactorChannel->channelWorkerCerr, __FILE__, __LINE__);
-					if (!RSSL_ERROR_INFO_CHECK(_reactorWorkerHandleChannelFailure(pReactorImpl, pReactorChannel, &pReactorChannel->channelWorkerCerr) == RSSL_RET_SUCCESS, RSSL_RET_FAILURE, &pReactorWorker->workerCerr))
-						return (_reactorWorkerShutdown(pReactorImpl, &pReactorWorker->workerCerr), RSSL_THREAD_RETURN());
-				}
-				else
-					pReactorChannel->lastPingSentMs = pReactorWorker->lastRecordedTimeMs;
-			}
-			else
-			{
-				_reactorWorkerCalculateNextTimeout(pReactorImpl, (RsslUInt32)(pReactorChannel->lastPingSentMs + (RsslInt64)(pReactorChannel->reactorChannel.pRsslChannel->pingTimeout * 1000 * pingIntervalFactor) - pReactorWorker->lastRecordedTimeMs));
-			}
-
-			/* Process any channels that are waiting for a timeout. */
-			if (pReactorChannel->nextExpireTime != RCIMPL_TIMER_UNSET)
-			{
-				if (pReactorChannel->nextExpireTime < pReactorWorker->lastRecordedTimeMs)
-				{
-					/* Timer expired for this channel, send event back. */
-					_reactorWorkerSendTimerExpired(pReactorImpl, pReactorChannel, pReactorWorker->lastRecordedTimeMs);
+					/* The thread cannot continue, so shut down every reactor it serves. */
+					RSSL_QUEUE_FOR_EACH_LINK(&pWorkerThread->workers, pLink)
+					{
+						pReactorImpl = RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorImpl, reactorWorker.workerThreadLink, pLink);
+						rsslSetErrorInfo(&pReactorImpl->reactorWorker.workerCerr, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__,
+								"rsslNotifierWait() failed: %d", waitError);
+						_reactorWorkerShutdown(pReactorImpl);
+					}
+					return RSSL_THREAD_RETURN();
 				}
-				else
-					_reactorWorkerCalculateNextTimeout(pReactorImpl, (RsslUInt32)(pReactorChannel->nextExpireTime - pReactorWorker->lastRecordedTimeMs));
 			}
 		}
 
-		RSSL_QUEUE_FOR_EACH_LINK(&pReactorWorker->reconnectingChannels, pLink)
-		{
-			pReactorChannel = RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorChannelImpl, workerLink, pLink);
-			
-			if((pReactorWorker->lastRecordedTimeMs - pReactorChannel->lastReconnectAttemptMs) >= pReactorChannel->reconnectDelay)
-				/* Attempt to reconnect here */
-			{
-
-				pReactorChannel->connectionListIter++;
-
-				if(pReactorChannel->connectionListIter >= pReactorChannel->connectionListCount)
-				{
-					pReactorChannel->connectionListIter = 0;
-				}
+		/* Ping/initialization/recovery timeout check */
 
-				pReactorChannel->reactorChannel.userSpecPtr = pReactorChannel->connectionOptList[pReactorChannel->connectionListIter].rsslConnectOptions.userSpecPtr;
+		pWorkerThread->sleepTimeMs = defaultSelectTimeoutMs;
 
-				if (!(pReactorChannel->reactorChannel.pRsslChannel = rsslConnect(&(pReactorChannel->connectionOptList[pReactorChannel->connectionListIter].rsslConnectOptions), &pReactorChannel->channelWorkerCerr.rsslError)))
-				{
-					if (!RSSL_ERROR_INFO_CHECK(_reactorWorkerHandleChannelFailure(pReactorImpl, pReactorChannel, &pReactorChannel->channelWorkerCerr) == RSSL_RET_SUCCESS, RSSL_RET_FAILURE, &pReactorWorker->workerCerr))
-						return (_reactorWorkerShutdown(pReactorImpl, &pReactorWorker->workerCerr), RSSL_THREAD_RETURN());
-				}
-				else
-				{
-					pReactorChannel->channelSetupState = RSSL_RC_CHST_INIT;
-					pReactorChannel->initializationTimeout = pReactorChannel->connectionOptList[pReactorChannel->connectionListIter].initializationTimeout;
-					if (!RSSL_ERROR_INFO_CHECK(_reactorWorkerProcessNewChannel(pReactorImpl, pReactorChannel) == RSSL_RET_SUCCESS, ret, &pReactorWorker->workerCerr))
-						return (_reactorWorkerShutdown(pReactorImpl, &pReactorWorker->workerCerr), RSSL_THREAD_RETURN());
-				}
-		}
-			else
-			{
-				_reactorWorkerCalculateNextTimeout(pReactorImpl, (RsslUInt32)(pReactorChannel->lastReconnectAttemptMs + pReactorChannel->reconnectDelay - pReactorWorker->lastRecordedTimeMs));
-			}
+		RSSL_QUEUE_FOR_EACH_LINK(&pWorkerThread->workers, pLink)
+		{
+			pReactorImpl = RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorImpl, reactorWorker.workerThreadLink, pLink);
+			if (!pReactorImpl->reactorWorker.shutdownRequested && _reactorWorkerProcessTimeouts(pReactorImpl) != RSSL_RET_SUCCESS)
+				_reactorWorkerShutdown(pReactorImpl);
 		}
 
+		/* A shared thread stops once its reactor group has destroyed every reactor using it. */
+		if (pWorkerThread->stopping && _reactorWorkerThreadIsDone(pWorkerThread))
+			return RSSL_THREAD_RETURN();
 	}
 }
 
-void _reactorWorkerShutdown(RsslReactorImpl *pReactorImpl, RsslErrorInfo *pErrorInfo)
+static void _reactorWorkerShutdown(RsslReactorImpl *pReactorImpl)
 {
-	RsslReactorStateEvent *pEvent = (RsslReactorStateEvent*)rsslReactorEventQueueGetFromPool(&pReactorImpl->reactorEventQueue);
+	RsslReactorStateEvent *pEvent;
 	RsslReactorWorker *pReactorWorker = &pReactorImpl->reactorWorker;
 
-	/* Send reactor shutdown request to reactor */
-	rsslClearReactorEvent(pEvent);
-	pEvent->reactorEventType = RSSL_RCIMPL_STET_SHUTDOWN;
-	pEvent->pErrorInfo = &pReactorImpl->reactorWorker.workerCerr;
-
-	if (!RSSL_ERROR_INFO_CHECK(rsslReactorEventQueuePut(&pReactorImpl->reactorEventQueue, (RsslReactorEventImpl*)pEvent) == RSSL_RET_SUCCESS, RSSL_RET_FAILURE, &pReactorWorker->workerCerr))
+	if (pReactorWorker->shutdownRequested)
 		return;
 
-	/* Wait for reactor to send back shutdown request */
-	while (RSSL_TRUE)
-	{
-		RsslRet ret;
+	pReactorWorker->shutdownRequested = RSSL_TRUE;
 
-		pEvent = (RsslReactorStateEvent*)rsslReactorEventQueueGet(&pReactorImpl->reactorWorker.workerQueue, &ret);
-		if (!RSSL_ERROR_INFO_CHECK(ret >= RSSL_RET_SUCCESS, ret, &pReactorWorker->workerCerr))
-			return;
+	/* Stop work on the reactor's channels now; the reactor's reply(handled as any other event) has nothing left to do. */
+	_reactorWorkerHandleShutdownRequest(pReactorImpl, &pReactorWorker->workerCerr);
 
-		if (pEvent && pEvent->base.eventType == RSSL_RCIMPL_ET_REACTOR && pEvent->reactorEventType == RSSL_RCIMPL_STET_SHUTDOWN)
-		{
-			_reactorWorkerHandleShutdownRequest(pReactorImpl, pErrorInfo);
-			return;
-		}
-	}
+	/* Send reactor shutdown request to reactor */
+	pEvent = (RsslReactorStateEvent*)rsslReactorEventQueueGetFromPool(&pReactorImpl->reactorEventQueue);
+	rsslClearReactorEvent(pEvent);
+	pEvent->reactorEventType = RSSL_RCIMPL_STET_SHUTDOWN;
+	pEvent->pErrorInfo = &pReactorWorker->workerCerr;
+
+	RSSL_ERROR_INFO_CHECK(rsslReactorEventQueuePut(&pReactorImpl->reactorEventQueue, (RsslReactorEventImpl*)pEvent) == RSSL_RET_SUCCESS, RSSL_RET_FAILURE, &pReactorWorker->workerCerr);
 }
 
 void _reactorWorkerHandleShutdownRequest(RsslReactorImpl *pReactorImpl, RsslErrorInfo *pErrorInfo)
@@ -832,19 +993,23 @@ void _reactorWorkerHandleShutdownRequest(RsslReactorImpl *pReactorImpl, RsslErro
 	RsslReactorWorker *pReactorWorker = &pReactorImpl->reactorWorker;
 	RsslQueueLink *pLink;
 
+	/* Descriptors are removed too, since the thread may keep running for other reactors(and a shutdown reactor's channels
+	 * are no longer flushed). */
 	RSSL_QUEUE_FOR_EACH_LINK(&pReactorWorker->activeChannels, pLink)
 	{
 		pReactorChannel = RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorChannelImpl, workerLink, pLink);
+		_reactorWorkerUnregisterChannel(pReactorImpl, pReactorChannel);
 		_reactorWorkerMoveChannel(&pReactorWorker->inactiveChannels, pReactorChannel);
 	}
 
 	RSSL_QUEUE_FOR_EACH_LINK(&pReactorWorker->initializingChannels, pLink)
 	{
 		pReactorChannel = RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorChannelImpl, workerLink, pLink);
+		_reactorWorkerUnregisterChannel(pReactorImpl, pReactorChannel);
 		_reactorWorkerMoveChannel(&pReactorWorker->inactiveChannels, pReactorChannel);
 	}
 
-	RSSL_QUEUE_FOR_EACH_LINK(&pReactorWorker->inactiveChannels, pLink)
+	RSSL_QUEUE_FOR_EACH_LINK(&pReactorWorker->reconnectingChannels, pLink)
 	{
 		pReactorChannel = RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorChannelImpl, workerLink, pLink);
 		_reactorWorkerMoveChannel(&pReactorWorker->inactiveChannels, pReactorChannel);
@@ -857,19 +1022,18 @@ RsslRet _reactorWorkerProcessNewChannel(RsslReactorImpl *pReactorImpl, RsslReact
 {
 	RsslReactorWorker *pReactorWorker = &pReactorImpl->reactorWorker;
 
-	/* Add channel to descriptor set */
-	FD_SET(pReactorChannel->reactorChannel.pRsslChannel->socketId, pReactorWorker->writeFds);
-
-	
+	/* Add channel to notifier */
+	if (_reactorWorkerRegisterChannel(pReactorImpl, pReactorChannel, RSSL_NOTIFIER_WRITE) != RSSL_RET_SUCCESS)
+		return _reactorWorkerHandleChannelFailure(pReactorImpl, pReactorChannel, &pReactorChannel->channelWorkerCerr);
 
 	switch (pReactorChannel->reactorChannel.pRsslChannel->state)
 	{
 		case RSSL_CH_STATE_INITIALIZING:
 			_reactorWorkerMoveChannel(&pReactorWorker->initializingChannels, pReactorChannel);
 			_reactorWorkerCalculateNextTimeout(pReactorImpl, pReactorChannel->initializationTimeout*1000);
-			pReactorChannel->initializationStartTimeMs = pReactorWorker->lastRecordedTimeMs;
-			FD_SET(pReactorChannel->reactorChannel.pRsslChannel->socketId, pReactorWorker->readFds);
-			FD_SET(pReactorChannel->reactorChannel.pRsslChannel->socketId, pReactorWorker->exceptFds);
+			pReactorChannel->initializationStartTimeMs = pReactorWorker->pWorkerThread->lastRecordedTimeMs;
+			if (_reactorWorkerRegisterChannel(pReactorImpl, pReactorChannel, RSSL_NOTIFIER_READ | RSSL_NOTIFIER_WRITE | RSSL_NOTIFIER_EXCEPT) != RSSL_RET_SUCCESS)
+				return _reactorWorkerHandleChannelFailure(pReactorImpl, pReactorChannel, &pReactorChannel->channelWorkerCerr);
 			return RSSL_RET_SUCCESS;
 		case RSSL_CH_STATE_ACTIVE:
 		{
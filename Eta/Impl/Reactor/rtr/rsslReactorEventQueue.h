@@ -32,7 +32,10 @@ extern "C" {
 typedef struct _RsslReactorEventQueueGroup RsslReactorEventQueueGroup;
 
 /* RsslReactorEventQueue
- * Queue of RsslReactorEvents */
+ * Queue of RsslReactorEvents.
+ * A queue initialized with rsslInitReactorEventRingQueue() passes events through a ring of preallocated
+ * slots instead, and may only have one producer and one consumer at a time (calls from more than one thread
+ * are fine if they are otherwise serialized, e.g. by the reactor's interfaceLock). */
 typedef struct
 {
 	RsslQueue eventPool;
@@ -43,7 +46,18 @@ typedef struct
 
 	RsslReactorEventQueueGroup *pParentGroup;
 	RsslQueueLink readyEventQueueLink;
-	RsslBool isInActiveEventQueueGroup;
+	volatile RsslBool isInActiveEventQueueGroup;
+
+	/* Used by ring queues. In a ring queue, eventPool is used only by the producer, and eventQueue holds 
+	 * events put while the ring was full (no further events are put into the ring until these are read). */
+	RsslBool isRing;
+	RsslReactorEventImpl *ringSlots;
+	RsslUInt32 ringMask;
+	volatile RsslUInt32 ringTail;		/* Written by producer. Next slot to fill. */
+	volatile RsslUInt32 ringHead;		/* Written by consumer. Slots before this one may be filled again. */
+	volatile RsslUInt32 ringReadIndex;	/* Written by consumer. Next slot to read. */
+	volatile RsslUInt32 overflowCount;	/* Number of events in eventQueue. */
+	RsslBool lastEventIsRingSlot;
 } RsslReactorEventQueue;
 
 /* RsslReactorEventQueueGroup
@@ -185,22 +199,56 @@ RTR_C_INLINE RsslRet rsslCleanupReactorEventQueue(RsslReactorEventQueue *pQueue)
 
 	if (pQueue->pLastEvent)
 	{
-		free(pQueue->pLastEvent);
+		if (!pQueue->lastEventIsRingSlot)
+			free(pQueue->pLastEvent);
 		pQueue->pLastEvent = 0;
 	}
 
+	if (pQueue->ringSlots)
+	{
+		free(pQueue->ringSlots);
+		pQueue->ringSlots = NULL;
+	}
+
 	RSSL_MUTEX_DESTROY(&pQueue->eventPoolLock);
 	RSSL_MUTEX_DESTROY(&pQueue->eventQueueLock);
 
 	return RSSL_RET_SUCCESS;
 }
 
+/* rsslInitReactorEventRingQueue 
+ * Initializes an RsslReactorEventQueue as a single-producer/single-consumer ring.
+ * ringSize is rounded up to a power of two. */
+RTR_C_INLINE RsslRet rsslInitReactorEventRingQueue(RsslReactorEventQueue *pQueue, RsslUInt32 ringSize, RsslReactorEventQueueGroup *pParentGroup)
+{
+	RsslRet ret;
+	RsslUInt32 slotCount = 1;
+
+	if ((ret = rsslInitReactorEventQueue(pQueue, 1, pParentGroup)) != RSSL_RET_SUCCESS)
+		return ret;
+
+	while (slotCount < ringSize)
+		slotCount <<= 1;
+
+	if (!(pQueue->ringSlots = (RsslReactorEventImpl*)malloc(slotCount * sizeof(RsslReactorEventImpl))))
+	{
+		rsslCleanupReactorEventQueue(pQueue);
+		return RSSL_RET_FAILURE;
+	}
+
+	pQueue->ringMask = slotCount - 1;
+	pQueue->isRing = RSSL_TRUE;
+
+	return RSSL_RET_SUCCESS;
+}
+
 RTR_C_INLINE RsslReactorEventImpl *rsslReactorEventQueueGetFromPool(RsslReactorEventQueue *pQueue)
 {
 	RsslReactorEventImpl *pEvent;
 	RsslQueueLink *pLink;
 
-	RSSL_MUTEX_LOCK(&pQueue->eventPoolLock);
+	/* A ring queue's pool is only used by its producer. */
+	if (!pQueue->isRing) RSSL_MUTEX_LOCK(&pQueue->eventPoolLock);
 	if ( (pLink = rsslQueueRemoveFirstLink(&pQueue->eventPool)))
 		pEvent = RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorEventImpl, base.eventQueueLink, pLink);
 	else
@@ -212,7 +260,7 @@ RTR_C_INLINE RsslReactorEventImpl *rsslReactorEventQueueGetFromPool(RsslReactorE
 			rsslInitQueueLink(&pEvent->base.eventQueueLink);
 		}
 	}
-	RSSL_MUTEX_UNLOCK(&pQueue->eventPoolLock);
+	if (!pQueue->isRing) RSSL_MUTEX_UNLOCK(&pQueue->eventPoolLock);
 
 	return pEvent;
 }
@@ -221,15 +269,165 @@ RTR_C_INLINE RsslReactorEventImpl *rsslReactorEventQueueGetFromPool(RsslReactorE
 /* This should not be run if the event has alredy been placed into an event queue. */
 RTR_C_INLINE void rsslReactorEventQueueReturnToPool(RsslReactorEventImpl *pEvent, RsslReactorEventQueue *pQueue)
 {
-	RSSL_MUTEX_LOCK(&pQueue->eventPoolLock);
+	if (!pQueue->isRing) RSSL_MUTEX_LOCK(&pQueue->eventPoolLock);
 	rsslQueueAddLinkToBack(&pQueue->eventPool, &pEvent->base.eventQueueLink);
-	RSSL_MUTEX_UNLOCK(&pQueue->eventPoolLock);
+	if (!pQueue->isRing) RSSL_MUTEX_UNLOCK(&pQueue->eventPoolLock);
+}
+
+/* Adds a ring queue to its parent's list of active queues, if it is not already there.
+ * Called by the producer, with the parent group's lock held, before it publishes an event. */
+RTR_C_INLINE RsslRet _rsslReactorEventRingQueueSetActive(RsslReactorEventQueue *pQueue)
+{
+	if (pQueue->isInActiveEventQueueGroup)
+		return RSSL_RET_SUCCESS;
+
+	/* Add to parent list of active queues */
+	rsslQueueAddLinkToBack(&pQueue->pParentGroup->readyEventQueueGroup, &pQueue->readyEventQueueLink);
+	pQueue->isInActiveEventQueueGroup = RSSL_TRUE;
+
+	if (rsslQueueGetElementCount(&pQueue->pParentGroup->readyEventQueueGroup) == 1)
+	{
+		/* List was previously empty; Need to trigger queue list descriptor */
+		if (rsslSetEventSignal(&pQueue->pParentGroup->eventSignal) < 0)
+			return RSSL_RET_FAILURE;
+	}
+
+	return RSSL_RET_SUCCESS;
+}
+
+/* Removes a ring queue from its parent's list of active queues.
+ * Called by the consumer when it has read everything in the queue. */
+RTR_C_INLINE RsslRet _rsslReactorEventRingQueueSetInactive(RsslReactorEventQueue *pQueue)
+{
+	RSSL_MUTEX_LOCK(&pQueue->pParentGroup->lock);
+
+	/* The producer publishes events under this lock, so any event it published since the consumer last looked is seen here. */
+	if (pQueue->isInActiveEventQueueGroup && pQueue->ringTail == pQueue->ringReadIndex && pQueue->overflowCount == 0)
+	{
+		rsslQueueRemoveLink(&pQueue->pParentGroup->readyEventQueueGroup, &pQueue->readyEventQueueLink);
+		pQueue->isInActiveEventQueueGroup = RSSL_FALSE;
+
+		if (rsslQueueGetElementCount(&pQueue->pParentGroup->readyEventQueueGroup) == 0)
+		{
+			/* List is now empty; need to reset queue list descriptor */
+			if (rsslResetEventSignal(&pQueue->pParentGroup->eventSignal) < 0)
+				return (RSSL_MUTEX_UNLOCK(&pQueue->pParentGroup->lock), RSSL_RET_FAILURE);
+		}
+	}
+
+	RSSL_MUTEX_UNLOCK(&pQueue->pParentGroup->lock);
+	return RSSL_RET_SUCCESS;
+}
+
+RTR_C_INLINE RsslRet _rsslReactorEventRingQueuePut(RsslReactorEventQueue *pQueue, RsslReactorEventImpl *pEvent)
+{
+	RsslUInt32 tail = pQueue->ringTail;
+	RsslMutex *pGroupLock = &pQueue->pParentGroup->lock;
+	RsslRet ret;
+
+	/* Once the consumer can see the event, it may free the queue(e.g. after a destroy event). So the queue is made active 
+	 * first, and nothing in it is touched after the event is published. The consumer removes an empty queue from the group
+	 * under the same lock, so it either sees the new event or the queue is added back afterwards. */
+	if (pQueue->overflowCount == 0 && tail - pQueue->ringHead <= pQueue->ringMask)
+	{
+		/* Copy the event into the ring, and keep the original for reuse. */
+		memcpy(&pQueue->ringSlots[tail & pQueue->ringMask], pEvent, sizeof(RsslReactorEventImpl));
+		rsslQueueAddLinkToBack(&pQueue->eventPool, &pEvent->base.eventQueueLink);
+
+		RSSL_MUTEX_LOCK(pGroupLock);
+		ret = _rsslReactorEventRingQueueSetActive(pQueue);
+
+		RSSL_MEMORY_BARRIER();
+		pQueue->ringTail = tail + 1;
+		RSSL_MUTEX_UNLOCK(pGroupLock);
+	}
+	else
+	{
+		/* Ring is full(or still has older events waiting in eventQueue); add the event to eventQueue. */
+		RSSL_MUTEX_LOCK(pGroupLock);
+		ret = _rsslReactorEventRingQueueSetActive(pQueue);
+
+		RSSL_MUTEX_LOCK(&pQueue->eventQueueLock);
+		rsslQueueAddLinkToBack(&pQueue->eventQueue, &pEvent->base.eventQueueLink);
+		++pQueue->overflowCount;
+		RSSL_MUTEX_UNLOCK(&pQueue->eventQueueLock);
+		RSSL_MUTEX_UNLOCK(pGroupLock);
+	}
+
+	return ret;
+}
+
+RTR_C_INLINE RsslReactorEventImpl* _rsslReactorEventRingQueueGet(RsslReactorEventQueue *pQueue, RsslRet *pRet)
+{
+	RsslReactorEventImpl *pEvent = NULL;
+	RsslUInt32 readIndex = pQueue->ringReadIndex;
+	RsslUInt32 tail;
+
+	if (pQueue->pLastEvent)
+	{
+		/* Release the previous event. */
+		if (pQueue->lastEventIsRingSlot)
+		{
+			RSSL_MEMORY_BARRIER();
+			pQueue->ringHead = readIndex;
+		}
+		else
+			free(pQueue->pLastEvent);
+
+		pQueue->pLastEvent = 0;
+	}
+
+	tail = pQueue->ringTail;
+	RSSL_MEMORY_BARRIER();
+
+	if (readIndex == tail && pQueue->overflowCount > 0)
+	{
+		RsslQueueLink *pLink;
+
+		/* Events in eventQueue were put after any in the ring, so check the ring once more now that we hold the lock. */
+		RSSL_MUTEX_LOCK(&pQueue->eventQueueLock);
+		tail = pQueue->ringTail;
+		if (readIndex == tail && (pLink = rsslQueueRemoveFirstLink(&pQueue->eventQueue)))
+		{
+			pEvent = RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorEventImpl, base.eventQueueLink, pLink);
+			--pQueue->overflowCount;
+			pQueue->lastEventIsRingSlot = RSSL_FALSE;
+		}
+		RSSL_MUTEX_UNLOCK(&pQueue->eventQueueLock);
+	}
+
+	if (!pEvent && readIndex != tail)
+	{
+		pEvent = &pQueue->ringSlots[readIndex & pQueue->ringMask];
+		pQueue->ringReadIndex = ++readIndex;
+		pQueue->lastEventIsRingSlot = RSSL_TRUE;
+	}
+
+	pQueue->pLastEvent = pEvent;
+
+	if (readIndex == pQueue->ringTail && pQueue->overflowCount == 0)
+	{
+		/* Nothing more to read. */
+		if (_rsslReactorEventRingQueueSetInactive(pQueue) != RSSL_RET_SUCCESS)
+		{
+			*pRet = RSSL_RET_FAILURE;
+			return NULL;
+		}
+		*pRet = 0;
+	}
+	else
+		*pRet = 1;
+
+	return pEvent;
 }
 
 RTR_C_INLINE RsslRet rsslReactorEventQueuePut(RsslReactorEventQueue *pQueue, RsslReactorEventImpl *pEvent)
 {
 	RsslUInt32 count;
 
+	if (pQueue->isRing)
+		return _rsslReactorEventRingQueuePut(pQueue, pEvent);
+
 	RSSL_MUTEX_LOCK(&pQueue->eventQueueLock);
 
 	rsslQueueAddLinkToBack(&pQueue->eventQueue, &pEvent->base.eventQueueLink);
@@ -281,6 +479,9 @@ RTR_C_INLINE RsslReactorEventImpl* rsslReactorEventQueueGet(RsslReactorEventQueu
 	RsslReactorEventImpl *pEvent;
 	RsslQueueLink *pLink;
 
+	if (pQueue->isRing)
+		return _rsslReactorEventRingQueueGet(pQueue, pRet);
+
 	if (pQueue->pLastEvent)
 	{
 		/* Return previous event to pool */
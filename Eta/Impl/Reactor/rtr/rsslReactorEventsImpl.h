@@ -93,7 +93,8 @@ typedef enum
 {
 	RSSL_RCIMPL_STET_INIT = 0,
 	RSSL_RCIMPL_STET_SHUTDOWN = -1,
-	RSSL_RCIMPL_STET_DESTROY = -2
+	RSSL_RCIMPL_STET_DESTROY = -2,
+	RSSL_RCIMPL_STET_ATTACH = -3	/* Sent to the worker thread when the reactor is created, to add the reactor's worker to it. */
 } RsslReactorStateEventType;
 
 typedef struct
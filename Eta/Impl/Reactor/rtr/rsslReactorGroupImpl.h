@@ -0,0 +1,76 @@
+/*
+ * This source code is provided under the Apache 2.0 license and is provided
+ * AS IS with no warranty or guarantee of fit for purpose.  See the project's
+ * LICENSE.md for details.
+ * Copyright Thomson Reuters 2015. All rights reserved.
+*/
+
+#ifndef _RTR_RSSL_REACTOR_GROUP_IMPL_H
+#define _RTR_RSSL_REACTOR_GROUP_IMPL_H
+
+#include "rtr/rsslReactorImpl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct _RsslReactorGroupImpl RsslReactorGroupImpl;
+
+/* RsslReactorGroupThread
+ * Dispatches one reactor of the group. Only this thread calls rsslReactorDispatch() on its reactor,
+ * so callbacks for the reactor's channels are always called from it. */
+typedef struct
+{
+	RsslReactorGroupImpl	*pReactorGroupImpl;
+	RsslReactorImpl			*pReactorImpl;
+	RsslThreadId			thread;
+	RsslBool				threadStarted;
+
+	RsslRet					dispatchRet;	/* Failure returned by rsslReactorDispatch(), if the thread stopped because of one. */
+	RsslErrorInfo			errorInfo;
+	volatile RsslBool		stopped;		/* Set once the thread has stopped because of a failure; no channels are added to its reactor. */
+} RsslReactorGroupThread;
+
+/* RsslReactorGroupImpl
+ * The reactor group. Each thread owns its reactor; the group only adds channels to them and stops the threads.
+ * The reactors share one worker thread, which the group starts before creating them and stops after destroying them. */
+struct _RsslReactorGroupImpl
+{
+	RsslReactorGroup		reactorGroup;		/* Public-facing reactor group object */
+
+	RsslReactorGroupThread	*threads;
+	RsslUInt32				threadCount;
+
+	RsslReactorWorkerThread	workerThread;		/* Runs the workers of all of the group's reactors. */
+	RsslBool				workerThreadStarted;
+
+	RsslMutex				assignLock;			/* Protects nextThread, for round-robin assignment. */
+	RsslUInt32				nextThread;
+
+	RsslUInt32				maxMessages;
+	RsslUInt32				dispatchWaitTimeout;	/* Microseconds. */
+	RsslReactorGroupThreadFailureCallback	*threadFailureCallback;
+	volatile RsslBool		stopping;			/* Set when the group is being destroyed. */
+};
+
+/* Dispatch thread function */
+RSSL_THREAD_DECLARE(runReactorGroupThread, pArg);
+
+/* Waits for activity on the thread's reactor, for up to the group's dispatchWaitTimeout. */
+static void _reactorGroupThreadWait(RsslReactorGroupThread *pThread);
+
+/* Binds a started dispatch thread to the given CPU. */
+static RsslRet _reactorGroupBindThread(RsslReactorGroupThread *pThread, RsslInt32 cpuId, RsslErrorInfo *pError);
+
+/* Chooses the reactor that will handle a new channel, skipping reactors whose thread has stopped. Returns NULL if all have stopped. */
+static RsslReactor *_reactorGroupSelectReactor(RsslReactorGroupImpl *pReactorGroupImpl, RsslInt32 threadHint, RsslErrorInfo *pError);
+
+/* Stops and joins the dispatch threads, then destroys the reactors and the group. Reports the failure of the first thread
+ * that stopped because of one, if any. */
+static RsslRet _reactorGroupCleanup(RsslReactorGroupImpl *pReactorGroupImpl, RsslErrorInfo *pError);
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif
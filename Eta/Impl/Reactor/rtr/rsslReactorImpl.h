@@ -17,6 +17,7 @@
 
 #include "rtr/rsslQueue.h"
 #include "rtr/rsslThread.h"
+#include "rtr/rsslNotifier.h"
 #include "rtr/rsslReactorUtils.h"
 #include "rtr/tunnelManager.h"
 
@@ -60,16 +61,39 @@ typedef struct
 	RsslReactorEventQueue eventQueue;
 	RsslInt64 lastPingReadMs;
 	RsslRet readRet;				/* Last return code from rsslRead on this channel. Helps determine whether data can still be read from this channel. */
+	RsslBool readWouldBlock;		/* Indicates whether the last rsslRead() on this channel returned RSSL_RET_READ_WOULD_BLOCK(readRet is reset to 0 in that case). */
+	RsslInt64 lastDataReadMs;		/* Time data(not a ping) was last read from this channel. Used to stop busy-polling. */
 	RsslRet writeRet;				/* Last return from rsslWrite() for this channel. Helps determine whether we should request a flush. */
 	RsslBool requestedFlush;		/* Indicates whether flushing is signaled for this channel */
 	RsslWatchlist *pWatchlist;
 	RsslBool	wlDispatchEventQueued;
 	RsslBool	tunnelDispatchEventQueued;
+	RsslNotifierEvent notifierEvent;	/* Registers this channel's descriptor with the reactor's notifier while active. */
+	RsslQueueLink readyChannelLink;
+	RsslBool	inReadyChannels;		/* Indicates whether this channel is in the reactor's readyChannels list. */
+	RsslUInt32	busyPollIdleTimeout;	/* Time(in milliseconds) the channel is busy-polled after last receiving data. 0 if busy-polling is off. */
+	RsslBool	busyPolling;			/* Indicates whether the channel is being busy-polled(kept on the ready list even when nothing was read). */
 
 	RsslRDMMsg rdmMsg;				/* The typed message that has been decoded */
+	RsslMsg *pLazyRDMMsg;			/* Message the current callback may decode on request(see RsslCreateReactorOptions.lazyRDMDecoding). */
 	RsslReactorChannelSetupState channelSetupState;
 	RsslBuffer *pWriteCallAgainBuffer; /* Used when WRITE_CALL_AGAIN is returned from an internal rsslReactorSubmit() call. */
 
+	/* Message packing (see RsslReactorConnectOptions.packingBufferSize) */
+	RsslUInt32 packingBufferSize;		/* Packed buffer size requested by the application. 0 if packing is off. */
+	RsslUInt32 packingMaxLatency;		/* Time(in milliseconds) a message may wait in pPackedBuffer. */
+	RsslUInt32 packedBufferMaxSize;		/* packingBufferSize, limited to the RsslChannel's maxFragmentSize. 0 until first needed for the current RsslChannel. */
+	RsslBuffer *pPackedBuffer;			/* Packed buffer currently being filled, if any. */
+	RsslUInt32 packedBufferMsgCount;	/* Number of messages in pPackedBuffer. */
+	RsslInt64 packedBufferExpireTime;	/* Time at which pPackedBuffer should be written. */
+	RsslUInt64 packedMsgCount;			/* Total messages written in packed buffers. */
+	RsslUInt64 packedBufferCount;		/* Total packed buffers written. */
+
+	/* Statistics (see RsslCreateReactorOptions.enableChannelStatistics) */
+	RsslReactorChannelStatistics statistics;			/* Running totals. The flush counts and times are updated by the worker thread. */
+	RsslReactorChannelStatistics statisticsBaseline;	/* Totals at the last reset. Totals are never cleared, so that the worker's updates are not lost. */
+	RsslUInt64 lastDispatchSeq;							/* The reactor's dispatchSeq when this channel was last read. */
+
 	RsslReactorChannelRole channelRole;
 
 	/* When a consumer connection is using the downloadDictionaries feature, store the streamID's used for requesting field & enum type dictionaries. */
@@ -79,6 +103,7 @@ typedef struct
 	/* Worker thread only */
 	RsslQueueLink workerLink;
 	RsslQueue *workerParentList;
+	RsslNotifierEvent workerNotifierEvent;	/* Registers this channel's descriptor with the worker's notifier while initializing or flushing. */
 	RsslInt64 lastPingSentMs;
 	RsslErrorInfo channelWorkerCerr;
 	RsslInt64 lastRequestedExpireTime;
@@ -102,6 +127,9 @@ RTR_C_INLINE void rsslClearReactorChannelImpl(RsslReactorImpl *pReactorImpl, Rss
 {
 	memset(pInfo, 0, sizeof(RsslReactorChannelImpl));
 	pInfo->pParentReactor = pReactorImpl;
+	rsslClearNotifierEvent(&pInfo->notifierEvent);
+	rsslClearNotifierEvent(&pInfo->workerNotifierEvent);
+	rsslInitQueueLink(&pInfo->readyChannelLink);
 	pInfo->nextExpireTime = RCIMPL_TIMER_UNSET;
 	pInfo->lastRequestedExpireTime = RCIMPL_TIMER_UNSET;
 }
@@ -190,9 +218,12 @@ RTR_C_INLINE void rsslResetReactorChannelState(RsslReactorImpl *pReactorImpl, Rs
 	pReactorChannel->channelSetupState = RSSL_RC_CHST_INIT;
 	pReactorChannel->lastPingReadMs = 0;
 	pReactorChannel->readRet = 0;
+	pReactorChannel->readWouldBlock = RSSL_FALSE;
+	pReactorChannel->lastDataReadMs = 0;
 	pReactorChannel->lastPingSentMs = 0;
 	pReactorChannel->writeRet = 0;
 	pReactorChannel->pWriteCallAgainBuffer = 0;
+	pReactorChannel->packedBufferMaxSize = 0;
 }
 
 
@@ -207,6 +238,17 @@ RTR_C_INLINE void rsslResetReactorChannel(RsslReactorImpl *pReactorImpl, RsslRea
 	pReactorChannel->workerParentList = 0;
 	pReactorChannel->lastReconnectAttemptMs = 0;
 	pReactorChannel->reconnectAttemptCount = 0;
+	pReactorChannel->packingBufferSize = 0;
+	pReactorChannel->busyPollIdleTimeout = 0;
+	pReactorChannel->busyPolling = RSSL_FALSE;
+	pReactorChannel->pPackedBuffer = NULL;
+	pReactorChannel->packedBufferMsgCount = 0;
+	pReactorChannel->packedMsgCount = 0;
+	pReactorChannel->packedBufferCount = 0;
+	pReactorChannel->pLazyRDMMsg = NULL;
+	rsslClearReactorChannelStatistics(&pReactorChannel->statistics);
+	rsslClearReactorChannelStatistics(&pReactorChannel->statisticsBaseline);
+	pReactorChannel->lastDispatchSeq = 0;
 
 	pReactorChannel->connectionListCount = 0;
 	pReactorChannel->connectionListIter = 0;
@@ -233,6 +275,27 @@ RsslRet reactorLockInterface(RsslReactorImpl *pReactorImpl, RsslBool allowedInCa
 /* Unlocks reactor */
 RsslRet reactorUnlockInterface(RsslReactorImpl *pReactorImpl);
 
+/* RsslReactorWorkerThread
+ * Runs the workers of one or more reactors. A reactor normally has its own; the reactors of a reactor group
+ * share the group's(see rsslCreateReactorGroup()), so that the group needs only one worker thread and one event signal.
+ * Workers are added to and removed from the thread by events on their queues, so only the thread itself touches its list of workers. */
+typedef struct
+{
+	RsslThreadId thread;
+	RsslBool isShared;						/* Owned by a reactor group rather than by a reactor. */
+	volatile RsslBool stopping;				/* Set by the owning reactor group once its reactors are destroyed. */
+
+	RsslNotifier notifier;					/* Notifies the thread of channels that are initializing or need flushing. */
+	RsslNotifierEvent queueNotifierEvent;	/* Registers the descriptor of activeEventQueueGroup. */
+	RsslReactorEventQueueGroup activeEventQueueGroup;	/* Event queues of the workers run by this thread. */
+
+	RsslQueue workers;						/* Workers run by this thread. */
+
+	RsslInt64 ticksPerMsec;
+	RsslInt64 lastRecordedTimeMs;
+	RsslUInt32 sleepTimeMs; /* Time to sleep when not flushing; should be equivalent to 1/3 of smallest ping timeout. */
+} RsslReactorWorkerThread;
+
 /* RsslReactorWorker
  * The reactorWorker handles when to send pings and flushing.
  * Primary responsiblities include:
@@ -248,17 +311,14 @@ typedef struct
 	RsslQueue inactiveChannels;			/* Channels that have failed in some way */
 	RsslQueue reconnectingChannels;
 
-	fd_set *readFds, *writeFds, *exceptFds;
-	fd_set *useReadFds, *useWriteFds, *useExceptFds;
+	RsslReactorWorkerThread *pWorkerThread;	/* Thread running this worker. */
+	RsslQueueLink workerThreadLink;			/* Link in the thread's list of workers. */
 
-	RsslInt64 lastRecordedTimeMs;
-
-	RsslThreadId thread;
 	RsslReactorEventQueue workerQueue;
-	RsslUInt32 sleepTimeMs; /* Time to sleep when not flushing; should be equivalent to 1/3 of smallest ping timeout. */
 
 	RsslErrorInfo workerCerr;
-	RsslReactorEventQueueGroup activeEventQueueGroup;
+	RsslBool shutdownRequested;				/* The worker failed and asked the reactor to shut down. Until the reactor is destroyed,
+											 * only reactor events are processed for it. */
 } RsslReactorWorker;
 
 typedef enum
@@ -269,6 +329,9 @@ typedef enum
 	RSSL_REACTOR_ST_SHUT_DOWN = 3 /* Reactor has shutdown */
 } RsslReactorState;
 
+/* Largest size the reactor's memory buffer for decoding RDM structures may grow to. */
+#define RSSL_REACTOR_MAX_DECODE_MEMORY_SIZE (64 * 1024 * 1024)
+
 /* RsslReactorImpl
  * The Reactor handles reading messages and commands from the application.
  * Primary responsiblities include:
@@ -292,11 +355,14 @@ struct _RsslReactorImpl
 	RsslThreadId thread;
 
 	RsslReactorEventQueue reactorEventQueue;
-	unsigned int fdSetSize;
-	unsigned int fdSetSizeInBytes;
-	fd_set *readFds, *exceptFds;
-	fd_set *useReadFds, *useExceptFds;
-	RsslBuffer memoryBuffer;
+	RsslNotifierType notifierType;			/* Mechanism used by the reactor and worker notifiers. */
+	RsslNotifier notifier;					/* Notifies the reactor of active channels that have data to read. */
+	RsslNotifierEvent queueNotifierEvent;	/* Registers the reactor's event queue descriptor. */
+	RsslQueue readyChannels;				/* Active channels known to have data to read, in round-robin order. */
+	RsslUInt32 busyPollChannelCount;		/* Number of active channels being busy-polled. */
+	RsslInt64 nextPingTimeoutCheckMs;		/* Next time to check channels that have not been ready for a ping timeout. */
+	RsslBuffer memoryBuffer;				/* Memory for decoding RDM structures. Starts at dispatchDecodeMemoryBufferSize and grows as needed. */
+	RsslBool lazyRDMDecoding;				/* Leave RDM decoding to the domain callbacks(see RsslCreateReactorOptions.lazyRDMDecoding). */
 
 	RsslInt64 lastRecordedTimeMs;
 
@@ -309,10 +375,15 @@ struct _RsslReactorImpl
 	RsslReactorEventQueueGroup activeEventQueueGroup;
 
 	RsslReactorWorker reactorWorker;						/* The reactor's worker */
+	RsslReactorWorkerThread workerThread;					/* Runs reactorWorker, unless the reactor belongs to a reactor group. */
 	RsslInt32 dispatchDecodeMemoryBufferSize;					/* The size to allocate for the temporary decoding block. This is used for decoding to the RDM structures. */
 	RsslReactorState state;
 
 	RsslInt64 ticksPerMsec;
+
+	RsslBool statisticsEnabled;		/* Channel statistics are kept (see RsslCreateReactorOptions.enableChannelStatistics). */
+	RsslUInt64 dispatchSeq;			/* Counts calls to rsslReactorDispatch(), to count the dispatches that read from each channel. */
+	RsslInt64 callbackStartUsec;	/* Time at which the current callback was called. */
 };
 
 RTR_C_INLINE void rsslClearReactorImpl(RsslReactorImpl *pReactorImpl)
@@ -320,8 +391,34 @@ RTR_C_INLINE void rsslClearReactorImpl(RsslReactorImpl *pReactorImpl)
 	memset(pReactorImpl, 0, sizeof(RsslReactorImpl));
 }
 
-/* Setup and start the worker thread (Should be called from rsslCreateReactor) */
-RsslRet _reactorWorkerStart(RsslReactorImpl *pReactorImpl, RsslCreateReactorOptions *pReactorOptions, RsslErrorInfo *pError);
+/* Adds a measured time to a histogram. */
+RTR_C_INLINE void _reactorAddLatency(RsslReactorLatencyHistogram *pHistogram, RsslInt64 usec)
+{
+	RsslUInt32 bucket = 0;
+	RsslInt64 remaining;
+
+	if (usec < 0)
+		usec = 0;
+
+	for (remaining = usec; remaining > 0 && bucket < RSSL_RC_LATENCY_HISTOGRAM_BUCKETS - 1; remaining >>= 1)
+		++bucket;
+
+	++pHistogram->count;
+	pHistogram->totalUsec += (RsslUInt64)usec;
+	++pHistogram->buckets[bucket];
+}
+
+/* Creates a reactor. If pSharedWorkerThread is set, the reactor's worker is run by that thread instead of one of its own. */
+RsslReactor *_reactorCreate(RsslCreateReactorOptions *pReactorOpts, RsslReactorWorkerThread *pSharedWorkerThread, RsslErrorInfo *pError);
+
+/* Setup the reactor's worker, starting its own worker thread unless pSharedWorkerThread is set (Should be called from rsslCreateReactor) */
+RsslRet _reactorWorkerStart(RsslReactorImpl *pReactorImpl, RsslCreateReactorOptions *pReactorOptions, RsslReactorWorkerThread *pSharedWorkerThread, RsslErrorInfo *pError);
+
+/* Initializes and starts a worker thread that reactors of a reactor group will share. */
+RsslRet _reactorWorkerThreadStartShared(RsslReactorWorkerThread *pWorkerThread, RsslNotifierType notifierType, RsslErrorInfo *pError);
+
+/* Stops a shared worker thread once the reactors using it have been destroyed, and cleans it up. */
+void _reactorWorkerThreadStopShared(RsslReactorWorkerThread *pWorkerThread);
 
 /* Cleanup all reactor resources(it is assumed that there will be no more use of this reactor so all memory can be cleaned up */
 void _reactorWorkerCleanupReactor(RsslReactorImpl *pReactorImpl);
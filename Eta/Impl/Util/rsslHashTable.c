@@ -6,11 +6,55 @@
 */
 
 #include "rtr/rsslHashTable.h"
+#include <string.h>
+
+/* Bytes */
+
+#define RSSL_HASH_PRIME1 0x9e3779b185ebca87ULL
+#define RSSL_HASH_PRIME2 0xc2b2ae3d27d4eb4fULL
+#define RSSL_HASH_PRIME3 0x165667b19e3779f9ULL
+
+#define RSSL_HASH_ROTL64(__x, __r) (((__x) << (__r)) | ((__x) >> (64 - (__r))))
+
+RsslUInt32 rsslHashBytes(const char *data, RsslUInt32 length, RsslUInt32 seed)
+{
+	const unsigned char *pData = (const unsigned char*)data;
+	RsslUInt64 hashSum = ((RsslUInt64)seed + RSSL_HASH_PRIME3) ^ ((RsslUInt64)length * RSSL_HASH_PRIME1);
+	RsslUInt64 word;
+	RsslUInt32 i;
+
+	/* Mix in eight bytes at a time. */
+	for (; length >= 8; length -= 8, pData += 8)
+	{
+		memcpy(&word, pData, 8);
+		word *= RSSL_HASH_PRIME2;
+		word = RSSL_HASH_ROTL64(word, 31);
+		word *= RSSL_HASH_PRIME1;
+		hashSum ^= word;
+		hashSum = RSSL_HASH_ROTL64(hashSum, 27) * RSSL_HASH_PRIME1 + RSSL_HASH_PRIME3;
+	}
+
+	/* Mix in any remaining bytes as one word. */
+	if (length)
+	{
+		word = 0;
+		for (i = 0; i < length; ++i)
+			word |= (RsslUInt64)pData[i] << (i * 8);
+
+		word *= RSSL_HASH_PRIME2;
+		word = RSSL_HASH_ROTL64(word, 31);
+		word *= RSSL_HASH_PRIME1;
+		hashSum ^= word;
+		hashSum = RSSL_HASH_ROTL64(hashSum, 27) * RSSL_HASH_PRIME1 + RSSL_HASH_PRIME3;
+	}
+
+	return rsslHashMixU64(hashSum);
+}
 
 /* U16 */
 
 RsslUInt32 rsslHashU16Sum(void *pKey)
-{ return (RsslUInt32)(*((RsslUInt16*)pKey)); }
+{ return rsslHashMixU32((RsslUInt32)(*((RsslUInt16*)pKey))); }
 
 RsslBool rsslHashU16Compare(void *pKey1, void *pKey2)
 { return (*(RsslUInt16*)pKey1) == (*(RsslUInt16*)pKey2); }
@@ -18,7 +62,7 @@ RsslBool rsslHashU16Compare(void *pKey1, void *pKey2)
 /* U32 */
 
 RsslUInt32 rsslHashU32Sum(void *pKey)
-{ return (RsslUInt32)(*((RsslUInt32*)pKey)); }
+{ return rsslHashMixU32(*((RsslUInt32*)pKey)); }
 
 RsslBool rsslHashU32Compare(void *pKey1, void *pKey2)
 { return (*(RsslUInt32*)pKey1) == (*(RsslUInt32*)pKey2); }
@@ -26,7 +70,7 @@ RsslBool rsslHashU32Compare(void *pKey1, void *pKey2)
 /* U64 */
 
 RsslUInt32 rsslHashU64Sum(void *pKey)
-{ return (RsslUInt32)(*((RsslUInt64*)pKey)); }
+{ return rsslHashMixU64(*((RsslUInt64*)pKey)); }
 
 RsslBool rsslHashU64Compare(void *pKey1, void *pKey2)
 { return (*(RsslUInt64*)pKey1) == (*(RsslUInt64*)pKey2); }
@@ -35,17 +79,8 @@ RsslBool rsslHashU64Compare(void *pKey1, void *pKey2)
 
 RsslUInt32 rsslHashBufferSum(void *pKey)
 {
-	RsslUInt32 i;
-	RsslUInt32 hashSum = 0;
 	RsslBuffer *pBuffer = (RsslBuffer*)pKey;
-
-	for(i = 0; i < pBuffer->length; ++i)
-	{
-		hashSum = (hashSum << 4) + (RsslUInt32)pBuffer->data[i];
-		hashSum ^= (hashSum >> 12);
-	}
-
-	return hashSum;
+	return rsslHashBytes(pBuffer->data, pBuffer->length, 0);
 }
 
 RsslBool rsslHashBufferCompare(void *pKey1, void *pKey2)
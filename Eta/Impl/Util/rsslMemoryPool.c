@@ -0,0 +1,253 @@
+/*
+ * This source code is provided under the Apache 2.0 license and is provided
+ * AS IS with no warranty or guarantee of fit for purpose.  See the project's
+ * LICENSE.md for details.
+ * Copyright Thomson Reuters 2015. All rights reserved.
+*/
+
+#include "rtr/rsslMemoryPool.h"
+#include <stdlib.h>
+
+#ifdef Linux
+#include <sys/mman.h>
+#define RSSL_MEMORY_POOL_HAVE_MMAP
+#endif
+
+/* Header at the start of each chunk. Blocks follow it. */
+typedef struct
+{
+	RsslQueueLink	qlChunks;
+	size_t			size;			/* Total size of the chunk, including this header. */
+	RsslBool		isMapped;		/* Whether the chunk was allocated with mmap() rather than malloc(). */
+	char			*blocksStart;	/* First block in the chunk. */
+	char			*blocksEnd;		/* End of the last block in the chunk. */
+	RsslUInt32		blockCount;		/* Number of blocks in the chunk. */
+	RsslUInt32		freeCount;		/* Used by rsslMemoryPoolTrim(). */
+	RsslBool		release;		/* Used by rsslMemoryPoolTrim(). */
+} RsslMemoryChunk;
+
+/* Blocks are aligned to this size, and the first block is aligned to a cache line. */
+#define RSSL_MEMORY_BLOCK_ALIGN 16
+#define RSSL_MEMORY_CHUNK_HEADER_SIZE ((sizeof(RsslMemoryChunk) + 63) & ~(size_t)63)
+
+#ifdef RSSL_MEMORY_POOL_HAVE_MMAP
+/* Size of the huge pages used for chunks. */
+#define RSSL_MEMORY_HUGE_PAGE_SIZE ((size_t)2 * 1024 * 1024)
+#endif
+
+RsslRet rsslMemoryPoolInitSlab(RsslMemoryPool *pPool, int blockSize, int blockCount, int chunkBlockCount,
+		RsslUInt32 flags, RsslErrorInfo *pErrorInfo)
+{
+	assert(blockSize > sizeof(RsslMemoryBlock));
+
+	memset(pPool, 0, sizeof(RsslMemoryPool));
+	rsslInitQueue(&pPool->blocks);
+	rsslInitQueue(&pPool->chunks);
+	pPool->blockSize = (int)((blockSize + RSSL_MEMORY_BLOCK_ALIGN - 1) & ~(RSSL_MEMORY_BLOCK_ALIGN - 1));
+	pPool->isSlab = RSSL_TRUE;
+	pPool->flags = flags;
+	pPool->chunkBlockCount = chunkBlockCount > 0 ? chunkBlockCount : 1;
+
+	/* Allocate the initial blocks as a single chunk. */
+	if (blockCount > 0)
+	{
+		RsslRet ret;
+
+		if (blockCount > pPool->chunkBlockCount)
+		{
+			int growBlockCount = pPool->chunkBlockCount;
+			pPool->chunkBlockCount = blockCount;
+			ret = _rsslMemoryPoolAddChunk(pPool, pErrorInfo);
+			pPool->chunkBlockCount = growBlockCount;
+		}
+		else
+			ret = _rsslMemoryPoolAddChunk(pPool, pErrorInfo);
+
+		if (ret != RSSL_RET_SUCCESS)
+			return ret;
+	}
+
+	return RSSL_RET_SUCCESS;
+}
+
+RsslRet _rsslMemoryPoolAddChunk(RsslMemoryPool *pPool, RsslErrorInfo *pErrorInfo)
+{
+	size_t size = RSSL_MEMORY_CHUNK_HEADER_SIZE + (size_t)pPool->blockSize * pPool->chunkBlockCount;
+	RsslMemoryChunk *pChunk = NULL;
+	RsslBool isMapped = RSSL_FALSE;
+	char *pBlock;
+	RsslUInt32 i;
+
+#ifdef RSSL_MEMORY_POOL_HAVE_MMAP
+	if (pPool->flags & RSSL_MPLF_HUGE_PAGES)
+	{
+		void *pMemory;
+
+		/* Round up to a whole number of huge pages; any extra space is used for more blocks. */
+		size = (size + RSSL_MEMORY_HUGE_PAGE_SIZE - 1) & ~(RSSL_MEMORY_HUGE_PAGE_SIZE - 1);
+
+#ifdef MAP_HUGETLB
+		if ((pMemory = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0)) == MAP_FAILED)
+#endif
+		{
+			/* No reserved huge pages; ask for transparent huge pages instead. */
+			if ((pMemory = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0)) != MAP_FAILED)
+			{
+#ifdef MADV_HUGEPAGE
+				madvise(pMemory, size, MADV_HUGEPAGE);
+#endif
+			}
+		}
+
+		if (pMemory != MAP_FAILED)
+		{
+			pChunk = (RsslMemoryChunk*)pMemory;
+			isMapped = RSSL_TRUE;
+		}
+	}
+#endif
+
+	if (!pChunk && !(pChunk = (RsslMemoryChunk*)malloc(size)))
+	{
+		rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, 
+				"Memory allocation failure.");
+		return RSSL_RET_FAILURE;
+	}
+
+	pChunk->size = size;
+	pChunk->isMapped = isMapped;
+	pChunk->blockCount = (RsslUInt32)((size - RSSL_MEMORY_CHUNK_HEADER_SIZE) / pPool->blockSize);
+	pChunk->blocksStart = (char*)pChunk + RSSL_MEMORY_CHUNK_HEADER_SIZE;
+	pChunk->blocksEnd = pChunk->blocksStart + (size_t)pChunk->blockCount * pPool->blockSize;
+	pChunk->freeCount = 0;
+	rsslQueueAddLinkToBack(&pPool->chunks, &pChunk->qlChunks);
+
+	/* Add blocks in reverse so they are retrieved in address order. */
+	for (i = pChunk->blockCount, pBlock = pChunk->blocksEnd; i > 0; --i)
+	{
+		pBlock -= pPool->blockSize;
+		rsslQueueAddLinkToFront(&pPool->blocks, &((RsslMemoryBlock*)pBlock)->qlPool);
+	}
+
+	return RSSL_RET_SUCCESS;
+}
+
+static void _rsslMemoryPoolFreeChunk(RsslMemoryChunk *pChunk)
+{
+#ifdef RSSL_MEMORY_POOL_HAVE_MMAP
+	if (pChunk->isMapped)
+	{
+		munmap(pChunk, pChunk->size);
+		return;
+	}
+#endif
+
+	free(pChunk);
+}
+
+void _rsslMemoryPoolFreeChunks(RsslMemoryPool *pPool)
+{
+	RsslQueueLink *pLink;
+
+	rsslInitQueue(&pPool->blocks);
+
+	while ((pLink = rsslQueueRemoveFirstLink(&pPool->chunks)))
+		_rsslMemoryPoolFreeChunk(RSSL_QUEUE_LINK_TO_OBJECT(RsslMemoryChunk, qlChunks, pLink));
+}
+
+static int _rsslMemoryChunkCompare(const void *p1, const void *p2)
+{
+	const RsslMemoryChunk *pChunk1 = *(const RsslMemoryChunk**)p1;
+	const RsslMemoryChunk *pChunk2 = *(const RsslMemoryChunk**)p2;
+
+	return (pChunk1->blocksStart < pChunk2->blocksStart) ? -1 : (pChunk1->blocksStart > pChunk2->blocksStart) ? 1 : 0;
+}
+
+/* Finds the chunk containing a block, using a list of chunks sorted by address. */
+static RsslMemoryChunk *_rsslMemoryPoolFindChunk(RsslMemoryChunk **chunkList, RsslUInt32 chunkCount, char *pBlock)
+{
+	RsslUInt32 low = 0, high = chunkCount;
+
+	while (low < high)
+	{
+		RsslUInt32 mid = low + (high - low) / 2;
+
+		if (pBlock < chunkList[mid]->blocksStart)
+			high = mid;
+		else if (pBlock >= chunkList[mid]->blocksEnd)
+			low = mid + 1;
+		else
+			return chunkList[mid];
+	}
+
+	return NULL;
+}
+
+void rsslMemoryPoolTrim(RsslMemoryPool *pPool, RsslUInt32 maxFreeBlocks)
+{
+	RsslUInt32 chunkCount = rsslQueueGetElementCount(&pPool->chunks);
+	RsslUInt32 freeBlocks = rsslQueueGetElementCount(&pPool->blocks);
+	RsslMemoryChunk **chunkList;
+	RsslQueueLink *pLink;
+	RsslUInt32 i, releasedCount = 0;
+
+	if (!pPool->isSlab || freeBlocks <= maxFreeBlocks || !chunkCount)
+		return;
+
+	/* Trimming is best-effort, so do nothing if the list can't be allocated. */
+	if (!(chunkList = (RsslMemoryChunk**)malloc(chunkCount * sizeof(RsslMemoryChunk*))))
+		return;
+
+	i = 0;
+	RSSL_QUEUE_FOR_EACH_LINK(&pPool->chunks, pLink)
+	{
+		RsslMemoryChunk *pChunk = RSSL_QUEUE_LINK_TO_OBJECT(RsslMemoryChunk, qlChunks, pLink);
+		pChunk->freeCount = 0;
+		pChunk->release = RSSL_FALSE;
+		chunkList[i++] = pChunk;
+	}
+
+	qsort(chunkList, chunkCount, sizeof(RsslMemoryChunk*), _rsslMemoryChunkCompare);
+
+	/* Count the free blocks in each chunk. */
+	RSSL_QUEUE_FOR_EACH_LINK(&pPool->blocks, pLink)
+	{
+		RsslMemoryChunk *pChunk = _rsslMemoryPoolFindChunk(chunkList, chunkCount, (char*)pLink);
+		assert(pChunk);
+		++pChunk->freeCount;
+	}
+
+	/* Pick chunks to release, starting from the highest addresses so that the remaining blocks stay low. */
+	for (i = chunkCount; i > 0 && freeBlocks > maxFreeBlocks; --i)
+	{
+		RsslMemoryChunk *pChunk = chunkList[i - 1];
+
+		if (pChunk->freeCount == pChunk->blockCount)
+		{
+			freeBlocks -= pChunk->blockCount;
+			pChunk->release = RSSL_TRUE;
+			++releasedCount;
+		}
+	}
+
+	if (releasedCount)
+	{
+		/* Remove the released chunks' blocks from the free list. */
+		RSSL_QUEUE_FOR_EACH_LINK(&pPool->blocks, pLink)
+		{
+			if (_rsslMemoryPoolFindChunk(chunkList, chunkCount, (char*)pLink)->release)
+				rsslQueueRemoveLink(&pPool->blocks, pLink);
+		}
+
+		for (i = 0; i < chunkCount; ++i)
+		{
+			if (chunkList[i]->release)
+			{
+				rsslQueueRemoveLink(&pPool->chunks, &chunkList[i]->qlChunks);
+				_rsslMemoryPoolFreeChunk(chunkList[i]);
+			}
+		}
+	}
+
+	free(chunkList);
+}
@@ -0,0 +1,590 @@
+/*
+ * This source code is provided under the Apache 2.0 license and is provided
+ * AS IS with no warranty or guarantee of fit for purpose.  See the project's
+ * LICENSE.md for details.
+ * Copyright Thomson Reuters 2015. All rights reserved.
+*/
+
+#include "rtr/rsslNotifier.h"
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+#ifndef WIN32
+#include <unistd.h>
+#include <sys/resource.h>
+#endif
+
+#ifdef Linux
+#include <sys/epoll.h>
+#define RSSL_NOTIFIER_HAVE_EPOLL
+#endif
+
+/* Initial number of events the notifier has room for. Grows as needed. */
+static const RsslUInt32 notifierInitialCapacity = 64;
+
+static RsslRet _notifierInitSelect(RsslNotifier *pNotifier, RsslErrorInfo *pErrorInfo)
+{
+#ifndef WIN32
+	struct rlimit rlimit;
+	long fdSetSizeRemainder;
+#endif
+
+	/* Size the descriptor sets the same way the reactor always has: to cover every descriptor the process may open. */
+#ifdef WIN32
+	pNotifier->fdSetSize = FD_SETSIZE;
+	pNotifier->fdSetSizeInBytes = sizeof(fd_set);
+#else
+	getrlimit(RLIMIT_NOFILE, &rlimit);
+	pNotifier->fdSetSize = (RsslUInt32)rlimit.rlim_cur;
+
+	/* do not allow fdSetSize to be smaller than FD_SETSIZE */
+	if (pNotifier->fdSetSize < FD_SETSIZE)
+		pNotifier->fdSetSize = FD_SETSIZE;
+
+	/* fdSetSize needs to be a multiple of 8 */
+	fdSetSizeRemainder = pNotifier->fdSetSize % 8;
+	if (fdSetSizeRemainder > 0)
+		pNotifier->fdSetSize += (8 - fdSetSizeRemainder);
+
+	pNotifier->fdSetSizeInBytes = pNotifier->fdSetSize / 8;
+#endif
+
+	if ((pNotifier->readFds = (fd_set*)malloc(pNotifier->fdSetSizeInBytes)) == NULL
+			|| (pNotifier->writeFds = (fd_set*)malloc(pNotifier->fdSetSizeInBytes)) == NULL
+			|| (pNotifier->exceptFds = (fd_set*)malloc(pNotifier->fdSetSizeInBytes)) == NULL
+			|| (pNotifier->useReadFds = (fd_set*)malloc(pNotifier->fdSetSizeInBytes)) == NULL
+			|| (pNotifier->useWriteFds = (fd_set*)malloc(pNotifier->fdSetSizeInBytes)) == NULL
+			|| (pNotifier->useExceptFds = (fd_set*)malloc(pNotifier->fdSetSizeInBytes)) == NULL)
+	{
+		rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to allocate memory.");
+		return RSSL_RET_FAILURE;
+	}
+
+	memset(pNotifier->readFds, 0, pNotifier->fdSetSizeInBytes);
+	memset(pNotifier->writeFds, 0, pNotifier->fdSetSizeInBytes);
+	memset(pNotifier->exceptFds, 0, pNotifier->fdSetSizeInBytes);
+	memset(pNotifier->useReadFds, 0, pNotifier->fdSetSizeInBytes);
+	memset(pNotifier->useWriteFds, 0, pNotifier->fdSetSizeInBytes);
+	memset(pNotifier->useExceptFds, 0, pNotifier->fdSetSizeInBytes);
+
+	return RSSL_RET_SUCCESS;
+}
+
+/* Sets or clears the descriptor in the select() descriptor sets according to the flags. */
+static void _notifierSetSelectFds(RsslNotifier *pNotifier, RsslSocket fd, RsslUInt8 notifyFlags)
+{
+	if (notifyFlags & RSSL_NOTIFIER_READ) FD_SET(fd, pNotifier->readFds); else FD_CLR(fd, pNotifier->readFds);
+	if (notifyFlags & RSSL_NOTIFIER_WRITE) FD_SET(fd, pNotifier->writeFds); else FD_CLR(fd, pNotifier->writeFds);
+	if (notifyFlags & RSSL_NOTIFIER_EXCEPT) FD_SET(fd, pNotifier->exceptFds); else FD_CLR(fd, pNotifier->exceptFds);
+}
+
+#ifndef WIN32
+static short _notifierFlagsToPollEvents(RsslUInt8 notifyFlags)
+{
+	short events = 0;
+
+	if (notifyFlags & RSSL_NOTIFIER_READ) events |= POLLIN;
+	if (notifyFlags & RSSL_NOTIFIER_WRITE) events |= POLLOUT;
+	if (notifyFlags & RSSL_NOTIFIER_EXCEPT) events |= POLLPRI;
+
+	return events;
+}
+#endif
+
+#ifdef RSSL_NOTIFIER_HAVE_EPOLL
+static RsslUInt32 _notifierFlagsToEpollEvents(RsslUInt8 notifyFlags)
+{
+	RsslUInt32 events = 0;
+
+	if (notifyFlags & RSSL_NOTIFIER_READ) events |= EPOLLIN;
+	if (notifyFlags & RSSL_NOTIFIER_WRITE) events |= EPOLLOUT;
+	if (notifyFlags & RSSL_NOTIFIER_EXCEPT) events |= EPOLLPRI;
+
+	return events;
+}
+
+static int _notifierEpollCtl(RsslNotifier *pNotifier, int op, RsslNotifierEvent *pEvent)
+{
+	struct epoll_event epollEvent;
+
+	memset(&epollEvent, 0, sizeof(epollEvent));
+	epollEvent.events = _notifierFlagsToEpollEvents(pEvent->notifyFlags);
+	epollEvent.data.ptr = pEvent;
+
+	return epoll_ctl(pNotifier->epollFd, op, pEvent->fd, &epollEvent);
+}
+#endif
+
+/* Makes room for at least one more event. */
+static RsslRet _notifierEnsureCapacity(RsslNotifier *pNotifier, RsslErrorInfo *pErrorInfo)
+{
+	RsslUInt32 newCapacity;
+	RsslNotifierEvent **newEvents, **newNotifiedEvents;
+
+	if (pNotifier->eventCount < pNotifier->eventCapacity)
+		return RSSL_RET_SUCCESS;
+
+	newCapacity = pNotifier->eventCapacity ? pNotifier->eventCapacity * 2 : notifierInitialCapacity;
+
+	if (!(newEvents = (RsslNotifierEvent**)realloc(pNotifier->events, newCapacity * sizeof(RsslNotifierEvent*))))
+	{
+		rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to allocate memory.");
+		return RSSL_RET_FAILURE;
+	}
+	pNotifier->events = newEvents;
+
+	if (!(newNotifiedEvents = (RsslNotifierEvent**)realloc(pNotifier->notifiedEvents, newCapacity * sizeof(RsslNotifierEvent*))))
+	{
+		rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to allocate memory.");
+		return RSSL_RET_FAILURE;
+	}
+	pNotifier->notifiedEvents = newNotifiedEvents;
+
+#ifndef WIN32
+	switch(pNotifier->type)
+	{
+		case RSSL_NOTIFIER_POLL:
+		{
+			struct pollfd *newPollFds;
+			if (!(newPollFds = (struct pollfd*)realloc(pNotifier->pollFds, newCapacity * sizeof(struct pollfd))))
+			{
+				rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to allocate memory.");
+				return RSSL_RET_FAILURE;
+			}
+			pNotifier->pollFds = newPollFds;
+			break;
+		}
+
+#ifdef RSSL_NOTIFIER_HAVE_EPOLL
+		case RSSL_NOTIFIER_EPOLL:
+		{
+			void *newEpollEvents;
+			if (!(newEpollEvents = realloc(pNotifier->epollEvents, newCapacity * sizeof(struct epoll_event))))
+			{
+				rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to allocate memory.");
+				return RSSL_RET_FAILURE;
+			}
+			pNotifier->epollEvents = newEpollEvents;
+			break;
+		}
+#endif
+
+		default:
+			break;
+	}
+#endif
+
+	pNotifier->eventCapacity = newCapacity;
+	return RSSL_RET_SUCCESS;
+}
+
+RsslRet rsslNotifierInit(RsslNotifier *pNotifier, RsslNotifierType type, RsslErrorInfo *pErrorInfo)
+{
+	memset(pNotifier, 0, sizeof(RsslNotifier));
+#ifndef WIN32
+	pNotifier->epollFd = -1;
+#endif
+
+	/* Use the nearest mechanism this platform supports. */
+#ifdef WIN32
+	type = RSSL_NOTIFIER_SELECT;
+#elif !defined(RSSL_NOTIFIER_HAVE_EPOLL)
+	if (type == RSSL_NOTIFIER_EPOLL)
+		type = RSSL_NOTIFIER_POLL;
+#endif
+
+	pNotifier->type = type;
+
+	switch(type)
+	{
+		case RSSL_NOTIFIER_SELECT:
+			if (_notifierInitSelect(pNotifier, pErrorInfo) != RSSL_RET_SUCCESS)
+			{
+				rsslNotifierCleanup(pNotifier);
+				return RSSL_RET_FAILURE;
+			}
+			break;
+
+#ifndef WIN32
+		case RSSL_NOTIFIER_POLL:
+			break;
+#endif
+
+#ifdef RSSL_NOTIFIER_HAVE_EPOLL
+		case RSSL_NOTIFIER_EPOLL:
+			if ((pNotifier->epollFd = epoll_create(notifierInitialCapacity)) < 0)
+			{
+				rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "epoll_create() failed: %d", errno);
+				rsslNotifierCleanup(pNotifier);
+				return RSSL_RET_FAILURE;
+			}
+			break;
+#endif
+
+		default:
+			rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, "Unknown notifier type %d.", type);
+			return RSSL_RET_INVALID_ARGUMENT;
+	}
+
+	if (_notifierEnsureCapacity(pNotifier, pErrorInfo) != RSSL_RET_SUCCESS)
+	{
+		rsslNotifierCleanup(pNotifier);
+		return RSSL_RET_FAILURE;
+	}
+
+	return RSSL_RET_SUCCESS;
+}
+
+void rsslNotifierCleanup(RsslNotifier *pNotifier)
+{
+	free(pNotifier->events);
+	free(pNotifier->notifiedEvents);
+	free(pNotifier->readFds);
+	free(pNotifier->writeFds);
+	free(pNotifier->exceptFds);
+	free(pNotifier->useReadFds);
+	free(pNotifier->useWriteFds);
+	free(pNotifier->useExceptFds);
+
+#ifndef WIN32
+	free(pNotifier->pollFds);
+	free(pNotifier->epollEvents);
+	if (pNotifier->type == RSSL_NOTIFIER_EPOLL && pNotifier->epollFd >= 0)
+		close(pNotifier->epollFd);
+#endif
+
+	memset(pNotifier, 0, sizeof(RsslNotifier));
+#ifndef WIN32
+	pNotifier->epollFd = -1;
+#endif
+}
+
+RsslRet rsslNotifierAddEvent(RsslNotifier *pNotifier, RsslNotifierEvent *pEvent, RsslSocket fd, void *object,
+		RsslUInt8 notifyFlags, RsslErrorInfo *pErrorInfo)
+{
+	if (rsslNotifierEventIsRegistered(pEvent))
+	{
+		rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, "Notifier event is already registered.");
+		return RSSL_RET_INVALID_ARGUMENT;
+	}
+
+	if (pNotifier->type == RSSL_NOTIFIER_SELECT
+#ifndef WIN32
+			&& (fd < 0 || (RsslUInt32)fd >= pNotifier->fdSetSize)
+#else
+			&& pNotifier->eventCount >= FD_SETSIZE
+#endif
+	   )
+	{
+		rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Descriptor %d cannot be added to the descriptor sets.", (int)fd);
+		return RSSL_RET_FAILURE;
+	}
+
+	if (_notifierEnsureCapacity(pNotifier, pErrorInfo) != RSSL_RET_SUCCESS)
+		return RSSL_RET_FAILURE;
+
+	pEvent->fd = fd;
+	pEvent->object = object;
+	pEvent->notifyFlags = notifyFlags;
+	pEvent->revents = RSSL_NOTIFIER_NONE;
+
+	switch(pNotifier->type)
+	{
+		case RSSL_NOTIFIER_SELECT:
+			_notifierSetSelectFds(pNotifier, fd, notifyFlags);
+			break;
+
+#ifndef WIN32
+		case RSSL_NOTIFIER_POLL:
+			pNotifier->pollFds[pNotifier->eventCount].fd = fd;
+			pNotifier->pollFds[pNotifier->eventCount].events = _notifierFlagsToPollEvents(notifyFlags);
+			pNotifier->pollFds[pNotifier->eventCount].revents = 0;
+			break;
+#endif
+
+#ifdef RSSL_NOTIFIER_HAVE_EPOLL
+		case RSSL_NOTIFIER_EPOLL:
+			if (_notifierEpollCtl(pNotifier, EPOLL_CTL_ADD, pEvent) < 0)
+			{
+				rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "epoll_ctl() failed to add descriptor %d: %d", fd, errno);
+				return RSSL_RET_FAILURE;
+			}
+			break;
+#endif
+
+		default:
+			break;
+	}
+
+	pEvent->_index = (RsslInt32)pNotifier->eventCount;
+	pNotifier->events[pNotifier->eventCount++] = pEvent;
+
+	return RSSL_RET_SUCCESS;
+}
+
+RsslRet rsslNotifierUpdateEventFd(RsslNotifier *pNotifier, RsslNotifierEvent *pEvent, RsslSocket fd, RsslErrorInfo *pErrorInfo)
+{
+	if (!rsslNotifierEventIsRegistered(pEvent))
+	{
+		rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, "Notifier event is not registered.");
+		return RSSL_RET_INVALID_ARGUMENT;
+	}
+
+	if (pEvent->fd == fd)
+		return RSSL_RET_SUCCESS;
+
+	switch(pNotifier->type)
+	{
+		case RSSL_NOTIFIER_SELECT:
+#ifndef WIN32
+			if (fd < 0 || (RsslUInt32)fd >= pNotifier->fdSetSize)
+			{
+				rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Descriptor %d cannot be added to the descriptor sets.", (int)fd);
+				return RSSL_RET_FAILURE;
+			}
+#endif
+			_notifierSetSelectFds(pNotifier, pEvent->fd, RSSL_NOTIFIER_NONE);
+			_notifierSetSelectFds(pNotifier, fd, pEvent->notifyFlags);
+			break;
+
+#ifndef WIN32
+		case RSSL_NOTIFIER_POLL:
+			pNotifier->pollFds[pEvent->_index].fd = fd;
+			break;
+#endif
+
+#ifdef RSSL_NOTIFIER_HAVE_EPOLL
+		case RSSL_NOTIFIER_EPOLL:
+			/* The old descriptor may already have been closed(which removes it from the epoll set), so ignore failure here. */
+			_notifierEpollCtl(pNotifier, EPOLL_CTL_DEL, pEvent);
+			pEvent->fd = fd;
+			if (_notifierEpollCtl(pNotifier, EPOLL_CTL_ADD, pEvent) < 0)
+			{
+				rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "epoll_ctl() failed to add descriptor %d: %d", fd, errno);
+				rsslNotifierRemoveEvent(pNotifier, pEvent);
+				return RSSL_RET_FAILURE;
+			}
+			break;
+#endif
+
+		default:
+			break;
+	}
+
+	pEvent->fd = fd;
+	pEvent->revents = RSSL_NOTIFIER_NONE;
+	return RSSL_RET_SUCCESS;
+}
+
+RsslRet rsslNotifierUpdateEventFlags(RsslNotifier *pNotifier, RsslNotifierEvent *pEvent, RsslUInt8 notifyFlags, RsslErrorInfo *pErrorInfo)
+{
+	if (!rsslNotifierEventIsRegistered(pEvent))
+	{
+		rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, "Notifier event is not registered.");
+		return RSSL_RET_INVALID_ARGUMENT;
+	}
+
+	if (pEvent->notifyFlags == notifyFlags)
+		return RSSL_RET_SUCCESS;
+
+	pEvent->notifyFlags = notifyFlags;
+	pEvent->revents &= notifyFlags;
+
+	switch(pNotifier->type)
+	{
+		case RSSL_NOTIFIER_SELECT:
+			_notifierSetSelectFds(pNotifier, pEvent->fd, notifyFlags);
+			break;
+
+#ifndef WIN32
+		case RSSL_NOTIFIER_POLL:
+			pNotifier->pollFds[pEvent->_index].events = _notifierFlagsToPollEvents(notifyFlags);
+			break;
+#endif
+
+#ifdef RSSL_NOTIFIER_HAVE_EPOLL
+		case RSSL_NOTIFIER_EPOLL:
+			if (_notifierEpollCtl(pNotifier, EPOLL_CTL_MOD, pEvent) < 0)
+			{
+				rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "epoll_ctl() failed to modify descriptor %d: %d", pEvent->fd, errno);
+				return RSSL_RET_FAILURE;
+			}
+			break;
+#endif
+
+		default:
+			break;
+	}
+
+	return RSSL_RET_SUCCESS;
+}
+
+void rsslNotifierRemoveEvent(RsslNotifier *pNotifier, RsslNotifierEvent *pEvent)
+{
+	RsslUInt32 index, lastIndex;
+
+	if (!rsslNotifierEventIsRegistered(pEvent))
+		return;
+
+	index = (RsslUInt32)pEvent->_index;
+	lastIndex = pNotifier->eventCount - 1;
+
+	switch(pNotifier->type)
+	{
+		case RSSL_NOTIFIER_SELECT:
+			_notifierSetSelectFds(pNotifier, pEvent->fd, RSSL_NOTIFIER_NONE);
+			break;
+
+#ifndef WIN32
+		case RSSL_NOTIFIER_POLL:
+			pNotifier->pollFds[index] = pNotifier->pollFds[lastIndex];
+			break;
+#endif
+
+#ifdef RSSL_NOTIFIER_HAVE_EPOLL
+		case RSSL_NOTIFIER_EPOLL:
+			/* The descriptor may already have been closed, so ignore failure here. */
+			_notifierEpollCtl(pNotifier, EPOLL_CTL_DEL, pEvent);
+			break;
+#endif
+
+		default:
+			break;
+	}
+
+	/* Move the last event into the removed event's position. */
+	pNotifier->events[index] = pNotifier->events[lastIndex];
+	pNotifier->events[index]->_index = (RsslInt32)index;
+	--pNotifier->eventCount;
+
+	pEvent->_index = -1;
+
+	/* Remove it from the results of the last wait, in case the owner is still walking them. */
+	if (pEvent->revents)
+	{
+		for (index = 0; index < pNotifier->notifiedEventCount; ++index)
+		{
+			if (pNotifier->notifiedEvents[index] == pEvent)
+			{
+				pNotifier->notifiedEvents[index] = NULL;
+				break;
+			}
+		}
+		pEvent->revents = RSSL_NOTIFIER_NONE;
+	}
+}
+
+int rsslNotifierWait(RsslNotifier *pNotifier, RsslInt64 timeoutUsec)
+{
+	RsslUInt32 i;
+	int ret;
+
+	/* Clear results of the previous call. */
+	for (i = 0; i < pNotifier->notifiedEventCount; ++i)
+	{
+		if (pNotifier->notifiedEvents[i])
+			pNotifier->notifiedEvents[i]->revents = RSSL_NOTIFIER_NONE;
+	}
+	pNotifier->notifiedEventCount = 0;
+
+	switch(pNotifier->type)
+	{
+		case RSSL_NOTIFIER_SELECT:
+		{
+			struct timeval selectTime;
+			struct timeval *pSelectTime = NULL;
+
+			if (timeoutUsec >= 0)
+			{
+				selectTime.tv_sec = (long)(timeoutUsec / 1000000);
+				selectTime.tv_usec = (long)(timeoutUsec % 1000000);
+				pSelectTime = &selectTime;
+			}
+
+			memcpy(pNotifier->useReadFds, pNotifier->readFds, pNotifier->fdSetSizeInBytes);
+			memcpy(pNotifier->useWriteFds, pNotifier->writeFds, pNotifier->fdSetSizeInBytes);
+			memcpy(pNotifier->useExceptFds, pNotifier->exceptFds, pNotifier->fdSetSizeInBytes);
+
+			if ((ret = select(pNotifier->fdSetSize, pNotifier->useReadFds, pNotifier->useWriteFds, pNotifier->useExceptFds, pSelectTime)) <= 0)
+				return ret;
+
+			for (i = 0; i < pNotifier->eventCount; ++i)
+			{
+				RsslNotifierEvent *pEvent = pNotifier->events[i];
+
+				if (FD_ISSET(pEvent->fd, pNotifier->useReadFds)) pEvent->revents |= RSSL_NOTIFIER_READ;
+				if (FD_ISSET(pEvent->fd, pNotifier->useWriteFds)) pEvent->revents |= RSSL_NOTIFIER_WRITE;
+				if (FD_ISSET(pEvent->fd, pNotifier->useExceptFds)) pEvent->revents |= RSSL_NOTIFIER_EXCEPT;
+
+				if (pEvent->revents)
+					pNotifier->notifiedEvents[pNotifier->notifiedEventCount++] = pEvent;
+			}
+			break;
+		}
+
+#ifndef WIN32
+		case RSSL_NOTIFIER_POLL:
+		{
+			int timeoutMs = (timeoutUsec >= 0) ? (int)((timeoutUsec + 999) / 1000) : -1;
+
+			if ((ret = poll(pNotifier->pollFds, pNotifier->eventCount, timeoutMs)) <= 0)
+				return ret;
+
+			for (i = 0; i < pNotifier->eventCount; ++i)
+			{
+				RsslNotifierEvent *pEvent = pNotifier->events[i];
+				short revents = pNotifier->pollFds[i].revents;
+
+				if (!revents)
+					continue;
+
+				if (revents & POLLIN) pEvent->revents |= RSSL_NOTIFIER_READ;
+				if (revents & POLLOUT) pEvent->revents |= RSSL_NOTIFIER_WRITE;
+				if (revents & POLLPRI) pEvent->revents |= RSSL_NOTIFIER_EXCEPT;
+
+				/* Report errors on all registered conditions, as select() would, so the owner attempts
+				 * its read or write and finds the error. */
+				if (revents & (POLLERR | POLLHUP | POLLNVAL))
+					pEvent->revents |= pEvent->notifyFlags;
+
+				if (pEvent->revents)
+					pNotifier->notifiedEvents[pNotifier->notifiedEventCount++] = pEvent;
+			}
+			break;
+		}
+#endif
+
+#ifdef RSSL_NOTIFIER_HAVE_EPOLL
+		case RSSL_NOTIFIER_EPOLL:
+		{
+			struct epoll_event *epollEvents = (struct epoll_event*)pNotifier->epollEvents;
+			int timeoutMs = (timeoutUsec >= 0) ? (int)((timeoutUsec + 999) / 1000) : -1;
+
+			if ((ret = epoll_wait(pNotifier->epollFd, epollEvents, (int)pNotifier->eventCapacity, timeoutMs)) <= 0)
+				return ret;
+
+			for (i = 0; i < (RsslUInt32)ret; ++i)
+			{
+				RsslNotifierEvent *pEvent = (RsslNotifierEvent*)epollEvents[i].data.ptr;
+				RsslUInt32 revents = epollEvents[i].events;
+
+				if (revents & EPOLLIN) pEvent->revents |= RSSL_NOTIFIER_READ;
+				if (revents & EPOLLOUT) pEvent->revents |= RSSL_NOTIFIER_WRITE;
+				if (revents & EPOLLPRI) pEvent->revents |= RSSL_NOTIFIER_EXCEPT;
+				if (revents & (EPOLLERR | EPOLLHUP))
+					pEvent->revents |= pEvent->notifyFlags;
+
+				if (pEvent->revents)
+					pNotifier->notifiedEvents[pNotifier->notifiedEventCount++] = pEvent;
+			}
+			break;
+		}
+#endif
+
+		default:
+			return -1;
+	}
+
+	return (int)pNotifier->notifiedEventCount;
+}
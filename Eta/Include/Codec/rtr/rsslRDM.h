@@ -480,6 +480,7 @@ static const RsslBuffer RSSL_ENAME_COS_PROT_MINOR_VERSION = { 21, (char*)":Proto
 static const RsslBuffer RSSL_ENAME_COS_STREAM_VERSION = { 14, (char*)":StreamVersion" };
 static const RsslBuffer RSSL_ENAME_COS_TYPE = { 5, (char*)":Type" };
 static const RsslBuffer RSSL_ENAME_COS_RECV_WINDOW_SIZE = { 15, (char*)":RecvWindowSize" };
+static const RsslBuffer RSSL_ENAME_COS_COMPRESSION_TYPE = { 16, (char*)":CompressionType" };
 
 /**
  * @}
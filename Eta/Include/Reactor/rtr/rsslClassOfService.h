@@ -33,6 +33,7 @@ typedef struct
 	RsslUInt8	protocolType;			/*!< The protocol type to be used in the qualified stream. */
 	RsslUInt8	protocolMajorVersion;	/*!< The major version of the protocol to be used in the qualified stream. */
 	RsslUInt8	protocolMinorVersion;	/*!< The minor version of the protocol to be used in the qualified stream. */
+	RsslUInt8	compressionType;		/*!< The type of compression applied to the content of each message on the qualified stream, if the remote end also supports it. Tunnel streams support RSSL_COMP_NONE and RSSL_COMP_LZ4. See RsslCompTypes. */
 } RsslClassOfServiceCommon;
 
 /**
@@ -51,6 +52,7 @@ typedef struct
 	RsslUInt	type;			/*!< The type of flow control to use. See RDMClassOfServiceFlowControlType. */
 	RsslInt		recvWindowSize;	/*!< The largest amount of data that the remote end of the stream should send at any time when performing flow control. */
 	RsslInt		sendWindowSize; /*!< Read-only. The largest amount of data that this end of the stream should send at any time when performing flow control. */
+	RsslBool	adaptiveSendWindow;	/*!< Not sent to the remote end. If RSSL_TRUE, this end measures how quickly its messages are acknowledged and limits the data it sends at any time to what the stream can carry, up to sendWindowSize. This allows the remote end to use a large recvWindowSize without being flooded. */
 } RsslClassOfServiceFlowControl;
 
 /**
@@ -61,14 +63,30 @@ typedef struct
 	RsslUInt	type;	/*!< The type of data integrity to use. See RDMClassOfServiceDataIntegrityType. */
 } RsslClassOfServiceDataIntegrity;
 
+/**
+  * @brief Determines when updates to a local persistence file are committed to disk.
+  * @see RsslClassOfServiceGuarantee
+  */
+typedef enum
+{
+	RSSL_COS_PC_EACH_MSG	= 0,	/*!< (0) Commit after every update to the file. */
+	RSSL_COS_PC_MSG_COUNT	= 1,	/*!< (1) Commit after every persistenceCommitCount updates. If persistenceCommitInterval is nonzero, updates short of the count are also committed once that many milliseconds have passed since the last timed commit.
+									 * Otherwise, up to persistenceCommitCount - 1 updates may remain uncommitted until more updates arrive or the queue stream is closed. */
+	RSSL_COS_PC_INTERVAL	= 2,	/*!< (2) Commit updates together, at most once every persistenceCommitInterval milliseconds. */
+	RSSL_COS_PC_DISPATCH	= 3		/*!< (3) Commit updates together when the reactor next processes the tunnel stream's timers. */
+} RsslClassOfServicePersistenceCommitPolicy;
+
 /**
   * @brief Represents Guarantee class of service properties used within a qualified stream.
   */
 typedef struct
 {
-	RsslUInt	type;					/*!< The type of guarantee to use. See RDMClassOfServiceGuaranteeType. */
-	RsslBool	persistLocally;			/*!< Consumers only. Indicates whether messages are persisted to a local file. */
-	char		*persistenceFilePath;   /*!< Consumers only. Path for storing persistence files, if local persistence is enabled. */
+	RsslUInt	type;						/*!< The type of guarantee to use. See RDMClassOfServiceGuaranteeType. */
+	RsslBool	persistLocally;				/*!< Consumers only. Indicates whether messages are persisted to a local file. */
+	char		*persistenceFilePath;		/*!< Consumers only. Path for storing persistence files, if local persistence is enabled. */
+	RsslUInt8	persistenceCommitPolicy;	/*!< Consumers only. When updates to the persistence file are committed to disk. See RsslClassOfServicePersistenceCommitPolicy. */
+	RsslUInt32	persistenceCommitCount;		/*!< Consumers only. Number of updates per commit, when persistenceCommitPolicy is RSSL_COS_PC_MSG_COUNT. */
+	RsslUInt32	persistenceCommitInterval;	/*!< Consumers only. Milliseconds between commits, when persistenceCommitPolicy is RSSL_COS_PC_INTERVAL. When it is RSSL_COS_PC_MSG_COUNT, optionally bounds how long updates remain uncommitted. */
 } RsslClassOfServiceGuarantee;
 
 
@@ -94,14 +112,19 @@ RTR_C_INLINE void rsslClearClassOfService(RsslClassOfService *pClass)
 	pClass->common.protocolType = RSSL_RWF_PROTOCOL_TYPE;
 	pClass->common.protocolMajorVersion = RSSL_RWF_MAJOR_VERSION;
 	pClass->common.protocolMinorVersion = RSSL_RWF_MINOR_VERSION;
+	pClass->common.compressionType = RSSL_COMP_NONE;
 	pClass->authentication.type = RDM_COS_AU_NOT_REQUIRED;
 	pClass->flowControl.type = RDM_COS_FC_NONE;
 	pClass->flowControl.recvWindowSize = -1;
 	pClass->flowControl.sendWindowSize = -1;
+	pClass->flowControl.adaptiveSendWindow = RSSL_FALSE;
 	pClass->dataIntegrity.type = RDM_COS_DI_BEST_EFFORT;
 	pClass->guarantee.type = RDM_COS_GU_NONE;
 	pClass->guarantee.persistLocally = RSSL_TRUE;
 	pClass->guarantee.persistenceFilePath = NULL;
+	pClass->guarantee.persistenceCommitPolicy = RSSL_COS_PC_EACH_MSG;
+	pClass->guarantee.persistenceCommitCount = 1;
+	pClass->guarantee.persistenceCommitInterval = 0;
 }
 
 #ifdef __cplusplus
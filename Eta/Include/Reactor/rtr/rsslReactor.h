@@ -101,6 +101,17 @@ typedef enum
 														 * necessary data is retrieved. This option is for use with an ADS. */
 } RsslDownloadDictionaryMode;
 
+/**
+ * @brief Order in which the watchlist sends item requests that are waiting for its request rate.
+ * @see RsslConsumerWatchlistOptions
+ */
+typedef enum
+{
+	RSSL_RC_RPO_FIFO			= 0,	/*!< (0) Requests are sent in the order they became ready. */
+	RSSL_RC_RPO_PRIORITY_CLASS	= 1,	/*!< (1) Items with the highest priority class are requested first. */
+	RSSL_RC_RPO_RANK			= 2		/*!< (2) Items with the highest RsslReactorRequestMsgOptions::requestRank are requested first. */
+} RsslReactorRequestPacingOrder;
+
 typedef struct 
 {
 	RsslBool 						enableWatchlist;		/*!< Enables the watchlist. */
@@ -110,6 +121,19 @@ typedef struct
 	RsslUInt32						maxOutstandingPosts;	/*!< Sets the maximum number of on-stream post acknowledgements that may be oustanding for the channel. */
 	RsslUInt32						postAckTimeout;			/*!< Time a stream will wait for acknowledgement of an on-stream post, in milliseconds. */
 	RsslUInt32						requestTimeout;			/*!< Time a requested stream will wait for a response from the provider, in milliseconds. */
+	RsslBool						enableFanoutList;		/*!< When several requests are open on the same item, delivers each update to the callback once, with the 
+															 * user-specified pointers of all of those requests listed in RsslStreamInfo::pUserSpecList, instead of once per request. 
+															 * The message carries the stream ID of the first request in the list. */
+	RsslUInt32						requestRate;			/*!< Maximum number of item requests needing a refresh that the watchlist sends per second, such as when 
+															 * recovering items after a reconnection. Requests beyond this rate wait and are sent in requestPacingOrder. 
+															 * Set to 0 to send requests as soon as possible. */
+	RsslUInt32						requestBurst;			/*!< Number of item requests that may be sent at once before requestRate applies. Used only when requestRate is set. */
+	RsslReactorRequestPacingOrder	requestPacingOrder;		/*!< Order in which waiting item requests are sent. Requests at the same level are sent in the order they started waiting. */
+	const char						*snapshotFile;			/*!< Name of a file written by rsslReactorSaveWatchlistSnapshot(). If set, the item requests saved in it are submitted when 
+															 * the channel is connected, before channelOpenCallback is called, and are then recovered like any other request. 
+															 * The saved directory is preloaded, so the restored requests are sent as soon as the login refresh is received. Services missing 
+															 * from the provider's first directory refresh are then removed. Restored requests have no user-specified pointer; the application 
+															 * identifies them by stream ID and must not open other requests on those stream IDs. A missing file is ignored. */
 } RsslConsumerWatchlistOptions;
 
 /**
@@ -144,6 +168,10 @@ RTR_C_INLINE void rsslClearOMMConsumerRole(RsslReactorOMMConsumerRole *pRole)
 	pRole->watchlistOptions.maxOutstandingPosts = 100000;
 	pRole->watchlistOptions.postAckTimeout = 15000;
 	pRole->watchlistOptions.requestTimeout = 15000;
+	pRole->watchlistOptions.enableFanoutList = RSSL_FALSE;
+	pRole->watchlistOptions.requestRate = 0;
+	pRole->watchlistOptions.requestBurst = 100;
+	pRole->watchlistOptions.requestPacingOrder = RSSL_RC_RPO_FIFO;
 }
 
 /**
@@ -216,14 +244,30 @@ RTR_C_INLINE void rsslClearReactorChannelRole(RsslReactorChannelRole *pRole)
 }
 
 
+/**
+ * @brief Enumerated types indicating the mechanism an RsslReactor uses to wait for its channels to become ready.
+ * @see RsslCreateReactorOptions
+ */
+typedef enum
+{
+	RSSL_RC_NT_SELECT	= 0,	/*!< Use select(). Every channel is checked on each pass, and channel descriptors are limited by FD_SETSIZE. */
+	RSSL_RC_NT_POLL		= 1,	/*!< Use poll(). Only channels that are ready are visited by rsslReactorDispatch(). Not available on Windows, where select() is used. */
+	RSSL_RC_NT_EPOLL	= 2		/*!< Use epoll(). Only channels that are ready are visited, and the cost of waiting does not grow with the number of channels. Available on Linux; poll() is used on other platforms. */
+} RsslReactorNotifierType;
+
 /**
  * @brief Configuraion options for creating an RsslReactor.
  * @see rsslCreateReactor
  */
 typedef struct {
-	RsslInt32	dispatchDecodeMemoryBufferSize;	/*!< Size of the memory buffer(in bytes) that the RsslReactor will use when decoding RsslRDMMsgs to pass to callback functions. */
+	RsslInt32	dispatchDecodeMemoryBufferSize;	/*!< Initial size of the memory buffer(in bytes) that the RsslReactor will use when decoding RsslRDMMsgs to pass to callback functions. The buffer is enlarged if a message does not fit. */
 	void		*userSpecPtr; 					/*!< user-specified pointer which will be set on the Reactor. */
 	int			port;							/*!< @deprecated DEPRECATED: This parameter no longer has any effect. It was a port used for creating the eventFd descriptor on the RsslReactor. It was never used on Linux or Solaris platforms. */
+	RsslReactorNotifierType	notifierType;		/*!< Mechanism used by rsslReactorDispatch() and the RsslReactor's worker thread to wait for channels to become ready. See RsslReactorNotifierType. */
+	RsslBool	enableChannelStatistics;		/*!< Keep statistics for each channel, which can be retrieved with rsslReactorGetChannelStatistics() and rsslReactorGetStatistics(). */
+	RsslBool	lazyRDMDecoding;				/*!< If RSSL_TRUE, login, directory and dictionary messages read from a channel are not decoded to RDM structures before their callback is called; the event's RDM pointer is NULL.
+												 * The callback can decode the message when needed with rsslReactorGetRDMLoginMsg(), rsslReactorGetRDMDirectoryMsg() or rsslReactorGetRDMDictionaryMsg(). 
+												 * Messages the RsslReactor itself needs, such as the directory used to request dictionaries, are still decoded. */
 } RsslCreateReactorOptions;
 
 /**
@@ -235,6 +279,7 @@ RTR_C_INLINE void rsslClearCreateReactorOptions(RsslCreateReactorOptions *pReact
 	memset(pReactorOpts, 0, sizeof(RsslCreateReactorOptions));
 	pReactorOpts->dispatchDecodeMemoryBufferSize = 65536;
 	pReactorOpts->port = 55000;
+	pReactorOpts->notifierType = RSSL_RC_NT_SELECT;
 }
 
 /**
@@ -256,6 +301,19 @@ RSSL_VA_API RsslReactor *rsslCreateReactor(RsslCreateReactorOptions *pReactorOpt
  */
 RSSL_VA_API RsslRet rsslDestroyReactor(RsslReactor *pReactor, RsslErrorInfo *pError);
 
+/**
+ * @brief Returns the statistics of an RsslReactor's channels, added together.
+ * Only channels currently held by the RsslReactor are included.
+ * @param pReactor The RsslReactor to get statistics from.
+ * @param pStatistics RsslReactorChannelStatistics structure to be populated with the statistics.
+ * @param reset If RSSL_TRUE, a new interval is started for each channel after the statistics are returned.
+ * @param pError Error structure to be populated in the event of failure.
+ * @return RSSL_RET_SUCCESS, if successful.
+ * @return RSSL_RET_INVALID_ARGUMENT, if the RsslReactor does not keep statistics.
+ * @see RsslCreateReactorOptions.enableChannelStatistics, rsslReactorGetChannelStatistics
+ */
+RSSL_VA_API RsslRet rsslReactorGetStatistics(RsslReactor *pReactor, RsslReactorChannelStatistics *pStatistics, RsslBool reset, RsslErrorInfo *pError);
+
 typedef struct
 {
 	RsslConnectOptions	rsslConnectOptions;		/*!< Options for creating the connection. */
@@ -286,6 +344,14 @@ typedef struct
 	RsslReactorConnectInfo	*reactorConnectionList;	/*!< A list of connnections.  Each connection in the list will be tried with each reconnection attempt. */
 	RsslUInt32				connectionCount;		/*!< The number of connections in reactorConnectionList. */
 
+	RsslUInt32				packingBufferSize;		/*!< If nonzero, messages submitted with rsslReactorSubmitMsg() are packed into buffers of up to this size(in bytes) instead of being written one at a time. 
+													 * Applies only when the watchlist is not enabled, and only on connection types that support packing(RSSL_CONN_TYPE_SOCKET, RSSL_CONN_TYPE_ENCRYPTED and RSSL_CONN_TYPE_HTTP);
+													 * on others, messages are written one at a time. The size is limited to the channel's maxFragmentSize. */
+	RsslUInt32				packingMaxLatency;		/*!< When packing, the maximum time(in milliseconds) that a message is held in a packed buffer before the buffer is written. See rsslReactorFlushPackedBuffer. */
+	RsslUInt32				busyPollIdleTimeout;	/*!< If nonzero, the channel is busy-polled once it receives data: rsslReactorDispatch() reads it on every call instead of waiting for its descriptor to be ready, 
+													 * and keeps returning a positive value so the application keeps dispatching. Once the channel has received nothing for this long(in milliseconds), 
+													 * it returns to waiting for its descriptor until data arrives again. When every active channel is busy-polled, rsslReactorDispatch() does not check descriptors at all. */
+
 } RsslReactorConnectOptions;
 
 /**
@@ -302,6 +368,10 @@ RTR_C_INLINE void rsslClearReactorConnectOptions(RsslReactorConnectOptions *pOpt
 
 	pOpts->reactorConnectionList = NULL;
 	pOpts->connectionCount = 0;
+
+	pOpts->packingBufferSize = 0;
+	pOpts->packingMaxLatency = 10;
+	pOpts->busyPollIdleTimeout = 0;
 }
 
 /**
@@ -323,6 +393,10 @@ typedef struct
 	RsslAcceptOptions	rsslAcceptOptions;		/*!< Options for accepting the connection. */
 	RsslUInt32			initializationTimeout;	/*!< Time(in seconds) to wait for successful initialization of a channel. 
 												 * If initialization does not complete in time, a RsslReactorChannelEvent will be sent indicating that the channel is down. */
+	RsslUInt32			packingBufferSize;		/*!< If nonzero, messages submitted with rsslReactorSubmitMsg() are packed into buffers of up to this size(in bytes) instead of being written one at a time. 
+												 * Ignored on connection types that do not support packing, as with RsslReactorConnectOptions.packingBufferSize. The size is limited to the channel's maxFragmentSize. */
+	RsslUInt32			packingMaxLatency;		/*!< When packing, the maximum time(in milliseconds) that a message is held in a packed buffer before the buffer is written. See rsslReactorFlushPackedBuffer. */
+	RsslUInt32			busyPollIdleTimeout;	/*!< If nonzero, the channel is busy-polled once it receives data. See RsslReactorConnectOptions.busyPollIdleTimeout. */
 } RsslReactorAcceptOptions;
 
 /**
@@ -333,6 +407,9 @@ RTR_C_INLINE void rsslClearReactorAcceptOptions(RsslReactorAcceptOptions *pOpts)
 {
 	rsslClearAcceptOpts(&pOpts->rsslAcceptOptions);
 	pOpts->initializationTimeout = 60;
+	pOpts->packingBufferSize = 0;
+	pOpts->packingMaxLatency = 10;
+	pOpts->busyPollIdleTimeout = 0;
 }
 
 /**
@@ -362,7 +439,11 @@ RSSL_VA_API RsslRet rsslReactorCloseChannel(RsslReactor *pReactor, RsslReactorCh
 typedef struct
 {
 	RsslReactorChannel	*pReactorChannel;	/*!< If specified, only events and messages for this channel with be processed. If not specified, messages and events for all channels will be processed. */
-	RsslUInt32			maxMessages;		/*!< The maximum number of events or messages to process for this call to rsslReactorDispatch(). */
+	RsslUInt32			maxMessages;		/*!< The maximum number of events or messages to process for this call to rsslReactorDispatch(). Each event or message counts against this limit by its weight(see eventWeight and readWeight). */
+	RsslUInt32			maxDispatchTimeUsec;	/*!< If nonzero, the maximum time(in microseconds) to spend in this call to rsslReactorDispatch(). The time is checked after each event or message, 
+												 * so a single callback that takes longer is not interrupted. If time runs out while channels still have data, a positive value is returned. */
+	RsslUInt32			eventWeight;		/*!< Amount each event from the RsslReactor's queues(channel events, timers, and internal events) counts against maxMessages. A weight of 0 is treated as 1. */
+	RsslUInt32			readWeight;			/*!< Amount each message read from a channel counts against maxMessages. A weight of 0 is treated as 1. */
 } RsslReactorDispatchOptions;
 
 /**
@@ -373,6 +454,9 @@ RTR_C_INLINE void rsslClearReactorDispatchOptions(RsslReactorDispatchOptions *pO
 {
 	pOpts->pReactorChannel = NULL;
 	pOpts->maxMessages = 100;
+	pOpts->maxDispatchTimeUsec = 0;
+	pOpts->eventWeight = 1;
+	pOpts->readWeight = 1;
 }
 
 /**
@@ -387,6 +471,39 @@ RTR_C_INLINE void rsslClearReactorDispatchOptions(RsslReactorDispatchOptions *pO
  */
 RSSL_VA_API RsslRet rsslReactorDispatch(RsslReactor *pReactor, RsslReactorDispatchOptions *pDispatchOpts, RsslErrorInfo *pError);
 
+/**
+ * @brief Returns the RDM representation of the message in a login message event, decoding it if necessary.
+ * Messages are only left undecoded when the RsslReactor was created with lazyRDMDecoding. Decoding can only be done from the loginMsgCallback that received the event.
+ * @param pReactorChannel The channel that received the event.
+ * @param pEvent The event passed to the callback. Its pRDMLoginMsg is set to the decoded message.
+ * @param pError Error structure to be populated in the event of failure.
+ * @return The decoded message, or NULL if it could not be decoded.
+ * @see RsslCreateReactorOptions.lazyRDMDecoding, RsslRDMLoginMsgEvent
+ */
+RSSL_VA_API RsslRDMLoginMsg *rsslReactorGetRDMLoginMsg(RsslReactorChannel *pReactorChannel, RsslRDMLoginMsgEvent *pEvent, RsslErrorInfo *pError);
+
+/**
+ * @brief Returns the RDM representation of the message in a directory message event, decoding it if necessary.
+ * Messages are only left undecoded when the RsslReactor was created with lazyRDMDecoding. Decoding can only be done from the directoryMsgCallback that received the event.
+ * @param pReactorChannel The channel that received the event.
+ * @param pEvent The event passed to the callback. Its pRDMDirectoryMsg is set to the decoded message.
+ * @param pError Error structure to be populated in the event of failure.
+ * @return The decoded message, or NULL if it could not be decoded.
+ * @see RsslCreateReactorOptions.lazyRDMDecoding, RsslRDMDirectoryMsgEvent
+ */
+RSSL_VA_API RsslRDMDirectoryMsg *rsslReactorGetRDMDirectoryMsg(RsslReactorChannel *pReactorChannel, RsslRDMDirectoryMsgEvent *pEvent, RsslErrorInfo *pError);
+
+/**
+ * @brief Returns the RDM representation of the message in a dictionary message event, decoding it if necessary.
+ * Messages are only left undecoded when the RsslReactor was created with lazyRDMDecoding. Decoding can only be done from the dictionaryMsgCallback that received the event.
+ * @param pReactorChannel The channel that received the event.
+ * @param pEvent The event passed to the callback. Its pRDMDictionaryMsg is set to the decoded message.
+ * @param pError Error structure to be populated in the event of failure.
+ * @return The decoded message, or NULL if it could not be decoded.
+ * @see RsslCreateReactorOptions.lazyRDMDecoding, RsslRDMDictionaryMsgEvent
+ */
+RSSL_VA_API RsslRDMDictionaryMsg *rsslReactorGetRDMDictionaryMsg(RsslReactorChannel *pReactorChannel, RsslRDMDictionaryMsgEvent *pEvent, RsslErrorInfo *pError);
+
 /**
  * @brief Options for submitting a message
  * @see rsslReactorSubmit
@@ -434,6 +551,8 @@ RSSL_VA_API RsslRet rsslReactorSubmit(RsslReactor *pReactor, RsslReactorChannel
 typedef struct
 {
 	void		*pUserSpec;			/*!< User-specified pointer to return as the application receives events related to this request. */
+	RsslUInt8	requestRank;		/*!< Rank of this request when the watchlist paces item requests by RSSL_RC_RPO_RANK. Items are requested 
+									 * in order of the highest rank among their requests; the default of 0 is the lowest. */
 } RsslReactorRequestMsgOptions;
 
 typedef struct
@@ -453,11 +572,55 @@ RTR_C_INLINE void rsslClearReactorSubmitMsgOptions(RsslReactorSubmitMsgOptions *
 	pOpts->minorVersion = RSSL_RWF_MINOR_VERSION;
 }
 
+/**
+ * @brief Saves the item requests of a channel's watchlist to a file, so that a later channel can restore them through RsslConsumerWatchlistOptions::snapshotFile,
+ * for example after the application restarts.
+ * Each streaming item request is saved with its stream ID, key, service, QoS, priority, view, and requestRank, along with the cached directory.
+ * User-specified pointers are not saved, since they are not meaningful to another process; restored requests have a NULL pUserSpec.
+ * @param pReactor The reactor handling the channel.
+ * @param pChannel The channel whose watchlist is saved. The watchlist must be enabled on it.
+ * @param fileName Name of the file to write. An existing file is replaced.
+ * @param pError Error structure to be populated in the event of an error.
+ * @return RSSL_RET_SUCCESS, if the snapshot was written. A failure RsslRet otherwise.
+ */
+RSSL_VA_API RsslRet rsslReactorSaveWatchlistSnapshot(RsslReactor *pReactor, RsslReactorChannel *pChannel, const char *fileName, RsslErrorInfo *pError);
+
 /**
   * @brief Sends an RsslMsg or RsslRDM message to the ReactorChannel.
   * When the watchlist is enabled, the message is submitted to the watchlist for processing.  If the watchlist is not enabled, the message is encoded and sent directly. */
 RSSL_VA_API RsslRet rsslReactorSubmitMsg(RsslReactor *pReactor, RsslReactorChannel *pChannel, RsslReactorSubmitMsgOptions *pOptions, RsslErrorInfo *pError);
 
+/**
+ * @brief Sends several RsslMsg or RsslRDM messages to the ReactorChannel in a single call.
+ * Each message is handled as it would be by rsslReactorSubmitMsg(), in order. If the watchlist is not enabled,
+ * RsslMsg structures are encoded back-to-back into packed buffers, so that the messages are written in as few buffers as possible(on connection types that support packing:
+ * RSSL_CONN_TYPE_SOCKET, RSSL_CONN_TYPE_ENCRYPTED and RSSL_CONN_TYPE_HTTP; on others, each message is written in its own buffer).
+ * Processing stops at the first message that fails, so that messages are never sent out of order.
+ * @param pReactor The reactor handling the channel.
+ * @param pChannel The channel to which the messages are sent.
+ * @param pOptionsArray Array of options, one for each message.
+ * @param msgCount Number of entries in pOptionsArray.
+ * @param pMsgRets Optional array of msgCount entries. If present, each entry is populated with the result of submitting the corresponding message. Messages that were not submitted due to an earlier failure are given RSSL_RET_FAILURE.
+ * @param pError Error structure to be populated in the event of failure.
+ * @return RSSL_RET_SUCCESS, if all messages were submitted.
+ * @return failure codes, if a message could not be submitted. pError describes the failure.
+ * @see rsslReactorSubmitMsg, RsslReactorSubmitMsgOptions
+ */
+RSSL_VA_API RsslRet rsslReactorSubmitMsgBatch(RsslReactor *pReactor, RsslReactorChannel *pChannel, RsslReactorSubmitMsgOptions *pOptionsArray, RsslUInt32 msgCount,
+		RsslRet *pMsgRets, RsslErrorInfo *pError);
+
+/**
+ * @brief Writes any messages that are being held in a packed buffer for the given RsslReactorChannel.
+ * Packed buffers are also written when they are full and when the channel's packingMaxLatency expires, so this call is only needed if the application wants to send the messages sooner.
+ * @param pReactor The reactor handling the channel.
+ * @param pChannel The channel whose packed buffer should be written.
+ * @param pError Error structure to be populated in the event of failure.
+ * @return RSSL_RET_SUCCESS, if the buffer was written or there was nothing to write.
+ * @return failure codes, if the buffer could not be written.
+ * @see RsslReactorConnectOptions, RsslReactorAcceptOptions, rsslReactorSubmitMsg
+ */
+RSSL_VA_API RsslRet rsslReactorFlushPackedBuffer(RsslReactor *pReactor, RsslReactorChannel *pChannel, RsslErrorInfo *pError);
+
 /**
  * @brief The options for opening a TunnelStream.
  * @see RsslTunnelStream
@@ -599,6 +762,110 @@ RTR_C_INLINE void rsslClearReactorRejectTunnelStreamOptions(RsslReactorRejectTun
  */
 RSSL_VA_API RsslRet rsslReactorRejectTunnelStream(RsslTunnelStreamRequestEvent *pEvent, RsslReactorRejectTunnelStreamOptions *pRsslReactorRejectTunnelStreamOptions, RsslErrorInfo *pError);
 
+/**
+ * @brief A group of RsslReactors, each dispatched by its own thread. Applications create an RsslReactorGroup by calling rsslCreateReactorGroup and add channels to it by calling rsslReactorGroupConnect/rsslReactorGroupAccept.
+ * Each channel belongs to one reactor of the group, and its callbacks are called from that reactor's dispatch thread, so channels on different threads do not contend for the same lock.
+ * Applications do not call rsslReactorDispatch() on the reactors of a group.
+ * The reactors of a group share a single worker thread(which initializes, flushes and pings their channels), rather than each starting its own.
+ * @see rsslCreateReactorGroup, rsslDestroyReactorGroup, rsslReactorGroupConnect, rsslReactorGroupAccept
+ */
+typedef struct
+{
+	RsslReactor	**reactors;		/*!< The reactors of the group, one per dispatch thread. */
+	RsslUInt32	reactorCount;	/*!< The number of reactors in the reactors array. */
+	void		*userSpecPtr;	/*!< A user-specified pointer associated with this RsslReactorGroup. */
+} RsslReactorGroup;
+
+/**
+ * @brief Signature of a Reactor Group Thread Failure Callback function.
+ * Called from a dispatch thread of an RsslReactorGroup when rsslReactorDispatch() fails on its reactor. The reactor has shut down(its channels have already been reported down), and the thread stops after the callback returns.
+ * New channels are no longer added to the reactor. The RsslReactorGroup must not be destroyed from the callback.
+ * @see RsslCreateReactorGroupOptions
+ */
+typedef void RsslReactorGroupThreadFailureCallback(RsslReactorGroup*, RsslReactor*, RsslErrorInfo*);
+
+/**
+ * @brief Configuration options for creating an RsslReactorGroup.
+ * @see rsslCreateReactorGroup
+ */
+typedef struct
+{
+	RsslCreateReactorOptions	reactorOptions;		/*!< Options used to create each reactor of the group. The epoll notifier is used where it is available, so that each thread can wait on all of its channels. */
+	RsslUInt32					threadCount;		/*!< The number of dispatch threads(and reactors) to create. Must be nonzero. */
+	RsslInt32					*cpuIds;			/*!< If specified, dispatch thread i is bound to the CPU given by cpuIds[i]. Threads beyond cpuIdCount, or given a negative ID, are not bound. */
+	RsslUInt32					cpuIdCount;			/*!< The number of entries in cpuIds. */
+	RsslUInt32					maxMessages;		/*!< The maximum number of events or messages each dispatch thread processes per call to rsslReactorDispatch(). */
+	RsslUInt32					dispatchWaitTimeout;	/*!< The maximum time(in microseconds) a dispatch thread waits for activity before checking whether the group is being destroyed.
+														 * On platforms without epoll, each wait selects on a copy of the reactor's descriptors, so a channel that becomes active during a wait is not read until the wait ends. */
+	RsslReactorGroupThreadFailureCallback	*threadFailureCallback;	/*!< If specified, called when a dispatch thread stops because its reactor failed. */
+	void						*userSpecPtr;		/*!< A user-specified pointer which will be set on the RsslReactorGroup. */
+} RsslCreateReactorGroupOptions;
+
+/**
+ * @brief Clears an RsslCreateReactorGroupOptions object.
+ * @see RsslCreateReactorGroupOptions
+ */
+RTR_C_INLINE void rsslClearCreateReactorGroupOptions(RsslCreateReactorGroupOptions *pOpts)
+{
+	memset(pOpts, 0, sizeof(RsslCreateReactorGroupOptions));
+	rsslClearCreateReactorOptions(&pOpts->reactorOptions);
+	pOpts->threadCount = 1;
+	pOpts->maxMessages = 100;
+	pOpts->dispatchWaitTimeout = 1000;
+}
+
+/**
+ * @brief Creates an RsslReactorGroup and starts its dispatch threads, and the worker thread its reactors share.
+ * @param pOpts Configuration options for creating the RsslReactorGroup.
+ * @param pError Error structure to be populated in the event of an error.
+ * @return Pointer to the newly created RsslReactorGroup. If the pointer is NULL, an error occurred.
+ * @see RsslCreateReactorGroupOptions, RsslErrorInfo
+ */
+RSSL_VA_API RsslReactorGroup *rsslCreateReactorGroup(RsslCreateReactorGroupOptions *pOpts, RsslErrorInfo *pError);
+
+/**
+ * @brief Stops the dispatch threads of an RsslReactorGroup and destroys its reactors, as rsslDestroyReactor does.
+ * Once this call is made, the RsslReactorGroup is destroyed and no further calls should be made with it.  This function is not thread-safe and must not be called from a callback.
+ * @param pReactorGroup The reactor group to destroy.
+ * @param pError Error structure to be populated in the event of an error.
+ * @return RSSL_RET_SUCCESS, if every dispatch thread ran until the group was destroyed.
+ * @return The failure returned by rsslReactorDispatch(), if a dispatch thread stopped early. pError is populated with its error.
+ * @see RsslReactorGroup, RsslErrorInfo
+ */
+RSSL_VA_API RsslRet rsslDestroyReactorGroup(RsslReactorGroup *pReactorGroup, RsslErrorInfo *pError);
+
+/**
+ * @brief Adds a client-side channel to one of the reactors of an RsslReactorGroup. Equivalent to rsslReactorConnect() on the chosen reactor.
+ * @param pReactorGroup The reactor group that will handle the new connection.
+ * @param threadHint If zero or greater, the channel is added to the reactor at (threadHint % reactorCount). If negative, the reactors are chosen in round-robin order.
+ * When called from a callback, the hint should select the reactor that called it, since waiting on another reactor from a callback may deadlock.
+ * Reactors whose dispatch thread has stopped are skipped in favor of the next one; if all have stopped, RSSL_RET_FAILURE is returned.
+ * @param pOpts The RsslReactorConnectOptions to configure options for this connection.
+ * @param pRole Structure representing the role of this connection.
+ * @param pError Error structure to be populated in the event of failure.
+ * @see RsslReactorGroup, rsslReactorConnect
+ */
+RSSL_VA_API RsslRet rsslReactorGroupConnect(RsslReactorGroup *pReactorGroup, RsslInt32 threadHint, RsslReactorConnectOptions *pOpts, RsslReactorChannelRole *pRole, RsslErrorInfo *pError);
+
+/**
+ * @brief Adds a server-side channel to one of the reactors of an RsslReactorGroup. Equivalent to rsslReactorAccept() on the chosen reactor.
+ * @param pReactorGroup The reactor group that will handle the new connection.
+ * @param threadHint If zero or greater, the channel is added to the reactor at (threadHint % reactorCount). If negative, the reactors are chosen in round-robin order.
+ * Reactors whose dispatch thread has stopped are skipped, as in rsslReactorGroupConnect().
+ * @param pServer The RsslServer that is accepting this connection.
+ * @param pOpts The RsslReactorAcceptOptions to configure options for this connection.
+ * @param pRole Structure representing the role of this connection.
+ * @param pError Error structure to be populated in the event of failure.
+ * @see RsslReactorGroup, rsslReactorAccept
+ */
+RSSL_VA_API RsslRet rsslReactorGroupAccept(RsslReactorGroup *pReactorGroup, RsslInt32 threadHint, RsslServer *pServer, RsslReactorAcceptOptions *pOpts, RsslReactorChannelRole *pRole, RsslErrorInfo *pError);
+
+/**
+ * @brief Returns the reactor of an RsslReactorGroup that handles the given channel, for use with functions such as rsslReactorSubmitMsg() and rsslReactorCloseChannel().
+ * @see RsslReactorGroup, RsslReactorChannel
+ */
+RSSL_VA_API RsslReactor *rsslReactorGroupGetChannelReactor(RsslReactorGroup *pReactorGroup, RsslReactorChannel *pChannel);
+
 /**
  *	@}
  */
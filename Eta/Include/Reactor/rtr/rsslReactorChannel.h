@@ -39,6 +39,19 @@ typedef struct
 	void	*userSpecPtr;		/*!< A user specified pointer associated with this RsslReactorChannel. */
 } RsslReactorChannel;
 
+/**
+ * @brief Usage of one of the memory pools of a channel's watchlist.
+ * The pools grow as items are requested, and release memory once many of their blocks are free again.
+ * @see RsslReactorChannelInfo
+ */
+typedef struct
+{
+	RsslUInt32	blocksInUse;	/*!< Number of blocks in use. */
+	RsslUInt32	freeBlocks;		/*!< Number of blocks allocated, but not in use. */
+	RsslUInt32	chunkCount;		/*!< Number of chunks of blocks allocated. */
+	RsslUInt32	missCount;		/*!< Number of times the pool had no free block and allocated more memory. */
+} RsslReactorWatchlistPoolInfo;
+
 /**
  * @brief Statistics returned by the rsslReactorGetChannelInfo() call.
  * @see RsslChannelInfo, rsslReactorGetChannelInfo
@@ -46,6 +59,10 @@ typedef struct
 typedef struct
 {
 	RsslChannelInfo	rsslChannelInfo;	/*!< RsslChannel information. */
+	RsslUInt64		packedMsgCount;		/*!< Number of messages the RsslReactor has written in packed buffers on this channel. See RsslReactorConnectOptions.packingBufferSize. */
+	RsslUInt64		packedBufferCount;	/*!< Number of packed buffers the RsslReactor has written on this channel. packedMsgCount / packedBufferCount is the average number of messages per buffer. */
+	RsslReactorWatchlistPoolInfo	watchlistRequestPool;	/*!< Usage of the watchlist's pool of item requests. Zero if the watchlist is not enabled. */
+	RsslReactorWatchlistPoolInfo	watchlistStreamPool;	/*!< Usage of the watchlist's pool of item streams. Zero if the watchlist is not enabled. */
 } RsslReactorChannelInfo;
 
 /**
@@ -57,14 +74,67 @@ typedef struct
  * @return RsslRet failure codes, if an error occurred.
  * @see RsslReactor, RsslReactorChannel, RsslReactorChannelInfo, RsslErrorInfo
  */
-RTR_C_INLINE RsslRet rsslReactorGetChannelInfo(RsslReactorChannel *pReactorChannel, RsslReactorChannelInfo *pInfo, RsslErrorInfo *pError)
+RSSL_VA_API RsslRet rsslReactorGetChannelInfo(RsslReactorChannel *pReactorChannel, RsslReactorChannelInfo *pInfo, RsslErrorInfo *pError);
+
+/**
+ * @brief Number of buckets in an RsslReactorLatencyHistogram.
+ * @see RsslReactorLatencyHistogram
+ */
+#define RSSL_RC_LATENCY_HISTOGRAM_BUCKETS 24
+
+/**
+ * @brief Distribution of measured times, in microseconds.
+ * Bucket 0 counts times under 1 microsecond. Bucket i(for i > 0) counts times of at least 2^(i-1) and less than 2^i microseconds; the last bucket also counts any longer time.
+ * @see RsslReactorChannelStatistics
+ */
+typedef struct
 {
-	RsslRet ret = rsslGetChannelInfo(pReactorChannel->pRsslChannel, &pInfo->rsslChannelInfo, &pError->rsslError);
-	if (ret != RSSL_RET_SUCCESS)
-		rsslSetErrorInfoLocation(pError, __FILE__, __LINE__);
-	return ret;
+	RsslUInt64	count;										/*!< Number of times measured. */
+	RsslUInt64	totalUsec;									/*!< Sum of the times measured, in microseconds. */
+	RsslUInt64	buckets[RSSL_RC_LATENCY_HISTOGRAM_BUCKETS];	/*!< Number of times measured in each bucket. */
+} RsslReactorLatencyHistogram;
+
+/**
+ * @brief Counters returned by the rsslReactorGetChannelStatistics() and rsslReactorGetStatistics() calls.
+ * Statistics are only kept when RsslCreateReactorOptions.enableChannelStatistics is set. Each value covers the interval since the statistics were last reset.
+ * @see rsslReactorGetChannelStatistics, rsslReactorGetStatistics
+ */
+typedef struct
+{
+	RsslUInt64	dispatchCount;			/*!< Number of rsslReactorDispatch() calls that read from the channel. msgsRead / dispatchCount is the average number of messages read per dispatch. */
+	RsslUInt64	readCount;				/*!< Number of times rsslRead() was called on the channel. */
+	RsslUInt64	msgsRead;				/*!< Number of messages read from the channel. */
+	RsslUInt64	bytesRead;				/*!< Number of bytes read from the channel. */
+	RsslUInt64	uncompressedBytesRead;	/*!< Number of bytes read from the channel, before decompression. */
+	RsslUInt64	eventCount;				/*!< Number of internal events dispatched for the channel, such as channel state changes from the RsslReactor's worker thread, flush completions, and timer expirations. */
+	RsslUInt64	flushRequestCount;		/*!< Number of times the RsslReactor signaled its worker thread to flush the channel. */
+	RsslUInt64	flushCount;				/*!< Number of times the worker thread called rsslFlush() on the channel. */
+	RsslUInt64	writeCallAgainCount;	/*!< Number of writes to the channel that returned RSSL_RET_WRITE_CALL_AGAIN. */
+	RsslReactorLatencyHistogram	callbackTime;	/*!< Time spent in the application's callback functions for the channel. */
+	RsslReactorLatencyHistogram	flushTime;		/*!< Time the worker thread spent in rsslFlush() for the channel. */
+} RsslReactorChannelStatistics;
+
+/**
+ * @brief Clears an RsslReactorChannelStatistics object.
+ * @see RsslReactorChannelStatistics
+ */
+RTR_C_INLINE void rsslClearReactorChannelStatistics(RsslReactorChannelStatistics *pStatistics)
+{
+	memset(pStatistics, 0, sizeof(RsslReactorChannelStatistics));
 }
 
+/**
+ * @brief Returns the statistics kept for an RsslReactorChannel.
+ * @param pReactorChannel The channel to get statistics from.
+ * @param pStatistics RsslReactorChannelStatistics structure to be populated with the statistics.
+ * @param reset If RSSL_TRUE, a new interval is started after the statistics are returned.
+ * @param pError Error structure to be populated in the event of failure.
+ * @return RSSL_RET_SUCCESS, if successful.
+ * @return RSSL_RET_INVALID_ARGUMENT, if the channel's RsslReactor does not keep statistics.
+ * @see RsslReactorChannel, RsslReactorChannelStatistics, RsslErrorInfo
+ */
+RSSL_VA_API RsslRet rsslReactorGetChannelStatistics(RsslReactorChannel *pReactorChannel, RsslReactorChannelStatistics *pStatistics, RsslBool reset, RsslErrorInfo *pError);
+
 
 
 /**
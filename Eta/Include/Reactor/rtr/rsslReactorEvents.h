@@ -65,6 +65,9 @@ typedef struct
 {
 	const RsslBuffer	*pServiceName;	/*!< Name of service associated with the stream, if any. */
 	void				*pUserSpec;		/*!< User-specified pointer given when the stream was opened. */
+	void				**pUserSpecList;	/*!< When RsslConsumerWatchlistOptions::enableFanoutList is set and an update is delivered once for several requests 
+											 * of the same item, contains the user-specified pointers of all of those requests(pUserSpec is the first entry). Otherwise NULL. */
+	RsslUInt32			userSpecCount;	/*!< Number of entries in pUserSpecList. */
 } RsslStreamInfo;
 
 /**
@@ -201,6 +201,23 @@ RSSL_VA_API RsslBuffer *rsslTunnelStreamGetBuffer(RsslTunnelStream *pTunnel,
  */
 RSSL_VA_API RsslRet rsslTunnelStreamReleaseBuffer(RsslBuffer *pBuffer, RsslErrorInfo *pError);
 
+/**
+ * @brief Keeps the content of a received message after its callback returns.
+ * Buffers and messages passed to tunnel stream callbacks point directly into the channel's received data and are 
+ * only valid until the callback returns. The retained buffer is a reference-counted view of pooled memory holding 
+ * the received message: decompressed content is already there, and other content is moved there once, by the first 
+ * buffer retained from the message. Retaining more of the same message does not copy it again, and the memory is 
+ * reused once every buffer referencing it has been released.
+ * Retained buffers cannot be submitted, and must be released before the tunnel stream is closed.
+ * @param pTunnel The Tunnel Stream that received the message.
+ * @param pBuffer The received content, such as the pRsslBuffer or pRsslMsg->msgBase.encMsgBuffer of an RsslTunnelStreamMsgEvent.
+ * @param pError Error structure to be populated in the event of failure.
+ * @return the retained RsslBuffer, which must be released with rsslTunnelStreamReleaseBuffer(), or
+ *         NULL, if an error occurred (errorInfo will be populated with information).
+ * @see RsslBuffer, RsslTunnelStream, RsslTunnelStreamMsgEvent, rsslTunnelStreamReleaseBuffer
+ */
+RSSL_VA_API RsslBuffer *rsslTunnelStreamRetainBuffer(RsslTunnelStream *pTunnel, RsslBuffer *pBuffer, RsslErrorInfo *pError);
+
 /**
  * @brief Options for submitting a buffer to a tunnel Stream.
  * @see rsslTunnelStreamSubmit
@@ -232,6 +249,31 @@ RTR_C_INLINE void rsslClearTunnelStreamSubmitOptions(RsslTunnelStreamSubmitOptio
  */
 RSSL_VA_API RsslRet rsslTunnelStreamSubmit(RsslTunnelStream *pTunnelStream, RsslBuffer *pBuffer, RsslTunnelStreamSubmitOptions *pRsslTunnelStreamSubmitOptions, RsslErrorInfo *pError);
 
+/**
+ * @brief Flow control statistics returned by the rsslTunnelStreamGetInfo() call.
+ * @see rsslTunnelStreamGetInfo, RsslClassOfServiceFlowControl
+ */
+typedef struct
+{
+	RsslInt		bytesWaitingAck;			/*!< Amount of data sent that the remote end has not yet acknowledged. */
+	RsslInt		effectiveSendWindowSize;	/*!< Amount of data this end currently allows to be waiting for acknowledgement. This is the classOfService.flowControl.sendWindowSize, unless adaptiveSendWindow is enabled and has reduced it. */
+	RsslUInt32	roundTripTime;				/*!< Smoothed time, in milliseconds, between sending a message and receiving its acknowledgement. Zero until a message is acknowledged. */
+	RsslUInt32	roundTripTimeVariance;		/*!< Mean deviation of the round trip time, in milliseconds. */
+	RsslUInt64	ackRate;					/*!< Smoothed number of bytes per second acknowledged by the remote end, while data is waiting for acknowledgement. */
+	RsslUInt64	retransmitCount;			/*!< Number of messages this end has retransmitted. */
+} RsslTunnelStreamInfo;
+
+/**
+ * @brief Returns flow control statistics for a Tunnel Stream.
+ * @param pTunnelStream The Tunnel Stream to get information from.
+ * @param pInfo RsslTunnelStreamInfo structure to be populated with information.
+ * @param pError Error structure to be populated in the event of failure.
+ * @return RSSL_RET_SUCCESS, if successful.
+ * @return failure codes, if an error occurred (errorInfo will be populated with information).
+ * @see RsslTunnelStream, RsslTunnelStreamInfo, RsslErrorInfo
+ */
+RSSL_VA_API RsslRet rsslTunnelStreamGetInfo(RsslTunnelStream *pTunnelStream, RsslTunnelStreamInfo *pInfo, RsslErrorInfo *pError);
+
 #ifdef __cplusplus
 };
 #endif
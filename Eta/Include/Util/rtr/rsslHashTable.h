@@ -5,7 +5,8 @@
  * Copyright Thomson Reuters 2015. All rights reserved.
 */
 
-/* Implements a basic hash table using the RsslQueue. */
+/* Implements a basic hash table using the RsslQueue. 
+ * Tables initialized with rsslHashTableInitOpenAddressing() instead use open addressing(see below). */
 
 #ifndef RSSL_HASH_TABLE_H
 #define RSSL_HASH_TABLE_H
@@ -44,6 +45,14 @@ RTR_C_INLINE void rsslHashLinkInit(RsslHashLink *pLink)
 	rsslInitQueueLink(&pLink->queueLink);
 }
 
+/* Slot in an open-addressing hash table. */
+typedef struct
+{
+	RsslHashLink	*pLink;			/* Link stored in this slot. */
+	RsslUInt32		hashSum;		/* Hash sum of the link's key, so most mismatches are found without following pLink. */
+	RsslUInt32		probeLength;	/* Distance from the slot where the link's key hashes to, plus one. Zero if the slot is empty. */
+} RsslHashSlot;
+
 /* Hash Table structure. */
 typedef struct {
 	RsslUInt32				queueCount;
@@ -53,6 +62,18 @@ typedef struct {
 	RsslQueue				*queueList;
 	RsslHashSumFunction		*keyHashFunction;
 	RsslHashCompareFunction	*keyCompareFunction;
+
+	/* Used by open-addressing tables. */
+	RsslBool				openAddressing;
+	RsslHashSlot			*slots;					/* Slots. The number of slots is always a power of two. */
+	RsslUInt32				slotMask;
+	RsslUInt32				slotShift;				/* Shift used to find a key's slot from its hash sum. */
+	RsslHashSlot			*oldSlots;				/* Slots that are being moved to a larger table, if any. */
+	RsslUInt32				oldSlotMask;
+	RsslUInt32				oldSlotShift;
+	RsslUInt32				oldMaxProbeLength;		/* Longest probeLength in oldSlots. */
+	RsslUInt32				oldSlotMoveIndex;		/* Slots in oldSlots before this index have been moved. */
+	RsslUInt32				maxProbeLength;			/* Longest probeLength in slots. */
 } RsslHashTable;
 
 /* Initializes a hash table. */
@@ -60,6 +81,16 @@ RTR_C_INLINE RsslRet rsslHashTableInit(RsslHashTable *pTable, RsslUInt32 queueCo
 		RsslHashSumFunction *keyHashFunction, RsslHashCompareFunction *keyCompareFunction,
 		RsslBool dynamicSize, RsslErrorInfo *pErrorInfo);
 
+/* Initializes a hash table that uses open addressing.
+ * Instead of keeping a list of links for each bucket, the table keeps each link's hash sum alongside it in a single array of slots,
+ * so finding a key rarely needs to read anything outside of that array. Keys that collide are placed with Robin Hood hashing.
+ * The table grows when it is 7/8 full(regardless of dynamicSize), moving the existing links to the larger table a few at a time
+ * as links are inserted and removed, rather than all at once.
+ * All other hash table functions may be used with the table as usual. */
+RTR_C_INLINE RsslRet rsslHashTableInitOpenAddressing(RsslHashTable *pTable, RsslUInt32 initialCount, 
+		RsslHashSumFunction *keyHashFunction, RsslHashCompareFunction *keyCompareFunction,
+		RsslBool dynamicSize, RsslErrorInfo *pErrorInfo);
+
 /* Cleans up a hash table. */
 RTR_C_INLINE RsslRet rsslHashTableCleanup(RsslHashTable *pTable);
 
@@ -77,6 +108,32 @@ RTR_C_INLINE RsslHashLink *rsslHashTableFind(RsslHashTable *pTable, void *pKey,
  * This convenience macro can be used to cast from a RsslHashLink into the full object. */
 #define RSSL_HASH_LINK_TO_OBJECT(__objectType, __link, __pLink) ((__objectType*)((char*)__pLink - offsetof(__objectType, __link)))
 
+/* Hashes a sequence of bytes. Reads the data a word at a time, and mixes the result so that every bit of the sum
+ * depends on every byte. The seed may be used to combine several sequences into one sum. */
+RsslUInt32 rsslHashBytes(const char *data, RsslUInt32 length, RsslUInt32 seed);
+
+/* Mixes the bits of an integer key, so that keys that are sequential or differ only in their upper bits 
+ * still produce well-distributed sums. */
+RTR_C_INLINE RsslUInt32 rsslHashMixU32(RsslUInt32 key)
+{
+	key ^= key >> 16;
+	key *= 0x85ebca6bU;
+	key ^= key >> 13;
+	key *= 0xc2b2ae35U;
+	key ^= key >> 16;
+	return key;
+}
+
+RTR_C_INLINE RsslUInt32 rsslHashMixU64(RsslUInt64 key)
+{
+	key ^= key >> 33;
+	key *= 0xff51afd7ed558ccdULL;
+	key ^= key >> 33;
+	key *= 0xc4ceb9fe1a85ec53ULL;
+	key ^= key >> 33;
+	return (RsslUInt32)key ^ (RsslUInt32)(key >> 32);
+}
+
 /* RsslUInt16 hash functions. */
 RsslUInt32 rsslHashU16Sum(void *pKey);
 RsslBool rsslHashU16Compare(void *pKey1, void *pKey2);
@@ -143,9 +200,259 @@ RTR_C_INLINE RsslRet rsslHashTableCleanup(RsslHashTable *pTable)
 {
 	free(pTable->queueList);
 	pTable->queueList = NULL;
+	free(pTable->slots);
+	pTable->slots = NULL;
+	free(pTable->oldSlots);
+	pTable->oldSlots = NULL;
+	return RSSL_RET_SUCCESS;
+}
+
+/*** Open addressing ***/
+
+/* Number of old slots moved to the larger table each time a link is inserted or removed while the table is growing. */
+#define RSSL_HASH_SLOT_MOVE_COUNT 16
+
+/* Returns the slot that a hash sum maps to. The sum is multiplied by 2^32/phi so that sums differing only in 
+ * their upper bits(or that are sequential) are spread across the table. */
+RTR_C_INLINE RsslUInt32 _rsslHashSlotIndex(RsslUInt32 hashSum, RsslUInt32 slotShift)
+{
+	return (RsslUInt32)(hashSum * 2654435769U) >> slotShift;
+}
+
+RTR_C_INLINE RsslHashSlot *_rsslHashSlotsAlloc(RsslUInt32 slotCount)
+{
+	RsslUInt64 slotsSize = (RsslUInt64)slotCount * sizeof(RsslHashSlot);
+
+	if (slotsSize > (size_t)-1) /* overflow */
+		return NULL;
+
+	return (RsslHashSlot*)calloc(slotCount, sizeof(RsslHashSlot));
+}
+
+/* Places a link in the slots, displacing links that are closer to their own slot(Robin Hood hashing). */
+RTR_C_INLINE void _rsslHashSlotsInsert(RsslHashTable *pTable, RsslHashLink *pLink)
+{
+	RsslHashSlot slot, tmpSlot;
+	RsslUInt32 i = _rsslHashSlotIndex(pLink->hashSum, pTable->slotShift);
+
+	slot.pLink = pLink;
+	slot.hashSum = pLink->hashSum;
+	slot.probeLength = 1;
+
+	while (pTable->slots[i].probeLength)
+	{
+		if (pTable->slots[i].probeLength < slot.probeLength)
+		{
+			if (slot.probeLength > pTable->maxProbeLength)
+				pTable->maxProbeLength = slot.probeLength;
+
+			tmpSlot = pTable->slots[i];
+			pTable->slots[i] = slot;
+			slot = tmpSlot;
+		}
+
+		i = (i + 1) & pTable->slotMask;
+		++slot.probeLength;
+	}
+
+	if (slot.probeLength > pTable->maxProbeLength)
+		pTable->maxProbeLength = slot.probeLength;
+
+	pTable->slots[i] = slot;
+}
+
+/* Empties a slot, shifting back any following links that are not in their own slot. */
+RTR_C_INLINE void _rsslHashSlotsRemoveAt(RsslHashSlot *slots, RsslUInt32 slotMask, RsslUInt32 i)
+{
+	RsslUInt32 next;
+
+	while (slots[(next = (i + 1) & slotMask)].probeLength > 1)
+	{
+		slots[i] = slots[next];
+		--slots[i].probeLength;
+		i = next;
+	}
+
+	slots[i].pLink = NULL;
+	slots[i].probeLength = 0;
+}
+
+/* Moves some of the old slots' links to the current slots. */
+RTR_C_INLINE void _rsslHashTableMoveOldSlots(RsslHashTable *pTable, RsslUInt32 count)
+{
+	RsslUInt32 oldSlotCount = pTable->oldSlotMask + 1;
+
+	for (; count && pTable->oldSlotMoveIndex < oldSlotCount; --count, ++pTable->oldSlotMoveIndex)
+	{
+		RsslHashSlot *pSlot = &pTable->oldSlots[pTable->oldSlotMoveIndex];
+
+		/* Moved slots are left empty without shifting the links that follow, so lookups of the old slots 
+		 * must skip over the moved slots(see _rsslHashTableFindOldSlot). */
+		if (pSlot->probeLength)
+		{
+			_rsslHashSlotsInsert(pTable, pSlot->pLink);
+			pSlot->pLink = NULL;
+			pSlot->probeLength = 0;
+		}
+	}
+
+	if (pTable->oldSlotMoveIndex == oldSlotCount)
+	{
+		free(pTable->oldSlots);
+		pTable->oldSlots = NULL;
+	}
+}
+
+/* Starts growing the table to twice its size. */
+RTR_C_INLINE RsslRet _rsslHashTableGrow(RsslHashTable *pTable)
+{
+	RsslUInt32 newSlotCount = (pTable->slotMask + 1) * 2;
+	RsslHashSlot *newSlots;
+
+	/* Finish any previous move first. */
+	if (pTable->oldSlots)
+		_rsslHashTableMoveOldSlots(pTable, pTable->oldSlotMask + 1);
+
+	if (!newSlotCount || !(newSlots = _rsslHashSlotsAlloc(newSlotCount)))
+		return RSSL_RET_FAILURE;
+
+	pTable->oldSlots = pTable->slots;
+	pTable->oldSlotMask = pTable->slotMask;
+	pTable->oldSlotShift = pTable->slotShift;
+	pTable->oldMaxProbeLength = pTable->maxProbeLength;
+	pTable->oldSlotMoveIndex = 0;
+
+	pTable->slots = newSlots;
+	pTable->slotMask = newSlotCount - 1;
+	--pTable->slotShift;
+	pTable->maxProbeLength = 0;
+	pTable->thresholdCapacity = newSlotCount - newSlotCount / 8;
+
+	return RSSL_RET_SUCCESS;
+}
+
+/* Searches the current slots for a link, or for a link matching a key if pLink is NULL. Returns the slot index, or -1 if not found. */
+RTR_C_INLINE RsslInt32 _rsslHashTableFindSlot(RsslHashTable *pTable, RsslHashLink *pLink, void *pKey, RsslUInt32 hashSum)
+{
+	RsslUInt32 i = _rsslHashSlotIndex(hashSum, pTable->slotShift);
+	RsslUInt32 probeLength;
+
+	/* With Robin Hood hashing, a key can't be found past a slot whose link is closer to its own slot than the key would be. */
+	for (probeLength = 1; pTable->slots[i].probeLength >= probeLength; ++probeLength, i = (i + 1) & pTable->slotMask)
+	{
+		RsslHashSlot *pSlot = &pTable->slots[i];
+
+		if (pSlot->hashSum == hashSum
+				&& (pLink ? pSlot->pLink == pLink : pTable->keyCompareFunction(pKey, pSlot->pLink->pKey)))
+			return (RsslInt32)i;
+	}
+
+	return -1;
+}
+
+/* Searches the old slots for a link, or for a link matching a key if pLink is NULL. Returns the slot index, or -1 if not found. */
+RTR_C_INLINE RsslInt32 _rsslHashTableFindOldSlot(RsslHashTable *pTable, RsslHashLink *pLink, void *pKey, RsslUInt32 hashSum)
+{
+	RsslUInt32 i = _rsslHashSlotIndex(hashSum, pTable->oldSlotShift);
+	RsslUInt32 probeLength;
+
+	for (probeLength = 1; probeLength <= pTable->oldMaxProbeLength; ++probeLength, i = (i + 1) & pTable->oldSlotMask)
+	{
+		RsslHashSlot *pSlot = &pTable->oldSlots[i];
+
+		if (i < pTable->oldSlotMoveIndex)
+			continue; /* Already moved(its link may have been anywhere in the probe). */
+
+		if (pSlot->probeLength < probeLength)
+			return -1;
+
+		if (pSlot->hashSum == hashSum
+				&& (pLink ? pSlot->pLink == pLink : pTable->keyCompareFunction(pKey, pSlot->pLink->pKey)))
+			return (RsslInt32)i;
+	}
+
+	return -1;
+}
+
+RTR_C_INLINE RsslRet rsslHashTableInitOpenAddressing(RsslHashTable *pTable, RsslUInt32 initialCount, 
+		RsslHashSumFunction *keyHashFunction, RsslHashCompareFunction *keyCompareFunction,
+		RsslBool dynamicSize, RsslErrorInfo *pErrorInfo)
+{
+	RsslUInt32 slotCount = 8, slotShift = 29;
+
+	memset(pTable, 0, sizeof(RsslHashTable));
+
+	/* Use enough slots to hold the initial count without growing. */
+	while (slotCount - slotCount / 8 < initialCount && slotShift > 1)
+	{
+		slotCount *= 2;
+		--slotShift;
+	}
+
+	if (!(pTable->slots = _rsslHashSlotsAlloc(slotCount)))
+	{
+		rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, 
+				"Memory allocation failure.");
+		return RSSL_RET_FAILURE;
+	}
+
+	pTable->openAddressing = RSSL_TRUE;
+	pTable->slotMask = slotCount - 1;
+	pTable->slotShift = slotShift;
+	pTable->thresholdCapacity = slotCount - slotCount / 8;
+	pTable->dynamicSize = dynamicSize;
+	pTable->keyHashFunction = keyHashFunction;
+	pTable->keyCompareFunction = keyCompareFunction;
+
 	return RSSL_RET_SUCCESS;
 }
 
+RTR_C_INLINE void _rsslHashTableOAInsertLink(RsslHashTable *pTable, RsslHashLink *pLink)
+{
+	if (pTable->oldSlots)
+		_rsslHashTableMoveOldSlots(pTable, RSSL_HASH_SLOT_MOVE_COUNT);
+
+	/* If the table can't grow, keep using the current slots until they are full. */
+	if (pTable->elementCount >= pTable->thresholdCapacity && _rsslHashTableGrow(pTable) != RSSL_RET_SUCCESS
+			&& pTable->elementCount > pTable->slotMask)
+		return;
+
+	_rsslHashSlotsInsert(pTable, pLink);
+	pTable->elementCount++;
+}
+
+RTR_C_INLINE void _rsslHashTableOARemoveLink(RsslHashTable *pTable, RsslHashLink *pLink)
+{
+	RsslInt32 i;
+
+	if ((i = _rsslHashTableFindSlot(pTable, pLink, NULL, pLink->hashSum)) >= 0)
+		_rsslHashSlotsRemoveAt(pTable->slots, pTable->slotMask, (RsslUInt32)i);
+	else if (pTable->oldSlots && (i = _rsslHashTableFindOldSlot(pTable, pLink, NULL, pLink->hashSum)) >= 0)
+		_rsslHashSlotsRemoveAt(pTable->oldSlots, pTable->oldSlotMask, (RsslUInt32)i);
+	else
+		return;
+
+	pTable->elementCount--;
+
+	if (pTable->oldSlots)
+		_rsslHashTableMoveOldSlots(pTable, RSSL_HASH_SLOT_MOVE_COUNT);
+}
+
+RTR_C_INLINE RsslHashLink *_rsslHashTableOAFind(RsslHashTable *pTable, void *pKey, RsslUInt32 hashSum)
+{
+	RsslInt32 i;
+
+	if ((i = _rsslHashTableFindSlot(pTable, NULL, pKey, hashSum)) >= 0)
+		return pTable->slots[i].pLink;
+
+	if (pTable->oldSlots && (i = _rsslHashTableFindOldSlot(pTable, NULL, pKey, hashSum)) >= 0)
+		return pTable->oldSlots[i].pLink;
+
+	return NULL;
+}
+
+/*** Chaining ***/
+
 RTR_C_INLINE RsslRet rsslHashTableResize(RsslHashTable *pTable)
 {
 	RsslUInt32 newQueueCount = pTable->queueCount * 2 + 1;
@@ -211,6 +518,12 @@ RTR_C_INLINE void rsslHashTableInsertLink(RsslHashTable *pTable, RsslHashLink *p
 	pLink->hashSum = (pSum ? *pSum : pTable->keyHashFunction(pKey));
 	pLink->pKey = pKey;
 
+	if (pTable->openAddressing)
+	{
+		_rsslHashTableOAInsertLink(pTable, pLink);
+		return;
+	}
+
 	queueListLocation =  pLink->hashSum % pTable->queueCount;
 	pQueue = &pTable->queueList[queueListLocation];
 
@@ -226,18 +539,30 @@ RTR_C_INLINE void rsslHashTableInsertLink(RsslHashTable *pTable, RsslHashLink *p
 
 RTR_C_INLINE void rsslHashTableRemoveLink(RsslHashTable *pTable, RsslHashLink *pLink)
 {
-	RsslUInt32 queueListLocation = pLink->hashSum % pTable->queueCount;
+	RsslUInt32 queueListLocation;
+
+	if (pTable->openAddressing)
+	{
+		_rsslHashTableOARemoveLink(pTable, pLink);
+		return;
+	}
+
+	queueListLocation = pLink->hashSum % pTable->queueCount;
 	rsslQueueRemoveLink(&pTable->queueList[queueListLocation], &pLink->queueLink);
 	pTable->elementCount--;
 }
 
 RTR_C_INLINE RsslHashLink *rsslHashTableFind(RsslHashTable *pTable, void *pKey, RsslUInt32 *pSum)
 {
-	RsslUInt32 queueListLocation = (pSum ? *pSum : pTable->keyHashFunction(pKey)) 
-		% pTable->queueCount;
-	RsslQueue *pQueue = &pTable->queueList[queueListLocation];
+	RsslUInt32 hashSum = (pSum ? *pSum : pTable->keyHashFunction(pKey));
+	RsslQueue *pQueue;
 	RsslQueueLink *pLink;
 
+	if (pTable->openAddressing)
+		return _rsslHashTableOAFind(pTable, pKey, hashSum);
+
+	pQueue = &pTable->queueList[hashSum % pTable->queueCount];
+
 	for(pLink = rsslQueuePeekFront(pQueue); pLink; pLink = rsslQueuePeekNext(pQueue, pLink))
 	{
 		RsslHashLink *pHashLink = RSSL_HASH_LINK_FROM_QUEUE_LINK(pLink);
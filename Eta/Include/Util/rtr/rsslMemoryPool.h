@@ -12,17 +12,35 @@
 #include "rtr/rsslErrorInfo.h"
 #include <assert.h>
 #include <malloc.h>
+#include <string.h>
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-/* Creates a pool of fixed-size memory blocks. */
+/* Creates a pool of fixed-size memory blocks. 
+ * By default, each block is allocated individually. A pool initialized with rsslMemoryPoolInitSlab() instead
+ * carves its blocks out of large contiguous chunks, so that blocks in use are densely packed. */
+
+/* Flags for rsslMemoryPoolInitSlab(). */
+typedef enum
+{
+	RSSL_MPLF_NONE			= 0x0,
+	RSSL_MPLF_HUGE_PAGES	= 0x1	/* Back chunks with huge pages where available(Linux only). Falls back to normal pages if they cannot be used. */
+} RsslMemoryPoolFlags;
 
 typedef struct
 {
 	int			blockSize;
-	RsslQueue	blocks;
+	RsslQueue	blocks;				/* Free blocks. */
+	RsslUInt32	blocksInUse;		/* Number of blocks currently retrieved from the pool. */
+	RsslUInt32	missCount;			/* Number of times a block was retrieved when no free block was available. */
+
+	/* Used in slab mode. */
+	RsslBool	isSlab;
+	RsslUInt32	flags;				/* RsslMemoryPoolFlags. */
+	int			chunkBlockCount;	/* Number of blocks to add when growing. */
+	RsslQueue	chunks;				/* Chunks allocated by the pool. */
 } RsslMemoryPool;
 
 typedef struct
@@ -30,13 +48,40 @@ typedef struct
 	RsslQueueLink qlPool;
 } RsslMemoryBlock;
 
+/* Statistics about a pool. */
+typedef struct
+{
+	RsslUInt32	blocksInUse;		/* Number of blocks currently retrieved from the pool. */
+	RsslUInt32	freeBlocks;			/* Number of blocks available in the pool. */
+	RsslUInt32	chunkCount;			/* Slab mode: Number of chunks allocated. */
+	RsslUInt32	missCount;			/* Number of times the pool had no free block and had to allocate memory. */
+} RsslMemoryPoolStats;
+
 /* Initializes a pool. */
 RTR_C_INLINE RsslRet rsslMemoryPoolInit(RsslMemoryPool *pPool, int blockSize, int blockCount,
 		RsslErrorInfo *pErrorInfo);
 
+/* Initializes a pool in slab mode. At least blockCount blocks are allocated initially, and the pool grows by
+ * chunkBlockCount blocks at a time. */
+RsslRet rsslMemoryPoolInitSlab(RsslMemoryPool *pPool, int blockSize, int blockCount, int chunkBlockCount,
+		RsslUInt32 flags, RsslErrorInfo *pErrorInfo);
+
 /* Cleans up a pool. */
 RTR_C_INLINE void rsslMemoryPoolCleanup(RsslMemoryPool *pPool);
 
+/* Slab mode: Releases chunks whose blocks are all free, until no more than maxFreeBlocks blocks are free
+ * (or no more chunks can be released). Has no effect on other pools. */
+void rsslMemoryPoolTrim(RsslMemoryPool *pPool, RsslUInt32 maxFreeBlocks);
+
+/* Retrieves statistics about a pool. */
+RTR_C_INLINE void rsslMemoryPoolGetStats(RsslMemoryPool *pPool, RsslMemoryPoolStats *pStats);
+
+/* Slab mode: Adds a chunk of free blocks to the pool. */
+RsslRet _rsslMemoryPoolAddChunk(RsslMemoryPool *pPool, RsslErrorInfo *pErrorInfo);
+
+/* Slab mode: Frees all chunks. */
+void _rsslMemoryPoolFreeChunks(RsslMemoryPool *pPool);
+
 /* Retrieves a memory block from the pool. */
 RTR_C_INLINE void *rsslMemoryPoolGet(RsslMemoryPool *pPool, RsslErrorInfo *pErrorInfo);
 
@@ -50,7 +95,9 @@ RTR_C_INLINE RsslRet rsslMemoryPoolInit(RsslMemoryPool *pPool, int blockSize, in
 
 	assert(blockSize > sizeof(RsslMemoryBlock));
 
+	memset(pPool, 0, sizeof(RsslMemoryPool));
 	rsslInitQueue(&pPool->blocks);
+	rsslInitQueue(&pPool->chunks);
 	pPool->blockSize = blockSize;
 
 	for(i = 0; i < blockCount; ++i)
@@ -74,7 +121,15 @@ RTR_C_INLINE RsslRet rsslMemoryPoolInit(RsslMemoryPool *pPool, int blockSize, in
 RTR_C_INLINE void rsslMemoryPoolCleanup(RsslMemoryPool *pPool)
 {
 	RsslQueueLink *pLink;
-	while (pLink = rsslQueueRemoveFirstLink(&pPool->blocks))
+
+	if (pPool->isSlab)
+	{
+		/* Blocks are part of the chunks. */
+		_rsslMemoryPoolFreeChunks(pPool);
+		return;
+	}
+
+	while ((pLink = rsslQueueRemoveFirstLink(&pPool->blocks)))
 		free(RSSL_QUEUE_LINK_TO_OBJECT(RsslMemoryBlock, qlPool, pLink));
 }
 
@@ -82,8 +137,23 @@ RTR_C_INLINE void *rsslMemoryPoolGet(RsslMemoryPool *pPool, RsslErrorInfo *pErro
 {
 	RsslQueueLink *pLink;
 
-	if (pLink = rsslQueueRemoveFirstLink(&pPool->blocks))
+	if ((pLink = rsslQueueRemoveFirstLink(&pPool->blocks)))
+	{
+		++pPool->blocksInUse;
+		return (void*)RSSL_QUEUE_LINK_TO_OBJECT(RsslMemoryBlock, qlPool, pLink);
+	}
+
+	++pPool->missCount;
+
+	if (pPool->isSlab)
+	{
+		if (_rsslMemoryPoolAddChunk(pPool, pErrorInfo) != RSSL_RET_SUCCESS)
+			return NULL;
+
+		pLink = rsslQueueRemoveFirstLink(&pPool->blocks);
+		++pPool->blocksInUse;
 		return (void*)RSSL_QUEUE_LINK_TO_OBJECT(RsslMemoryBlock, qlPool, pLink);
+	}
 	else
 	{
 		void *pBlock = (void*)malloc(pPool->blockSize);
@@ -95,13 +165,28 @@ RTR_C_INLINE void *rsslMemoryPoolGet(RsslMemoryPool *pPool, RsslErrorInfo *pErro
 			return NULL;
 		}
 
+		++pPool->blocksInUse;
 		return pBlock;
 	}
 }
 
 RTR_C_INLINE void rsslMemoryPoolPut(RsslMemoryPool *pPool, void *pMemory)
 {
-	rsslQueueAddLinkToBack(&pPool->blocks, &((RsslMemoryBlock*)pMemory)->qlPool);
+	--pPool->blocksInUse;
+
+	/* Slab pools reuse the most recently returned block first, as it is the most likely to be cached. */
+	if (pPool->isSlab)
+		rsslQueueAddLinkToFront(&pPool->blocks, &((RsslMemoryBlock*)pMemory)->qlPool);
+	else
+		rsslQueueAddLinkToBack(&pPool->blocks, &((RsslMemoryBlock*)pMemory)->qlPool);
+}
+
+RTR_C_INLINE void rsslMemoryPoolGetStats(RsslMemoryPool *pPool, RsslMemoryPoolStats *pStats)
+{
+	pStats->blocksInUse = pPool->blocksInUse;
+	pStats->freeBlocks = rsslQueueGetElementCount(&pPool->blocks);
+	pStats->chunkCount = rsslQueueGetElementCount(&pPool->chunks);
+	pStats->missCount = pPool->missCount;
 }
 
 #ifdef __cplusplus
@@ -0,0 +1,134 @@
+/*
+ * This source code is provided under the Apache 2.0 license and is provided
+ * AS IS with no warranty or guarantee of fit for purpose.  See the project's
+ * LICENSE.md for details.
+ * Copyright Thomson Reuters 2015. All rights reserved.
+*/
+
+/* Provides notification of descriptor readiness using select(), poll() or epoll().
+ * Descriptors are registered with an RsslNotifierEvent, and after a call to rsslNotifierWait()
+ * only the events whose descriptors are ready are listed in the notifier's notifiedEvents array,
+ * so the caller does not need to check every descriptor it has registered.
+ * These functions are not thread-safe; each notifier is expected to be owned by a single thread. */
+
+#ifndef RSSL_NOTIFIER_H
+#define RSSL_NOTIFIER_H
+
+#include "rtr/os.h"
+#include "rtr/rsslTypes.h"
+#include "rtr/rsslRetCodes.h"
+#include "rtr/rsslErrorInfo.h"
+
+#ifdef WIN32
+#include <winsock2.h>
+#else
+#include <sys/time.h>
+#include <sys/types.h>
+#include <sys/select.h>
+#include <poll.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Mechanism used by the notifier to wait for descriptors. */
+typedef enum
+{
+	RSSL_NOTIFIER_SELECT	= 0,	/* Uses select(). Descriptors are limited to the size of the descriptor sets. */
+	RSSL_NOTIFIER_POLL		= 1,	/* Uses poll(). Falls back to select() on Windows. */
+	RSSL_NOTIFIER_EPOLL		= 2		/* Uses epoll(Linux only). Falls back to poll() on other platforms. */
+} RsslNotifierType;
+
+/* Conditions that can be registered with, and reported by, the notifier. */
+typedef enum
+{
+	RSSL_NOTIFIER_NONE		= 0x0,
+	RSSL_NOTIFIER_READ		= 0x1,	/* Descriptor is readable. */
+	RSSL_NOTIFIER_WRITE		= 0x2,	/* Descriptor is writable. */
+	RSSL_NOTIFIER_EXCEPT	= 0x4	/* Descriptor has an exceptional condition. */
+} RsslNotifierEventFlags;
+
+/* Represents a descriptor registered with the notifier. */
+typedef struct
+{
+	RsslSocket	fd;				/* Registered descriptor. */
+	void		*object;		/* Object associated with the descriptor. */
+	RsslUInt8	notifyFlags;	/* Conditions registered for this descriptor(see RsslNotifierEventFlags). */
+	RsslUInt8	revents;		/* Conditions found by the last call to rsslNotifierWait(see RsslNotifierEventFlags). */
+	RsslInt32	_index;			/* Position in the notifier's event list, or -1 if not registered. */
+} RsslNotifierEvent;
+
+/* Clears an RsslNotifierEvent. */
+RTR_C_INLINE void rsslClearNotifierEvent(RsslNotifierEvent *pEvent)
+{
+	pEvent->fd = (RsslSocket)-1;
+	pEvent->object = NULL;
+	pEvent->notifyFlags = RSSL_NOTIFIER_NONE;
+	pEvent->revents = RSSL_NOTIFIER_NONE;
+	pEvent->_index = -1;
+}
+
+/* Indicates whether the event is currently registered with a notifier. */
+RTR_C_INLINE RsslBool rsslNotifierEventIsRegistered(RsslNotifierEvent *pEvent)
+{
+	return (pEvent->_index >= 0) ? RSSL_TRUE : RSSL_FALSE;
+}
+
+/* Notifier structure. */
+typedef struct
+{
+	RsslNotifierType	type;
+
+	RsslNotifierEvent	**events;				/* Registered events. */
+	RsslUInt32			eventCount;
+	RsslUInt32			eventCapacity;
+
+	RsslNotifierEvent	**notifiedEvents;		/* Events found ready by the last call to rsslNotifierWait(). Entries are NULL if since removed. */
+	RsslUInt32			notifiedEventCount;
+
+	/* Used by RSSL_NOTIFIER_SELECT */
+	RsslUInt32			fdSetSize;
+	RsslUInt32			fdSetSizeInBytes;
+	fd_set				*readFds, *writeFds, *exceptFds;
+	fd_set				*useReadFds, *useWriteFds, *useExceptFds;
+
+#ifndef WIN32
+	/* Used by RSSL_NOTIFIER_POLL; kept parallel to the events array. */
+	struct pollfd		*pollFds;
+
+	/* Used by RSSL_NOTIFIER_EPOLL */
+	int					epollFd;
+	void				*epollEvents;
+#endif
+} RsslNotifier;
+
+/* Initializes a notifier. The requested type may be replaced by the nearest one available on this platform. */
+RsslRet rsslNotifierInit(RsslNotifier *pNotifier, RsslNotifierType type, RsslErrorInfo *pErrorInfo);
+
+/* Cleans up a notifier. Events that are still registered are not modified, so they should not be reused with another notifier. */
+void rsslNotifierCleanup(RsslNotifier *pNotifier);
+
+/* Registers a descriptor with the notifier. */
+RsslRet rsslNotifierAddEvent(RsslNotifier *pNotifier, RsslNotifierEvent *pEvent, RsslSocket fd, void *object,
+		RsslUInt8 notifyFlags, RsslErrorInfo *pErrorInfo);
+
+/* Changes the descriptor of a registered event(e.g. in response to an FD_CHANGE). */
+RsslRet rsslNotifierUpdateEventFd(RsslNotifier *pNotifier, RsslNotifierEvent *pEvent, RsslSocket fd, RsslErrorInfo *pErrorInfo);
+
+/* Changes the conditions registered for an event. */
+RsslRet rsslNotifierUpdateEventFlags(RsslNotifier *pNotifier, RsslNotifierEvent *pEvent, RsslUInt8 notifyFlags, RsslErrorInfo *pErrorInfo);
+
+/* Unregisters an event. Does nothing if the event is not registered. */
+void rsslNotifierRemoveEvent(RsslNotifier *pNotifier, RsslNotifierEvent *pEvent);
+
+/* Waits for registered descriptors to become ready, for up to timeoutUsec microseconds(a negative timeout waits indefinitely).
+ * Returns the number of events placed in the notifiedEvents array, or -1 on failure(the system error is left in errno, or WSAGetLastError() on Windows).
+ * An event removed after this call is replaced with NULL in the notifiedEvents array, so callers should skip NULL entries. */
+int rsslNotifierWait(RsslNotifier *pNotifier, RsslInt64 timeoutUsec);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
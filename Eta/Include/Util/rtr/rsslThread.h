@@ -42,6 +42,9 @@ typedef CRITICAL_SECTION RsslMutex;
 #define RSSL_MUTEX_LOCK(__pMutex) (EnterCriticalSection(__pMutex), 0)
 #define RSSL_MUTEX_UNLOCK(__pMutex) (LeaveCriticalSection(__pMutex), 0)
 
+/* Full memory barrier, for values shared between threads without a mutex. */
+#define RSSL_MEMORY_BARRIER() MemoryBarrier()
+
 #else
 
 #include <pthread.h>
@@ -66,6 +69,9 @@ RTR_C_INLINE int RSSL_MUTEX_INIT(RsslMutex *pMutex)
 #define RSSL_MUTEX_LOCK(__pMutex) (pthread_mutex_lock(__pMutex)) 
 #define RSSL_MUTEX_UNLOCK(__pMutex) (pthread_mutex_unlock(__pMutex)) 
 
+/* Full memory barrier, for values shared between threads without a mutex. */
+#define RSSL_MEMORY_BARRIER() __sync_synchronize()
+
 #endif
 
 #ifdef __cplusplus